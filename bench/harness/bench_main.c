@@ -0,0 +1,124 @@
+/**
+ * Host timing harness for the C-Next benchmark kernels (npm run bench:c)
+ *
+ * Linked with one transpiled kernel, which defines benchKernel(). The kernel
+ * is called in batches, doubling the batch until it runs for at least
+ * BENCH_MIN_BATCH_NS (which also warms caches and branch predictors). The
+ * fastest of BENCH_SAMPLES batches of that size is reported as:
+ *
+ *   BENCH ns_per_call=12.345 calls=1048576
+ *
+ * benchKernel() lives in a separate translation unit and works on globals,
+ * so the calls cannot be folded away at -O2.
+ *
+ * Kernels that access registers are built with BENCH_REGISTER_BASES, a
+ * comma-separated list of register block addresses. Each block is backed by
+ * an anonymous page mapped at that address, so the generated read-modify-write
+ * sequences run against ordinary memory. If the host cannot place a page
+ * there, the harness exits with BENCH_EXIT_SKIPPED.
+ */
+
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef BENCH_REGISTER_BASES
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES 15
+#endif
+
+#ifndef BENCH_MIN_BATCH_NS
+#define BENCH_MIN_BATCH_NS 20000000.0
+#endif
+
+/* Exit status for "cannot run on this host" (the automake skip convention) */
+#define BENCH_EXIT_SKIPPED 77
+
+#define BENCH_MAX_CALLS (UINT64_C(1) << 40)
+
+void benchKernel(void);
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static double timeBatch(uint64_t calls) {
+    const double start = nowNs();
+    for (uint64_t i = 0; i < calls; i++) {
+        benchKernel();
+    }
+    return nowNs() - start;
+}
+
+#ifdef BENCH_REGISTER_BASES
+static int mapRegisterBlocks(void) {
+    static const uintptr_t bases[] = {BENCH_REGISTER_BASES};
+    const size_t count = sizeof(bases) / sizeof(bases[0]);
+    const uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+
+    for (size_t i = 0; i < count; i++) {
+        const uintptr_t page = bases[i] & ~(pageSize - 1U);
+        int mapped = 0;
+        for (size_t j = 0; j < i; j++) {
+            if ((bases[j] & ~(pageSize - 1U)) == page) {
+                mapped = 1;
+            }
+        }
+        if (mapped) {
+            continue;
+        }
+
+        void* hint = (void*)page;
+        void* block = mmap(hint, (size_t)pageSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (block != hint) {
+            if (block != MAP_FAILED) {
+                munmap(block, (size_t)pageSize);
+            }
+            fprintf(stderr, "cannot map mock register block at 0x%lx\n",
+                    (unsigned long)bases[i]);
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
+int main(void) {
+#ifdef BENCH_REGISTER_BASES
+    if (!mapRegisterBlocks()) {
+        return BENCH_EXIT_SKIPPED;
+    }
+#endif
+
+    uint64_t calls = 1;
+    while (timeBatch(calls) < BENCH_MIN_BATCH_NS && calls < BENCH_MAX_CALLS) {
+        calls *= 2;
+    }
+
+    double best = timeBatch(calls);
+    for (int sample = 1; sample < BENCH_SAMPLES; sample++) {
+        const double elapsed = timeBatch(calls);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("BENCH ns_per_call=%.3f calls=%llu\n", best / (double)calls,
+           (unsigned long long)calls);
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * Unit tests for bench-baseline.mjs
+ *
+ * Locks in the contract between bench/harness/bench_main.c and bench-c.mjs:
+ *   1. the harness result line is parsed (and its absence detected),
+ *   2. register blocks a kernel declares are found for the mock mapping,
+ *   3. only results slower than the baseline by more than the tolerance
+ *      fail the run.
+ */
+
+import BenchBaseline from "../bench-baseline.mjs";
+
+describe("parseResult", () => {
+  it("extracts ns per call from the harness result line", () => {
+    const output = "BENCH ns_per_call=12.345 calls=1048576\n";
+    expect(BenchBaseline.parseResult(output)).toBe(12.345);
+  });
+
+  it("returns null when the harness printed no result", () => {
+    expect(BenchBaseline.parseResult("Segmentation fault\n")).toBeNull();
+  });
+});
+
+describe("registerBases", () => {
+  it("collects each register block address once", () => {
+    const source = `
+register MOTOR @ 0x40001000 {
+    CTRL: u8 rw @ 0x00,
+}
+register GPIO @ 0x40002000 {
+    DR: u32 rw @ 0x00,
+}
+register GPIO_ALIAS @ 0x40002000 {
+    DR: u32 rw @ 0x00,
+}`;
+    expect(BenchBaseline.registerBases(source)).toEqual([
+      "0x40001000",
+      "0x40002000",
+    ]);
+  });
+
+  it("returns an empty array for kernels without registers", () => {
+    expect(BenchBaseline.registerBases("u32 count <- 0;")).toEqual([]);
+  });
+});
+
+describe("compare", () => {
+  it("classifies results against the baseline with the tolerance", () => {
+    const results = {
+      "clamp-arith@O0": 10.1,
+      "clamp-arith@O2": 14,
+      "string-ops@O2": 5,
+      "switch-dispatch@O2": 3,
+    };
+    const baseline = {
+      "clamp-arith@O0": 10,
+      "clamp-arith@O2": 10,
+      "string-ops@O2": 10,
+    };
+    const verdicts = BenchBaseline.compare(results, baseline, 0.25).map(
+      (comparison) => [comparison.key, comparison.verdict],
+    );
+    expect(verdicts).toEqual([
+      ["clamp-arith@O0", "same"],
+      ["clamp-arith@O2", "slower"],
+      ["string-ops@O2", "faster"],
+      ["switch-dispatch@O2", "new"],
+    ]);
+  });
+
+  it("fails only on slower results", () => {
+    const comparisons = BenchBaseline.compare(
+      { "a@O2": 20, "b@O2": 1, "c@O2": 5 },
+      { "a@O2": 10, "b@O2": 10 },
+    );
+    expect(
+      BenchBaseline.findRegressions(comparisons).map((c) => c.key),
+    ).toEqual(["a@O2"]);
+  });
+});
+
+describe("toBaseline", () => {
+  it("sorts keys and rounds to picoseconds", () => {
+    const baseline = BenchBaseline.toBaseline("gcc (GCC) 13.2.0", {
+      "switch-dispatch@O2": 3.14159,
+      "array-copy@O0": 120.5,
+    });
+    expect(baseline).toEqual({
+      compiler: "gcc (GCC) 13.2.0",
+      results: { "array-copy@O0": 120.5, "switch-dispatch@O2": 3.142 },
+    });
+    expect(Object.keys(baseline.results)).toEqual([
+      "array-copy@O0",
+      "switch-dispatch@O2",
+    ]);
+  });
+});
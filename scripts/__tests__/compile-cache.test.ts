@@ -0,0 +1,83 @@
+/**
+ * Unit tests for compile-cache.ts
+ *
+ * The cache may only return a result when nothing that reaches the compiler
+ * changed: source files, (transitively) included headers and flags.
+ */
+
+import { mkdtempSync, writeFileSync, mkdirSync, rmSync } from "node:fs";
+import { join } from "node:path";
+import { tmpdir } from "node:os";
+import CompileCache from "../compile-cache";
+
+describe("CompileCache", () => {
+  let rootDir: string;
+  let includeDir: string;
+  let source: string;
+  let cache: CompileCache;
+
+  const input = (flags: string[] = ["-std=c99"]) => ({
+    compiler: "gcc",
+    flags,
+    sourceFiles: [source],
+    includeDirs: [includeDir],
+    execute: false,
+  });
+
+  beforeEach(() => {
+    rootDir = mkdtempSync(join(tmpdir(), "compile-cache-"));
+    includeDir = join(rootDir, "include");
+    mkdirSync(includeDir);
+    source = join(rootDir, "test.c");
+    writeFileSync(
+      source,
+      '#include <stdint.h>\n#include "local.h"\n#include <shared.h>\n',
+    );
+    writeFileSync(join(rootDir, "local.h"), '#include "nested.h"\n');
+    writeFileSync(join(includeDir, "nested.h"), "#define NESTED 1\n");
+    writeFileSync(join(includeDir, "shared.h"), "#define SHARED 1\n");
+    cache = new CompileCache(rootDir);
+  });
+
+  afterEach(() => {
+    rmSync(rootDir, { recursive: true, force: true });
+  });
+
+  it("resolves includes recursively, keeping unresolved names", () => {
+    expect(CompileCache.collectHeaders([source], [includeDir])).toEqual([
+      "<stdint.h>",
+      join(rootDir, "local.h"),
+      join(includeDir, "shared.h"),
+      join(includeDir, "nested.h"),
+    ]);
+  });
+
+  it("keeps the key while inputs are unchanged", () => {
+    expect(cache.key(input())).toBe(cache.key(input()));
+  });
+
+  it("changes the key when a nested header changes", () => {
+    const before = cache.key(input());
+    writeFileSync(join(includeDir, "nested.h"), "#define NESTED 2\n");
+    expect(cache.key(input())).not.toBe(before);
+  });
+
+  it("changes the key when the flags change", () => {
+    expect(cache.key(input(["-std=c99", "-Werror"]))).not.toBe(
+      cache.key(input()),
+    );
+  });
+
+  it("stores and returns entries", () => {
+    const key = cache.key(input());
+    expect(cache.get(key)).toBeNull();
+
+    cache.set(key, { status: 0, diagnostics: "", exitCode: 3, stdout: "x\n" });
+    expect(cache.get(key)).toEqual({
+      status: 0,
+      diagnostics: "",
+      exitCode: 3,
+      stdout: "x\n",
+    });
+  });
+});
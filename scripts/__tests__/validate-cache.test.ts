@@ -0,0 +1,95 @@
+/**
+ * Unit tests for validate-cache.mjs
+ *
+ * Locks in what lets batch-validate.mjs reuse a tool result:
+ *   1. a file's hash covers the headers it includes, transitively,
+ *   2. keys depend on tool version, arguments and input hashes,
+ *   3. --changed-only selects files that changed or never passed,
+ *   4. saving drops unused entries only for the tools that ran.
+ */
+
+import { mkdtempSync, writeFileSync, rmSync, readFileSync } from "node:fs";
+import { join } from "node:path";
+import { tmpdir } from "node:os";
+import ValidateCache from "../validate-cache.mjs";
+
+describe("ValidateCache", () => {
+  let rootDir: string;
+  let cachePath: string;
+  let source: string;
+
+  beforeEach(() => {
+    rootDir = mkdtempSync(join(tmpdir(), "validate-cache-"));
+    cachePath = join(rootDir, ".cnx", "validate-cache.json");
+    source = join(rootDir, "a.test.c");
+    writeFileSync(source, '#include "a.test.h"\n#include <stdint.h>\n');
+    writeFileSync(join(rootDir, "a.test.h"), '#include "types.h"\n');
+    writeFileSync(join(rootDir, "types.h"), "typedef int t;\n");
+  });
+
+  afterEach(() => {
+    rmSync(rootDir, { recursive: true, force: true });
+  });
+
+  it("changes a file's hash when a nested header changes", () => {
+    const before = new ValidateCache(cachePath, rootDir).hashFile(source, []);
+    writeFileSync(join(rootDir, "types.h"), "typedef long t;\n");
+    const after = new ValidateCache(cachePath, rootDir).hashFile(source, []);
+    expect(after).not.toBe(before);
+  });
+
+  it("keys on tool version and arguments", () => {
+    const cache = new ValidateCache(cachePath, rootDir);
+    const key = cache.key("MISRA", "Cppcheck 2.13", [source], ["h1"]);
+    expect(cache.key("MISRA", "Cppcheck 2.13", [source], ["h1"])).toBe(key);
+    expect(cache.key("MISRA", "Cppcheck 2.14", [source], ["h1"])).not.toBe(
+      key,
+    );
+    expect(cache.key("MISRA", "Cppcheck 2.13", [source], ["h2"])).not.toBe(
+      key,
+    );
+  });
+
+  it("selects files that changed or did not pass last time", () => {
+    const other = join(rootDir, "b.test.c");
+    const hashes = new Map([
+      [source, "h1"],
+      [other, "h2"],
+    ]);
+    const cache = new ValidateCache(cachePath, rootDir);
+    cache.recordPassed("misra", source, "h1");
+    cache.recordPassed("misra", other, "old");
+    cache.save(["misra"]);
+
+    const reloaded = new ValidateCache(cachePath, rootDir);
+    expect(reloaded.changedFiles("misra", [source, other], hashes)).toEqual([
+      other,
+    ]);
+    expect(
+      reloaded.changedFiles("clang-tidy", [source, other], hashes),
+    ).toEqual([source, other]);
+
+    reloaded.recordFailed("misra", source);
+    expect(reloaded.changedFiles("misra", [source], hashes)).toEqual([source]);
+  });
+
+  it("drops unused entries of the tools that ran", () => {
+    const cache = new ValidateCache(cachePath, rootDir);
+    cache.set("used", { tool: "misra", status: 0, stdout: "", stderr: "" });
+    cache.set("stale", { tool: "misra", status: 1, stdout: "", stderr: "" });
+    cache.set("other", {
+      tool: "flawfinder",
+      status: 0,
+      stdout: "",
+      stderr: "",
+    });
+    cache.save(["misra"]);
+
+    const reloaded = new ValidateCache(cachePath, rootDir);
+    reloaded.get("used");
+    reloaded.save(["misra"]);
+
+    const stored = JSON.parse(readFileSync(cachePath, "utf-8"));
+    expect(Object.keys(stored.entries).sort()).toEqual(["other", "used"]);
+  });
+});
@@ -7,25 +7,42 @@
  * previously ran during integration tests, amortizing tool startup
  * costs and ensuring local + CI behavior are identical.
  *
+ * Tool runs execute in parallel (one per core by default) and are reported
+ * afterwards in a fixed order: cppcheck, clang-tidy, MISRA, flawfinder, files
+ * sorted by path. Results are cached in .cnx/validate-cache.json by tool
+ * version, arguments and content hash of the inputs (validate-cache.mjs), so
+ * unchanged outputs are not analyzed again.
+ *
  * Usage:
- *   npm run validate:c              # Run all available checks
- *   node scripts/batch-validate.mjs # Same thing
+ *   npm run validate:c                      # Run all available checks
+ *   node scripts/batch-validate.mjs         # Same thing
+ *   npm run validate:c -- --tool misra      # Run a single tool
+ *   npm run validate:c -- --jobs 4          # Run at most 4 tools at once
+ *   npm run validate:c -- --changed-only    # Only files changed since they last passed
+ *   npm run validate:c -- --no-cache        # Re-run every tool (full run)
+ *
+ * --changed-only also narrows the batch tools (cppcheck, flawfinder) to the
+ * changed files, so cross-file findings against unchanged files (cppcheck's
+ * ODR checks) only surface in a full run.
  *
- * Security: All external tool invocations use execFileSync (not exec)
- * to prevent shell injection. File paths come from filesystem traversal,
- * not user input.
+ * Security: All external tool invocations use execFile/execFileSync (not
+ * exec) to prevent shell injection. File paths come from filesystem
+ * traversal, not user input.
  */
 
-import { execFileSync } from "node:child_process";
+import { execFile, execFileSync } from "node:child_process";
 import { existsSync, readFileSync, readdirSync } from "node:fs";
+import { cpus } from "node:os";
 import { join, dirname } from "node:path";
 import { fileURLToPath } from "node:url";
 import MisraBaseline from "./misra-baseline.mjs";
+import ValidateCache from "./validate-cache.mjs";
 
 const __dirname = dirname(fileURLToPath(import.meta.url));
 const ROOT = join(__dirname, "..");
 const TESTS_DIR = join(ROOT, "tests");
 const INCLUDE_DIR = join(ROOT, "tests/include");
+const CACHE_PATH = join(ROOT, ".cnx", "validate-cache.json");
 
 // ============================================================================
 // CLI argument parsing
@@ -36,6 +53,9 @@ const VALID_TOOLS = ["cppcheck", "clang-tidy", "misra", "flawfinder", "all"];
 function parseArgs() {
   const args = process.argv.slice(2);
   let tool = "all";
+  let jobs = cpus().length;
+  let changedOnly = false;
+  let useCache = true;
 
   for (let i = 0; i < args.length; i++) {
     if (args[i] === "--tool" && args[i + 1]) {
@@ -45,34 +65,56 @@ function parseArgs() {
         console.error(`Valid options: ${VALID_TOOLS.join(", ")}`);
         process.exit(1);
       }
+    } else if ((args[i] === "--jobs" || args[i] === "-j") && args[i + 1]) {
+      jobs = Number.parseInt(args[i + 1], 10);
+      if (!(jobs > 0)) {
+        console.error(`Invalid job count: ${args[i + 1]}`);
+        process.exit(1);
+      }
+    } else if (args[i] === "--changed-only") {
+      changedOnly = true;
+    } else if (args[i] === "--no-cache") {
+      useCache = false;
     }
   }
 
-  return { tool };
+  return { tool, jobs, changedOnly, useCache };
 }
 
-const { tool: selectedTool } = parseArgs();
+const {
+  tool: selectedTool,
+  jobs: maxJobs,
+  changedOnly,
+  useCache,
+} = parseArgs();
 
 // ============================================================================
 // Tool detection
 // ============================================================================
 
-function toolAvailable(cmd) {
+// First line of `<cmd> --version`, or null when the tool is not installed.
+// The version is part of every cache key.
+function toolVersion(cmd) {
   try {
-    execFileSync(cmd, ["--version"], {
+    const output = execFileSync(cmd, ["--version"], {
       encoding: "utf-8",
       stdio: "pipe",
       timeout: 5000,
     });
-    return true;
+    return output.split("\n")[0].trim();
   } catch {
-    return false;
+    return null;
   }
 }
 
-const hasCppcheck = toolAvailable("cppcheck");
-const hasClangTidy = toolAvailable("clang-tidy");
-const hasFlawfinder = toolAvailable("flawfinder");
+const versions = {
+  cppcheck: toolVersion("cppcheck"),
+  "clang-tidy": toolVersion("clang-tidy"),
+  flawfinder: toolVersion("flawfinder"),
+};
+const hasCppcheck = versions.cppcheck !== null;
+const hasClangTidy = versions["clang-tidy"] !== null;
+const hasFlawfinder = versions.flawfinder !== null;
 
 // ============================================================================
 // File discovery
@@ -91,8 +133,9 @@ function findFilesRecursively(dir, pattern) {
   return results;
 }
 
-const cFiles = findFilesRecursively(TESTS_DIR, /\.test\.c$/);
-const cppFiles = findFilesRecursively(TESTS_DIR, /\.test\.cpp$/);
+// Sorted so jobs, reports and cache keys of batch runs are deterministic
+const cFiles = findFilesRecursively(TESTS_DIR, /\.test\.c$/).sort();
+const cppFiles = findFilesRecursively(TESTS_DIR, /\.test\.cpp$/).sort();
 
 console.log(`Found ${cFiles.length} C files and ${cppFiles.length} C++ files`);
 
@@ -156,9 +199,91 @@ function requiresCpp(cFile) {
 }
 
 // ============================================================================
-// Validation runners
+// Tool runs: cached, parallel, reported in order
 // ============================================================================
 
+const cache = new ValidateCache(CACHE_PATH, ROOT);
+const fileHashes = new Map(
+  [...cFiles, ...cppFiles].map((file) => [
+    file,
+    cache.hashFile(file, [INCLUDE_DIR]),
+  ]),
+);
+
+// Inputs of a tool: all files, or with --changed-only those whose content
+// (including headers) changed since they last passed it
+function selectFiles(tool, files) {
+  return changedOnly ? cache.changedFiles(tool, files, fileHashes) : files;
+}
+
+// Each job is one tool invocation:
+//   tool     - selection name (--tool), for --changed-only bookkeeping
+//   label    - name in FAIL lines
+//   target   - file or batch description in FAIL lines
+//   cmd/args - what to run; files are its inputs (part of the cache key)
+//   evaluate - raw { status, stdout, stderr } -> failure message, or null
+// Evaluation runs on cached results too, so policy changes (e.g. the MISRA
+// baseline) apply without re-running the tool.
+const jobs = [];
+let cacheHits = 0;
+
+// Run a tool without blocking the other jobs. status is null when the tool
+// was killed (timeout) or could not start; those results are not cached.
+function runTool(cmd, args, timeout) {
+  return new Promise((resolve) => {
+    execFile(
+      cmd,
+      args,
+      { encoding: "utf-8", timeout, maxBuffer: 64 * 1024 * 1024 },
+      (error, stdout, stderr) => {
+        let status = 0;
+        if (error) {
+          status = typeof error.code === "number" ? error.code : null;
+        }
+        resolve({
+          status,
+          stdout: stdout || "",
+          stderr: stderr || (status === null ? error.message : ""),
+        });
+      },
+    );
+  });
+}
+
+async function runJob(job) {
+  const key = cache.key(
+    job.label,
+    versions[job.cmd],
+    job.args,
+    job.files.map((file) => fileHashes.get(file)),
+  );
+  const cached = useCache ? cache.get(key) : null;
+  if (cached !== null) {
+    cacheHits++;
+    return cached;
+  }
+  const result = await runTool(job.cmd, job.args, job.timeout);
+  if (result.status !== null) {
+    cache.set(key, { tool: job.tool, ...result });
+  }
+  return result;
+}
+
+// Run all jobs, at most `limit` at a time; results keep the job order
+async function runJobs(limit) {
+  const results = new Array(jobs.length);
+  let next = 0;
+  const worker = async () => {
+    while (next < jobs.length) {
+      const index = next++;
+      results[index] = await runJob(jobs[index]);
+    }
+  };
+  const workerCount = Math.min(limit, jobs.length);
+  await Promise.all(Array.from({ length: workerCount }, worker));
+  return results;
+}
+
 let failures = 0;
 
 function reportFailure(tool, file, message) {
@@ -172,8 +297,12 @@ function reportFailure(tool, file, message) {
   failures++;
 }
 
+// ============================================================================
+// Validation jobs
+// ============================================================================
+
 // --- cppcheck (batch mode) ---
-function runCppcheck() {
+function addCppcheckJobs() {
   if (!hasCppcheck) {
     console.log("⊘ cppcheck not available, skipping");
     return;
@@ -196,31 +325,37 @@ function runCppcheck() {
     "--suppress=floatConversionOverflow",
     "--quiet",
   ];
+  const evaluate = (result) =>
+    result.status === 0 ? null : result.stderr || result.stdout;
 
   // Batch C files (excluding those that need C++ mode)
   // Also exclude error test files (*-error.test.c) which intentionally contain
   // invalid code to test transpiler error detection (e.g., shift beyond width)
-  const pureCFiles = cFiles.filter(
-    (f) => !requiresCpp(f) && !f.endsWith("-error.test.c"),
+  const pureCFiles = selectFiles(
+    "cppcheck",
+    cFiles.filter((f) => !requiresCpp(f) && !f.endsWith("-error.test.c")),
   );
   const cppDetectedFiles = cFiles.filter((f) => requiresCpp(f));
 
   if (pureCFiles.length > 0) {
     console.log(`Running cppcheck on ${pureCFiles.length} C files...`);
-    try {
-      execFileSync("cppcheck", [...baseArgs, ...pureCFiles], {
-        encoding: "utf-8",
-        timeout: 300000,
-        stdio: "pipe",
-      });
-    } catch (error) {
-      const output = error.stderr || error.stdout || error.message;
-      reportFailure("cppcheck", `${pureCFiles.length} C files`, output);
-    }
+    jobs.push({
+      tool: "cppcheck",
+      label: "cppcheck",
+      target: `${pureCFiles.length} C files`,
+      cmd: "cppcheck",
+      args: [...baseArgs, ...pureCFiles],
+      files: pureCFiles,
+      timeout: 300000,
+      evaluate,
+    });
   }
 
   // C files needing C++ mode + actual C++ files
-  const allCppFiles = [...cppDetectedFiles, ...cppFiles];
+  const allCppFiles = selectFiles("cppcheck", [
+    ...cppDetectedFiles,
+    ...cppFiles,
+  ]);
   if (allCppFiles.length > 0) {
     console.log(
       `Running cppcheck (C++ mode) on ${allCppFiles.length} files...`,
@@ -235,62 +370,66 @@ function runCppcheck() {
       "--language=c++",
       "--std=c++14",
     ];
-    try {
-      execFileSync("cppcheck", [...cppArgs, ...allCppFiles], {
-        encoding: "utf-8",
-        timeout: 300000,
-        stdio: "pipe",
-      });
-    } catch (error) {
-      const output = error.stderr || error.stdout || error.message;
-      reportFailure("cppcheck-cpp", `${allCppFiles.length} C++ files`, output);
-    }
+    jobs.push({
+      tool: "cppcheck",
+      label: "cppcheck-cpp",
+      target: `${allCppFiles.length} C++ files`,
+      cmd: "cppcheck",
+      args: [...cppArgs, ...allCppFiles],
+      files: allCppFiles,
+      timeout: 300000,
+      evaluate,
+    });
   }
 }
 
 // --- clang-tidy (per-file, no batch mode) ---
 // Enhancement over original: adds -I flags for include resolution, reducing
 // false positives from missing headers (original validateClangTidy lacked these).
-function runClangTidy() {
+function addClangTidyJobs() {
   if (!hasClangTidy) {
     console.log("⊘ clang-tidy not available, skipping");
     return;
   }
 
-  const allFiles = [...cFiles, ...cppFiles];
+  const allFiles = selectFiles("clang-tidy", [...cFiles, ...cppFiles]);
   console.log(`Running clang-tidy on ${allFiles.length} files...`);
 
   for (const file of allFiles) {
     const useCpp = cppFiles.includes(file) || requiresCpp(file);
     const stdFlag = useCpp ? "-std=c++14" : "-std=c99";
 
-    try {
-      execFileSync(
-        "clang-tidy",
-        [
-          file,
-          "--",
-          stdFlag,
-          "-Wno-unused-variable",
-          "-I",
-          INCLUDE_DIR,
-          "-I",
-          dirname(file),
-        ],
-        { encoding: "utf-8", timeout: 30000, stdio: "pipe" },
-      );
-    } catch (error) {
-      const output = error.stderr || error.stdout || error.message;
-      const issues = output
-        .split("\n")
-        .filter((line) => line.includes("error:"))
-        .slice(0, 5)
-        .join("\n");
-      // clang-tidy returns non-zero even for warnings; only fail on errors
-      if (issues.includes("error:")) {
-        reportFailure("clang-tidy", file, issues);
-      }
-    }
+    jobs.push({
+      tool: "clang-tidy",
+      label: "clang-tidy",
+      target: file,
+      cmd: "clang-tidy",
+      args: [
+        file,
+        "--",
+        stdFlag,
+        "-Wno-unused-variable",
+        "-I",
+        INCLUDE_DIR,
+        "-I",
+        dirname(file),
+      ],
+      files: [file],
+      timeout: 30000,
+      evaluate: (result) => {
+        if (result.status === 0) {
+          return null;
+        }
+        const output = result.stderr || result.stdout;
+        const issues = output
+          .split("\n")
+          .filter((line) => line.includes("error:"))
+          .slice(0, 5)
+          .join("\n");
+        // clang-tidy returns non-zero even for warnings; only fail on errors
+        return issues.includes("error:") ? issues : null;
+      },
+    });
   }
 }
 
@@ -302,7 +441,7 @@ const MISRA_EXCLUDED_FILES = [
   "uri-exception.test.c",
 ];
 
-function runMisra() {
+function addMisraJobs() {
   if (!hasCppcheck) {
     console.log("⊘ cppcheck not available (needed for MISRA addon), skipping");
     return;
@@ -312,11 +451,14 @@ function runMisra() {
   // Also exclude files testing valid MISRA exceptions
   // Also exclude error test files (*-error.test.c) which intentionally contain
   // invalid code to test transpiler error detection (e.g., shift beyond width)
-  const misraFiles = cFiles.filter(
-    (f) =>
-      !requiresCpp(f) &&
-      !f.endsWith("-error.test.c") &&
-      !MISRA_EXCLUDED_FILES.some((exc) => f.endsWith(exc)),
+  const misraFiles = selectFiles(
+    "misra",
+    cFiles.filter(
+      (f) =>
+        !requiresCpp(f) &&
+        !f.endsWith("-error.test.c") &&
+        !MISRA_EXCLUDED_FILES.some((exc) => f.endsWith(exc)),
+    ),
   );
   console.log(`Running MISRA on ${misraFiles.length} C files...`);
 
@@ -324,71 +466,78 @@ function runMisra() {
   //   - buildArgs() enables `--enable=style` so the addon actually reports (#1057)
   //   - findFailures() fails only on un-baselined rules in C-Next-generated code
   // cppcheck exits 1 on ANY enabled finding (including non-MISRA style noise),
-  // so every match throws; we parse the captured output and decide ourselves.
+  // so the raw output is cached and the baseline applied here on every run.
   for (const file of misraFiles) {
-    let output;
-    try {
-      execFileSync("cppcheck", MisraBaseline.buildArgs(file, INCLUDE_DIR), {
-        encoding: "utf-8",
-        timeout: 60000,
-        stdio: "pipe",
-      });
-      continue; // exit 0 → no findings at all
-    } catch (error) {
-      // Exit 1 is the expected "findings present" signal; any other status
-      // means cppcheck itself failed to run, which must not pass silently.
-      if (error.status !== 1) {
-        reportFailure(
-          "MISRA",
-          file,
-          error.stderr || error.stdout || error.message,
+    jobs.push({
+      tool: "misra",
+      label: "MISRA",
+      target: file,
+      cmd: "cppcheck",
+      args: MisraBaseline.buildArgs(file, INCLUDE_DIR),
+      files: [file],
+      timeout: 60000,
+      evaluate: (result) => {
+        if (result.status === 0) {
+          return null; // no findings at all
+        }
+        // Exit 1 is the expected "findings present" signal; any other status
+        // means cppcheck itself failed to run, which must not pass silently.
+        if (result.status !== 1) {
+          return result.stderr || result.stdout;
+        }
+        const failures = MisraBaseline.findFailures(
+          MisraBaseline.parseViolations(`${result.stdout}\n${result.stderr}`),
         );
-        continue;
-      }
-      output = `${error.stdout || ""}\n${error.stderr || ""}`;
-    }
-
-    const failures = MisraBaseline.findFailures(
-      MisraBaseline.parseViolations(output),
-    );
-    if (failures.length > 0) {
-      reportFailure(
-        "MISRA",
-        file,
-        failures
-          .slice(0, 5)
-          .map((violation) => violation.raw)
-          .join("\n"),
-      );
-    }
+        return failures.length > 0
+          ? failures
+              .slice(0, 5)
+              .map((violation) => violation.raw)
+              .join("\n")
+          : null;
+      },
+    });
   }
 }
 
 // --- flawfinder (batch mode) ---
-function runFlawfinder() {
+function addFlawfinderJobs() {
   if (!hasFlawfinder) {
     console.log("⊘ flawfinder not available, skipping");
     return;
   }
 
-  const allFiles = [...cFiles, ...cppFiles];
+  const allFiles = selectFiles("flawfinder", [...cFiles, ...cppFiles]);
   console.log(`Running flawfinder on ${allFiles.length} files...`);
-
-  try {
-    execFileSync(
-      "flawfinder",
-      ["--minlevel=3", "--error-level=3", "--dataonly", "--quiet", ...allFiles],
-      { encoding: "utf-8", timeout: 120000, stdio: "pipe" },
-    );
-  } catch (error) {
-    const output = error.stdout || error.stderr || error.message;
-    const issues = output
-      .split("\n")
-      .filter((line) => line.includes("CWE") || line.trim().length > 0)
-      .slice(0, 10)
-      .join("\n");
-    reportFailure("flawfinder", `${allFiles.length} files`, issues);
+  if (allFiles.length === 0) {
+    return;
   }
+
+  jobs.push({
+    tool: "flawfinder",
+    label: "flawfinder",
+    target: `${allFiles.length} files`,
+    cmd: "flawfinder",
+    args: [
+      "--minlevel=3",
+      "--error-level=3",
+      "--dataonly",
+      "--quiet",
+      ...allFiles,
+    ],
+    files: allFiles,
+    timeout: 120000,
+    evaluate: (result) => {
+      if (result.status === 0) {
+        return null;
+      }
+      const output = result.stdout || result.stderr;
+      return output
+        .split("\n")
+        .filter((line) => line.includes("CWE") || line.trim().length > 0)
+        .slice(0, 10)
+        .join("\n");
+    },
+  });
 }
 
 // ============================================================================
@@ -427,14 +576,37 @@ if (selectedTool === "all") {
 } else {
   console.log(`Tool: ${selectedTool}`);
 }
+if (changedOnly) {
+  console.log("Files: changed since they last passed");
+}
 console.log();
 
-if (shouldRun("cppcheck")) runCppcheck();
-if (shouldRun("clang-tidy")) runClangTidy();
-if (shouldRun("misra")) runMisra();
-if (shouldRun("flawfinder")) runFlawfinder();
+if (shouldRun("cppcheck")) addCppcheckJobs();
+if (shouldRun("clang-tidy")) addClangTidyJobs();
+if (shouldRun("misra")) addMisraJobs();
+if (shouldRun("flawfinder")) addFlawfinderJobs();
+
+const results = await runJobs(maxJobs);
+
+jobs.forEach((job, index) => {
+  const message = job.evaluate(results[index]);
+  for (const file of job.files) {
+    if (message === null) {
+      cache.recordPassed(job.tool, file, fileHashes.get(file));
+    } else {
+      cache.recordFailed(job.tool, file);
+    }
+  }
+  if (message !== null) {
+    reportFailure(job.label, job.target, message);
+  }
+});
+
+// A --changed-only run leaves the entries of unselected files in place
+cache.save(changedOnly ? [] : availableTools.filter(shouldRun));
 
 console.log();
+console.log(`${cacheHits} of ${jobs.length} tool runs reused from cache`);
 if (failures > 0) {
   console.error(`${failures} validation failure(s)`);
   process.exit(1);
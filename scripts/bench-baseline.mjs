@@ -0,0 +1,102 @@
+/**
+ * Result parsing + baseline comparison for bench-c.mjs.
+ *
+ * Each benchmark kernel (bench/kernels/*.cnx) is transpiled, linked with
+ * bench/harness/bench_main.c and run once per optimization level. The
+ * harness prints a single result line:
+ *
+ *   BENCH ns_per_call=12.345 calls=1048576
+ *
+ * Baselines live in bench/baselines/<compiler>.json, one file per host
+ * compiler because gcc and clang timings are not comparable. They are meant
+ * to be recorded and compared on the same machine: the check catches a
+ * codegen change making a kernel slower, not absolute numbers on CI runners.
+ *
+ * This module owns the parsing and the regression decision so the runner
+ * and its unit tests share one source of truth:
+ *   - parseResult()     — ns per call from harness output (null if missing).
+ *   - registerBases()   — register block addresses a kernel needs mapped.
+ *   - key()             — baseline key for a kernel at an optimization level.
+ *   - compare()         — per-key verdict against a baseline.
+ *   - findRegressions() — comparisons that should fail the run.
+ *   - toBaseline()      — baseline file contents for a run.
+ */
+
+// Matches the harness result line and captures ns per call
+const BENCH_LINE = /^BENCH ns_per_call=(\d+(?:\.\d+)?) calls=\d+$/m;
+
+// Matches a register block declaration and captures its base address:
+//   register GPIO @ 0x40002000 {
+const REGISTER_DECL = /^\s*register\s+\w+\s*@\s*(0x[0-9a-fA-F]+|\d+)\s*\{/gm;
+
+// Timing noise between two runs on an idle machine stays well inside this;
+// a codegen change has to cost more than a quarter to count as a regression.
+const DEFAULT_TOLERANCE = 0.25;
+
+class BenchBaseline {
+  static DEFAULT_TOLERANCE = DEFAULT_TOLERANCE;
+
+  /** ns per kernel call from harness stdout, null if the line is missing. */
+  static parseResult(output) {
+    const match = BENCH_LINE.exec(output);
+    return match === null ? null : Number(match[1]);
+  }
+
+  /** Unique register block base addresses declared in a kernel's source. */
+  static registerBases(source) {
+    const bases = new Set();
+    for (const match of source.matchAll(REGISTER_DECL)) {
+      bases.add(match[1]);
+    }
+    return [...bases];
+  }
+
+  /** Baseline key, e.g. "clamp-arith@O2". */
+  static key(kernel, level) {
+    return `${kernel}@${level}`;
+  }
+
+  /**
+   * Compare measured ns per call against a baseline's results. A result is
+   * "slower"/"faster" when it differs from its baseline by more than
+   * tolerance (a fraction), "new" when the baseline has no entry for it.
+   */
+  static compare(results, baselineResults, tolerance = DEFAULT_TOLERANCE) {
+    return Object.entries(results).map(([key, nsPerCall]) => {
+      const baselineNs = baselineResults[key];
+      if (baselineNs === undefined) {
+        return {
+          key,
+          nsPerCall,
+          baselineNs: null,
+          ratio: null,
+          verdict: "new",
+        };
+      }
+      const ratio = nsPerCall / baselineNs;
+      let verdict = "same";
+      if (ratio > 1 + tolerance) {
+        verdict = "slower";
+      } else if (ratio < 1 - tolerance) {
+        verdict = "faster";
+      }
+      return { key, nsPerCall, baselineNs, ratio, verdict };
+    });
+  }
+
+  /** Comparisons that should fail the run. */
+  static findRegressions(comparisons) {
+    return comparisons.filter((comparison) => comparison.verdict === "slower");
+  }
+
+  /** Baseline file contents: compiler identification + sorted results. */
+  static toBaseline(compiler, results) {
+    const sorted = {};
+    for (const key of Object.keys(results).sort()) {
+      sorted[key] = Math.round(results[key] * 1000) / 1000;
+    }
+    return { compiler, results: sorted };
+  }
+}
+
+export default BenchBaseline;
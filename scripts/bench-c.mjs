@@ -0,0 +1,343 @@
+#!/usr/bin/env node
+/**
+ * Host Runtime Benchmarks for Generated C
+ *
+ * Transpiles each kernel in bench/kernels/, links it with the timing harness
+ * (bench/harness/bench_main.c) using the host C compiler at -O0, -Og and
+ * -O2, runs it and compares ns per call with the compiler's baseline in
+ * bench/baselines/. Codegen changes to the overflow helpers, string
+ * declarations, register access and friends get a performance check next to
+ * the .expected.c snapshot check.
+ *
+ * Usage:
+ *   npm run bench:c                         # Run and compare with baseline
+ *   npm run bench:c -- --update-baseline    # Record a new baseline
+ *   npm run bench:c -- --kernel string-ops  # Run a single kernel
+ *   npm run bench:c -- --cc clang           # Use another host compiler
+ *   npm run bench:c -- --tolerance 0.1      # Fail on >10% slowdowns
+ *   npm run bench:c -- -- --strength-reduce # Pass options to the transpiler
+ *
+ * Kernels compile with -I tests/include, so atomics use the host stubs in
+ * cmsis_gcc.h, and registers are backed by memory the harness maps at each
+ * register block address. Baselines are machine-specific: record one before
+ * a change and compare after it on the same host.
+ *
+ * Security: All external tool invocations use execFileSync/spawnSync (not
+ * exec) to prevent shell injection.
+ */
+
+import { execFileSync, spawnSync } from "node:child_process";
+import {
+  existsSync,
+  mkdirSync,
+  mkdtempSync,
+  readFileSync,
+  readdirSync,
+  rmSync,
+  writeFileSync,
+} from "node:fs";
+import { tmpdir } from "node:os";
+import { basename, dirname, join } from "node:path";
+import { fileURLToPath } from "node:url";
+import BenchBaseline from "./bench-baseline.mjs";
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const ROOT = join(__dirname, "..");
+const KERNELS_DIR = join(ROOT, "bench/kernels");
+const HARNESS = join(ROOT, "bench/harness/bench_main.c");
+const BASELINES_DIR = join(ROOT, "bench/baselines");
+const INCLUDE_DIR = join(ROOT, "tests/include");
+const DIST_ENTRY = join(ROOT, "dist", "index.js");
+
+const OPT_LEVELS = ["O0", "Og", "O2"];
+
+// Exit status of the harness when a kernel cannot run on this host
+const EXIT_SKIPPED = 77;
+
+// ============================================================================
+// CLI argument parsing
+// ============================================================================
+
+function parseArgs() {
+  const args = process.argv.slice(2);
+  const options = {
+    cc: process.env.CC || null,
+    kernel: null,
+    tolerance: BenchBaseline.DEFAULT_TOLERANCE,
+    updateBaseline: false,
+    transpilerArgs: [],
+  };
+
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === "--") {
+      options.transpilerArgs = args.slice(i + 1);
+      break;
+    } else if (args[i] === "--update-baseline") {
+      options.updateBaseline = true;
+    } else if (args[i] === "--cc" && args[i + 1]) {
+      options.cc = args[++i];
+    } else if (args[i] === "--kernel" && args[i + 1]) {
+      options.kernel = args[++i];
+    } else if (args[i] === "--tolerance" && args[i + 1]) {
+      options.tolerance = Number(args[++i]);
+      if (!(options.tolerance > 0)) {
+        console.error(`Invalid tolerance: ${args[i]}`);
+        process.exit(1);
+      }
+    } else {
+      console.error(`Unknown option: ${args[i]}`);
+      process.exit(1);
+    }
+  }
+
+  return options;
+}
+
+const options = parseArgs();
+
+// ============================================================================
+// Compiler detection
+// ============================================================================
+
+function compilerVersion(cmd) {
+  try {
+    const output = execFileSync(cmd, ["--version"], {
+      encoding: "utf-8",
+      stdio: "pipe",
+      timeout: 5000,
+    });
+    return output.split("\n")[0].trim();
+  } catch {
+    return null;
+  }
+}
+
+function findCompiler() {
+  const candidates = options.cc ? [options.cc] : ["gcc", "clang", "cc"];
+  for (const cmd of candidates) {
+    const version = compilerVersion(cmd);
+    if (version !== null) {
+      return { cmd, version };
+    }
+  }
+  return null;
+}
+
+const compiler = findCompiler();
+if (compiler === null) {
+  console.error(
+    options.cc
+      ? `C compiler not available: ${options.cc}`
+      : "No host C compiler found (tried gcc, clang, cc); set CC or --cc",
+  );
+  process.exit(1);
+}
+
+// ============================================================================
+// Kernel discovery
+// ============================================================================
+
+const kernels = readdirSync(KERNELS_DIR)
+  .filter((name) => name.endsWith(".cnx"))
+  .map((name) => basename(name, ".cnx"))
+  .filter((name) => options.kernel === null || name === options.kernel)
+  .sort();
+
+if (kernels.length === 0) {
+  console.error(`No kernel named ${options.kernel} in bench/kernels`);
+  process.exit(1);
+}
+
+// ============================================================================
+// Transpile, build, run
+// ============================================================================
+
+function transpile(cnxFile, outputPath) {
+  const cliArgs = [
+    cnxFile,
+    "--include",
+    INCLUDE_DIR,
+    "-o",
+    outputPath,
+    ...options.transpilerArgs,
+  ];
+
+  // Clear VITEST so the CLI's main() runs (src/index.ts skips it under vitest)
+  const cleanEnv = { ...process.env };
+  delete cleanEnv.VITEST;
+
+  // Use the pre-built bundle when available, fall back to npx tsx for dev
+  const result = existsSync(DIST_ENTRY)
+    ? spawnSync(process.execPath, [DIST_ENTRY, ...cliArgs], {
+        cwd: ROOT,
+        encoding: "utf-8",
+        timeout: 30000,
+        env: cleanEnv,
+      })
+    : spawnSync("npx", ["tsx", join(ROOT, "src/index.ts"), ...cliArgs], {
+        cwd: ROOT,
+        encoding: "utf-8",
+        timeout: 30000,
+        env: cleanEnv,
+      });
+
+  if (result.status !== 0 || !existsSync(outputPath)) {
+    return result.stderr || result.stdout || "transpiler failed";
+  }
+  return null;
+}
+
+function build(kernel, level, workDir) {
+  const source = readFileSync(join(KERNELS_DIR, `${kernel}.cnx`), "utf-8");
+  const bases = BenchBaseline.registerBases(source);
+  const executable = join(workDir, `${kernel}-${level}`);
+
+  const args = [
+    "-std=c99",
+    `-${level}`,
+    "-Wno-unused-variable",
+    "-I",
+    INCLUDE_DIR,
+    "-I",
+    workDir,
+  ];
+  if (bases.length > 0) {
+    args.push(`-DBENCH_REGISTER_BASES=${bases.join(",")}`);
+  }
+  args.push(HARNESS, join(workDir, `${kernel}.c`), "-o", executable);
+
+  execFileSync(compiler.cmd, args, {
+    encoding: "utf-8",
+    timeout: 60000,
+    stdio: "pipe",
+  });
+  return executable;
+}
+
+function run(executable) {
+  const result = spawnSync(executable, [], {
+    encoding: "utf-8",
+    timeout: 120000,
+  });
+  if (result.status === EXIT_SKIPPED) {
+    return { skipped: (result.stderr || "").trim() };
+  }
+  const nsPerCall = BenchBaseline.parseResult(result.stdout || "");
+  if (result.status !== 0 || nsPerCall === null) {
+    return {
+      error: result.stderr || result.error?.message || "no result",
+    };
+  }
+  return { nsPerCall };
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+const workDir = mkdtempSync(join(tmpdir(), "cnext-bench-"));
+const results = {};
+let failures = 0;
+
+console.log(`Compiler: ${compiler.version}`);
+if (options.transpilerArgs.length > 0) {
+  console.log(`Transpiler options: ${options.transpilerArgs.join(" ")}`);
+}
+
+try {
+  for (const kernel of kernels) {
+    const error = transpile(
+      join(KERNELS_DIR, `${kernel}.cnx`),
+      join(workDir, `${kernel}.c`),
+    );
+    if (error !== null) {
+      console.error(`FAIL [transpile] ${kernel}`);
+      console.error(`  ${error.split("\n").slice(0, 5).join("\n  ")}`);
+      failures++;
+      continue;
+    }
+
+    for (const level of OPT_LEVELS) {
+      const key = BenchBaseline.key(kernel, level);
+      let outcome;
+      try {
+        outcome = run(build(kernel, level, workDir));
+      } catch (error) {
+        outcome = { error: error.stderr || error.message };
+      }
+
+      if (outcome.skipped !== undefined) {
+        console.log(`⊘ ${key} skipped: ${outcome.skipped}`);
+      } else if (outcome.error !== undefined) {
+        console.error(`FAIL [build/run] ${key}`);
+        console.error(
+          `  ${outcome.error.split("\n").slice(0, 5).join("\n  ")}`,
+        );
+        failures++;
+      } else {
+        results[key] = outcome.nsPerCall;
+      }
+    }
+  }
+} finally {
+  rmSync(workDir, { recursive: true, force: true });
+}
+
+const compilerId = basename(compiler.cmd);
+const baselinePath = join(BASELINES_DIR, `${compilerId}.json`);
+
+if (options.updateBaseline) {
+  // A partial run (--kernel) only replaces the entries it measured
+  const previous = existsSync(baselinePath)
+    ? JSON.parse(readFileSync(baselinePath, "utf-8")).results
+    : {};
+  const baseline = BenchBaseline.toBaseline(compiler.version, {
+    ...previous,
+    ...results,
+  });
+  mkdirSync(BASELINES_DIR, { recursive: true });
+  writeFileSync(baselinePath, `${JSON.stringify(baseline, null, 2)}\n`);
+  for (const key of Object.keys(results)) {
+    console.log(`  ${key.padEnd(28)} ${results[key].toFixed(3)} ns`);
+  }
+  console.log(`Baseline written to ${baselinePath}`);
+} else {
+  const baseline = existsSync(baselinePath)
+    ? JSON.parse(readFileSync(baselinePath, "utf-8"))
+    : { compiler: null, results: {} };
+  if (baseline.compiler === null) {
+    console.log(`No baseline for ${compilerId} (run with --update-baseline)`);
+  } else if (baseline.compiler !== compiler.version) {
+    console.log(`Baseline recorded with ${baseline.compiler}`);
+  }
+
+  const comparisons = BenchBaseline.compare(
+    results,
+    baseline.results,
+    options.tolerance,
+  );
+  for (const comparison of comparisons) {
+    const measured = `${comparison.nsPerCall.toFixed(3)} ns`;
+    const change =
+      comparison.ratio === null
+        ? ""
+        : `(${((comparison.ratio - 1) * 100).toFixed(1)}% vs ${comparison.baselineNs} ns)`;
+    console.log(
+      `  ${comparison.key.padEnd(28)} ${measured.padStart(14)}  ${comparison.verdict.padEnd(6)} ${change}`,
+    );
+  }
+
+  const regressions = BenchBaseline.findRegressions(comparisons);
+  for (const regression of regressions) {
+    console.error(
+      `FAIL [slower] ${regression.key} beyond ${options.tolerance * 100}% tolerance`,
+    );
+  }
+  failures += regressions.length;
+}
+
+if (failures > 0) {
+  console.error(`\n${failures} benchmark failure(s)`);
+  process.exit(1);
+}
+console.log("\nAll benchmarks completed");
@@ -0,0 +1,179 @@
+/**
+ * Compile/Execute Result Cache for the Integration Test Runner
+ *
+ * Every test compiles its generated .c/.cpp with gcc/g++ and runs the binary
+ * of test-execution tests, even when the generated code is byte-identical to
+ * the previous run. After a codegen change only a few outputs differ, so the
+ * outcome of each compiler (and executable) run is stored under a key made
+ * from what can change it:
+ *   - the content of every source file passed to the compiler,
+ *   - the content of every header they include (resolved recursively through
+ *     the including file's directory and the -I directories; unresolved names
+ *     such as system headers are keyed by name),
+ *   - the compiler's `--version` output,
+ *   - the compiler name and flags.
+ *
+ * Entries are one JSON file per key in .cnx/test-cache/, written atomically
+ * so parallel workers can share the directory. Runs that were killed (e.g.
+ * by a timeout) are not stored. `npm test -- --no-compile-cache` bypasses
+ * the cache entirely (CI runs that way).
+ */
+
+import {
+  existsSync,
+  mkdirSync,
+  readFileSync,
+  renameSync,
+  writeFileSync,
+} from "node:fs";
+import { dirname, join, relative } from "node:path";
+import { execFileSync } from "node:child_process";
+import { createHash } from "node:crypto";
+import ICompileCacheEntry from "./types/ICompileCacheEntry";
+import ICompileCacheInput from "./types/ICompileCacheInput";
+
+/** Bump when the entry format or key derivation changes */
+const CACHE_VERSION = 1;
+
+const INCLUDE_REGEX = /^\s*#\s*include\s*([<"])([^>"]+)[>"]/gm;
+
+class CompileCache {
+  private static readonly compilerVersions = new Map<string, string>();
+
+  private readonly cacheDir: string;
+  private readonly rootDir: string;
+
+  /**
+   * @param rootDir - Project root; paths in keys are relative to it so a
+   *   cache survives moving the checkout
+   * @param cacheDir - Directory holding the entries
+   */
+  constructor(
+    rootDir: string,
+    cacheDir: string = join(rootDir, ".cnx", "test-cache"),
+  ) {
+    this.rootDir = rootDir;
+    this.cacheDir = cacheDir;
+  }
+
+  /**
+   * First line of `<compiler> --version` (memoized per process)
+   */
+  static compilerVersion(compiler: string): string {
+    let version = CompileCache.compilerVersions.get(compiler);
+    if (version === undefined) {
+      try {
+        version = execFileSync(compiler, ["--version"], {
+          encoding: "utf-8",
+          stdio: "pipe",
+          timeout: 5000,
+        }).split("\n")[0];
+      } catch {
+        version = "unknown";
+      }
+      CompileCache.compilerVersions.set(compiler, version);
+    }
+    return version;
+  }
+
+  /**
+   * Headers reachable from the source files through #include, in discovery
+   * order. Quoted includes are looked up next to the including file first,
+   * then in includeDirs; angle includes only in includeDirs. Names that
+   * resolve nowhere are returned as `<name>`.
+   */
+  static collectHeaders(
+    sourceFiles: string[],
+    includeDirs: string[],
+  ): string[] {
+    const headers: string[] = [];
+    const visited = new Set<string>(sourceFiles);
+    const queue = [...sourceFiles];
+
+    while (queue.length > 0) {
+      const file = queue.shift()!;
+      const content = readFileSync(file, "utf-8");
+      for (const match of content.matchAll(INCLUDE_REGEX)) {
+        const [, delimiter, name] = match;
+        const searchDirs =
+          delimiter === '"' ? [dirname(file), ...includeDirs] : includeDirs;
+        const resolved = searchDirs
+          .map((dir) => join(dir, name))
+          .find((candidate) => existsSync(candidate));
+        const header = resolved ?? `<${name}>`;
+        if (visited.has(header)) {
+          continue;
+        }
+        visited.add(header);
+        headers.push(header);
+        if (resolved !== undefined) {
+          queue.push(resolved);
+        }
+      }
+    }
+
+    return headers;
+  }
+
+  /**
+   * Content-addressed key for a compiler run
+   */
+  key(input: ICompileCacheInput): string {
+    const hash = createHash("sha256");
+    const add = (part: string): void => {
+      hash.update(part);
+      hash.update("\0");
+    };
+
+    add(`v${CACHE_VERSION}`);
+    add(input.execute ? "run" : "compile");
+    add(input.compiler);
+    add(CompileCache.compilerVersion(input.compiler));
+    for (const flag of input.flags) {
+      add(this.relativize(flag));
+    }
+
+    const headers = CompileCache.collectHeaders(
+      input.sourceFiles,
+      input.includeDirs,
+    );
+    for (const file of [...input.sourceFiles, ...headers]) {
+      add(this.relativize(file));
+      if (!file.startsWith("<")) {
+        add(createHash("sha256").update(readFileSync(file)).digest("hex"));
+      }
+    }
+
+    return hash.digest("hex");
+  }
+
+  get(key: string): ICompileCacheEntry | null {
+    try {
+      return JSON.parse(readFileSync(this.entryPath(key), "utf-8"));
+    } catch {
+      return null; // Missing or unreadable entries are misses
+    }
+  }
+
+  set(key: string, entry: ICompileCacheEntry): void {
+    const path = this.entryPath(key);
+    const tempPath = `${path}.${process.pid}.tmp`;
+    try {
+      mkdirSync(dirname(path), { recursive: true });
+      writeFileSync(tempPath, JSON.stringify(entry));
+      renameSync(tempPath, path);
+    } catch {
+      // A failed write only costs a recompile next run
+    }
+  }
+
+  private entryPath(key: string): string {
+    return join(this.cacheDir, key.slice(0, 2), `${key}.json`);
+  }
+
+  private relativize(path: string): string {
+    return path.startsWith(this.rootDir) ? relative(this.rootDir, path) : path;
+  }
+}
+
+export default CompileCache;
@@ -15,8 +15,9 @@ import {
   unlinkSync,
   statSync,
   readdirSync,
+  mkdirSync,
 } from "node:fs";
-import { join, dirname, basename } from "node:path";
+import { join, dirname, basename, relative } from "node:path";
 import { execFileSync, spawnSync } from "node:child_process";
 import { tmpdir } from "node:os";
 import { randomBytes } from "node:crypto";
@@ -28,6 +29,10 @@ import ITestResult from "./types/ITestResult";
 import type TTestMode from "./types/TTestMode";
 import type IModeResult from "./types/ITestMode";
 import detectCppSyntax from "../src/transpiler/logic/detectCppSyntax";
+import TranspilerDaemon from "./transpiler-daemon";
+import CompileCache from "./compile-cache";
+import ICompileCacheEntry from "./types/ICompileCacheEntry";
+import ICompileCacheInput from "./types/ICompileCacheInput";
 
 // Project root for CLI invocation (this file is in /workspace/scripts/)
 const PROJECT_ROOT = dirname(dirname(fileURLToPath(import.meta.url)));
@@ -94,73 +99,267 @@ interface ICliTranspileResult {
   stderr: string;
 }
 
+/**
+ * Exit status and stderr of one CLI invocation
+ */
+interface ICliRun {
+  status: number | null;
+  stderr: string;
+}
+
+// Command that starts the CLI: the pre-built bundle, or tsx for dev
+const CLI_COMMAND = USE_BUILT
+  ? [process.execPath, DIST_ENTRY]
+  : ["npx", "tsx", join(PROJECT_ROOT, "src/index.ts")];
+
+const CLI_TIMEOUT_MS = 30000;
+
+/**
+ * Outcome of a compiler (and executable) run, and whether it may be cached:
+ * runs killed by a timeout or that failed to start are not.
+ */
+interface ICompilerRun {
+  entry: ICompileCacheEntry;
+  cacheable: boolean;
+}
+
+/**
+ * Run the compiler with args, recording its exit status and diagnostics
+ */
+function runCompiler(
+  compiler: string,
+  args: string[],
+  timeout: number,
+): ICompilerRun {
+  try {
+    execFileSync(compiler, args, { encoding: "utf-8", timeout, stdio: "pipe" });
+    return { entry: { status: 0, diagnostics: "" }, cacheable: true };
+  } catch (error: unknown) {
+    const err = error as {
+      status?: number | null;
+      stderr?: string;
+      stdout?: string;
+      message: string;
+    };
+    return {
+      entry: {
+        status: err.status ?? 1,
+        diagnostics: err.stderr || err.stdout || err.message,
+      },
+      cacheable: typeof err.status === "number",
+    };
+  }
+}
+
+/**
+ * Look the run up in the compile cache (compile-cache.ts), running and
+ * storing it on a miss. options.noCompileCache always runs.
+ */
+function runCompilerCached(
+  input: ICompileCacheInput,
+  rootDir: string,
+  options: ITestOptions,
+  run: () => ICompilerRun,
+): ICompileCacheEntry {
+  if (options.noCompileCache) {
+    return run().entry;
+  }
+  const cache = new CompileCache(rootDir);
+  let key: string;
+  try {
+    key = cache.key(input);
+  } catch {
+    return run().entry; // Unreadable source: let the compiler report it
+  }
+  const cached = cache.get(key);
+  if (cached !== null) {
+    return cached;
+  }
+  const { entry, cacheable } = run();
+  if (cacheable) {
+    cache.set(key, entry);
+  }
+  return entry;
+}
+
+/**
+ * Run the CLI in a fresh process.
+ */
+function spawnCli(cliArgs: string[]): ICliRun {
+  // Clear VITEST env so the CLI's main() function runs
+  // (src/index.ts checks VITEST to skip auto-execution during unit tests)
+  const cleanEnv = { ...process.env };
+  delete cleanEnv.VITEST;
+
+  const result = spawnSync(
+    CLI_COMMAND[0],
+    [...CLI_COMMAND.slice(1), ...cliArgs],
+    {
+      cwd: PROJECT_ROOT,
+      encoding: "utf-8",
+      timeout: CLI_TIMEOUT_MS,
+      env: cleanEnv,
+    },
+  );
+  return { status: result.status, stderr: result.stderr || "" };
+}
+
+/**
+ * Run the CLI in this process's resident transpiler (transpiler-daemon.ts),
+ * falling back to a fresh process if the daemon cannot run it.
+ */
+async function runCliResident(cliArgs: string[]): Promise<ICliRun> {
+  try {
+    const result = await TranspilerDaemon.shared(
+      CLI_COMMAND,
+      PROJECT_ROOT,
+    ).transpileFiles(cliArgs, CLI_TIMEOUT_MS);
+    return { status: result.exitCode, stderr: result.stderr };
+  } catch {
+    return spawnCli(cliArgs);
+  }
+}
+
+function readIfExists(path: string): string | null {
+  return existsSync(path) ? readFileSync(path, "utf-8") : null;
+}
+
+/**
+ * Re-run a command line in a fresh process and describe how its exit code,
+ * stderr and generated files differ from the resident run (null if none).
+ */
+function checkDaemonParity(
+  cliArgs: string[],
+  residentRun: ICliRun,
+  outputPaths: string[],
+): string | null {
+  const residentOutputs = outputPaths.map(readIfExists);
+  const spawnedRun = spawnCli(cliArgs);
+
+  const differences: string[] = [];
+  if (spawnedRun.status !== residentRun.status) {
+    differences.push(
+      `exit code ${residentRun.status} vs ${spawnedRun.status}`,
+    );
+  }
+  if (spawnedRun.stderr !== residentRun.stderr) {
+    differences.push("stderr");
+  }
+  outputPaths.forEach((path, i) => {
+    if (readIfExists(path) !== residentOutputs[i]) {
+      differences.push(basename(path));
+    }
+  });
+
+  return differences.length > 0
+    ? `Daemon parity mismatch (daemon vs spawn): ${differences.join(", ")}`
+    : null;
+}
+
 /**
  * Transpile a C-Next file using the CLI (not library imports).
  *
  * This ensures tests exercise the exact same code path as real users.
  * Previously tests imported Transpiler directly, which bypassed conflict
- * detection and other CLI-only features.
+ * detection and other CLI-only features. The CLI runs in a resident
+ * `--serve` process (transpileFiles) unless options.noDaemon is set;
+ * options.daemonParity also runs it in a fresh process and fails on any
+ * difference.
  *
  * @param cnxFile - Path to the .cnx file to transpile
  * @param _rootDir - Project root directory (unused, kept for API compatibility)
  * @param cppMode - Whether to use C++ mode (--cpp flag)
+ * @param options - Test execution options (noDaemon, daemonParity)
  * @param outputPath - Optional output path for the generated code file
  */
-function transpileViaCli(
+async function transpileViaCli(
   cnxFile: string,
   _rootDir: string,
   cppMode: boolean,
+  options: ITestOptions = {},
+  outputPath?: string,
+): Promise<ICliTranspileResult> {
+  const results = await transpileModesViaCli(
+    cnxFile,
+    [cppMode],
+    options,
+    outputPath,
+  );
+  return results[0];
+}
+
+/**
+ * Transpile a C-Next file once for one or both output languages. With both
+ * (C first, then C++) the CLI runs with --dual-output, which analyzes the
+ * file once and writes .c/.h and .cpp/.hpp; the result has one entry per
+ * requested mode.
+ *
+ * @param cnxFile - Path to the .cnx file to transpile
+ * @param cppModes - false for C, true for C++
+ * @param options - Test execution options (noDaemon, daemonParity)
+ * @param outputPath - Optional output path for the code file (single mode)
+ */
+async function transpileModesViaCli(
+  cnxFile: string,
+  cppModes: boolean[],
+  options: ITestOptions = {},
   outputPath?: string,
-): ICliTranspileResult {
+): Promise<ICliTranspileResult[]> {
   // Build CLI args - use PROJECT_ROOT for CLI/includes, but cnxFile is the actual test file path
   // Note: We don't clean up stale files - the CLI overwrites them and they're tracked in git
   const cliArgs = [cnxFile, "--include", join(PROJECT_ROOT, "tests/include")];
 
-  if (cppMode) {
+  if (cppModes.length > 1) {
+    cliArgs.push("--dual-output");
+  } else if (cppModes[0]) {
     cliArgs.push("--cpp");
   }
 
-  // Determine output paths
-  let codePath: string;
-  let headerPath: string;
-  const codeExt = cppMode ? ".cpp" : ".c";
-  const headerExt = cppMode ? ".hpp" : ".h";
-
   if (outputPath) {
     cliArgs.push("-o", outputPath);
-    codePath = outputPath;
-    // Header goes next to the code file with matching extension
-    headerPath = outputPath.replace(/\.(c|cpp)$/, headerExt);
-  } else {
-    const basePath = cnxFile.replace(/\.cnx$/, "");
-    codePath = basePath + codeExt;
-    headerPath = basePath + headerExt;
   }
 
-  // Run CLI from project root (where src/index.ts exists)
-  // Clear VITEST env so the CLI's main() function runs
-  // (src/index.ts checks VITEST to skip auto-execution during unit tests)
-  const cleanEnv = { ...process.env };
-  delete cleanEnv.VITEST;
+  // Determine output paths
+  const outputs = cppModes.map((cppMode) => {
+    const codeExt = cppMode ? ".cpp" : ".c";
+    const headerExt = cppMode ? ".hpp" : ".h";
 
-  // Use pre-built bundle when available (fast), fall back to npx tsx for dev
-  const result = USE_BUILT
-    ? spawnSync(process.execPath, [DIST_ENTRY, ...cliArgs], {
-        cwd: PROJECT_ROOT,
-        encoding: "utf-8",
-        timeout: 30000,
-        env: cleanEnv,
-      })
-    : spawnSync(
-        "npx",
-        ["tsx", join(PROJECT_ROOT, "src/index.ts"), ...cliArgs],
-        {
-          cwd: PROJECT_ROOT,
-          encoding: "utf-8",
-          timeout: 30000,
-          env: cleanEnv,
-        },
-      );
+    if (outputPath) {
+      // Header goes next to the code file with matching extension
+      return {
+        codePath: outputPath,
+        headerPath: outputPath.replace(/\.(c|cpp)$/, headerExt),
+      };
+    }
+    const basePath = cnxFile.replace(/\.cnx$/, "");
+    return { codePath: basePath + codeExt, headerPath: basePath + headerExt };
+  });
+
+  const result = options.noDaemon
+    ? spawnCli(cliArgs)
+    : await runCliResident(cliArgs);
+
+  if (options.daemonParity && !options.noDaemon) {
+    // Include the C++ paths the CLI switches to when it auto-detects C++
+    const outputPaths = new Set(
+      outputs.flatMap(({ codePath, headerPath }) => [
+        codePath,
+        headerPath,
+        codePath.replace(/\.c$/, ".cpp"),
+        headerPath.replace(/\.h$/, ".hpp"),
+      ]),
+    );
+    const mismatch = checkDaemonParity(cliArgs, result, [...outputPaths]);
+    if (mismatch) {
+      return cppModes.map(() => ({
+        success: false,
+        code: "",
+        headerCode: "",
+        errors: [{ line: 0, column: 0, message: mismatch }],
+        stderr: `${mismatch}\n${result.stderr}`,
+      }));
+    }
+  }
 
   // Parse errors from stderr
   // CLI format: "Error: /path/file.cnx:line:column message" followed by optional indented continuation lines
@@ -232,39 +431,83 @@ function transpileViaCli(
   }
 
   // Read generated files if they exist
-  // Handle CLI auto-detection: if we asked for C but got C++ (due to .hpp includes), use C++ paths
+  return outputs.map(({ codePath, headerPath }) => ({
+    success: result.status === 0,
+    ...(result.status === 0
+      ? readTranspileOutput(codePath, headerPath)
+      : { code: "", headerCode: "" }),
+    errors,
+    stderr: result.stderr || "",
+  }));
+}
+
+/**
+ * Transpile a C-Next file and its .cnx includes into one translation unit
+ * (--amalgamate) at outputPath.
+ *
+ * @returns Error message, or null on success
+ */
+async function transpileAmalgamatedViaCli(
+  cnxFile: string,
+  cppMode: boolean,
+  outputPath: string,
+  options: ITestOptions,
+): Promise<string | null> {
+  const cliArgs = [
+    cnxFile,
+    "--include",
+    join(PROJECT_ROOT, "tests/include"),
+    "--amalgamate",
+    outputPath,
+    // Headers are inlined in the unit; keep the tracked ones untouched
+    "--header-out",
+    outputPath.replace(/\.cp*$/, ".headers"),
+  ];
+  if (cppMode) {
+    cliArgs.push("--cpp");
+  }
+  const result = options.noDaemon
+    ? spawnCli(cliArgs)
+    : await runCliResident(cliArgs);
+  if (result.status !== 0) {
+    return result.stderr.trim() || `exit code ${result.status}`;
+  }
+  return existsSync(outputPath) ? null : `${outputPath} was not written`;
+}
+
+/**
+ * Read the generated code and header of one mode.
+ * Handles CLI auto-detection: if we asked for C but got C++ (due to .hpp
+ * includes), use the C++ paths.
+ */
+function readTranspileOutput(
+  codePath: string,
+  headerPath: string,
+): { code: string; headerCode: string } {
   let code = "";
   let headerCode = "";
   let actualCodePath = codePath;
   let actualHeaderPath = headerPath;
 
-  if (result.status === 0) {
-    // Check if the expected file exists, or if CLI auto-detected a different mode
-    if (!existsSync(codePath)) {
-      // CLI may have auto-detected C++ mode from .hpp includes
-      const altCodePath = codePath.replace(/\.c$/, ".cpp");
-      const altHeaderPath = headerPath.replace(/\.h$/, ".hpp");
-      if (existsSync(altCodePath)) {
-        actualCodePath = altCodePath;
-        actualHeaderPath = altHeaderPath;
-      }
+  // Check if the expected file exists, or if CLI auto-detected a different mode
+  if (!existsSync(codePath)) {
+    // CLI may have auto-detected C++ mode from .hpp includes
+    const altCodePath = codePath.replace(/\.c$/, ".cpp");
+    const altHeaderPath = headerPath.replace(/\.h$/, ".hpp");
+    if (existsSync(altCodePath)) {
+      actualCodePath = altCodePath;
+      actualHeaderPath = altHeaderPath;
     }
+  }
 
-    if (existsSync(actualCodePath)) {
-      code = readFileSync(actualCodePath, "utf-8");
-    }
-    if (existsSync(actualHeaderPath)) {
-      headerCode = readFileSync(actualHeaderPath, "utf-8");
-    }
+  if (existsSync(actualCodePath)) {
+    code = readFileSync(actualCodePath, "utf-8");
+  }
+  if (existsSync(actualHeaderPath)) {
+    headerCode = readFileSync(actualHeaderPath, "utf-8");
   }
 
-  return {
-    success: result.status === 0,
-    code,
-    headerCode,
-    errors,
-    stderr: result.stderr || "",
-  };
+  return { code, headerCode };
 }
 
 // Shared patterns for distinguishing C++ constructors from C function prototypes
@@ -503,51 +746,57 @@ class TestUtils {
    * @param cFile - Path to the C file
    * @param rootDir - Project root directory for include paths
    */
-  static validateNoWarnings(cFile: string, rootDir: string): IValidationResult {
-    try {
-      // Auto-detect C++14 headers and use g++ when needed
-      const useCpp = TestUtils.requiresCpp14(cFile);
-      const compiler = useCpp ? "g++" : "gcc";
-      const stdFlag = useCpp ? "-std=c++14" : "-std=c99";
-
-      // Compile with -Werror to treat warnings as errors
-      // Include common warning flags that catch issues like -Wstringop-overflow
-      execFileSync(
+  static validateNoWarnings(
+    cFile: string,
+    rootDir: string,
+    options: ITestOptions = {},
+  ): IValidationResult {
+    // Auto-detect C++14 headers and use g++ when needed
+    const useCpp = TestUtils.requiresCpp14(cFile);
+    const compiler = useCpp ? "g++" : "gcc";
+    const stdFlag = useCpp ? "-std=c++14" : "-std=c99";
+    const includeDir = join(rootDir, "tests/include");
+
+    // Compile with -Werror to treat warnings as errors
+    // Include common warning flags that catch issues like -Wstringop-overflow
+    const flags = [
+      "-fsyntax-only",
+      stdFlag,
+      "-Wall",
+      "-Wextra",
+      "-Werror",
+      "-Wno-unused-variable",
+      "-Wno-main",
+      "-I",
+      includeDir,
+    ];
+    const compiled = runCompilerCached(
+      {
         compiler,
-        [
-          "-fsyntax-only",
-          stdFlag,
-          "-Wall",
-          "-Wextra",
-          "-Werror",
-          "-Wno-unused-variable",
-          "-Wno-main",
-          "-I",
-          join(rootDir, "tests/include"),
-          cFile,
-        ],
-        { encoding: "utf-8", timeout: 10000, stdio: "pipe" },
-      );
+        flags,
+        sourceFiles: [cFile],
+        includeDirs: [includeDir],
+        execute: false,
+      },
+      rootDir,
+      options,
+      () => runCompiler(compiler, [...flags, cFile], 10000),
+    );
+    if (compiled.status === 0) {
       return { valid: true };
-    } catch (error: unknown) {
-      const err = error as {
-        stderr?: string;
-        stdout?: string;
-        message: string;
-      };
-      // Extract just the warning/error messages
-      const output = err.stderr || err.stdout || err.message;
-      const warnings = output
-        .split("\n")
-        .filter((line) => line.includes("warning:") || line.includes("error:"))
-        .map((line) => line.replace(cFile + ":", ""))
-        .slice(0, 5)
-        .join("\n");
-      return {
-        valid: false,
-        message: warnings || "Compilation produced warnings",
-      };
     }
+
+    // Extract just the warning/error messages
+    const warnings = compiled.diagnostics
+      .split("\n")
+      .filter((line) => line.includes("warning:") || line.includes("error:"))
+      .map((line) => line.replace(cFile + ":", ""))
+      .slice(0, 5)
+      .join("\n");
+    return {
+      valid: false,
+      message: warnings || "Compilation produced warnings",
+    };
   }
 
   /**
@@ -689,6 +938,112 @@ class TestUtils {
     }
   }
 
+  /**
+   * Build sourceFiles into execPath and run it, for the compile cache
+   */
+  private static compileAndRun(
+    compiler: string,
+    flags: string[],
+    sourceFiles: string[],
+    execPath: string,
+  ): ICompilerRun {
+    const build = runCompiler(
+      compiler,
+      [...flags, "-o", execPath, ...sourceFiles],
+      30000,
+    );
+    if (build.entry.status !== 0) {
+      return build;
+    }
+
+    try {
+      const stdout = execFileSync(execPath, [], {
+        encoding: "utf-8",
+        timeout: 5000,
+        stdio: "pipe",
+      });
+      return {
+        entry: { ...build.entry, exitCode: 0, stdout },
+        cacheable: true,
+      };
+    } catch (execError: unknown) {
+      const err = execError as { status?: number | null; stdout?: string };
+      return {
+        entry: {
+          ...build.entry,
+          exitCode: err.status || 1,
+          stdout: err.stdout,
+        },
+        cacheable: typeof err.status === "number",
+      };
+    } finally {
+      try {
+        if (existsSync(execPath)) unlinkSync(execPath);
+      } catch {
+        // Ignore cleanup errors
+      }
+    }
+  }
+
+  /**
+   * Amalgamated pass of an execution test: transpile it with --amalgamate,
+   * build the single translation unit (plus test-link sources), run it and
+   * compare with the per-file run, which exited 0 with expectedStdout.
+   *
+   * @returns Description of the difference, or null if it behaves the same
+   */
+  private static async runAmalgamated(
+    cnxFile: string,
+    source: string,
+    mode: TTestMode,
+    compiler: string,
+    compileFlags: string[],
+    includeDirs: string[],
+    rootDir: string,
+    options: ITestOptions,
+    expectedStdout: string,
+  ): Promise<string | null> {
+    // Stable per-test path, so unchanged output hits the compile cache
+    const unitName = relative(PROJECT_ROOT, cnxFile)
+      .replaceAll(/[\\/]/g, "__")
+      .replace(/\.test\.cnx$/, mode === "cpp" ? ".cpp" : ".c");
+    const unitPath = join(tmpdir(), "cnx-amalgamation", unitName);
+    mkdirSync(dirname(unitPath), { recursive: true });
+
+    const transpileError = await transpileAmalgamatedViaCli(
+      cnxFile,
+      mode === "cpp",
+      unitPath,
+      options,
+    );
+    if (transpileError) {
+      return `transpile failed: ${transpileError}`;
+    }
+
+    const sourceFiles = [
+      unitPath,
+      ...TestUtils.findLinkedSourceFiles(cnxFile, source),
+    ];
+    const execPath = TestUtils.getExecutablePath(cnxFile);
+    const ran = runCompilerCached(
+      { compiler, flags: compileFlags, sourceFiles, includeDirs, execute: true },
+      rootDir,
+      options,
+      () =>
+        TestUtils.compileAndRun(compiler, compileFlags, sourceFiles, execPath),
+    );
+    if (ran.status !== 0) {
+      return `compile failed: ${ran.diagnostics.split("\n").slice(0, 5).join("\n")}`;
+    }
+    if (ran.exitCode !== 0) {
+      return `execution failed with exit code ${ran.exitCode}`;
+    }
+    if ((ran.stdout ?? "") !== expectedStdout) {
+      return "stdout differs from the per-file build";
+    }
+    return null;
+  }
+
   /**
    * Run a test in a single mode (C or C++)
    *
@@ -703,6 +1058,8 @@ class TestUtils {
    * @param rootDir - Project root directory
    * @param helperCnxFiles - Helper .cnx files to also transpile
    * @param options - Test execution options (transpileOnly)
+   * @param transpiled - This mode's result of a dual-output transpile that
+   *   runTest already ran (the file is transpiled here otherwise)
    */
   static async runTestMode(
     cnxFile: string,
@@ -713,6 +1070,7 @@ class TestUtils {
     rootDir: string,
     helperCnxFiles: string[],
     options: ITestOptions = {},
+    transpiled?: ICliTranspileResult,
   ): Promise<IModeResult> {
     const basePath = cnxFile.replace(/\.test\.cnx$/, "");
     const paths = TestUtils.getExpectedPaths(basePath, mode);
@@ -737,7 +1095,9 @@ class TestUtils {
     // Always transpile via CLI: every test is re-transpiled in the same pass
     // that compiles and executes it, so a stale .cnx can never be silently
     // validated against pre-existing generated files (Issue #1018).
-    const transpileResult = transpileViaCli(cnxFile, rootDir, mode === "cpp");
+    const transpileResult =
+      transpiled ??
+      (await transpileViaCli(cnxFile, rootDir, mode === "cpp", options));
 
     if (!transpileResult.success) {
       const errors = transpileResult.errors
@@ -764,7 +1124,12 @@ class TestUtils {
       );
 
       // Transpile WITHOUT -o to avoid renaming tracked files
-      const helperResult = transpileViaCli(helperCnx, rootDir, mode === "cpp");
+      const helperResult = await transpileViaCli(
+        helperCnx,
+        rootDir,
+        mode === "cpp",
+        options,
+      );
 
       if (helperResult.success) {
         helperImplFiles.push(helperImplFile);
@@ -852,33 +1217,39 @@ class TestUtils {
     const actualCompiler = needsCppCompiler ? "g++" : "gcc";
     const actualStdFlag = needsCppCompiler ? "-std=c++14" : "-std=c99";
 
+    const includeDir = join(rootDir, "tests/include");
+    const cFileDir = dirname(expectedImplPath);
+    const compileFlags = [
+      actualStdFlag,
+      "-Wno-unused-variable",
+      "-Wno-main",
+      "-I",
+      includeDir,
+      "-I",
+      cFileDir,
+    ];
+
     if (tools.gcc) {
-      try {
-        const cFileDir = dirname(expectedImplPath);
-        execFileSync(
-          actualCompiler,
-          [
-            "-fsyntax-only",
-            actualStdFlag,
-            "-Wno-unused-variable",
-            "-Wno-main",
-            "-I",
-            join(rootDir, "tests/include"),
-            "-I",
-            cFileDir,
-            expectedImplPath,
-          ],
-          { encoding: "utf-8", timeout: 10000, stdio: "pipe" },
-        );
-        result.compileSuccess = true;
-      } catch (error: unknown) {
-        const err = error as {
-          stderr?: string;
-          stdout?: string;
-          message: string;
-        };
-        const output = err.stderr || err.stdout || err.message;
-        const errors = output
+      const syntaxFlags = ["-fsyntax-only", ...compileFlags];
+      const compiled = runCompilerCached(
+        {
+          compiler: actualCompiler,
+          flags: syntaxFlags,
+          sourceFiles: [expectedImplPath],
+          includeDirs: [includeDir, cFileDir],
+          execute: false,
+        },
+        rootDir,
+        options,
+        () =>
+          runCompiler(
+            actualCompiler,
+            [...syntaxFlags, expectedImplPath],
+            10000,
+          ),
+      );
+      if (compiled.status !== 0) {
+        const errors = compiled.diagnostics
           .split("\n")
           .filter((line) => line.includes("error:"))
           .slice(0, 5)
@@ -887,6 +1258,7 @@ class TestUtils {
         // No cleanup needed for helper files
         return result;
       }
+      result.compileSuccess = true;
     } else {
       result.compileSuccess = true; // Skip if no gcc
     }
@@ -902,6 +1274,7 @@ class TestUtils {
       const noWarningsResult = TestUtils.validateNoWarnings(
         expectedImplPath,
         rootDir,
+        options,
       );
       if (!noWarningsResult.valid) {
         result.error = `No-warnings check failed: ${noWarningsResult.message}`;
@@ -928,55 +1301,56 @@ class TestUtils {
         ...TestUtils.findLinkedSourceFiles(cnxFile, source),
       ];
 
-      try {
-        // Compile to executable (reuse auto-detected compiler from above)
-        const cFileDir = dirname(expectedImplPath);
-        execFileSync(
-          actualCompiler,
-          [
-            actualStdFlag,
-            "-Wno-unused-variable",
-            "-Wno-main",
-            "-I",
-            join(rootDir, "tests/include"),
-            "-I",
-            cFileDir,
-            "-o",
+      // Compile to executable (reuse auto-detected compiler from above),
+      // execute and capture stdout for parity comparison
+      const ran = runCompilerCached(
+        {
+          compiler: actualCompiler,
+          flags: compileFlags,
+          sourceFiles,
+          includeDirs: [includeDir, cFileDir],
+          execute: true,
+        },
+        rootDir,
+        options,
+        () =>
+          TestUtils.compileAndRun(
+            actualCompiler,
+            compileFlags,
+            sourceFiles,
             execPath,
-            ...sourceFiles,
-          ],
-          { encoding: "utf-8", timeout: 30000, stdio: "pipe" },
-        );
+          ),
+      );
+      if (ran.status !== 0) {
+        result.error = `${mode.toUpperCase()} compile for execution failed: ${ran.diagnostics}`;
+        // No cleanup needed for helper files
+        return result;
+      }
+      result.stdout = ran.stdout; // Capture stdout even on failure
+      if (ran.exitCode !== 0) {
+        result.error = `${mode.toUpperCase()} execution failed with exit code ${ran.exitCode}`;
+        // No cleanup needed for helper files
+        return result;
+      }
 
-        // Execute and capture stdout for parity comparison
-        try {
-          const stdout = execFileSync(execPath, [], {
-            encoding: "utf-8",
-            timeout: 5000,
-            stdio: "pipe",
-          });
-          result.execSuccess = true;
-          result.stdout = stdout; // Capture for parity comparison
-        } catch (execError: unknown) {
-          const err = execError as { status?: number; stdout?: string };
-          const exitCode = err.status || 1;
-          result.error = `${mode.toUpperCase()} execution failed with exit code ${exitCode}`;
-          result.stdout = err.stdout; // Capture stdout even on failure
-          // No cleanup needed for helper files
+      if (!options.noAmalgamation) {
+        const amalgamationError = await TestUtils.runAmalgamated(
+          cnxFile,
+          source,
+          mode,
+          actualCompiler,
+          compileFlags,
+          [includeDir, cFileDir],
+          rootDir,
+          options,
+          ran.stdout ?? "",
+        );
+        if (amalgamationError) {
+          result.error = `${mode.toUpperCase()} amalgamated build: ${amalgamationError}`;
           return result;
-        } finally {
-          try {
-            if (existsSync(execPath)) unlinkSync(execPath);
-          } catch {
-            // Ignore cleanup errors
-          }
         }
-      } catch (compileError: unknown) {
-        const err = compileError as { stderr?: string; message: string };
-        result.error = `${mode.toUpperCase()} compile for execution failed: ${err.stderr || err.message}`;
-        // No cleanup needed for helper files
-        return result;
       }
+      result.execSuccess = true;
     } else {
       result.execSuccess = true; // No execution requested
     }
@@ -1041,12 +1415,24 @@ class TestUtils {
         expectedErrorFile,
         updateMode,
         rootDir,
+        options,
       );
     }
 
+    // Both modes: one --dual-output transpile analyzes the file once and
+    // writes the C and C++ output (options.noDualOutput transpiles per mode)
+    const transpiled =
+      modes.length > 1 && !options.noDualOutput
+        ? await transpileModesViaCli(
+            cnxFile,
+            modes.map((mode) => mode === "cpp"),
+            options,
+          )
+        : [];
+
     // Run each enabled mode (default: both C and C++)
     const modeResults: IModeResult[] = [];
-    for (const mode of modes as TTestMode[]) {
+    for (const [i, mode] of (modes as TTestMode[]).entries()) {
       const modeResult = await TestUtils.runTestMode(
         cnxFile,
         source,
@@ -1056,6 +1442,7 @@ class TestUtils {
         rootDir,
         helperCnxFiles,
         options,
+        transpiled[i],
       );
       modeResults.push(modeResult);
     }
@@ -1111,6 +1498,7 @@ class TestUtils {
     expectedErrorFile: string,
     updateMode: boolean,
     rootDir: string,
+    options: ITestOptions = {},
   ): Promise<ITestResult> {
     const expectedCFile = basePath + ".expected.c";
     const expectedHFile = basePath + ".expected.h";
@@ -1130,7 +1518,7 @@ class TestUtils {
     }
 
     // Transpile via CLI to check for errors
-    const result = transpileViaCli(cnxFile, rootDir, false);
+    const result = await transpileViaCli(cnxFile, rootDir, false, options);
 
     if (result.success) {
       if (updateMode) {
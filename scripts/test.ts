@@ -12,7 +12,8 @@
  *   2. Cppcheck static analysis
  *   3. Clang-tidy analysis
  *   4. MISRA C compliance check
- *   5. Execution test (if test-execution marker present)
+ *   5. Execution test (if test-execution marker present), repeated on the
+ *      amalgamated (--amalgamate) build, which must behave identically
  *
  * Execution testing:
  * - Add test-execution comment at top of .cnx file to enable
@@ -26,6 +27,11 @@
  *   npm test -- --jobs 4                  # Run with 4 parallel workers
  *   npm test -- --jobs 1                  # Run sequentially (no parallelism)
  *   npm test -- --transpile-only          # Transpile + snapshot comparison only (no compile/execute)
+ *   npm test -- --no-daemon               # Spawn the CLI per transpile (no resident transpiler)
+ *   npm test -- --daemon-parity           # Check resident transpiles against spawned ones
+ *   npm test -- --no-compile-cache        # Always compile/execute (no cached results)
+ *   npm test -- --no-dual-output          # Transpile C and C++ separately (no --dual-output)
+ *   npm test -- --no-amalgamation         # Skip the amalgamated (--amalgamate) execution pass
  *   npm test -- tests/enum                # Run specific directory
  *   npm test -- tests/enum/my.test.cnx    # Run single test file
  */
@@ -412,10 +418,20 @@ async function main(): Promise<void> {
   const updateMode = args.includes("--update") || args.includes("-u");
   const quietMode = args.includes("--quiet") || args.includes("-q");
   const transpileOnly = args.includes("--transpile-only");
+  const noDaemon = args.includes("--no-daemon");
+  const daemonParity = args.includes("--daemon-parity");
+  const noCompileCache = args.includes("--no-compile-cache");
+  const noDualOutput = args.includes("--no-dual-output");
+  const noAmalgamation = args.includes("--no-amalgamation");
 
   // Build test options
   const testOptions: ITestOptions = {
     transpileOnly,
+    noDaemon,
+    daemonParity,
+    noCompileCache,
+    noDualOutput,
+    noAmalgamation,
   };
 
   // Parse --jobs argument
@@ -486,6 +502,22 @@ async function main(): Promise<void> {
     } else {
       // Show available validation tools
       console.log(chalk.cyan(`Validation: ${tools.gcc ? "gcc" : "(no gcc)"}`));
+      if (noCompileCache) {
+        console.log(chalk.dim("Compile cache: disabled (full run)"));
+      }
+    }
+
+    // Show how the CLI is run
+    if (noDaemon) {
+      console.log(chalk.dim("Transpiler: spawned per test"));
+    } else if (daemonParity) {
+      console.log(chalk.cyan("Transpiler: resident, checked against spawn"));
+    }
+    if (noDualOutput) {
+      console.log(chalk.dim("C/C++ output: transpiled separately"));
+    }
+    if (noAmalgamation && !transpileOnly) {
+      console.log(chalk.dim("Amalgamated execution pass: disabled"));
     }
 
     // Show parallelism info
@@ -0,0 +1,163 @@
+/**
+ * Resident Transpiler for the Integration Test Runner
+ *
+ * Spawning `cnext` for every transpile pays Node startup, grammar loading
+ * and toolchain detection each time, thousands of times per `npm test`.
+ * TranspilerDaemon keeps one `cnext --serve` child per process (the main
+ * runner or a test worker) and sends each command line through its
+ * transpileFiles method, which runs the same Cli/Runner path as the binary
+ * (config loading, conflict checks, output paths) and returns the exit code
+ * and what it printed.
+ *
+ * If the child exits (e.g. yargs exiting on an invalid flag), pending
+ * requests are rejected and the next request starts a new child. The child
+ * is unreferenced while idle so it never keeps its parent alive.
+ */
+
+import { ChildProcess, spawn } from "node:child_process";
+import { createInterface } from "node:readline";
+
+/**
+ * Result of one command line run by the daemon
+ */
+interface ITranspileFilesResult {
+  exitCode: number;
+  stdout: string;
+  stderr: string;
+}
+
+interface IPendingRequest {
+  resolve: (result: ITranspileFilesResult) => void;
+  reject: (error: Error) => void;
+}
+
+/** Handles the child keeps open (child process and its stdio pipes) */
+interface IRefHandle {
+  ref(): void;
+  unref(): void;
+}
+
+class TranspilerDaemon {
+  private static instance: TranspilerDaemon | null = null;
+
+  private readonly child: ChildProcess;
+  private readonly pending = new Map<number, IPendingRequest>();
+  private nextId = 1;
+  private exitError: Error | null = null;
+
+  /**
+   * Shared daemon for this process, started on first use
+   * @param command - Executable and leading args of the CLI (node dist/index.js or npx tsx src/index.ts)
+   * @param cwd - Working directory relative paths resolve against
+   */
+  static shared(command: string[], cwd: string): TranspilerDaemon {
+    let daemon = TranspilerDaemon.instance;
+    if (daemon === null || daemon.exitError !== null) {
+      daemon = new TranspilerDaemon(command, cwd);
+      TranspilerDaemon.instance = daemon;
+    }
+    return daemon;
+  }
+
+  private constructor(command: string[], cwd: string) {
+    // Clear VITEST so the CLI's main() runs in the child
+    const cleanEnv = { ...process.env };
+    delete cleanEnv.VITEST;
+
+    this.child = spawn(command[0], [...command.slice(1), "--serve"], {
+      cwd,
+      env: cleanEnv,
+      stdio: ["pipe", "pipe", "ignore"],
+    });
+
+    createInterface({ input: this.child.stdout! }).on("line", (line) =>
+      this.handleResponse(line),
+    );
+    this.child.on("error", (error) => this.handleExit(error));
+    this.child.stdin!.on("error", (error) => this.handleExit(error));
+    this.child.on("exit", (code) =>
+      this.handleExit(new Error(`transpiler daemon exited with code ${code}`)),
+    );
+    this.setBusy(false);
+  }
+
+  /**
+   * Run a cnext command line (without "node cnext") in the daemon. A run
+   * that exceeds timeoutMs kills the daemon, like spawnSync's timeout.
+   */
+  transpileFiles(
+    args: string[],
+    timeoutMs: number,
+  ): Promise<ITranspileFilesResult> {
+    if (this.exitError !== null) {
+      return Promise.reject(this.exitError);
+    }
+    const id = this.nextId++;
+    return new Promise((resolve, reject) => {
+      const timer = setTimeout(() => this.child.kill(), timeoutMs);
+      timer.unref();
+      this.pending.set(id, {
+        resolve: (result) => {
+          clearTimeout(timer);
+          resolve(result);
+        },
+        reject: (error) => {
+          clearTimeout(timer);
+          reject(error);
+        },
+      });
+      this.setBusy(true);
+      const request = { id, method: "transpileFiles", params: { args } };
+      this.child.stdin!.write(`${JSON.stringify(request)}\n`);
+    });
+  }
+
+  private handleResponse(line: string): void {
+    let response: {
+      id?: number;
+      result?: ITranspileFilesResult;
+      error?: { message: string };
+    };
+    try {
+      response = JSON.parse(line);
+    } catch {
+      return; // Not a response (stray output)
+    }
+    const request = this.pending.get(response.id ?? -1);
+    if (!request) {
+      return;
+    }
+    this.pending.delete(response.id!);
+    this.setBusy(this.pending.size > 0);
+    if (response.result) {
+      request.resolve(response.result);
+    } else {
+      request.reject(new Error(response.error?.message ?? "no result"));
+    }
+  }
+
+  private handleExit(error: Error): void {
+    if (this.exitError !== null) {
+      return;
+    }
+    this.exitError = error;
+    for (const request of this.pending.values()) {
+      request.reject(error);
+    }
+    this.pending.clear();
+  }
+
+  /** Keep the parent alive only while requests are outstanding */
+  private setBusy(busy: boolean): void {
+    const handles = [this.child, this.child.stdin, this.child.stdout];
+    for (const handle of handles as unknown as IRefHandle[]) {
+      if (busy) {
+        handle.ref();
+      } else {
+        handle.unref();
+      }
+    }
+  }
+}
+
+export default TranspilerDaemon;
@@ -0,0 +1,16 @@
+/**
+ * Stored outcome of a compiler run (and, for test-execution tests, of
+ * running the binary it produced) in the integration test compile cache
+ */
+interface ICompileCacheEntry {
+  /** Compiler exit status (0 = compiled) */
+  status: number;
+  /** Compiler output (stderr, else stdout) when it failed */
+  diagnostics: string;
+  /** Exit code of the executable, for compile-and-run entries */
+  exitCode?: number;
+  /** Stdout of the executable, for compile-and-run entries */
+  stdout?: string;
+}
+
+export default ICompileCacheEntry;
@@ -0,0 +1,15 @@
+/**
+ * What an integration test compile cache key is computed from
+ */
+interface ICompileCacheInput {
+  compiler: string;
+  /** Compiler flags, excluding source files and the -o output path */
+  flags: string[];
+  sourceFiles: string[];
+  /** -I directories, searched for included headers */
+  includeDirs: string[];
+  /** Distinguishes compile-only from compile-and-run entries */
+  execute: boolean;
+}
+
+export default ICompileCacheInput;
@@ -5,9 +5,25 @@
  *   Useful as a fast local check. The full pipeline (transpile + compile + execute)
  *   is the default and is what CI runs, so every test-execution test is always
  *   re-transpiled in the same pass that compiles and runs it (Issue #1018).
+ * - noDaemon: Spawn a fresh CLI process per transpile instead of running the
+ *   command line in the process's resident `--serve` transpiler.
+ * - daemonParity: Also run every transpile in a fresh process and fail the
+ *   test if exit code, stderr or generated files differ from the resident run.
+ * - noCompileCache: Always run gcc/g++ and test executables instead of reusing
+ *   results cached for identical sources, headers, compiler and flags.
+ * - noDualOutput: Transpile C and C++ tests separately instead of once with
+ *   `--dual-output`.
+ * - noAmalgamation: Skip the amalgamated pass, which re-transpiles every
+ *   test-execution test with `--amalgamate` into one translation unit and
+ *   requires the same exit code and stdout as the per-file build.
  */
 interface ITestOptions {
   transpileOnly?: boolean;
+  noDaemon?: boolean;
+  daemonParity?: boolean;
+  noCompileCache?: boolean;
+  noDualOutput?: boolean;
+  noAmalgamation?: boolean;
 }
 
 export default ITestOptions;
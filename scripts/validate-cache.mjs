@@ -0,0 +1,180 @@
+/**
+ * Result cache for batch-validate.mjs.
+ *
+ * `validate:c` runs cppcheck, clang-tidy, the MISRA addon and flawfinder over
+ * thousands of generated files, and after a codegen change only a few of them
+ * differ. Every tool run is stored under a key made from:
+ *   - the tool and its `--version` line,
+ *   - its arguments (paths relative to the project root),
+ *   - the content hash of each input file, which covers the headers it
+ *     includes (resolved recursively next to the including file and in the
+ *     -I directories; unresolved names such as system headers are keyed by
+ *     name).
+ * Entries hold the raw exit status and output, not a verdict: the runner
+ * re-applies its failure rules (including the MISRA baseline) on every run,
+ * so editing misra-baseline.mjs takes effect without re-running cppcheck.
+ *
+ * The cache also records, per tool, the hash of every file that last passed,
+ * which is what `--changed-only` compares against.
+ */
+
+import { createHash } from "node:crypto";
+import { existsSync, mkdirSync, readFileSync, writeFileSync } from "node:fs";
+import { dirname, join, relative } from "node:path";
+
+// Bump when the entry format or key derivation changes
+const CACHE_VERSION = 1;
+
+const INCLUDE_REGEX = /^\s*#\s*include\s*([<"])([^>"]+)[>"]/gm;
+
+class ValidateCache {
+  /**
+   * @param {string} cachePath - JSON file holding the cache
+   * @param {string} rootDir - Project root; keys use paths relative to it
+   */
+  constructor(cachePath, rootDir) {
+    this.cachePath = cachePath;
+    this.rootDir = rootDir;
+    this.contentHashes = new Map();
+    this.usedKeys = new Set();
+
+    let stored = null;
+    try {
+      stored = JSON.parse(readFileSync(cachePath, "utf-8"));
+    } catch {
+      // Missing or unreadable cache: start empty
+    }
+    const valid = stored !== null && stored.version === CACHE_VERSION;
+    this.entries = valid ? stored.entries : {};
+    this.passed = valid ? stored.passed : {};
+  }
+
+  /**
+   * Hash of a file's content and of every header it reaches through
+   * #include. Quoted includes are looked up next to the including file
+   * first, then in includeDirs; angle includes only in includeDirs.
+   */
+  hashFile(file, includeDirs) {
+    const hash = createHash("sha256");
+    const visited = new Set([file]);
+    const queue = [file];
+
+    while (queue.length > 0) {
+      const current = queue.shift();
+      const content = readFileSync(current, "utf-8");
+      hash.update(`${this.relativize(current)}\0`);
+      hash.update(`${this.hashContent(current)}\0`);
+
+      for (const match of content.matchAll(INCLUDE_REGEX)) {
+        const [, delimiter, name] = match;
+        const searchDirs =
+          delimiter === '"' ? [dirname(current), ...includeDirs] : includeDirs;
+        const resolved = searchDirs
+          .map((dir) => join(dir, name))
+          .find((candidate) => existsSync(candidate));
+        const header = resolved ?? `<${name}>`;
+        if (visited.has(header)) {
+          continue;
+        }
+        visited.add(header);
+        if (resolved === undefined) {
+          hash.update(`${header}\0`);
+        } else {
+          queue.push(resolved);
+        }
+      }
+    }
+
+    return hash.digest("hex");
+  }
+
+  /**
+   * Cache key for one tool run
+   * @param {string} tool - Tool name as reported (e.g. "MISRA")
+   * @param {string} version - The tool's --version line
+   * @param {string[]} args - Full argv, including the input files
+   * @param {string[]} fileHashes - hashFile() of each input file
+   */
+  key(tool, version, args, fileHashes) {
+    const hash = createHash("sha256");
+    for (const part of [
+      tool,
+      version,
+      ...args.map((arg) => this.relativize(arg)),
+      ...fileHashes,
+    ]) {
+      hash.update(`${part}\0`);
+    }
+    return hash.digest("hex");
+  }
+
+  /** Stored { status, stdout, stderr } for key, or null */
+  get(key) {
+    const entry = this.entries[key];
+    if (entry === undefined) {
+      return null;
+    }
+    this.usedKeys.add(key);
+    return entry;
+  }
+
+  set(key, entry) {
+    this.entries[key] = entry;
+    this.usedKeys.add(key);
+  }
+
+  /** Files whose hash differs from the last time they passed with tool */
+  changedFiles(tool, files, hashes) {
+    const passed = this.passed[tool] ?? {};
+    return files.filter(
+      (file) => passed[this.relativize(file)] !== hashes.get(file),
+    );
+  }
+
+  /** Record that file (with this hash) passed tool */
+  recordPassed(tool, file, hash) {
+    this.passed[tool] ??= {};
+    this.passed[tool][this.relativize(file)] = hash;
+  }
+
+  /** Record that file failed tool, so --changed-only keeps selecting it */
+  recordFailed(tool, file) {
+    if (this.passed[tool] !== undefined) {
+      delete this.passed[tool][this.relativize(file)];
+    }
+  }
+
+  /**
+   * Write the cache, dropping entries of the tools that ran this time that
+   * were not used (stale results for outputs that have since changed).
+   * @param {string[]} ranTools - Tool names run this time
+   */
+  save(ranTools) {
+    const entries = {};
+    for (const [key, entry] of Object.entries(this.entries)) {
+      if (this.usedKeys.has(key) || !ranTools.includes(entry.tool)) {
+        entries[key] = entry;
+      }
+    }
+    mkdirSync(dirname(this.cachePath), { recursive: true });
+    writeFileSync(
+      this.cachePath,
+      JSON.stringify({ version: CACHE_VERSION, entries, passed: this.passed }),
+    );
+  }
+
+  hashContent(file) {
+    let hash = this.contentHashes.get(file);
+    if (hash === undefined) {
+      hash = createHash("sha256").update(readFileSync(file)).digest("hex");
+      this.contentHashes.set(file, hash);
+    }
+    return hash;
+  }
+
+  relativize(path) {
+    return path.startsWith(this.rootDir) ? relative(this.rootDir, path) : path;
+  }
+}
+
+export default ValidateCache;
@@ -18,6 +18,7 @@ interface IYargsResult {
   "header-out"?: string;
   "base-path"?: string;
   cpp: boolean;
+  "dual-output": boolean;
   include: string[];
   target?: string;
   D: string[];
@@ -31,6 +32,32 @@ interface IYargsResult {
   "pio-install": boolean;
   "pio-uninstall": boolean;
   serve: boolean;
+  "compact-enums": boolean;
+  "packed-bool-arrays": boolean;
+  "reorder-structs": boolean;
+  "reorder-struct": string[];
+  soa: string[];
+  "internal-linkage": boolean;
+  amalgamate?: string;
+  "shared-helpers": boolean;
+  "eliminate-dead-code": boolean;
+  "cmsis-dsp": boolean;
+  "switch-tables": boolean;
+  "branch-hints": boolean;
+  cold: string[];
+  hot: string[];
+  "static-vectors": boolean;
+  "isr-section"?: string;
+  "restrict-params": boolean;
+  "strength-reduce": boolean;
+  "stack-report": boolean;
+  "stack-size"?: number;
+  "memory-report": boolean;
+  "memory-json"?: string;
+  "memory-baseline"?: string;
+  configs?: string;
+  "layout-report": boolean;
+  "bounds-report": boolean;
 }
 
 /**
@@ -73,6 +100,11 @@ A safer C for embedded systems development.`,
         describe: "Output .cpp instead of .c (for C++ features like Serial)",
         default: false,
       })
+      .option("dual-output", {
+        type: "boolean",
+        describe: "Output both .c/.h and .cpp/.hpp from one analysis pass",
+        default: false,
+      })
       .option("include", {
         type: "string",
         array: true,
@@ -80,11 +112,141 @@ A safer C for embedded systems development.`,
         requiresArg: true,
         default: [] as string[],
       })
+      .option("internal-linkage", {
+        type: "boolean",
+        describe:
+          "Make default-visibility scope functions static and drop them from headers unless another C-Next file calls them",
+        default: false,
+      })
+      .option("amalgamate", {
+        type: "string",
+        describe: "Write the whole project as one translation unit to <file>",
+        requiresArg: true,
+      })
+      .option("shared-helpers", {
+        type: "boolean",
+        describe: "Emit overflow/division helpers once in cnx_runtime.h/.c",
+        default: false,
+      })
+      .option("eliminate-dead-code", {
+        type: "boolean",
+        describe:
+          "Drop scope functions/variables no root can reach; functions the header exports are roots, so mostly useful with --internal-linkage",
+        default: false,
+      })
+      .option("cmsis-dsp", {
+        type: "boolean",
+        describe: "Lower array arithmetic to CMSIS-DSP on DSP targets",
+        default: false,
+      })
+      .option("switch-tables", {
+        type: "boolean",
+        describe: "Lower dense value-mapping switches to lookup tables",
+        default: false,
+      })
+      .option("branch-hints", {
+        type: "boolean",
+        describe: "Mark overflow/division helper error branches unlikely",
+        default: false,
+      })
+      .option("cold", {
+        type: "string",
+        array: true,
+        describe: "Define a function with the cold attribute (can repeat)",
+        requiresArg: true,
+        default: [] as string[],
+      })
+      .option("hot", {
+        type: "string",
+        array: true,
+        describe: "Define a function with the hot attribute (can repeat)",
+        requiresArg: true,
+        default: [] as string[],
+      })
+      .option("static-vectors", {
+        type: "boolean",
+        describe: "Emit registers with ISR members as const vector tables",
+        default: false,
+      })
+      .option("isr-section", {
+        type: "string",
+        describe: "Linker section for bound interrupt handlers (e.g. ITCM)",
+        requiresArg: true,
+      })
+      .option("restrict-params", {
+        type: "boolean",
+        describe: "Qualify pointer parameters restrict where proven unaliased",
+        default: false,
+      })
+      .option("strength-reduce", {
+        type: "boolean",
+        describe: "Inline safe_div/safe_mod by constants as shifts and masks",
+        default: false,
+      })
+      .option("stack-report", {
+        type: "boolean",
+        describe: "Print worst-case stack usage per entry point",
+        default: false,
+      })
+      .option("stack-size", {
+        type: "number",
+        describe: "Warn when the worst-case stack exceeds <bytes>",
+        requiresArg: true,
+      })
+      .option("memory-report", {
+        type: "boolean",
+        describe: "Print static RAM/flash usage per file, scope and variable",
+        default: false,
+      })
+      .option("memory-json", {
+        type: "string",
+        describe: "Write the memory report as JSON to <file>",
+        requiresArg: true,
+      })
+      .option("memory-baseline", {
+        type: "string",
+        describe: "Compare the memory report with a --memory-json <file>",
+        requiresArg: true,
+      })
       .option("target", {
         type: "string",
         describe: "Target platform for atomic code gen (ADR-049)",
         requiresArg: true,
       })
+      .option("configs", {
+        type: "string",
+        describe: "Build each configuration in a JSON <file> from one parse",
+        requiresArg: true,
+      })
+      .option("compact-enums", {
+        type: "boolean",
+        describe: "Store enums in the smallest width that holds all values",
+        default: false,
+      })
+      .option("packed-bool-arrays", {
+        type: "boolean",
+        describe: "Store bool arrays as bit-packed uint32_t words",
+        default: false,
+      })
+      .option("reorder-structs", {
+        type: "boolean",
+        describe: "Reorder private scope struct fields to minimize padding",
+        default: false,
+      })
+      .option("reorder-struct", {
+        type: "string",
+        array: true,
+        describe: "Reorder the fields of one struct (can repeat)",
+        requiresArg: true,
+        default: [] as string[],
+      })
+      .option("soa", {
+        type: "string",
+        array: true,
+        describe: "Store arrays of a struct as one array per field (can repeat)",
+        requiresArg: true,
+        default: [] as string[],
+      })
       .option("D", {
         type: "string",
         array: true,
@@ -120,6 +282,16 @@ A safer C for embedded systems development.`,
         describe: "Generate panic-on-overflow helpers (ADR-044)",
         default: false,
       })
+      .option("layout-report", {
+        type: "boolean",
+        describe: "Print enum/struct sizes for the target",
+        default: false,
+      })
+      .option("bounds-report", {
+        type: "boolean",
+        describe: "Print array accesses not proven in bounds (ADR-054)",
+        default: false,
+      })
       .option("preprocess", {
         type: "boolean",
         describe:
@@ -164,12 +336,36 @@ Config files (searched in order, JSON format):
 
 Config options:
   cppRequired    Output .cpp instead of .c (boolean)
+  dualOutput     Output both .c/.h and .cpp/.hpp (boolean)
   noCache        Disable symbol caching (boolean)
   include        Additional include directories (string[])
   output         Output directory for generated files (string)
   headerOut      Separate directory for header files (string)
   target         Target platform for atomic code gen (string)
-  debugMode      Generate panic-on-overflow helpers (boolean)`,
+  debugMode      Generate panic-on-overflow helpers (boolean)
+  compactEnums   Smallest-width enum storage (boolean)
+  packedBoolArrays Bit-packed bool array storage (boolean)
+  reorderStructs Padding-minimizing order for private scope structs (boolean)
+  reorderedStructs Structs reordered even without reorderStructs (string[])
+  soaStructs     Structs whose arrays use struct-of-arrays storage (string[])
+  internalLinkage Whole-program static linkage for scope functions (boolean)
+  amalgamate     Single translation unit output file (string)
+  sharedHelpers  Project-wide cnx_runtime.h/.c helpers (boolean)
+  eliminateDeadCode Drop unreachable scope functions/variables; header-exported
+                 functions stay roots unless internalLinkage (boolean)
+  cmsisDsp       CMSIS-DSP array arithmetic on DSP targets (boolean)
+  switchTables   Lookup tables for value-mapping switches (boolean)
+  branchHints    Unlikely error branches in generated helpers (boolean)
+  coldFunctions  Functions defined with the cold attribute (string[])
+  hotFunctions   Functions defined with the hot attribute (string[])
+  staticVectors  Const vector tables for ISR register members (boolean)
+  isrSection     Linker section for bound interrupt handlers (string)
+  restrictParams restrict on pointer parameters no call site aliases (boolean)
+  strengthReduce Inline safe division by constant divisors (boolean)
+  stackSize      Stack size in bytes checked by --stack-report (number)
+  memoryBaseline Memory report JSON to diff against (string)
+  configs        Configurations built from one parse: [{ name, target?,
+                 defines? (-D syntax) }], output in <output>/<name> (array)`,
       )
 
       // Version from package.json
@@ -228,16 +424,7 @@ class ArgParser {
 
     const parsed = configureYargs(args, argv).parseSync() as IYargsResult;
 
-    // Parse -D defines into a record
-    const defines: Record<string, string | boolean> = {};
-    for (const define of parsed.D) {
-      const eqIndex = define.indexOf("=");
-      if (eqIndex > 0) {
-        defines[define.slice(0, eqIndex)] = define.slice(eqIndex + 1);
-      } else {
-        defines[define] = true;
-      }
-    }
+    const defines = this.parseDefines(parsed.D);
 
     // Get input files from positional args (everything that isn't an option)
     const inputFiles = parsed._.map(String);
@@ -248,6 +435,7 @@ class ArgParser {
       includeDirs: parsed.include,
       defines,
       cppRequired: parsed.cpp,
+      dualOutput: parsed["dual-output"],
       target: parsed.target,
       preprocess: parsed.preprocess,
       verbose: parsed.verbose,
@@ -261,8 +449,50 @@ class ArgParser {
       pioUninstall: parsed["pio-uninstall"],
       debugMode: parsed.debug,
       serveMode: parsed.serve,
+      compactEnums: parsed["compact-enums"],
+      packedBoolArrays: parsed["packed-bool-arrays"],
+      reorderStructs: parsed["reorder-structs"],
+      reorderedStructs: parsed["reorder-struct"],
+      soaStructs: parsed.soa,
+      internalLinkage: parsed["internal-linkage"],
+      amalgamate: parsed.amalgamate,
+      sharedHelpers: parsed["shared-helpers"],
+      eliminateDeadCode: parsed["eliminate-dead-code"],
+      cmsisDsp: parsed["cmsis-dsp"],
+      switchTables: parsed["switch-tables"],
+      branchHints: parsed["branch-hints"],
+      coldFunctions: parsed.cold,
+      hotFunctions: parsed.hot,
+      staticVectors: parsed["static-vectors"],
+      isrSection: parsed["isr-section"],
+      restrictParams: parsed["restrict-params"],
+      strengthReduce: parsed["strength-reduce"],
+      stackReport: parsed["stack-report"],
+      stackSize: parsed["stack-size"],
+      memoryReport: parsed["memory-report"],
+      memoryJson: parsed["memory-json"],
+      memoryBaseline: parsed["memory-baseline"],
+      layoutReport: parsed["layout-report"],
+      boundsReport: parsed["bounds-report"],
+      configsPath: parsed.configs,
     };
   }
+
+  /**
+   * Parse -D defines ("NAME" or "NAME=value") into a record
+   */
+  static parseDefines(defines: string[]): Record<string, string | boolean> {
+    const record: Record<string, string | boolean> = {};
+    for (const define of defines) {
+      const eqIndex = define.indexOf("=");
+      if (eqIndex > 0) {
+        record[define.slice(0, eqIndex)] = define.slice(eqIndex + 1);
+      } else {
+        record[define] = true;
+      }
+    }
+    return record;
+  }
 }
 
 export default ArgParser;
@@ -23,11 +23,12 @@ import IFileConfig from "./types/IFileConfig";
 class Cli {
   /**
    * Run the CLI
+   * @param argv - Command-line arguments (defaults to process.argv)
    * @returns CLI result with configuration for Runner if transpilation should run
    */
-  static run(): ICliResult {
+  static run(argv: string[] = process.argv): ICliResult {
     // Parse arguments (yargs handles --help and --version automatically)
-    const args = ArgParser.parse(process.argv);
+    const args = ArgParser.parse(argv);
 
     // Early exits for PlatformIO commands
     if (args.pioInstall) {
@@ -60,6 +61,13 @@ class Cli {
     // Merge CLI args with file config
     const config = this.mergeConfig(args, fileConfig);
 
+    // Multi-configuration build: --configs file, else the configs key
+    const configsError = this.resolveConfigurations(args, config);
+    if (configsError) {
+      console.error(`Error: ${configsError}`);
+      return { shouldRun: false, exitCode: 1 };
+    }
+
     // Handle --config: show effective configuration
     if (args.showConfig) {
       ConfigPrinter.showConfig(config, fileConfig);
@@ -125,16 +133,82 @@ class Cli {
       preprocess: args.preprocess,
       verbose: args.verbose,
       cppRequired: args.cppRequired || fileConfig.cppRequired || false,
+      dualOutput: args.dualOutput || fileConfig.dualOutput,
       noCache: args.noCache || fileConfig.noCache === true,
       parseOnly: args.parseOnly,
       headerOutDir: args.headerOutDir ?? fileConfig.headerOut,
       basePath: args.basePath ?? fileConfig.basePath,
       target: args.target ?? fileConfig.target,
       debugMode: args.debugMode || fileConfig.debugMode,
+      compactEnums: args.compactEnums || fileConfig.compactEnums,
+      packedBoolArrays: args.packedBoolArrays || fileConfig.packedBoolArrays,
+      reorderStructs: args.reorderStructs || fileConfig.reorderStructs,
+      reorderedStructs: [
+        ...(fileConfig.reorderedStructs ?? []),
+        ...(args.reorderedStructs ?? []),
+      ],
+      soaStructs: [
+        ...(fileConfig.soaStructs ?? []),
+        ...(args.soaStructs ?? []),
+      ],
+      internalLinkage: args.internalLinkage || fileConfig.internalLinkage,
+      amalgamate: args.amalgamate ?? fileConfig.amalgamate,
+      sharedHelpers: args.sharedHelpers || fileConfig.sharedHelpers,
+      eliminateDeadCode: args.eliminateDeadCode || fileConfig.eliminateDeadCode,
+      cmsisDsp: args.cmsisDsp || fileConfig.cmsisDsp,
+      switchTables: args.switchTables || fileConfig.switchTables,
+      branchHints: args.branchHints || fileConfig.branchHints,
+      coldFunctions: [
+        ...(fileConfig.coldFunctions ?? []),
+        ...(args.coldFunctions ?? []),
+      ],
+      hotFunctions: [
+        ...(fileConfig.hotFunctions ?? []),
+        ...(args.hotFunctions ?? []),
+      ],
+      staticVectors: args.staticVectors || fileConfig.staticVectors,
+      isrSection: args.isrSection ?? fileConfig.isrSection,
+      restrictParams: args.restrictParams || fileConfig.restrictParams,
+      strengthReduce: args.strengthReduce || fileConfig.strengthReduce,
+      layoutReport: args.layoutReport,
+      boundsReport: args.boundsReport,
+      stackReport: args.stackReport,
+      stackSize: args.stackSize ?? fileConfig.stackSize,
+      memoryReport: args.memoryReport,
+      memoryJson: args.memoryJson,
+      memoryBaseline: args.memoryBaseline ?? fileConfig.memoryBaseline,
+      configs: fileConfig.configs,
     };
 
     return PathNormalizer.normalizeConfig(rawConfig);
   }
+
+  /**
+   * Load (--configs) and check the configurations of a multi-configuration
+   * build into config.configs
+   * @returns Error message, or null
+   */
+  private static resolveConfigurations(
+    args: IParsedArgs,
+    config: ICliConfig,
+  ): string | null {
+    if (args.configsPath) {
+      try {
+        config.configs = ConfigLoader.loadConfigurations(
+          PathNormalizer.normalizePath(args.configsPath),
+        );
+      } catch (err) {
+        return err instanceof Error ? err.message : String(err);
+      }
+    }
+    if (config.configs === undefined) {
+      return null;
+    }
+    if (/\.(c|cpp)$/.test(config.outputPath)) {
+      return "configs write one output directory per configuration; -o must be a directory";
+    }
+    return ConfigLoader.validateConfigurations(config.configs);
+  }
 }
 
 export default Cli;
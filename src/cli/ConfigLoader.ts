@@ -3,8 +3,10 @@
  * Loads configuration from project config files using cosmiconfig
  */
 
+import { readFileSync } from "node:fs";
 import { cosmiconfigSync } from "cosmiconfig";
 import IFileConfig from "./types/IFileConfig";
+import IBuildConfiguration from "./types/IBuildConfiguration";
 
 /**
  * Load configuration from project directory
@@ -40,6 +42,50 @@ class ConfigLoader {
 
     return {}; // No config found
   }
+
+  /**
+   * Load the configurations of a multi-configuration build (--configs)
+   * @param path - JSON file holding an array of configurations
+   * @throws Error if the file cannot be read or parsed
+   */
+  static loadConfigurations(path: string): IBuildConfiguration[] {
+    try {
+      return JSON.parse(readFileSync(path, "utf-8"));
+    } catch (err) {
+      const message = err instanceof Error ? err.message : String(err);
+      throw new Error(`Failed to load configurations from ${path}: ${message}`);
+    }
+  }
+
+  /**
+   * Check the configurations of a multi-configuration build
+   * @returns Error message, or null if they are valid
+   */
+  static validateConfigurations(configs: unknown): string | null {
+    if (!Array.isArray(configs) || configs.length === 0) {
+      return "configs must be a non-empty array";
+    }
+    const names = new Set<string>();
+    for (const config of configs as Array<IBuildConfiguration | null>) {
+      const name: unknown = config?.name;
+      // Names become output subdirectories
+      if (typeof name !== "string" || !/^[\w.-]+$/.test(name)) {
+        return `Invalid configuration name: ${JSON.stringify(name)}`;
+      }
+      if (name === "." || name === ".." || names.has(name)) {
+        return `Invalid or duplicate configuration name: ${name}`;
+      }
+      names.add(name);
+      if (
+        config?.defines !== undefined &&
+        (!Array.isArray(config.defines) ||
+          config.defines.some((d) => typeof d !== "string"))
+      ) {
+        return `Configuration ${name}: defines must be an array of strings`;
+      }
+    }
+    return null;
+  }
 }
 
 export default ConfigLoader;
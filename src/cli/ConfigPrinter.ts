@@ -33,7 +33,46 @@ class ConfigPrinter {
     console.log("");
     console.log("  Config file:    " + (fileConfig._path ?? "(none)"));
     console.log("  cppRequired:    " + config.cppRequired);
+    console.log("  dualOutput:     " + (config.dualOutput ?? false));
     console.log("  debugMode:      " + (config.debugMode ?? false));
+    console.log("  compactEnums:   " + (config.compactEnums ?? false));
+    console.log("  packedBoolArrays: " + (config.packedBoolArrays ?? false));
+    console.log("  reorderStructs: " + (config.reorderStructs ?? false));
+    console.log(
+      "  reorderedStructs: " +
+        (config.reorderedStructs?.length
+          ? config.reorderedStructs.join(", ")
+          : "(none)"),
+    );
+    console.log(
+      "  soaStructs:     " +
+        (config.soaStructs?.length ? config.soaStructs.join(", ") : "(none)"),
+    );
+    console.log("  internalLinkage: " + (config.internalLinkage ?? false));
+    console.log("  amalgamate:     " + (config.amalgamate ?? "(none)"));
+    console.log("  sharedHelpers:  " + (config.sharedHelpers ?? false));
+    console.log("  eliminateDeadCode: " + (config.eliminateDeadCode ?? false));
+    console.log("  cmsisDsp:       " + (config.cmsisDsp ?? false));
+    console.log("  switchTables:   " + (config.switchTables ?? false));
+    console.log("  branchHints:    " + (config.branchHints ?? false));
+    console.log(
+      "  coldFunctions:  " +
+        (config.coldFunctions?.length
+          ? config.coldFunctions.join(", ")
+          : "(none)"),
+    );
+    console.log(
+      "  hotFunctions:   " +
+        (config.hotFunctions?.length
+          ? config.hotFunctions.join(", ")
+          : "(none)"),
+    );
+    console.log("  staticVectors:  " + (config.staticVectors ?? false));
+    console.log("  isrSection:     " + (config.isrSection ?? "(none)"));
+    console.log("  restrictParams: " + (config.restrictParams ?? false));
+    console.log("  strengthReduce: " + (config.strengthReduce ?? false));
+    console.log("  stackSize:      " + (config.stackSize ?? "(none)"));
+    console.log("  memoryBaseline: " + (config.memoryBaseline ?? "(none)"));
     console.log("  target:         " + (config.target ?? "(none)"));
     console.log("  noCache:        " + config.noCache);
     console.log("  preprocess:     " + config.preprocess);
@@ -57,6 +96,16 @@ class ConfigPrinter {
     for (const [key, value] of Object.entries(config.defines)) {
       console.log("    - " + key + (value === true ? "" : "=" + value));
     }
+    console.log(
+      "  configs:        " + (config.configs?.length ? "" : "(none)"),
+    );
+    for (const configuration of config.configs ?? []) {
+      const details = [
+        configuration.target && "target=" + configuration.target,
+        ...(configuration.defines ?? []).map((define) => "-D" + define),
+      ].filter(Boolean);
+      console.log("    - " + [configuration.name, ...details].join(" "));
+    }
     console.log("");
     console.log("Source:");
     console.log("  CLI flags take precedence over config file values");
@@ -162,6 +162,15 @@ class PathNormalizer {
       basePath: config.basePath
         ? this.normalizePath(config.basePath)
         : undefined,
+      amalgamate: config.amalgamate
+        ? this.normalizePath(config.amalgamate)
+        : undefined,
+      memoryJson: config.memoryJson
+        ? this.normalizePath(config.memoryJson)
+        : undefined,
+      memoryBaseline: config.memoryBaseline
+        ? this.normalizePath(config.memoryBaseline)
+        : undefined,
       includeDirs: this.normalizeIncludePaths(config.includeDirs, fs),
     };
   }
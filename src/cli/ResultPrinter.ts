@@ -3,7 +3,15 @@
  * Prints transpiler compilation results
  */
 
+import { basename } from "node:path";
 import ITranspilerResult from "../transpiler/types/ITranspilerResult";
+import ILayoutReportEntry from "../transpiler/types/ILayoutReportEntry";
+import IStackReportEntry from "../transpiler/types/IStackReportEntry";
+import IMemoryReportEntry from "../transpiler/types/IMemoryReportEntry";
+import IMemoryDiffEntry from "../transpiler/types/IMemoryDiffEntry";
+import IBoundsReportEntry from "../transpiler/types/IBoundsReportEntry";
+import StackReportBuilder from "../transpiler/output/codegen/analysis/StackReportBuilder";
+import MemoryReportBuilder from "../transpiler/output/codegen/analysis/MemoryReportBuilder";
 
 /**
  * Print transpiler compilation results
@@ -42,11 +50,182 @@ class ResultPrinter {
       for (const file of result.outputFiles) {
         console.log(`  ${file}`);
       }
+      if (result.layoutReport) {
+        this.printLayoutReport(result.layoutReport);
+      }
+      if (result.deadCode) {
+        this.printDeadCode(result.deadCode);
+      }
+      if (result.stackReport) {
+        this.printStackReport(result.stackReport);
+      }
+      if (result.memoryReport) {
+        this.printMemoryReport(result.memoryReport);
+      }
+      if (result.memoryDiff) {
+        this.printMemoryDiff(result.memoryDiff);
+      }
+      if (result.boundsReport) {
+        this.printBoundsReport(result.boundsReport);
+      }
     } else {
       console.error("");
       console.error("Compilation failed");
     }
   }
+
+  /**
+   * Print the functions and variables dead code elimination removed.
+   */
+  static printDeadCode(names: string[]): void {
+    console.log("");
+    console.log(`Removed ${names.length} unreachable symbol(s):`);
+    for (const name of names) {
+      console.log(`  ${name}`);
+    }
+  }
+
+  /**
+   * Print the worst-case stack per entry point with its deepest call path.
+   * "+?" marks paths with locals of unknown size.
+   */
+  static printStackReport(entries: IStackReportEntry[]): void {
+    console.log("");
+    console.log("Stack report (bytes, worst case):");
+    if (entries.length === 0) {
+      console.log("  (no entry points)");
+      return;
+    }
+    for (const entry of entries) {
+      const unknown = entry.isComplete ? "" : "+?";
+      console.log(
+        `  ${entry.name} (${basename(entry.sourcePath)}): ` +
+          `${entry.worstCase}${unknown}  ${entry.callPath.join(" -> ")}`,
+      );
+    }
+    if (entries.length > 1) {
+      const nested = StackReportBuilder.nestedWorstCase(entries);
+      console.log(`  with interrupt nesting: ${nested}`);
+    }
+  }
+
+  /**
+   * Print RAM/flash totals per file and scope, then one row per variable.
+   * "?" marks variables of unknown size (external C types).
+   */
+  static printMemoryReport(entries: IMemoryReportEntry[]): void {
+    const formatTotals = (group: IMemoryReportEntry[]): string => {
+      const totals = MemoryReportBuilder.totals(group);
+      return `RAM ${totals.ram}, flash ${totals.flash}`;
+    };
+
+    console.log("");
+    console.log("Memory report (bytes):");
+    if (entries.length === 0) {
+      console.log("  (no variables)");
+      return;
+    }
+    const files = MemoryReportBuilder.groupBy(entries, (e) => e.sourcePath);
+    for (const [sourcePath, fileEntries] of files) {
+      console.log(`  ${basename(sourcePath)}: ${formatTotals(fileEntries)}`);
+      const scopes = MemoryReportBuilder.groupBy(
+        fileEntries,
+        (e) => e.scope ?? "",
+      );
+      for (const [scope, scopeEntries] of scopes) {
+        let indent = "    ";
+        if (scope) {
+          console.log(`    ${scope}: ${formatTotals(scopeEntries)}`);
+          indent = "      ";
+        }
+        for (const entry of scopeEntries) {
+          console.log(
+            `${indent}${entry.name}: ${entry.size ?? "?"}, ` +
+              `align ${entry.align}, ${entry.section}`,
+          );
+        }
+      }
+    }
+    if (files.size > 1) {
+      console.log(`  total: ${formatTotals(entries)}`);
+    }
+  }
+
+  /**
+   * Print the variables whose size changed since the memory baseline.
+   */
+  static printMemoryDiff(changes: IMemoryDiffEntry[]): void {
+    console.log("");
+    console.log("Memory changes vs baseline (bytes):");
+    if (changes.length === 0) {
+      console.log("  (no changes)");
+      return;
+    }
+    const totals = { ram: 0, flash: 0 };
+    for (const change of changes) {
+      const delta = change.size - change.baselineSize;
+      const memory = change.isFlash ? "flash" : "RAM";
+      totals[change.isFlash ? "flash" : "ram"] += delta;
+      console.log(
+        `  ${change.name}: ${change.baselineSize} -> ${change.size} ` +
+          `(${ResultPrinter.formatDelta(delta)} ${memory})`,
+      );
+    }
+    console.log(
+      `  total: RAM ${ResultPrinter.formatDelta(totals.ram)}, ` +
+        `flash ${ResultPrinter.formatDelta(totals.flash)}`,
+    );
+  }
+
+  /**
+   * Print how many subscripts range analysis proved in bounds, then each
+   * one that still needs a runtime check with what was derived for it.
+   */
+  static printBoundsReport(entries: IBoundsReportEntry[]): void {
+    const unproven = entries.filter((entry) => !entry.isProven);
+    console.log("");
+    console.log(
+      `Bounds report: ${entries.length - unproven.length} of ` +
+        `${entries.length} array accesses proven in range`,
+    );
+    for (const entry of unproven) {
+      const size = entry.size ?? "?";
+      const range = entry.indexRange ?? "unknown";
+      console.log(
+        `  ${basename(entry.sourcePath)}:${entry.line}:${entry.column} ` +
+          `${entry.access}: index ${range}, size ${size}`,
+      );
+    }
+  }
+
+  private static formatDelta(delta: number): string {
+    return delta > 0 ? `+${delta}` : String(delta);
+  }
+
+  /**
+   * Print the layout-size report: one row per enum/struct with the
+   * default size ("before") next to the configured size ("after"), and the
+   * size reordering would reach when reorderStructs is off.
+   */
+  static printLayoutReport(entries: ILayoutReportEntry[]): void {
+    console.log("");
+    console.log("Layout report (bytes):");
+    if (entries.length === 0) {
+      console.log("  (no enums or structs)");
+      return;
+    }
+    for (const entry of entries) {
+      const padding = entry.padding > 0 ? `, ${entry.padding} padding` : "";
+      const reordered =
+        entry.reorderedSize === undefined
+          ? ""
+          : ` (${entry.reorderedSize} if reordered)`;
+      console.log(
+        `  ${entry.kind} ${entry.name} (${basename(entry.sourcePath)}): ` +
+          `${entry.defaultSize} -> ${entry.size}, align ${entry.align}${padding}${reordered}`,
+      );
+    }
+  }
 }
 
 export default ResultPrinter;
@@ -3,10 +3,13 @@
  * Executes the transpiler with the given configuration
  */
 
-import { basename, dirname, resolve } from "node:path";
+import { basename, dirname, join, resolve } from "node:path";
 import { existsSync, statSync, renameSync } from "node:fs";
 import Transpiler from "../transpiler/Transpiler";
+import ParseCache from "../transpiler/logic/parser/ParseCache";
+import ArgParser from "./ArgParser";
 import ICliConfig from "./types/ICliConfig";
+import IBuildConfiguration from "./types/IBuildConfiguration";
 import ResultPrinter from "./ResultPrinter";
 import ITranspilerResult from "../transpiler/types/ITranspilerResult";
 import InputExpansion from "../transpiler/data/InputExpansion";
@@ -22,33 +25,34 @@ interface IOutputPathResult {
  */
 class Runner {
   /**
-   * Execute the transpiler with the given configuration
+   * Execute the transpiler with the given configuration and exit with its
+   * status
    * @param config - CLI configuration
    */
   static async execute(config: ICliConfig): Promise<void> {
+    const result = await this.run(config);
+    process.exit(result.success ? 0 : 1);
+  }
+
+  /**
+   * Run the transpiler with the given configuration and print the result,
+   * without exiting (the serve mode transpileFiles method runs command lines
+   * through this in a resident process)
+   * @param config - CLI configuration
+   * @returns Transpiler result
+   */
+  static async run(config: ICliConfig): Promise<ITranspilerResult> {
+    if (config.configs) {
+      return this._runConfigurations(config, config.configs);
+    }
+
     const resolvedInput = resolve(config.input);
     const { outDir, explicitOutputFile } = this._determineOutputPath(
       config,
       resolvedInput,
     );
 
-    // Infer basePath from entry file's parent directory if not set
-    const basePath = config.basePath || dirname(resolvedInput);
-
-    const pipeline = new Transpiler({
-      input: resolvedInput,
-      includeDirs: config.includeDirs,
-      outDir,
-      headerOutDir: config.headerOutDir,
-      basePath,
-      preprocess: config.preprocess,
-      defines: config.defines,
-      cppRequired: config.cppRequired,
-      noCache: config.noCache,
-      parseOnly: config.parseOnly,
-      target: config.target,
-      debugMode: config.debugMode,
-    });
+    const pipeline = this._createTranspiler(config, resolvedInput, outDir);
 
     if (InputExpansion.isCppEntryPoint(resolvedInput)) {
       console.log(`Scanning ${basename(resolvedInput)} for C-Next includes...`);
@@ -63,7 +67,140 @@ class Runner {
     this._renameOutputIfNeeded(result, explicitOutputFile);
 
     ResultPrinter.print(result);
-    process.exit(result.success ? 0 : 1);
+    return result;
+  }
+
+  /**
+   * Multi-configuration build: transpile once per configuration into
+   * <output>/<name>, sharing .cnx and header parses between them (headers
+   * with #if expressions are still preprocessed per configuration).
+   * @returns All configurations' results combined
+   */
+  private static async _runConfigurations(
+    config: ICliConfig,
+    configurations: IBuildConfiguration[],
+  ): Promise<ITranspilerResult> {
+    const resolvedInput = resolve(config.input);
+    const { outDir } = this._determineOutputPath(config, resolvedInput);
+    const parseCache = new ParseCache();
+    // Files named by the user (not directories) move into the subdirectory
+    const perConfiguration = (
+      path: string | undefined,
+      name: string,
+    ): string | undefined =>
+      path ? join(dirname(path), name, basename(path)) : path;
+
+    const combined: ITranspilerResult = {
+      success: true,
+      files: [],
+      filesProcessed: 0,
+      symbolsCollected: 0,
+      conflicts: [],
+      errors: [],
+      warnings: [],
+      outputFiles: [],
+    };
+
+    for (const configuration of configurations) {
+      const { name } = configuration;
+      const pipeline = this._createTranspiler(
+        {
+          ...config,
+          defines: {
+            ...config.defines,
+            ...ArgParser.parseDefines(configuration.defines ?? []),
+          },
+          target: configuration.target ?? config.target,
+          headerOutDir: config.headerOutDir && join(config.headerOutDir, name),
+          amalgamate: perConfiguration(config.amalgamate, name),
+          memoryJson: perConfiguration(config.memoryJson, name),
+        },
+        resolvedInput,
+        join(outDir, name),
+        parseCache,
+      );
+
+      console.log(`Configuration ${name}:`);
+      const result = await pipeline.transpile({ kind: "files" });
+      ResultPrinter.print(result);
+      console.log("");
+
+      combined.success &&= result.success;
+      combined.files.push(...result.files);
+      combined.filesProcessed += result.filesProcessed;
+      combined.symbolsCollected += result.symbolsCollected;
+      combined.conflicts.push(...result.conflicts);
+      combined.errors.push(...result.errors);
+      combined.warnings.push(...result.warnings);
+      combined.outputFiles.push(...result.outputFiles);
+    }
+
+    const headers = parseCache.getHeaderSets();
+    console.log(
+      `Built ${configurations.length} configurations: ` +
+        `${headers.independent.length} headers shared, ` +
+        `${headers.dependent.length} preprocessed per configuration`,
+    );
+    return combined;
+  }
+
+  /**
+   * Transpiler for one run of the CLI configuration
+   * @param parseCache - Parses shared between configurations (--configs)
+   */
+  private static _createTranspiler(
+    config: ICliConfig,
+    resolvedInput: string,
+    outDir: string,
+    parseCache?: ParseCache,
+  ): Transpiler {
+    // Infer basePath from entry file's parent directory if not set
+    const basePath = config.basePath || dirname(resolvedInput);
+
+    return new Transpiler(
+      {
+        input: resolvedInput,
+        includeDirs: config.includeDirs,
+        outDir,
+        headerOutDir: config.headerOutDir,
+        basePath,
+        preprocess: config.preprocess,
+        defines: config.defines,
+        cppRequired: config.cppRequired,
+        dualOutput: config.dualOutput,
+        noCache: config.noCache,
+        parseOnly: config.parseOnly,
+        target: config.target,
+        debugMode: config.debugMode,
+        compactEnums: config.compactEnums,
+        packedBoolArrays: config.packedBoolArrays,
+        reorderStructs: config.reorderStructs,
+        reorderedStructs: config.reorderedStructs,
+        soaStructs: config.soaStructs,
+        internalLinkage: config.internalLinkage,
+        amalgamate: config.amalgamate,
+        sharedHelpers: config.sharedHelpers,
+        eliminateDeadCode: config.eliminateDeadCode,
+        cmsisDsp: config.cmsisDsp,
+        switchTables: config.switchTables,
+        branchHints: config.branchHints,
+        coldFunctions: config.coldFunctions,
+        hotFunctions: config.hotFunctions,
+        staticVectors: config.staticVectors,
+        isrSection: config.isrSection,
+        restrictParams: config.restrictParams,
+        strengthReduce: config.strengthReduce,
+        layoutReport: config.layoutReport,
+        boundsReport: config.boundsReport,
+        stackReport: config.stackReport,
+        stackSize: config.stackSize,
+        memoryReport: config.memoryReport,
+        memoryJson: config.memoryJson,
+        memoryBaseline: config.memoryBaseline,
+      },
+      undefined,
+      parseCache,
+    );
   }
 
   /**
@@ -95,6 +95,12 @@ describe("ArgParser", () => {
         expect(result.cppRequired).toBe(false);
       });
 
+      it("parses --dual-output flag", () => {
+        const result = ArgParser.parse(argv("input.cnx", "--dual-output"));
+
+        expect(result.dualOutput).toBe(true);
+      });
+
       it("parses single --include flag", () => {
         const result = ArgParser.parse(argv("input.cnx", "--include", "lib/"));
 
@@ -117,6 +123,14 @@ describe("ArgParser", () => {
         expect(result.target).toBe("teensy41");
       });
 
+      it("parses --configs flag", () => {
+        const result = ArgParser.parse(
+          argv("input.cnx", "--configs", "configs.json"),
+        );
+
+        expect(result.configsPath).toBe("configs.json");
+      });
+
       it("parses -D flag without value", () => {
         const result = ArgParser.parse(argv("input.cnx", "-D", "DEBUG"));
 
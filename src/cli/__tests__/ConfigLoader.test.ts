@@ -155,4 +155,43 @@ describe("ConfigLoader", () => {
       expect(config.basePath).toBe("src/");
     });
   });
+
+  describe("configurations", () => {
+    it("loads an array of configurations from a JSON file", () => {
+      const configs = [{ name: "teensy", target: "teensy41" }];
+      const path = join(tempDir, "configs.json");
+      writeFileSync(path, JSON.stringify(configs));
+
+      expect(ConfigLoader.loadConfigurations(path)).toEqual(configs);
+    });
+
+    it("throws with the path when the file cannot be loaded", () => {
+      const path = join(tempDir, "missing.json");
+
+      expect(() => ConfigLoader.loadConfigurations(path)).toThrow(path);
+    });
+
+    it("accepts named configurations with -D style defines", () => {
+      expect(
+        ConfigLoader.validateConfigurations([
+          { name: "teensy", target: "teensy41", defines: ["USE_CAN"] },
+          { name: "host-1.0", defines: ["LED_PIN=0"] },
+        ]),
+      ).toBeNull();
+    });
+
+    it("rejects empty, unnamed, unsafe or duplicate configurations", () => {
+      expect(ConfigLoader.validateConfigurations([])).toContain("non-empty");
+      expect(ConfigLoader.validateConfigurations([{}])).toContain("name");
+      expect(
+        ConfigLoader.validateConfigurations([{ name: "../out" }]),
+      ).toContain("name");
+      expect(
+        ConfigLoader.validateConfigurations([{ name: "a" }, { name: "a" }]),
+      ).toContain("duplicate");
+      expect(
+        ConfigLoader.validateConfigurations([{ name: "a", defines: "X" }]),
+      ).toContain("defines");
+    });
+  });
 });
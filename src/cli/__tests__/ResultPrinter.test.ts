@@ -198,6 +198,198 @@ describe("ResultPrinter", () => {
       expect(errorOutput).toContain("Error: 3:3 Error 3");
     });
 
+    it("prints layout report rows with before/after sizes", () => {
+      ResultPrinter.print(
+        createResult({
+          layoutReport: [
+            {
+              sourcePath: "/src/motor.cnx",
+              kind: "enum",
+              name: "State",
+              defaultSize: 4,
+              size: 1,
+              align: 1,
+              padding: 0,
+            },
+            {
+              sourcePath: "/src/motor.cnx",
+              kind: "struct",
+              name: "Motor",
+              defaultSize: 8,
+              size: 4,
+              align: 2,
+              padding: 1,
+            },
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain("Layout report (bytes):");
+      expect(logOutput).toContain("  enum State (motor.cnx): 4 -> 1, align 1");
+      expect(logOutput).toContain(
+        "  struct Motor (motor.cnx): 8 -> 4, align 2, 1 padding",
+      );
+    });
+
+    it("prints the reordered size when reordering would shrink a struct", () => {
+      ResultPrinter.print(
+        createResult({
+          layoutReport: [
+            {
+              sourcePath: "/src/packet.cnx",
+              kind: "struct",
+              name: "Packet",
+              defaultSize: 12,
+              size: 12,
+              align: 4,
+              padding: 6,
+              reorderedSize: 8,
+            },
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain(
+        "  struct Packet (packet.cnx): 12 -> 12, align 4, 6 padding (8 if reordered)",
+      );
+    });
+
+    it("omits layout report when not requested", () => {
+      ResultPrinter.print(createResult());
+
+      expect(logOutput).not.toContain("Layout report (bytes):");
+    });
+
+    it("prints stack report with call paths and nesting total", () => {
+      ResultPrinter.print(
+        createResult({
+          stackReport: [
+            {
+              name: "main",
+              sourcePath: "/src/main.cnx",
+              worstCase: 88,
+              callPath: ["main", "Motor_update"],
+              isComplete: true,
+            },
+            {
+              name: "SysTick_Handler",
+              sourcePath: "/src/main.cnx",
+              worstCase: 52,
+              callPath: ["SysTick_Handler"],
+              isComplete: false,
+            },
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain("Stack report (bytes, worst case):");
+      expect(logOutput).toContain(
+        "  main (main.cnx): 88  main -> Motor_update",
+      );
+      expect(logOutput).toContain(
+        "  SysTick_Handler (main.cnx): 52+?  SysTick_Handler",
+      );
+      expect(logOutput).toContain("  with interrupt nesting: 140");
+    });
+
+    it("prints memory report per file and scope", () => {
+      ResultPrinter.print(
+        createResult({
+          memoryReport: [
+            {
+              sourcePath: "/src/main.cnx",
+              scope: null,
+              name: "ticks",
+              size: 4,
+              align: 4,
+              section: "bss",
+            },
+            {
+              sourcePath: "/src/main.cnx",
+              scope: "Motor",
+              name: "Motor_table",
+              size: 16,
+              align: 2,
+              section: "rodata",
+            },
+            {
+              sourcePath: "/src/main.cnx",
+              scope: "Motor",
+              name: "Motor_handle",
+              size: null,
+              align: 0,
+              section: "data",
+            },
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain("Memory report (bytes):");
+      expect(logOutput).toContain("  main.cnx: RAM 4, flash 16");
+      expect(logOutput).toContain("    ticks: 4, align 4, bss");
+      expect(logOutput).toContain("    Motor: RAM 0, flash 16");
+      expect(logOutput).toContain("      Motor_table: 16, align 2, rodata");
+      expect(logOutput).toContain("      Motor_handle: ?, align 0, data");
+    });
+
+    it("prints memory changes against the baseline", () => {
+      ResultPrinter.print(
+        createResult({
+          memoryDiff: [
+            { name: "buffer", baselineSize: 64, size: 128, isFlash: false },
+            { name: "table", baselineSize: 32, size: 0, isFlash: true },
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain("Memory changes vs baseline (bytes):");
+      expect(logOutput).toContain("  buffer: 64 -> 128 (+64 RAM)");
+      expect(logOutput).toContain("  table: 32 -> 0 (-32 flash)");
+      expect(logOutput).toContain("  total: RAM +64, flash -32");
+    });
+
+    it("prints array accesses not proven in bounds", () => {
+      const access = (text: string, indexRange: string | null) => ({
+        sourcePath: "/src/main.cnx",
+        line: 12,
+        column: 8,
+        access: text,
+        size: 16,
+        isProven: indexRange === "0..15",
+        indexRange,
+      });
+      ResultPrinter.print(
+        createResult({
+          boundsReport: [
+            access("buf[i]", "0..15"),
+            access("buf[n]", "0..255"),
+            access("buf[f()]", null),
+          ],
+        }),
+      );
+
+      expect(logOutput).toContain(
+        "Bounds report: 1 of 3 array accesses proven in range",
+      );
+      expect(logOutput).toContain(
+        "  main.cnx:12:8 buf[n]: index 0..255, size 16",
+      );
+      expect(logOutput).toContain(
+        "  main.cnx:12:8 buf[f()]: index unknown, size 16",
+      );
+      expect(logOutput.join("\n")).not.toContain("buf[i]");
+    });
+
+    it("prints removed symbols after dead code elimination", () => {
+      ResultPrinter.print(
+        createResult({ deadCode: ["Math_cube", "Math_table"] }),
+      );
+
+      expect(logOutput).toContain("Removed 2 unreachable symbol(s):");
+      expect(logOutput).toContain("  Math_cube");
+      expect(logOutput).toContain("  Math_table");
+    });
+
     it("prints warnings, conflicts, and errors in order", () => {
       const allOutput: string[] = [];
       consoleWarnSpy.mockImplementation(((msg: string) =>
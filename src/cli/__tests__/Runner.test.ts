@@ -211,6 +211,59 @@ describe("Runner", () => {
       );
     });
 
+    it("run returns the result without exiting", async () => {
+      mockTranspilerInstance.transpile.mockResolvedValue({
+        success: false,
+        outputFiles: [],
+        errors: ["Some error"],
+      });
+
+      const result = await Runner.run(mockConfig);
+
+      expect(result.success).toBe(false);
+      expect(ResultPrinter.print).toHaveBeenCalledWith(result);
+      expect(processExitSpy).not.toHaveBeenCalled();
+    });
+
+    it("runs each configuration into its own output directory", async () => {
+      mockConfig.outputPath = "/project/build/";
+      mockConfig.defines = { LED_PIN: "13" };
+      mockConfig.configs = [
+        { name: "teensy", target: "teensy41", defines: ["USE_CAN"] },
+        { name: "host", defines: ["LED_PIN=0"] },
+      ];
+      mockTranspilerInstance.transpile.mockResolvedValue({
+        success: true,
+        files: [],
+        filesProcessed: 1,
+        symbolsCollected: 2,
+        conflicts: [],
+        errors: [],
+        warnings: [],
+        outputFiles: ["main.c"],
+      });
+
+      const result = await Runner.run(mockConfig);
+
+      const calls = vi.mocked(Transpiler).mock.calls;
+      expect(calls).toHaveLength(2);
+      expect(calls[0][0]).toMatchObject({
+        outDir: "/project/build/teensy",
+        target: "teensy41",
+        defines: { LED_PIN: "13", USE_CAN: true },
+      });
+      expect(calls[1][0]).toMatchObject({
+        outDir: "/project/build/host",
+        defines: { LED_PIN: "0" },
+      });
+      // Both runs share one parse cache
+      expect(calls[0][2]).toBeDefined();
+      expect(calls[1][2]).toBe(calls[0][2]);
+      expect(result.success).toBe(true);
+      expect(result.filesProcessed).toBe(2);
+      expect(result.outputFiles).toEqual(["main.c", "main.c"]);
+    });
+
     it("doesn't rename when generated file matches explicit path", async () => {
       mockConfig.outputPath = "/project/output/main.c";
 
@@ -0,0 +1,61 @@
+/**
+ * ConsoleCapture
+ * Collects what console.log/info/warn/error print while a call runs
+ *
+ * In serve mode stdout carries JSON-RPC responses, so CLI output produced
+ * for a transpileFiles request (ResultPrinter, Cli error messages) must be
+ * captured and returned instead of written. log/info go to stdout and
+ * warn/error to stderr, as Node's console does.
+ */
+
+import { format } from "node:util";
+
+/**
+ * Value of the call with the captured output
+ */
+interface ICapturedOutput<T> {
+  value: T;
+  stdout: string;
+  stderr: string;
+}
+
+type TConsoleMethod = "log" | "info" | "warn" | "error";
+
+const STDOUT_METHODS: TConsoleMethod[] = ["log", "info"];
+const STDERR_METHODS: TConsoleMethod[] = ["warn", "error"];
+
+class ConsoleCapture {
+  /**
+   * Run fn with console output redirected into strings. Calls must not
+   * overlap: the console is process-wide.
+   */
+  static async run<T>(fn: () => Promise<T>): Promise<ICapturedOutput<T>> {
+    const output = { stdout: "", stderr: "" };
+    const originals = new Map<TConsoleMethod, typeof console.log>();
+
+    const redirect = (
+      methods: TConsoleMethod[],
+      stream: "stdout" | "stderr",
+    ): void => {
+      for (const method of methods) {
+        originals.set(method, console[method]);
+        console[method] = (...args: unknown[]): void => {
+          output[stream] += `${format(...args)}\n`;
+        };
+      }
+    };
+
+    redirect(STDOUT_METHODS, "stdout");
+    redirect(STDERR_METHODS, "stderr");
+    try {
+      const value = await fn();
+      return { value, ...output };
+    } finally {
+      for (const [method, original] of originals) {
+        console[method] = original;
+      }
+    }
+  }
+}
+
+export default ConsoleCapture;
@@ -14,6 +14,9 @@ import IJsonRpcRequest from "./types/IJsonRpcRequest";
 import IJsonRpcResponse from "./types/IJsonRpcResponse";
 import ConfigPrinter from "../ConfigPrinter";
 import ConfigLoader from "../ConfigLoader";
+import Cli from "../Cli";
+import Runner from "../Runner";
+import ConsoleCapture from "./ConsoleCapture";
 import Transpiler from "../../transpiler/Transpiler";
 import parseWithSymbols from "../../lib/parseWithSymbols";
 import parseCHeader from "../../lib/parseCHeader";
@@ -59,6 +62,8 @@ class ServeCommand {
   private static readline: Interface | null = null;
   private static debugMode = false;
   private static transpiler: Transpiler | null = null;
+  /** Tail of the transpileFiles queue (captured console output is global) */
+  private static transpileFilesQueue: Promise<unknown> = Promise.resolve();
 
   /**
    * Method handlers registry
@@ -75,6 +80,7 @@ class ServeCommand {
     parseCHeader: ServeCommand._withSourceValidation(
       ServeCommand._handleParseCHeader,
     ),
+    transpileFiles: ServeCommand._handleTranspileFiles,
     shutdown: ServeCommand.handleShutdown,
   };
 
@@ -253,6 +259,20 @@ class ServeCommand {
       target: config.target ?? "",
       debugMode: config.debugMode ?? false,
       noCache: config.noCache ?? false,
+      compactEnums: config.compactEnums ?? false,
+      packedBoolArrays: config.packedBoolArrays ?? false,
+      reorderStructs: config.reorderStructs ?? false,
+      reorderedStructs: config.reorderedStructs ?? [],
+      soaStructs: config.soaStructs ?? [],
+      cmsisDsp: config.cmsisDsp ?? false,
+      switchTables: config.switchTables ?? false,
+      branchHints: config.branchHints ?? false,
+      coldFunctions: config.coldFunctions ?? [],
+      hotFunctions: config.hotFunctions ?? [],
+      staticVectors: config.staticVectors ?? false,
+      isrSection: config.isrSection ?? "",
+      restrictParams: config.restrictParams ?? false,
+      strengthReduce: config.strengthReduce ?? false,
     });
 
     ServeCommand.log(
@@ -372,6 +392,65 @@ class ServeCommand {
     };
   }
 
+  /**
+   * Handle transpileFiles method
+   * Runs a cnext command line (params.args, without "node cnext") through
+   * the same Cli and Runner path as the binary: config file loading, input
+   * checks, output paths, conflict detection and the printed result. Returns
+   * the exit code the binary would exit with and what it printed, so a
+   * resident server can stand in for spawning cnext per file. Relative paths
+   * resolve against the server's working directory. Requests run one at a
+   * time.
+   */
+  private static async _handleTranspileFiles(
+    params?: Record<string, unknown>,
+  ): Promise<IMethodResult> {
+    const args = params?.args;
+    if (
+      !Array.isArray(args) ||
+      args.length === 0 ||
+      !args.every((arg) => typeof arg === "string")
+    ) {
+      return {
+        success: false,
+        errorCode: JsonRpcHandler.ERROR_INVALID_PARAMS,
+        errorMessage: "Missing required param: args",
+      };
+    }
+
+    const run = ServeCommand.transpileFilesQueue.then(() =>
+      ConsoleCapture.run(() => ServeCommand._runCommandLine(args)),
+    );
+    ServeCommand.transpileFilesQueue = run.catch(() => undefined);
+    const { value: exitCode, stdout, stderr } = await run;
+
+    return {
+      success: true,
+      result: { exitCode, stdout, stderr },
+    };
+  }
+
+  /**
+   * Run one command line as src/index.ts would, returning its exit code
+   */
+  private static async _runCommandLine(args: string[]): Promise<number> {
+    try {
+      const cliResult = Cli.run(["node", "cnext", ...args]);
+      if (cliResult.serveMode) {
+        console.error("Error: --serve is not supported by transpileFiles");
+        return 1;
+      }
+      if (!cliResult.shouldRun || !cliResult.config) {
+        return cliResult.exitCode;
+      }
+      const result = await Runner.run(cliResult.config);
+      return result.success ? 0 : 1;
+    } catch (err: unknown) {
+      console.error("Unexpected error:", err);
+      return 1;
+    }
+  }
+
   /**
    * Handle shutdown method
    */
@@ -0,0 +1,38 @@
+/**
+ * Unit tests for ConsoleCapture
+ */
+
+import { describe, it, expect } from "vitest";
+import ConsoleCapture from "../ConsoleCapture";
+
+describe("ConsoleCapture", () => {
+  it("collects log/info as stdout and warn/error as stderr", async () => {
+    const captured = await ConsoleCapture.run(async () => {
+      console.log("Compiled %d files", 1);
+      console.info("info");
+      console.warn("Warning: unused");
+      console.error("Error:", "1:0 bad");
+      return 7;
+    });
+
+    expect(captured).toEqual({
+      value: 7,
+      stdout: "Compiled 1 files\ninfo\n",
+      stderr: "Warning: unused\nError: 1:0 bad\n",
+    });
+  });
+
+  it("restores the console when the call throws", async () => {
+    const originalLog = console.log;
+    const originalError = console.error;
+
+    await expect(
+      ConsoleCapture.run(async () => {
+        throw new Error("boom");
+      }),
+    ).rejects.toThrow("boom");
+
+    expect(console.log).toBe(originalLog);
+    expect(console.error).toBe(originalError);
+  });
+});
@@ -6,6 +6,9 @@
  */
 
 import { describe, it, expect, vi, beforeEach, afterEach } from "vitest";
+import { existsSync, mkdtempSync, rmSync, writeFileSync } from "node:fs";
+import { tmpdir } from "node:os";
+import { join } from "node:path";
 import ServeCommand from "../ServeCommand";
 import JsonRpcHandler from "../JsonRpcHandler";
 
@@ -347,6 +350,87 @@ describe("ServeCommand", () => {
     });
   });
 
+  describe("transpileFiles", () => {
+    let tempDir: string;
+
+    beforeEach(() => {
+      tempDir = mkdtempSync(join(tmpdir(), "cnext-serve-"));
+    });
+
+    afterEach(() => {
+      rmSync(tempDir, { recursive: true, force: true });
+    });
+
+    it("runs a command line and returns its exit code and output", async () => {
+      const input = join(tempDir, "main.cnx");
+      const output = join(tempDir, "out.c");
+      writeFileSync(input, "u32 counter <- 0;\n");
+
+      const response = await sendRequest({
+        id: 90,
+        method: "transpileFiles",
+        params: { args: [input, "-o", output, "--no-cache"] },
+      });
+
+      expect(response).toMatchObject({
+        id: 90,
+        result: { exitCode: 0, stderr: "" },
+      });
+      const result = (response as { result: { stdout: string } }).result;
+      expect(result.stdout).toContain("Compiled 1 files");
+      expect(result.stdout).toContain(output);
+      expect(existsSync(output)).toBe(true);
+    });
+
+    it("returns exit code 1 and the printed errors on failure", async () => {
+      const input = join(tempDir, "bad.cnx");
+      writeFileSync(input, "u32 counter <- ;\n");
+
+      const response = await sendRequest({
+        id: 91,
+        method: "transpileFiles",
+        params: { args: [input, "--no-cache"] },
+      });
+
+      expect(response).toMatchObject({ id: 91, result: { exitCode: 1 } });
+      const result = (response as { result: { stderr: string } }).result;
+      expect(result.stderr).toMatch(/^Error: /m);
+      expect(result.stderr).toContain("Compilation failed");
+    });
+
+    it("reports CLI input errors with the CLI exit code", async () => {
+      const response = await sendRequest({
+        id: 92,
+        method: "transpileFiles",
+        params: { args: [join(tempDir, "missing.cnx")] },
+      });
+
+      expect(response).toMatchObject({
+        id: 92,
+        result: {
+          exitCode: 1,
+          stderr: expect.stringContaining("Error: Input not found"),
+        },
+      });
+    });
+
+    it("returns error for missing args param", async () => {
+      const response = await sendRequest({
+        id: 93,
+        method: "transpileFiles",
+        params: { args: [] },
+      });
+
+      expect(response).toMatchObject({
+        id: 93,
+        error: {
+          code: JsonRpcHandler.ERROR_INVALID_PARAMS,
+          message: "Missing required param: args",
+        },
+      });
+    });
+  });
+
   describe("shutdown", () => {
     it("returns success", async () => {
       // Note: We can't fully test shutdown behavior because it closes the readline
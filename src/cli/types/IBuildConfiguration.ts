@@ -0,0 +1,15 @@
+/**
+ * One configuration of a multi-configuration build (--configs, or the
+ * `configs` key of the config file). Each configuration writes its output
+ * to a subdirectory named after it.
+ */
+interface IBuildConfiguration {
+  /** Output subdirectory name (e.g. "teensy41") */
+  name: string;
+  /** Target platform, overriding the shared target */
+  target?: string;
+  /** Defines added to the shared -D defines ("NAME" or "NAME=value") */
+  defines?: string[];
+}
+
+export default IBuildConfiguration;
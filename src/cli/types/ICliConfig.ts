@@ -1,3 +1,5 @@
+import IBuildConfiguration from "./IBuildConfiguration";
+
 /**
  * Merged CLI + file configuration for the transpiler
  *
@@ -19,6 +21,8 @@ interface ICliConfig {
   verbose: boolean;
   /** Force C++ output */
   cppRequired: boolean;
+  /** Write both .c/.h and .cpp/.hpp from one analysis */
+  dualOutput?: boolean;
   /** Disable symbol caching */
   noCache: boolean;
   /** Parse only mode */
@@ -31,6 +35,58 @@ interface ICliConfig {
   target?: string;
   /** Generate panic-on-overflow helpers */
   debugMode?: boolean;
+  /** Smallest-width enum storage */
+  compactEnums?: boolean;
+  /** Bit-packed bool array storage */
+  packedBoolArrays?: boolean;
+  /** Reorder private scope struct fields to minimize padding */
+  reorderStructs?: boolean;
+  /** Structs reordered regardless of reorderStructs */
+  reorderedStructs?: string[];
+  /** Structs whose arrays use struct-of-arrays storage */
+  soaStructs?: string[];
+  /** Whole-program internal linkage for scope functions */
+  internalLinkage?: boolean;
+  /** Single translation unit output file */
+  amalgamate?: string;
+  /** Project-wide helper header/source */
+  sharedHelpers?: boolean;
+  /** Reachability-based dead code elimination */
+  eliminateDeadCode?: boolean;
+  /** Array arithmetic through CMSIS-DSP */
+  cmsisDsp?: boolean;
+  /** Lookup tables for value-mapping switches */
+  switchTables?: boolean;
+  /** Unlikely error branches in generated helpers */
+  branchHints?: boolean;
+  /** Functions defined with the cold attribute */
+  coldFunctions?: string[];
+  /** Functions defined with the hot attribute */
+  hotFunctions?: string[];
+  /** Const vector tables for ISR register members */
+  staticVectors?: boolean;
+  /** Linker section for bound interrupt handlers */
+  isrSection?: string;
+  /** restrict on pointer parameters no call site aliases */
+  restrictParams?: boolean;
+  /** Safe division by constant divisors without helpers */
+  strengthReduce?: boolean;
+  /** Print worst-case stack report */
+  stackReport?: boolean;
+  /** Stack size to check the stack report against */
+  stackSize?: number;
+  /** Print static RAM/flash report */
+  memoryReport?: boolean;
+  /** Memory report JSON output file */
+  memoryJson?: string;
+  /** Memory report JSON to diff against */
+  memoryBaseline?: string;
+  /** Print enum/struct layout report */
+  layoutReport?: boolean;
+  /** Print array accesses range analysis could not prove in bounds */
+  boundsReport?: boolean;
+  /** Configurations built from one parse (--configs) */
+  configs?: IBuildConfiguration[];
 }
 
 export default ICliConfig;
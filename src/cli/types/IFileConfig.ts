@@ -1,3 +1,5 @@
+import IBuildConfiguration from "./IBuildConfiguration";
+
 /**
  * C-Next configuration file options
  *
@@ -7,6 +9,8 @@
 interface IFileConfig {
   /** Issue #211: Force C++ output. Auto-detection may also enable this. */
   cppRequired?: boolean;
+  /** Write both .c/.h and .cpp/.hpp from one analysis */
+  dualOutput?: boolean;
   /** Generate panic-on-overflow helpers */
   debugMode?: boolean;
   /** ADR-049: Target platform (e.g., "teensy41", "cortex-m0") */
@@ -21,6 +25,48 @@ interface IFileConfig {
   headerOut?: string;
   /** Base path to strip from header output paths (only used with headerOut) */
   basePath?: string;
+  /** Store enums in the smallest backing width that holds all values */
+  compactEnums?: boolean;
+  /** Store one-dimensional bool arrays as bit-packed uint32_t words */
+  packedBoolArrays?: boolean;
+  /** Reorder private scope struct fields to minimize padding (checked with static_assert) */
+  reorderStructs?: boolean;
+  /** Structs emitted in padding-minimizing order even without reorderStructs */
+  reorderedStructs?: string[];
+  /** Structs whose arrays are stored as one array per field */
+  soaStructs?: string[];
+  /** Emit scope functions no other file calls as static (whole program) */
+  internalLinkage?: boolean;
+  /** Write the whole project as one translation unit to this file */
+  amalgamate?: string;
+  /** Emit overflow/division helpers once in cnx_runtime.h/.c */
+  sharedHelpers?: boolean;
+  /** Drop scope functions and variables no root reaches (whole program) */
+  eliminateDeadCode?: boolean;
+  /** Lower whole-array arithmetic to CMSIS-DSP calls on DSP-capable targets */
+  cmsisDsp?: boolean;
+  /** Lower dense value-mapping switches to static const lookup tables */
+  switchTables?: boolean;
+  /** Mark overflow/division helper error branches CNX_UNLIKELY */
+  branchHints?: boolean;
+  /** Functions (Scope.fn) defined with the cold attribute */
+  coldFunctions?: string[];
+  /** Functions (Scope.fn) defined with the hot attribute */
+  hotFunctions?: string[];
+  /** Emit registers with ISR members as const .isr_vector tables */
+  staticVectors?: boolean;
+  /** Linker section for bound interrupt handlers (e.g. ".fastrun" ITCM) */
+  isrSection?: string;
+  /** Qualify pointer parameters of internal functions restrict when proven */
+  restrictParams?: boolean;
+  /** Inline safe_div/safe_mod/safe_divmod whose divisor is a constant */
+  strengthReduce?: boolean;
+  /** Stack size in bytes; --stack-report warns above it */
+  stackSize?: number;
+  /** Memory report JSON (--memory-json) that --memory-report diffs against */
+  memoryBaseline?: string;
+  /** Configurations built from one parse, one output subdirectory each */
+  configs?: IBuildConfiguration[];
   /** Internal: path to config file that was loaded (set by ConfigLoader) */
   _path?: string;
 }
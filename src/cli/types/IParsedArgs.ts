@@ -12,6 +12,8 @@ interface IParsedArgs {
   defines: Record<string, string | boolean>;
   /** --cpp flag */
   cppRequired?: boolean;
+  /** --dual-output flag */
+  dualOutput?: boolean;
   /** --target flag */
   target?: string;
   /** --no-preprocess flag (inverted: preprocess = true by default) */
@@ -38,6 +40,58 @@ interface IParsedArgs {
   debugMode: boolean;
   /** --serve flag */
   serveMode: boolean;
+  /** --compact-enums flag */
+  compactEnums?: boolean;
+  /** --packed-bool-arrays flag */
+  packedBoolArrays?: boolean;
+  /** --reorder-structs flag */
+  reorderStructs?: boolean;
+  /** --reorder-struct struct names */
+  reorderedStructs?: string[];
+  /** --soa struct names */
+  soaStructs?: string[];
+  /** --internal-linkage flag */
+  internalLinkage?: boolean;
+  /** --amalgamate output file */
+  amalgamate?: string;
+  /** --shared-helpers flag */
+  sharedHelpers?: boolean;
+  /** --eliminate-dead-code flag */
+  eliminateDeadCode?: boolean;
+  /** --cmsis-dsp flag */
+  cmsisDsp?: boolean;
+  /** --switch-tables flag */
+  switchTables?: boolean;
+  /** --branch-hints flag */
+  branchHints?: boolean;
+  /** --cold function names */
+  coldFunctions?: string[];
+  /** --hot function names */
+  hotFunctions?: string[];
+  /** --static-vectors flag */
+  staticVectors?: boolean;
+  /** --isr-section name */
+  isrSection?: string;
+  /** --restrict-params flag */
+  restrictParams?: boolean;
+  /** --strength-reduce flag */
+  strengthReduce?: boolean;
+  /** --stack-report flag */
+  stackReport?: boolean;
+  /** --stack-size bytes */
+  stackSize?: number;
+  /** --memory-report flag */
+  memoryReport?: boolean;
+  /** --memory-json output file */
+  memoryJson?: string;
+  /** --memory-baseline JSON file */
+  memoryBaseline?: string;
+  /** --layout-report flag */
+  layoutReport?: boolean;
+  /** --bounds-report flag */
+  boundsReport?: boolean;
+  /** --configs JSON file */
+  configsPath?: string;
 }
 
 export default IParsedArgs;
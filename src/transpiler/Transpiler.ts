@@ -16,12 +16,15 @@ import IFileSystem from "./types/IFileSystem";
 import NodeFileSystem from "./NodeFileSystem";
 
 import CNextSourceParser from "./logic/parser/CNextSourceParser";
+import ParseCache from "./logic/parser/ParseCache";
+import { ProgramContext } from "./logic/parser/grammar/CNextParser";
 import HeaderParser from "./logic/parser/HeaderParser";
 
 import CodeGenerator from "./output/codegen/CodeGenerator";
 import CodeGenState from "./state/CodeGenState";
 import HeaderGenerator from "./output/headers/HeaderGenerator";
 import ExternalTypeHeaderBuilder from "./output/headers/ExternalTypeHeaderBuilder";
+import AmalgamationBuilder from "./output/AmalgamationBuilder";
 import ICodeGenSymbols from "./types/ICodeGenSymbols";
 import IncludeExtractor from "./logic/IncludeExtractor";
 import SymbolTable from "./logic/symbols/SymbolTable";
@@ -52,18 +55,36 @@ import ParserUtils from "../utils/ParserUtils";
 import ITranspilerConfig from "./types/ITranspilerConfig";
 import ITranspilerResult from "./types/ITranspilerResult";
 import IFileResult from "./types/IFileResult";
+import ILayoutReportEntry from "./types/ILayoutReportEntry";
+import IStackFrame from "./types/IStackFrame";
+import IMemoryReportEntry from "./types/IMemoryReportEntry";
+import IBoundsReportEntry from "./types/IBoundsReportEntry";
+import IAmalgamationUnit from "./types/IAmalgamationUnit";
 import IPipelineFile from "./types/IPipelineFile";
+import IFileAnalysis from "./types/IFileAnalysis";
 import IPipelineInput from "./types/IPipelineInput";
 import TTranspileInput from "./types/TTranspileInput";
 import ITranspileError from "../lib/types/ITranspileError";
 import TranspilerState from "./state/TranspilerState";
 import runAnalyzers from "./logic/analysis/runAnalyzers";
 import ModificationAnalyzer from "./logic/analysis/ModificationAnalyzer";
+import InternalLinkageAnalyzer from "./logic/analysis/InternalLinkageAnalyzer";
+import DeadSymbolAnalyzer from "./logic/analysis/DeadSymbolAnalyzer";
 import CacheManager from "../utils/cache/CacheManager";
 import MapUtils from "../utils/MapUtils";
+import FunctionUtils from "../utils/FunctionUtils";
+import SymbolNameUtils from "./logic/symbols/cnext/utils/SymbolNameUtils";
 import detectCppSyntax from "./logic/detectCppSyntax";
 import TransitiveEnumCollector from "./logic/symbols/TransitiveEnumCollector";
 import TypedefParamParser from "./output/codegen/helpers/TypedefParamParser";
+import TypeLayoutCalculator from "./output/codegen/analysis/TypeLayoutCalculator";
+import StructLayoutHelper from "./output/codegen/helpers/StructLayoutHelper";
+import StackFrameEstimator from "./output/codegen/analysis/StackFrameEstimator";
+import StackReportBuilder from "./output/codegen/analysis/StackReportBuilder";
+import DeclarationLayoutResolver from "./output/codegen/analysis/DeclarationLayoutResolver";
+import MemoryFootprintEstimator from "./output/codegen/analysis/MemoryFootprintEstimator";
+import MemoryReportBuilder from "./output/codegen/analysis/MemoryReportBuilder";
+import helperGenerators from "./output/codegen/generators/support/HelperGenerator";
 
 /**
  * Unified transpiler
@@ -75,6 +96,8 @@ class Transpiler {
   private readonly headerGenerator: HeaderGenerator;
   private readonly warnings: string[];
   private readonly cacheManager: CacheManager | null;
+  /** Parses shared with the other configurations of a --configs build */
+  private readonly parseCache: ParseCache | null;
   /** Issue #211: Tracks if C++ output is needed (one-way flag, false → true only) */
   private cppDetected: boolean;
   /** Issue #587: Encapsulated state for accumulated Maps/Sets */
@@ -84,14 +107,47 @@ class Transpiler {
    * Accumulates parameter modifications and param lists across all processed files.
    */
   private readonly modificationAnalyzer = new ModificationAnalyzer();
+  /** Cross-file references for whole-program linkage (internalLinkage) */
+  private readonly linkageAnalyzer = new InternalLinkageAnalyzer();
+  /** Scope functions emitted static and left out of headers this run */
+  private internalFunctions: ReadonlySet<string> = new Set();
+  /** eliminateDeadCode: scope members (C names) no root reaches */
+  private readonly deadSymbolAnalyzer = new DeadSymbolAnalyzer();
+  private deadSymbols: ReadonlySet<string> = new Set();
+  /** Helpers already emitted into the amalgamated translation unit */
+  private amalgamationHelpers: Set<string> | undefined;
+  /** dualOutput: per-file analysis the C++ pass reuses */
+  private fileAnalyses: Map<string, IFileAnalysis> | undefined;
+  /** sharedHelpers: clamp/safe-div operations used anywhere in the run */
+  private runtimeClampOps: Set<string> | undefined;
+  private runtimeSafeDivOps: Set<string> | undefined;
   /** Issue #586: Centralized path resolution for output files */
   private readonly pathResolver: PathResolver;
   /** File system abstraction for testability */
   private readonly fs: IFileSystem;
+  /** Layout report rows accumulated per file (when layoutReport is enabled) */
+  private layoutEntries: ILayoutReportEntry[] = [];
+  /** Function frames accumulated per file (when stackReport is enabled) */
+  private stackFrames: IStackFrame[] = [];
+  /** Variable storage accumulated per file (when memoryReport is enabled) */
+  private memoryEntries: IMemoryReportEntry[] = [];
+  /** Array subscripts accumulated per file (when boundsReport is enabled) */
+  private boundsEntries: IBoundsReportEntry[] = [];
 
-  constructor(config: ITranspilerConfig, fs?: IFileSystem) {
+  /**
+   * @param config - Transpiler configuration
+   * @param fs - File system (defaults to Node.js)
+   * @param parseCache - Parses shared by the runs of a multi-configuration
+   *   build, one Transpiler per configuration
+   */
+  constructor(
+    config: ITranspilerConfig,
+    fs?: IFileSystem,
+    parseCache?: ParseCache,
+  ) {
     // Use injected file system or default to Node.js implementation
     this.fs = fs ?? new NodeFileSystem();
+    this.parseCache = parseCache ?? null;
     // Apply defaults
     this.config = {
       input: config.input,
@@ -102,11 +158,41 @@ class Transpiler {
       defines: config.defines ?? {},
       preprocess: config.preprocess ?? true,
       cppRequired: config.cppRequired ?? false,
+      dualOutput: config.dualOutput ?? false,
       parseOnly: config.parseOnly ?? false,
       debugMode: config.debugMode ?? false,
       target: config.target ?? "",
       collectGrammarCoverage: config.collectGrammarCoverage ?? false,
       noCache: config.noCache ?? false,
+      compactEnums: config.compactEnums ?? false,
+      packedBoolArrays: config.packedBoolArrays ?? false,
+      reorderStructs: config.reorderStructs ?? false,
+      reorderedStructs: config.reorderedStructs ?? [],
+      soaStructs: config.soaStructs ?? [],
+      internalLinkage: config.internalLinkage ?? false,
+      amalgamate: config.amalgamate ?? "",
+      sharedHelpers: config.sharedHelpers ?? false,
+      eliminateDeadCode: config.eliminateDeadCode ?? false,
+      cmsisDsp: config.cmsisDsp ?? false,
+      switchTables: config.switchTables ?? false,
+      branchHints: config.branchHints ?? false,
+      coldFunctions: config.coldFunctions ?? [],
+      hotFunctions: config.hotFunctions ?? [],
+      staticVectors: config.staticVectors ?? false,
+      isrSection: config.isrSection ?? "",
+      restrictParams: config.restrictParams ?? false,
+      strengthReduce: config.strengthReduce ?? false,
+      stackReport: config.stackReport ?? false,
+      stackSize: config.stackSize ?? 0,
+      // Writing or diffing the report implies collecting it
+      memoryReport:
+        (config.memoryReport ?? false) ||
+        !!config.memoryJson ||
+        !!config.memoryBaseline,
+      memoryJson: config.memoryJson ?? "",
+      memoryBaseline: config.memoryBaseline ?? "",
+      layoutReport: config.layoutReport ?? false,
+      boundsReport: config.boundsReport ?? false,
     };
 
     // Issue #211: Initialize cppDetected from config (--cpp flag sets this)
@@ -228,23 +314,123 @@ class Transpiler {
     // Stage 3b: Resolve external const array dimensions
     CodeGenState.symbolTable.resolveExternalArrayDimensions();
 
+    // Stage 3c: Whole-program linkage. Only files mode sees every caller;
+    // source mode transpiles one file without the files that include it.
+    // Default-visibility functions are exported through the header
+    // (ADR-016), so only the internalLinkage opt-in makes them static.
+    const isAmalgamating = !!this.config.amalgamate && input.writeOutputToDisk;
+    if (isAmalgamating) {
+      this.amalgamationHelpers = new Set();
+    }
+    if (this.config.internalLinkage && input.writeOutputToDisk) {
+      // One translation unit: every caller is in the same file
+      this.internalFunctions = isAmalgamating
+        ? this.linkageAnalyzer.getCandidateFunctions()
+        : this.linkageAnalyzer.getInternalFunctions();
+    }
+
+    // Stage 3d: Reachability from main, ISRs and the header API. Like
+    // linkage, it needs every file of the program (files mode only).
+    if (this.config.eliminateDeadCode && input.writeOutputToDisk) {
+      this.deadSymbols = this.deadSymbolAnalyzer.getDeadSymbols(
+        this.internalFunctions,
+      );
+      result.deadCode = [...this.deadSymbols].sort((a, b) =>
+        a.localeCompare(b),
+      );
+    }
+
+    // Helpers shared through cnx_runtime need a project to write them into
+    if (this.config.sharedHelpers && input.writeOutputToDisk) {
+      this.runtimeClampOps = new Set();
+      this.runtimeSafeDivOps = new Set();
+    }
+
     // Stage 4: Check for symbol conflicts
     if (!this._checkSymbolConflicts(result)) {
       return;
     }
 
+    // Stages 5-6 run once per output language: dualOutput adds a C++ pass
+    // that reuses the parse and analyzer results of the C pass
+    const dualOutput = this._isDualOutput(input, isAmalgamating);
+    this.fileAnalyses = dualOutput ? new Map() : undefined;
+    this._generateOutputs(input, result, isAmalgamating, true);
+    if (dualOutput && result.success) {
+      this.cppDetected = true;
+      this._useCppHeaderDirectives();
+      this._generateOutputs(input, result, isAmalgamating, false);
+      this.cppDetected = false;
+    }
+  }
+
+  /**
+   * Whether this run writes both .c/.h and .cpp/.hpp (dualOutput). Only
+   * files mode writes output, amalgamation writes a single file, and when
+   * the headers already force C++ there is no C output to pair with.
+   */
+  private _isDualOutput(
+    input: IPipelineInput,
+    isAmalgamating: boolean,
+  ): boolean {
+    if (!this.config.dualOutput || this.config.parseOnly) {
+      return false;
+    }
+    if (isAmalgamating) {
+      this.warnings.push(
+        "Warning: dualOutput is ignored with amalgamate (one output file)",
+      );
+      return false;
+    }
+    return input.writeOutputToDisk && !this.cppDetected;
+  }
+
+  /**
+   * Stages 5-6 for the current output language (this.cppDetected).
+   *
+   * @param primary - false for the C++ pass of a dual-output run, which
+   *   skips what does not depend on the language (reports, warnings and
+   *   the shared runtime helpers)
+   */
+  private _generateOutputs(
+    input: IPipelineInput,
+    result: ITranspilerResult,
+    isAmalgamating: boolean,
+    primary: boolean,
+  ): void {
     // Stage 5: Analyze and transpile each C-Next file
     for (const file of input.cnextFiles) {
       if (file.symbolOnly) {
         continue;
       }
 
-      const fileResult = this._transpileFile(file);
+      const fileResult = this._transpileFile(file, primary);
       this._recordFileResult(
         file.discoveredFile,
         fileResult,
         result,
-        input.writeOutputToDisk,
+        input.writeOutputToDisk && !isAmalgamating,
+        primary,
+      );
+    }
+
+    // Stage 5b: Join per-file output into one translation unit
+    if (result.success && isAmalgamating) {
+      this._writeAmalgamation(input.cnextFiles, result);
+    }
+
+    // Stage 5c: Write the project-wide helper header and source
+    if (
+      result.success &&
+      primary &&
+      this.runtimeClampOps &&
+      this.runtimeSafeDivOps
+    ) {
+      this._writeRuntimeHelpers(
+        input.cnextFiles,
+        this.runtimeClampOps,
+        this.runtimeSafeDivOps,
+        result,
       );
     }
 
@@ -254,6 +440,22 @@ class Transpiler {
     }
   }
 
+  /**
+   * Point the header directives of C-Next includes at the .hpp headers
+   * before the C++ pass of a dual-output run. Discovery stored them for C
+   * (IncludeResolver maps foo.cnx to foo.h outside C++ mode).
+   */
+  private _useCppHeaderDirectives(): void {
+    for (const [path, directive] of this.state.getAllHeaderDirectives()) {
+      if (/\.cnx$|\.cnext$/.test(path)) {
+        this.state.setHeaderDirective(
+          path,
+          directive.replace(/\.h([">])$/, ".hpp$1"),
+        );
+      }
+    }
+  }
+
   /**
    * Stage 3 for pipeline files: Collect symbols from all C-Next files.
    *
@@ -284,7 +486,7 @@ class Transpiler {
     file: IPipelineFile,
   ): ITranspileError[] | null {
     const content = file.source ?? this.fs.readFile(file.path);
-    const { tree, errors } = CNextSourceParser.parse(content);
+    const { tree, errors } = this._parseCNext(file.path, content);
 
     // Parse errors — return them with original line/column and sourcePath
     if (errors.length > 0) {
@@ -299,11 +501,19 @@ class Transpiler {
       CodeGenState.symbolTable.addTSymbols(tSymbols);
 
       // Issue #465: Store ICodeGenSymbols for external enum resolution in stage 5
-      const symbolInfo = TSymbolInfoAdapter.convert(tSymbols);
+      const symbolInfo = this._convertSymbols(tSymbols);
       this.state.setFileSymbolInfo(file.path, symbolInfo);
 
-      // Issue #593: Collect modification analysis in C++ mode
-      if (this.cppDetected) {
+      if (this.config.internalLinkage) {
+        this.linkageAnalyzer.collectFile(tree, file.path);
+      }
+      if (this.config.eliminateDeadCode) {
+        this.deadSymbolAnalyzer.collectFile(tree);
+      }
+
+      // Issue #593: Collect modification analysis in C++ mode (dualOutput
+      // may add a C++ pass after the C one)
+      if (this.cppDetected || this.config.dualOutput) {
         const results = this.codeGenerator.analyzeModificationsOnly(
           tree,
           this.modificationAnalyzer.getModifications(),
@@ -328,71 +538,51 @@ class Transpiler {
     return null;
   }
 
+  /**
+   * Parse a C-Next file, or reuse the parse of another configuration of a
+   * multi-configuration build
+   */
+  private _parseCNext(
+    path: string,
+    source: string,
+  ): ReturnType<typeof CNextSourceParser.parse> {
+    return this.parseCache
+      ? this.parseCache.parseCNext(path, source)
+      : CNextSourceParser.parse(source);
+  }
+
   /**
    * Stage 5: Transpile a single C-Next file.
    *
    * Assumes the symbol table is already populated (stages 2-3 complete).
    * Directly updates this.state and this.modificationAnalyzer.
+   *
+   * @param primary - false for the C++ pass of a dual-output run, which
+   *   reuses the file's analysis and does not collect reports again
    */
-  private _transpileFile(file: IPipelineFile): IFileResult {
+  private _transpileFile(file: IPipelineFile, primary: boolean): IFileResult {
     const sourcePath = file.path;
-    const source = file.source ?? this.fs.readFile(file.path);
 
     try {
-      // Parse source
-      const { tree, tokenStream, errors, declarationCount } =
-        CNextSourceParser.parse(source);
-
-      if (errors.length > 0) {
-        return this.buildErrorResult(sourcePath, errors, declarationCount);
-      }
-
-      // Parse only mode
-      if (this.config.parseOnly) {
-        return this.buildParseOnlyResult(sourcePath, declarationCount);
-      }
-
-      // Build symbolInfo for code generation (before analyzers so they can read it)
-      const tSymbols = CNextResolver.resolve(tree, sourcePath);
-      let symbolInfo = TSymbolInfoAdapter.convert(tSymbols);
-
-      // Merge enum info from included .cnx files
-      const externalEnumSources = this._collectExternalEnumSources(
-        sourcePath,
-        file.cnextIncludes,
-      );
-      if (externalEnumSources.length > 0) {
-        symbolInfo = TSymbolInfoAdapter.mergeExternalEnums(
-          symbolInfo,
-          externalEnumSources,
-        );
-      }
-
-      // Issue #948/#958: Merge truly opaque types from C/C++ headers
-      // Query-time resolution filters out types whose struct body has been found
-      const externalOpaqueTypes = CodeGenState.symbolTable
-        .getAllOpaqueTypes()
-        .filter((t) => CodeGenState.symbolTable.isOpaqueType(t));
-      if (externalOpaqueTypes.length > 0) {
-        symbolInfo = TSymbolInfoAdapter.mergeOpaqueTypes(
-          symbolInfo,
-          externalOpaqueTypes,
+      let analysis = this.fileAnalyses?.get(sourcePath);
+      if (analysis) {
+        // Generate against the callback typedefs the analyzers had found
+        // when this file was generated in the C pass
+        CodeGenState.callbackCompatibleFunctions = new Map(
+          analysis.callbackCompatibleFunctions,
         );
+      } else {
+        const analyzed = this._analyzeFile(file);
+        if (!("tree" in analyzed)) {
+          return analyzed;
+        }
+        analysis = analyzed;
+        this.fileAnalyses?.set(sourcePath, analysis);
       }
-
-      // Make symbols available to analyzers (CodeGenerator.generate() sets this too)
+      const { tree, tokenStream, declarationCount } = analysis;
+      const { localSymbolInfo, symbolInfo } = analysis;
       CodeGenState.symbols = symbolInfo;
 
-      // Run analyzers (reads symbols, externalStructFields, and symbolTable from CodeGenState)
-      const analyzerErrors = runAnalyzers(tree, tokenStream);
-      if (analyzerErrors.length > 0) {
-        return this.buildErrorResult(
-          sourcePath,
-          analyzerErrors,
-          declarationCount,
-        );
-      }
-
       // Inject cross-file modification data for const inference
       this._setupCrossFileModifications();
 
@@ -408,8 +598,29 @@ class Transpiler {
         cppMode: this.cppDetected,
         symbolInfo,
         sourceRelativePath,
+        compactEnums: this.config.compactEnums,
+        packedBoolArrays: this.config.packedBoolArrays,
+        soaStructs: this.config.soaStructs,
+        internalFunctions: this.internalFunctions,
+        deadSymbols: this.deadSymbols,
+        emittedHelpers: this.amalgamationHelpers,
+        sharedHelpers: this.runtimeClampOps !== undefined,
+        cmsisDsp: this.config.cmsisDsp,
+        switchTables: this.config.switchTables,
+        branchHints: this.config.branchHints,
+        coldFunctions: this.config.coldFunctions,
+        hotFunctions: this.config.hotFunctions,
+        staticVectors: this.config.staticVectors,
+        isrSection: this.config.isrSection,
+        restrictParams: this.config.restrictParams,
+        strengthReduce: this.config.strengthReduce,
+        boundsReport: this.config.boundsReport,
       });
 
+      if (primary) {
+        this._collectFileReports(tree, sourcePath, localSymbolInfo, symbolInfo);
+      }
+
       // Collect user includes
       const userIncludes = IncludeExtractor.collectUserIncludes(
         tree,
@@ -424,6 +635,10 @@ class Transpiler {
       this.state.setSymbolInfo(sourcePath, symbolInfo);
       this.state.setPassByValueParams(sourcePath, passByValueCopy);
       this.state.setUserIncludes(sourcePath, [...userIncludes]);
+      this.state.setTargetWordSize(
+        sourcePath,
+        CodeGenState.targetCapabilities.wordSize,
+      );
 
       // Accumulate C++ modifications directly
       if (this.cppDetected) {
@@ -444,6 +659,284 @@ class Transpiler {
     }
   }
 
+  /**
+   * Stage 5, up to code generation: parse, resolve symbols and run the
+   * analyzers.
+   *
+   * @returns The analysis, or the file's result when parsing or an analyzer
+   *   failed (or in parse-only mode)
+   */
+  private _analyzeFile(file: IPipelineFile): IFileAnalysis | IFileResult {
+    const sourcePath = file.path;
+    const source = file.source ?? this.fs.readFile(file.path);
+
+    // Parse source
+    const { tree, tokenStream, errors, declarationCount } = this._parseCNext(
+      sourcePath,
+      source,
+    );
+
+    if (errors.length > 0) {
+      return this.buildErrorResult(sourcePath, errors, declarationCount);
+    }
+
+    // Parse only mode
+    if (this.config.parseOnly) {
+      return this.buildParseOnlyResult(sourcePath, declarationCount);
+    }
+
+    // Build symbolInfo for code generation (before analyzers so they can read it)
+    const tSymbols = CNextResolver.resolve(tree, sourcePath);
+    const localSymbolInfo = this._convertSymbols(tSymbols);
+    let symbolInfo = localSymbolInfo;
+
+    // Merge enum info from included .cnx files
+    const externalEnumSources = this._collectExternalEnumSources(
+      sourcePath,
+      file.cnextIncludes,
+    );
+    if (externalEnumSources.length > 0) {
+      symbolInfo = TSymbolInfoAdapter.mergeExternalEnums(
+        symbolInfo,
+        externalEnumSources,
+      );
+    }
+
+    // Issue #948/#958: Merge truly opaque types from C/C++ headers
+    // Query-time resolution filters out types whose struct body has been found
+    const externalOpaqueTypes = CodeGenState.symbolTable
+      .getAllOpaqueTypes()
+      .filter((t) => CodeGenState.symbolTable.isOpaqueType(t));
+    if (externalOpaqueTypes.length > 0) {
+      symbolInfo = TSymbolInfoAdapter.mergeOpaqueTypes(
+        symbolInfo,
+        externalOpaqueTypes,
+      );
+    }
+
+    // Make symbols available to analyzers (CodeGenerator.generate() sets this too)
+    CodeGenState.symbols = symbolInfo;
+
+    // Run analyzers (reads symbols, externalStructFields, and symbolTable from CodeGenState)
+    const analyzerErrors = runAnalyzers(tree, tokenStream);
+    if (analyzerErrors.length > 0) {
+      return this.buildErrorResult(
+        sourcePath,
+        analyzerErrors,
+        declarationCount,
+      );
+    }
+
+    return {
+      tree,
+      tokenStream,
+      declarationCount,
+      localSymbolInfo,
+      symbolInfo,
+      callbackCompatibleFunctions: new Map(
+        CodeGenState.callbackCompatibleFunctions,
+      ),
+    };
+  }
+
+  /**
+   * Collect what the last generate() reported for one file (alias warnings,
+   * bounds entries, runtime helper ops) and the opt-in layout, stack and
+   * memory report entries.
+   */
+  private _collectFileReports(
+    tree: ProgramContext,
+    sourcePath: string,
+    localSymbolInfo: ICodeGenSymbols,
+    symbolInfo: ICodeGenSymbols,
+  ): void {
+    // restrictParams: call sites that kept parameters unqualified
+    this.warnings.push(...CodeGenState.aliasWarnings);
+    // boundsReport: subscripts range analysis checked in this file
+    this.boundsEntries.push(...CodeGenState.boundsEntries);
+
+    // sharedHelpers: the runtime files hold the union of all files' helpers
+    for (const op of CodeGenState.usedClampOps) {
+      this.runtimeClampOps?.add(op);
+    }
+    for (const op of CodeGenState.usedSafeDivOps) {
+      this.runtimeSafeDivOps?.add(op);
+    }
+
+    if (this.config.layoutReport) {
+      this._collectLayoutEntries(sourcePath, localSymbolInfo, symbolInfo);
+    }
+    if (this.config.stackReport) {
+      this.stackFrames.push(
+        ...StackFrameEstimator.estimate(
+          tree,
+          sourcePath,
+          this._createLayoutResolver(symbolInfo),
+        ),
+      );
+    }
+    if (this.config.memoryReport) {
+      this.memoryEntries.push(
+        ...MemoryFootprintEstimator.estimate(
+          tree,
+          sourcePath,
+          this._createLayoutResolver(symbolInfo),
+          this.deadSymbols,
+        ),
+      );
+    }
+  }
+
+  /**
+   * Convert one file's symbols for code generation and record which of its
+   * structs are emitted in padding-minimizing order.
+   */
+  private _convertSymbols(tSymbols: TSymbol[]): ICodeGenSymbols {
+    const symbolInfo = TSymbolInfoAdapter.convert(tSymbols);
+    return {
+      ...symbolInfo,
+      reorderedStructs: StructLayoutHelper.selectReordered(
+        symbolInfo,
+        this.config.reorderStructs,
+        this.config.reorderedStructs,
+      ),
+    };
+  }
+
+  /**
+   * Declaration sizes for the stack and memory reports of one file.
+   * Reads the const values and word size the code generator resolved.
+   */
+  private _createLayoutResolver(
+    symbolInfo: ICodeGenSymbols,
+  ): DeclarationLayoutResolver {
+    const { wordSize } = CodeGenState.targetCapabilities;
+    const layout = new TypeLayoutCalculator(symbolInfo, {
+      wordSize,
+      compactEnums: this.config.compactEnums,
+    });
+    return new DeclarationLayoutResolver({
+      layout,
+      wordSize,
+      constValues: CodeGenState.constValues,
+      packedBoolArrays: this.config.packedBoolArrays,
+    });
+  }
+
+  /**
+   * Attach the memory report, write it as JSON and diff it against the
+   * baseline. A missing or unreadable baseline is a warning, not an error.
+   */
+  private _finalizeMemoryReport(result: ITranspilerResult): void {
+    const entries = this.memoryEntries;
+    result.memoryReport = entries;
+
+    if (this.config.memoryJson) {
+      this.fs.writeFile(
+        this.config.memoryJson,
+        JSON.stringify(entries, null, 2) + "\n",
+      );
+    }
+    if (!this.config.memoryBaseline) {
+      return;
+    }
+    try {
+      const baseline = JSON.parse(
+        this.fs.readFile(this.config.memoryBaseline),
+      ) as IMemoryReportEntry[];
+      result.memoryDiff = MemoryReportBuilder.diff(baseline, entries);
+    } catch (err) {
+      const message = err instanceof Error ? err.message : String(err);
+      result.warnings.push(
+        `Cannot read memory baseline ${this.config.memoryBaseline}: ${message}`,
+      );
+    }
+  }
+
+  /**
+   * Build the stack report and warn when the combined worst case with
+   * interrupt nesting exceeds the configured stack size.
+   */
+  private _finalizeStackReport(result: ITranspilerResult): void {
+    const entries = StackReportBuilder.build(this.stackFrames);
+    result.stackReport = entries;
+
+    const nested = StackReportBuilder.nestedWorstCase(entries);
+    if (this.config.stackSize > 0 && nested > this.config.stackSize) {
+      result.warnings.push(
+        `Worst-case stack with interrupt nesting (${nested} bytes) exceeds stackSize (${this.config.stackSize} bytes)`,
+      );
+    }
+  }
+
+  /**
+   * Record enum and struct sizes defined in one file for the layout report.
+   * Uses the target word size resolved by the code generator for this file.
+   *
+   * @param localInfo - Symbols defined in this file (rows to report)
+   * @param symbolInfo - Merged symbols (to size included field types)
+   */
+  private _collectLayoutEntries(
+    sourcePath: string,
+    localInfo: ICodeGenSymbols,
+    symbolInfo: ICodeGenSymbols,
+  ): void {
+    const { wordSize } = CodeGenState.targetCapabilities;
+    const configured = new TypeLayoutCalculator(symbolInfo, {
+      wordSize,
+      compactEnums: this.config.compactEnums,
+    });
+    const reordering = new TypeLayoutCalculator(symbolInfo, {
+      wordSize,
+      compactEnums: this.config.compactEnums,
+      reorderFields: true,
+    });
+    const baseline = new TypeLayoutCalculator(symbolInfo, {
+      wordSize,
+      compactEnums: false,
+      declarationOrder: true,
+    });
+
+    for (const name of localInfo.knownEnums) {
+      const members = symbolInfo.enumMembers.get(name);
+      if (!members) {
+        continue;
+      }
+      const size = configured.getEnumSize(members);
+      this.layoutEntries.push({
+        sourcePath,
+        kind: "enum",
+        name,
+        defaultSize: baseline.defaultEnumSize,
+        size,
+        align: size,
+        padding: 0,
+      });
+    }
+
+    for (const name of localInfo.knownStructs) {
+      const layout = configured.getStructLayout(name);
+      const defaultLayout = baseline.getStructLayout(name);
+      if (!layout || !defaultLayout) {
+        continue;
+      }
+      const reordered = reordering.getStructLayout(name);
+      this.layoutEntries.push({
+        sourcePath,
+        kind: "struct",
+        name,
+        defaultSize: defaultLayout.size,
+        size: layout.size,
+        align: layout.align,
+        padding: layout.padding,
+        reorderedSize:
+          reordered && reordered.size < layout.size
+            ? reordered.size
+            : undefined,
+      });
+    }
+  }
+
   /**
    * Accumulate C++ modification data from the code generator into the
    * centralized modification analyzer.
@@ -597,8 +1090,20 @@ class Transpiler {
     }
     // Issue #593: Reset cross-file modification tracking for new run
     this.modificationAnalyzer.clear();
+    this.linkageAnalyzer.clear();
+    this.internalFunctions = new Set();
+    this.deadSymbolAnalyzer.clear();
+    this.deadSymbols = new Set();
+    this.amalgamationHelpers = undefined;
+    this.fileAnalyses = undefined;
+    this.runtimeClampOps = undefined;
+    this.runtimeSafeDivOps = undefined;
     // Issue #587: Reset accumulated state for new run
     this.state.reset();
+    this.layoutEntries = [];
+    this.stackFrames = [];
+    this.memoryEntries = [];
+    this.boundsEntries = [];
     // Issue #634: Reset symbol table for new run
     CodeGenState.symbolTable.clear();
     // Reset SymbolRegistry for new run (new IFunctionSymbol type system)
@@ -670,6 +1175,7 @@ class Transpiler {
     fileResult: IFileResult,
     result: ITranspilerResult,
     writeOutputToDisk: boolean,
+    primary: boolean = true,
   ): void {
     let outputPath: string | undefined;
     if (
@@ -683,7 +1189,10 @@ class Transpiler {
     }
 
     result.files.push({ ...fileResult, outputPath });
-    result.filesProcessed++;
+    // The C++ pass of a dual-output run emits the same files again
+    if (primary) {
+      result.filesProcessed++;
+    }
 
     if (!fileResult.success) {
       result.success = false;
@@ -698,6 +1207,80 @@ class Transpiler {
     }
   }
 
+  /**
+   * Stage 5b: Write the amalgamated translation unit (--amalgamate).
+   * Per-file sources are not written; headers still are (Stage 6) so C code
+   * can call the project's public functions.
+   */
+  private _writeAmalgamation(
+    cnextFiles: IPipelineFile[],
+    result: ITranspilerResult,
+  ): void {
+    const generatedFiles = cnextFiles.filter((f) => !f.symbolOnly);
+    const headerExt = this.cppDetected ? ".hpp" : ".h";
+    const headerName = (f: IPipelineFile): string =>
+      basename(f.path).replace(/\.cnx$|\.cnext$/, headerExt);
+    const projectHeaders = new Set(generatedFiles.map(headerName));
+    const codeByPath = new Map(result.files.map((f) => [f.sourcePath, f.code]));
+    const units: IAmalgamationUnit[] = generatedFiles.map((file) => ({
+      sourcePath: file.path,
+      headerCode: this.generateHeaderForFile(file),
+      headerName: headerName(file),
+      code: codeByPath.get(file.path) ?? "",
+    }));
+
+    const outputPath = resolve(this.config.amalgamate);
+    const outputDir = dirname(outputPath);
+    if (!this.fs.exists(outputDir)) {
+      this.fs.mkdir(outputDir, { recursive: true });
+    }
+    this.fs.writeFile(
+      outputPath,
+      AmalgamationBuilder.build(units, projectHeaders),
+    );
+    result.outputFiles.push(outputPath);
+  }
+
+  /**
+   * Stage 5c: Write cnx_runtime.h/.c (--shared-helpers) with one copy of
+   * every clamp and safe-div helper the project uses. The source goes to the
+   * output directory, the header next to the generated headers.
+   */
+  private _writeRuntimeHelpers(
+    cnextFiles: IPipelineFile[],
+    clampOps: ReadonlySet<string>,
+    safeDivOps: ReadonlySet<string>,
+    result: ITranspilerResult,
+  ): void {
+    if (clampOps.size === 0 && safeDivOps.size === 0) {
+      return;
+    }
+    const {
+      RUNTIME_NAME,
+      generateRuntimeHeader,
+      generateRuntimeSource,
+    } = helperGenerators;
+    // Without --out, output sits next to the sources
+    const sourceDir = this.config.outDir || dirname(cnextFiles[0].path);
+    const headerDir = this.config.headerOutDir || sourceDir;
+    const { debugMode, branchHints } = this.config;
+
+    const files: Array<[string, string]> = [
+      [
+        join(headerDir, `${RUNTIME_NAME}.h`),
+        generateRuntimeHeader(clampOps, safeDivOps, debugMode, branchHints),
+      ],
+      [
+        join(sourceDir, `${RUNTIME_NAME}.c`),
+        generateRuntimeSource(clampOps, safeDivOps, debugMode, branchHints),
+      ],
+    ];
+    for (const [path, content] of files) {
+      this.fs.writeFile(path, content);
+      result.outputFiles.push(path);
+    }
+  }
+
   /**
    * Stage 6: Generate headers for pipeline files
    */
@@ -734,6 +1317,18 @@ class Transpiler {
     }
     result.symbolsCollected = CodeGenState.symbolTable.size;
     result.warnings = [...result.warnings, ...this.warnings];
+    if (this.config.layoutReport) {
+      result.layoutReport = this.layoutEntries;
+    }
+    if (this.config.stackReport) {
+      this._finalizeStackReport(result);
+    }
+    if (this.config.memoryReport) {
+      this._finalizeMemoryReport(result);
+    }
+    if (this.config.boundsReport) {
+      result.boundsReport = this.boundsEntries;
+    }
 
     if (this.cacheManager) {
       await this.cacheManager.flush();
@@ -1063,8 +1658,13 @@ class Transpiler {
     const absolutePath = resolve(file.path);
     this.state.markHeaderProcessed(absolutePath);
 
+    // A multi-configuration build only shares cached symbols of headers
+    // that read the same in every configuration
+    const cacheable =
+      !this.parseCache || !this._readHeader(file).configDependent;
+
     // Check cache first
-    if (this.tryRestoreFromCache(file)) {
+    if (cacheable && this.tryRestoreFromCache(file)) {
       return; // Cache hit - skip full parsing
     }
 
@@ -1079,7 +1679,7 @@ class Transpiler {
     }
 
     // Issue #590: Cache the results using simplified API
-    if (this.cacheManager) {
+    if (this.cacheManager && cacheable) {
       this.cacheManager.setSymbolsFromTable(
         file.path,
         CodeGenState.symbolTable,
@@ -1139,7 +1739,7 @@ class Transpiler {
    * like #if MACRO != 0 that require expression evaluation.
    */
   private async getHeaderContent(file: IDiscoveredFile): Promise<string> {
-    const rawContent = this.fs.readFile(file.path);
+    const { content: rawContent, configDependent } = this._readHeader(file);
 
     // Check if preprocessing is disabled
     if (this.config.preprocess === false) {
@@ -1154,7 +1754,7 @@ class Transpiler {
     // Issue #945: Only preprocess if file has conditional compilation patterns
     // that require expression evaluation (e.g., #if MACRO != 0, #if MACRO == 1)
     // Simple #ifdef/#ifndef patterns are already handled by the parser
-    if (!this.needsConditionalPreprocessing(rawContent)) {
+    if (!configDependent) {
       return rawContent;
     }
 
@@ -1176,6 +1776,25 @@ class Transpiler {
     return result.content;
   }
 
+  /**
+   * Raw content of a header and whether it needs conditional preprocessing
+   * (so its symbols depend on the defines). Read once per multi-configuration
+   * build when there is a parse cache.
+   */
+  private _readHeader(file: IDiscoveredFile): {
+    content: string;
+    configDependent: boolean;
+  } {
+    const read = (): string => this.fs.readFile(file.path);
+    const isConfigDependent = (content: string): boolean =>
+      this.needsConditionalPreprocessing(content);
+    if (this.parseCache) {
+      return this.parseCache.getHeader(file.path, read, isConfigDependent);
+    }
+    const content = read();
+    return { content, configDependent: isConfigDependent(content) };
+  }
+
   /**
    * Check if a header file needs conditional preprocessing.
    * Issue #945: Only preprocess files with #if expressions that need evaluation.
@@ -1340,7 +1959,9 @@ class Transpiler {
    * ADR-055 Phase 7: Direct TCSymbol storage (no adapter conversion)
    */
   private parsePureCHeader(content: string, filePath: string): void {
-    const { tree } = HeaderParser.parseC(content);
+    const tree = this.parseCache
+      ? this.parseCache.parseCHeader(filePath, content)
+      : HeaderParser.parseC(content).tree;
     if (tree) {
       const result = CResolver.resolve(
         tree,
@@ -1357,7 +1978,9 @@ class Transpiler {
    * ADR-055 Phase 7: Direct TCppSymbol storage (no adapter conversion)
    */
   private parseCppHeader(content: string, filePath: string): void {
-    const { tree } = HeaderParser.parseCpp(content);
+    const tree = this.parseCache
+      ? this.parseCache.parseCppHeader(filePath, content)
+      : HeaderParser.parseCpp(content).tree;
     if (tree) {
       const result = CppResolver.resolve(
         tree,
@@ -1373,6 +1996,21 @@ class Transpiler {
   // Code Generation Helpers
   // ===========================================================================
 
+  /**
+   * internalLinkage: functions made static have no header prototype.
+   * eliminateDeadCode: dropped functions and variables have no declaration.
+   */
+  private _isOmittedFromHeader(symbol: TSymbol): boolean {
+    if (symbol.kind === "function") {
+      const cName = FunctionUtils.getTranspiledCName(symbol);
+      return this.internalFunctions.has(cName) || this.deadSymbols.has(cName);
+    }
+    if (symbol.kind === "variable") {
+      return this.deadSymbols.has(SymbolNameUtils.getTranspiledCName(symbol));
+    }
+    return false;
+  }
+
   /**
    * Stage 6: Generate header file for a C-Next file
    * ADR-055 Phase 7: Uses TSymbol directly, converts to IHeaderSymbol for generation.
@@ -1385,7 +2023,9 @@ class Transpiler {
   private generateHeaderForFile(file: IPipelineFile): string | null {
     const sourcePath = file.path;
     const tSymbols = CodeGenState.symbolTable.getTSymbolsByFile(sourcePath);
-    const exportedSymbols = tSymbols.filter((s) => s.isExported);
+    const exportedSymbols = tSymbols.filter(
+      (s) => s.isExported && !this._isOmittedFromHeader(s),
+    );
 
     if (exportedSymbols.length === 0) {
       return null;
@@ -1436,6 +2076,9 @@ class Transpiler {
         userIncludes,
         externalTypeHeaders,
         cppMode: this.cppDetected,
+        compactEnums: this.config.compactEnums,
+        packedBoolArrays: this.config.packedBoolArrays,
+        targetWordSize: this.state.getTargetWordSize(sourcePath),
       },
       typeInputWithSymbolTable,
       passByValueParams,
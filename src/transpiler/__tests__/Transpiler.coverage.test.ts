@@ -11,7 +11,13 @@
  */
 
 import { describe, it, expect, vi, beforeEach, afterEach } from "vitest";
-import { writeFileSync, mkdirSync, rmSync } from "node:fs";
+import {
+  writeFileSync,
+  mkdirSync,
+  rmSync,
+  existsSync,
+  readFileSync,
+} from "node:fs";
 import { join } from "node:path";
 import Transpiler from "../Transpiler";
 import MockFileSystem from "./MockFileSystem";
@@ -1232,6 +1238,123 @@ describe("Transpiler coverage integration tests", () => {
     expect(result.filesProcessed).toBe(2);
   });
 
+  it("writes one amalgamated translation unit", async () => {
+    const srcDir = join(testDir, "src");
+    mkdirSync(srcDir, { recursive: true });
+
+    writeFileSync(
+      join(srcDir, "main.cnx"),
+      '#include "lib.cnx"\nvoid main() { u32 x <- Math.twice(2); }',
+    );
+    writeFileSync(
+      join(srcDir, "lib.cnx"),
+      "scope Math { u32 twice(u32 a) { return a + a; } }",
+    );
+    const outputPath = join(testDir, "out", "app.c");
+
+    const transpiler = new Transpiler({
+      input: join(srcDir, "main.cnx"),
+      outDir: testDir,
+      noCache: true,
+      amalgamate: outputPath,
+    });
+
+    const result = await transpiler.transpile({ kind: "files" });
+
+    expect(result.success).toBe(true);
+    expect(result.outputFiles).toContain(outputPath);
+    expect(existsSync(join(testDir, "main.c"))).toBe(false);
+
+    const code = readFileSync(outputPath, "utf-8");
+    // Default-visibility functions stay exported (ADR-016)
+    expect(code).toContain("uint32_t Math_twice(");
+    expect(code).not.toContain("static uint32_t Math_twice(");
+    expect(readFileSync(join(testDir, "lib.h"), "utf-8")).toContain(
+      "Math_twice(",
+    );
+    expect(code).not.toContain('#include "lib.h"');
+    // Dependency order: the library comes before its caller
+    expect(code.indexOf("lib.cnx")).toBeLessThan(code.indexOf("main.cnx"));
+  });
+
+  it("makes amalgamated scope functions static with internalLinkage", async () => {
+    const srcDir = join(testDir, "src");
+    mkdirSync(srcDir, { recursive: true });
+
+    writeFileSync(
+      join(srcDir, "main.cnx"),
+      '#include "lib.cnx"\nvoid main() { u32 x <- Math.twice(2); }',
+    );
+    writeFileSync(
+      join(srcDir, "lib.cnx"),
+      "scope Math { u32 twice(u32 a) { return a + a; } }",
+    );
+    const outputPath = join(testDir, "out", "app.c");
+
+    const transpiler = new Transpiler({
+      input: join(srcDir, "main.cnx"),
+      outDir: testDir,
+      noCache: true,
+      amalgamate: outputPath,
+      internalLinkage: true,
+    });
+
+    const result = await transpiler.transpile({ kind: "files" });
+
+    expect(result.success).toBe(true);
+    expect(readFileSync(outputPath, "utf-8")).toContain(
+      "static uint32_t Math_twice(",
+    );
+  });
+
+  it("writes the memory report as JSON and diffs it against a baseline", async () => {
+    const srcDir = join(testDir, "src");
+    mkdirSync(srcDir, { recursive: true });
+    writeFileSync(
+      join(srcDir, "main.cnx"),
+      "u8[16] buffer;\nscope Motor { public const u16[2] table <- [1, 2]; }\nvoid main() { }",
+    );
+    const baselinePath = join(testDir, "baseline.json");
+    writeFileSync(
+      baselinePath,
+      JSON.stringify([
+        {
+          sourcePath: join(srcDir, "main.cnx"),
+          scope: null,
+          name: "buffer",
+          size: 8,
+          align: 1,
+          section: "bss",
+        },
+      ]),
+    );
+    const jsonPath = join(testDir, "memory.json");
+
+    const transpiler = new Transpiler({
+      input: join(srcDir, "main.cnx"),
+      outDir: testDir,
+      noCache: true,
+      memoryJson: jsonPath,
+      memoryBaseline: baselinePath,
+    });
+
+    const result = await transpiler.transpile({ kind: "files" });
+
+    expect(result.success).toBe(true);
+    const rows = result.memoryReport?.map((e) => [e.name, e.size, e.section]);
+    expect(rows).toEqual([
+      ["buffer", 16, "bss"],
+      ["Motor_table", 4, "rodata"],
+    ]);
+    expect(JSON.parse(readFileSync(jsonPath, "utf-8"))).toEqual(
+      result.memoryReport,
+    );
+    expect(result.memoryDiff).toEqual([
+      { name: "buffer", baselineSize: 8, size: 16, isFlash: false },
+      { name: "Motor_table", baselineSize: 0, size: 4, isFlash: true },
+    ]);
+  });
+
   // ==========================================================================
   // Cache hit C++ detection tests (covers lines 546-550)
   // ==========================================================================
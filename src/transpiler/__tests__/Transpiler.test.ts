@@ -373,6 +373,160 @@ describe("Transpiler", () => {
         expect(hFile?.content).toContain("Math_add");
       });
 
+      it("gives uncalled default-visibility scope functions internal linkage", async () => {
+        mockFs.addFile(
+          "/project/src/lib.cnx",
+          `
+            scope Math {
+              u32 twice(u32 a) { return a + a; }
+              public u32 quad(u32 a) { return this.twice(a) + this.twice(a); }
+            }
+          `,
+        );
+
+        const transpiler = new Transpiler(
+          {
+            input: "/project/src/lib.cnx",
+            outDir: "/project/build",
+            noCache: true,
+            internalLinkage: true,
+          },
+          mockFs,
+        );
+
+        const result = await transpiler.transpile({ kind: "files" });
+
+        expect(result.success).toBe(true);
+
+        const writeCalls = mockFs.getWriteLog();
+        const cFile = writeCalls.find((w) => w.path.endsWith(".c"));
+        const hFile = writeCalls.find((w) => w.path.endsWith(".h"));
+        expect(cFile?.content).toContain("static uint32_t Math_twice(");
+        expect(cFile?.content).not.toContain("static uint32_t Math_quad(");
+        expect(hFile?.content).not.toContain("Math_twice");
+        expect(hFile?.content).toContain("Math_quad");
+      });
+
+      it("writes clamp helpers once to cnx_runtime with sharedHelpers", async () => {
+        mockFs.addFile(
+          "/project/src/main.cnx",
+          `
+            u32 main() {
+              clamp u8 x <- 200;
+              x +<- 100;
+              return x;
+            }
+          `,
+        );
+
+        const transpiler = new Transpiler(
+          {
+            input: "/project/src/main.cnx",
+            outDir: "/project/build",
+            noCache: true,
+            sharedHelpers: true,
+          },
+          mockFs,
+        );
+
+        const result = await transpiler.transpile({ kind: "files" });
+
+        expect(result.success).toBe(true);
+
+        const writeCalls = mockFs.getWriteLog();
+        const mainC = writeCalls.find((w) => w.path.endsWith("main.c"));
+        const runtimeH = writeCalls.find((w) =>
+          w.path.endsWith("cnx_runtime.h"),
+        );
+        const runtimeC = writeCalls.find((w) =>
+          w.path.endsWith("cnx_runtime.c"),
+        );
+        expect(mainC?.content).toContain('#include "cnx_runtime.h"');
+        expect(mainC?.content).not.toContain("static inline");
+        expect(runtimeH?.content).toContain("cnx_clamp_add_u8(");
+        expect(runtimeC?.content).toContain("cnx_clamp_add_u8(");
+      });
+
+      it("writes C and C++ output from one run with dualOutput", async () => {
+        mockFs.addFile(
+          "/project/src/lib.cnx",
+          `
+            scope Math {
+              public u32 add(u32 a, u32 b) { return a + b; }
+            }
+          `,
+        );
+
+        const transpiler = new Transpiler(
+          {
+            input: "/project/src/lib.cnx",
+            outDir: "/project/build",
+            noCache: true,
+            dualOutput: true,
+          },
+          mockFs,
+        );
+
+        const result = await transpiler.transpile({ kind: "files" });
+
+        expect(result.success).toBe(true);
+        expect(result.filesProcessed).toBe(1);
+        const outputNames = result.outputFiles.map((f) => f.split("/").pop());
+        expect(outputNames.sort()).toEqual([
+          "lib.c",
+          "lib.cpp",
+          "lib.h",
+          "lib.hpp",
+        ]);
+
+        const writeCalls = mockFs.getWriteLog();
+        const cppFile = writeCalls.find((w) => w.path.endsWith("lib.cpp"));
+        const hppFile = writeCalls.find((w) => w.path.endsWith("lib.hpp"));
+        expect(cppFile?.content).toContain("Math_add");
+        expect(hppFile?.content).toContain("Math_add");
+        expect(transpiler.isCppDetected()).toBe(false);
+      });
+
+      it("drops scope functions and variables no root reaches", async () => {
+        mockFs.addFile(
+          "/project/src/main.cnx",
+          `
+            scope Math {
+              u32 calls;
+              u32 unused;
+              u32 twice(u32 a) { this.calls +<- 1; return a + a; }
+              u32 square(u32 a) { return a * a; }
+              private u32 cube(u32 a) { return a * a * a; }
+            }
+            u32 main() { return Math.twice(2); }
+          `,
+        );
+
+        const transpiler = new Transpiler(
+          {
+            input: "/project/src/main.cnx",
+            outDir: "/project/build",
+            noCache: true,
+            eliminateDeadCode: true,
+          },
+          mockFs,
+        );
+
+        const result = await transpiler.transpile({ kind: "files" });
+
+        expect(result.success).toBe(true);
+        expect(result.deadCode).toEqual(["Math_cube", "Math_unused"]);
+
+        const writeCalls = mockFs.getWriteLog();
+        const cFile = writeCalls.find((w) => w.path.endsWith(".c"));
+        expect(cFile?.content).toContain("Math_twice(");
+        expect(cFile?.content).toContain("Math_calls");
+        expect(cFile?.content).not.toContain("Math_cube");
+        expect(cFile?.content).not.toContain("Math_unused");
+        // Default-visibility functions stay in the header API (ADR-016)
+        expect(cFile?.content).toContain("Math_square(");
+      });
+
       it("returns no files for non-existent input", async () => {
         const transpiler = new Transpiler(
           {
@@ -0,0 +1,241 @@
+/**
+ * Dead Symbol Analyzer
+ * Project-wide reachability for dead code elimination (eliminateDeadCode)
+ *
+ * Builds a reference graph over every C-Next file of a run. Nodes are scope
+ * functions and scope variables (C names, e.g. `Math_square`); an edge is any
+ * mention of another node inside a node's definition: a call, a callback
+ * passed by name, a read or an assignment.
+ *
+ * Roots (always kept):
+ * - Top-level functions: main, ISR handlers, startup hooks
+ * - Scope members the generated header exports: functions that are not
+ *   `private` (public by default, ADR-016) and `public` variables, since
+ *   hand-written C may call them. Functions made static by the
+ *   internalLinkage opt-in are not exported and are not roots.
+ * - Anything referenced outside a scope member (e.g. global initializers)
+ *
+ * Because default-visibility functions are roots, without internalLinkage
+ * the pass can only drop private functions and non-public variables; the
+ * CLI help says so.
+ *
+ * Every node not reachable from a root is dead and can be dropped from the
+ * generated source and header. Callbacks are covered by the edges: a function
+ * handed to a callback parameter is kept exactly when its caller is.
+ *
+ * Bare identifiers inside a scope are counted as references to both the
+ * global and the scope member of that name, so the graph over-approximates
+ * and never drops a symbol that is used.
+ *
+ * Usage:
+ * - Call collectFile() for each C-Next file during symbol collection
+ * - Call getDeadSymbols() once all files are collected
+ * - Call clear() between transpilation runs
+ */
+
+import { ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../parser/grammar/CNextListener";
+import * as Parser from "../parser/grammar/CNextParser";
+import ScopeUtils from "../../../utils/ScopeUtils";
+
+/**
+ * Collects nodes and their references in one file.
+ */
+class ReferenceListener extends CNextListener {
+  /** Node C name -> true if it is a root */
+  readonly nodes: Map<string, boolean> = new Map();
+
+  /** Node C name -> names mentioned in its definition */
+  readonly edges: Map<string, Set<string>> = new Map();
+
+  /** Names mentioned outside any node */
+  readonly rootReferences: Set<string> = new Set();
+
+  private currentScope: string | null = null;
+
+  private currentNode: string | null = null;
+
+  override enterScopeDeclaration = (
+    ctx: Parser.ScopeDeclarationContext,
+  ): void => {
+    this.currentScope = ctx.IDENTIFIER().getText();
+  };
+
+  override exitScopeDeclaration = (): void => {
+    this.currentScope = null;
+  };
+
+  override enterScopeMember = (ctx: Parser.ScopeMemberContext): void => {
+    const name =
+      ctx.functionDeclaration()?.IDENTIFIER().getText() ??
+      ctx.variableDeclaration()?.IDENTIFIER().getText();
+    if (!name || !this.currentScope) {
+      return;
+    }
+    // ADR-016: header-exported members are part of the API
+    const visibility =
+      ctx.visibilityModifier()?.getText() ??
+      ScopeUtils.getDefaultVisibility(ctx.functionDeclaration() !== null);
+    this.enterNode(`${this.currentScope}_${name}`, visibility === "public");
+  };
+
+  override exitScopeMember = (): void => {
+    this.currentNode = null;
+  };
+
+  /**
+   * Top-level functions are roots; scope functions are handled above
+   */
+  override enterFunctionDeclaration = (
+    ctx: Parser.FunctionDeclarationContext,
+  ): void => {
+    if (!this.currentScope && !this.currentNode) {
+      this.enterNode(ctx.IDENTIFIER().getText(), true);
+    }
+  };
+
+  override exitFunctionDeclaration = (): void => {
+    if (!this.currentScope) {
+      this.currentNode = null;
+    }
+  };
+
+  /**
+   * x, this.x, Scope.x and global.Scope.x in expressions
+   */
+  override enterPostfixExpression = (
+    ctx: Parser.PostfixExpressionContext,
+  ): void => {
+    const primary = ctx.primaryExpression();
+    const ops = ctx.postfixOp();
+    const first = ops[0]?.IDENTIFIER()?.getText();
+    if (primary.IDENTIFIER()) {
+      this.addAccess(primary.IDENTIFIER()!.getText(), first);
+    } else if (primary.THIS() && first) {
+      this.addScopeMember(first);
+    } else if (primary.GLOBAL() && first) {
+      this.addAccess(first, ops[1]?.IDENTIFIER()?.getText());
+    }
+  };
+
+  /**
+   * The same forms as assignment targets
+   */
+  override enterAssignmentTarget = (
+    ctx: Parser.AssignmentTargetContext,
+  ): void => {
+    const name = ctx.IDENTIFIER().getText();
+    const member = ctx.postfixTargetOp()[0]?.IDENTIFIER()?.getText();
+    if (ctx.THIS()) {
+      this.addScopeMember(name);
+    } else {
+      this.addAccess(name, member);
+    }
+  };
+
+  private enterNode(name: string, isRoot: boolean): void {
+    this.currentNode = name;
+    this.nodes.set(name, isRoot);
+    if (!this.edges.has(name)) {
+      this.edges.set(name, new Set());
+    }
+  }
+
+  /**
+   * `name` or `name.member`: a global, a local, or Scope.member
+   */
+  private addAccess(name: string, member: string | undefined): void {
+    this.addReference(name);
+    if (member) {
+      this.addReference(`${name}_${member}`);
+    }
+    this.addScopeMember(name);
+  }
+
+  private addScopeMember(name: string): void {
+    if (this.currentScope) {
+      this.addReference(`${this.currentScope}_${name}`);
+    }
+  }
+
+  private addReference(name: string): void {
+    const target = this.currentNode
+      ? this.edges.get(this.currentNode)!
+      : this.rootReferences;
+    target.add(name);
+  }
+}
+
+/**
+ * Analyzer that finds scope functions and variables no root can reach.
+ */
+class DeadSymbolAnalyzer {
+  /** Node C name -> true if it is a root */
+  private readonly nodes: Map<string, boolean> = new Map();
+
+  /** Node C name -> names mentioned in its definition */
+  private readonly edges: Map<string, Set<string>> = new Map();
+
+  /** Names mentioned outside any node */
+  private readonly rootReferences: Set<string> = new Set();
+
+  /**
+   * Collect nodes and references from one file.
+   *
+   * @param tree - Parsed C-Next program
+   */
+  collectFile(tree: Parser.ProgramContext): void {
+    const listener = new ReferenceListener();
+    ParseTreeWalker.DEFAULT.walk(listener, tree);
+
+    for (const [name, isRoot] of listener.nodes) {
+      this.nodes.set(name, isRoot);
+    }
+    for (const [name, refs] of listener.edges) {
+      this.edges.set(name, refs);
+    }
+    for (const name of listener.rootReferences) {
+      this.rootReferences.add(name);
+    }
+  }
+
+  /**
+   * Get the C names of scope functions and variables no root reaches.
+   *
+   * @param internalFunctions - Functions made static by internalLinkage,
+   *   which the header no longer exports
+   */
+  getDeadSymbols(
+    internalFunctions: ReadonlySet<string> = new Set(),
+  ): Set<string> {
+    const reached = new Set<string>();
+    const pending = [...this.rootReferences];
+    for (const [name, isRoot] of this.nodes) {
+      if (isRoot && !internalFunctions.has(name)) {
+        pending.push(name);
+      }
+    }
+
+    while (pending.length > 0) {
+      const name = pending.pop()!;
+      if (reached.has(name) || !this.nodes.has(name)) {
+        continue;
+      }
+      reached.add(name);
+      pending.push(...(this.edges.get(name) ?? []));
+    }
+
+    return new Set([...this.nodes.keys()].filter((n) => !reached.has(n)));
+  }
+
+  /**
+   * Clear all accumulated state.
+   */
+  clear(): void {
+    this.nodes.clear();
+    this.edges.clear();
+    this.rootReferences.clear();
+  }
+}
+
+export default DeadSymbolAnalyzer;
@@ -23,6 +23,9 @@ import ExpressionUnwrapper from "../../../utils/ExpressionUnwrapper";
 const CNEXT_BUILTINS: Set<string> = new Set([
   "safe_div", // ADR-051: Safe division with default value
   "safe_mod", // ADR-051: Safe modulo with default value
+  "safe_divmod", // ADR-051: Quotient and remainder from one division
+  "likely", // Branch hint: if (likely(cond)), switch (likely(key, value))
+  "unlikely", // Branch hint: if (unlikely(cond))
 ]);
 
 /**
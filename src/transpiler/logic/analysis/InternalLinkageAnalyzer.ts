@@ -0,0 +1,166 @@
+/**
+ * Internal Linkage Analyzer
+ * Whole-program linkage inference for scope functions (internalLinkage option)
+ *
+ * Scope functions without a visibility modifier are public by default
+ * (ADR-016), so they get external linkage and a header prototype even when
+ * nothing outside their own file calls them. That keeps the C compiler from
+ * inlining or dropping them without LTO.
+ *
+ * This analyzer accumulates, across every C-Next file of a run:
+ * 1. Candidate functions: scope functions with default visibility
+ * 2. References: `Scope.member` and `global.Scope.member` expressions
+ *
+ * A candidate that no other file references can be emitted `static` and
+ * left out of its header. That changes the header contract of ADR-016, so
+ * the analysis only runs when internalLinkage is set: without it (including
+ * amalgamated builds) every default-visibility function stays external and
+ * keeps its header prototype. Explicitly `public` members and top-level
+ * functions (main, ISR handlers, startup hooks) always keep external linkage.
+ * Explicitly `private` scope functions need no analysis: ScopeGenerator
+ * always emits them `static` (ADR-016).
+ *
+ * Top-level functions and variables are not analyzed: C startup code and
+ * vector tables reference them by name, which no C-Next file shows.
+ *
+ * Usage:
+ * - Call collectFile() for each C-Next file during symbol collection
+ * - Call getInternalFunctions() (or getCandidateFunctions() for an
+ *   amalgamated build) once all files are collected
+ * - Call clear() between transpilation runs
+ */
+
+import { ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../parser/grammar/CNextListener";
+import * as Parser from "../parser/grammar/CNextParser";
+
+/**
+ * Collects candidate definitions and cross-scope references in one file.
+ */
+class LinkageListener extends CNextListener {
+  readonly candidates: Set<string> = new Set();
+
+  readonly references: Set<string> = new Set();
+
+  private currentScope: string | null = null;
+
+  override enterScopeDeclaration = (
+    ctx: Parser.ScopeDeclarationContext,
+  ): void => {
+    this.currentScope = ctx.IDENTIFIER().getText();
+  };
+
+  override exitScopeDeclaration = (): void => {
+    this.currentScope = null;
+  };
+
+  /**
+   * Scope functions relying on the default (public) visibility; explicit
+   * public keeps external linkage and explicit private is already static
+   */
+  override enterScopeMember = (ctx: Parser.ScopeMemberContext): void => {
+    const funcDecl = ctx.functionDeclaration();
+    if (!funcDecl || ctx.visibilityModifier() || !this.currentScope) {
+      return;
+    }
+    this.candidates.add(
+      `${this.currentScope}_${funcDecl.IDENTIFIER().getText()}`,
+    );
+  };
+
+  /**
+   * Scope.member and global.Scope.member
+   */
+  override enterPostfixExpression = (
+    ctx: Parser.PostfixExpressionContext,
+  ): void => {
+    const primary = ctx.primaryExpression();
+    const ops = ctx.postfixOp();
+    let scopeName: string | undefined;
+    let memberOp: Parser.PostfixOpContext | undefined;
+    if (primary.IDENTIFIER()) {
+      scopeName = primary.IDENTIFIER()!.getText();
+      memberOp = ops[0];
+    } else if (primary.GLOBAL()) {
+      scopeName = ops[0]?.IDENTIFIER()?.getText();
+      memberOp = ops[1];
+    }
+    const memberName = memberOp?.IDENTIFIER()?.getText();
+    if (scopeName && memberName) {
+      this.references.add(`${scopeName}_${memberName}`);
+    }
+  };
+}
+
+/**
+ * Analyzer that infers internal linkage for scope functions across files.
+ */
+class InternalLinkageAnalyzer {
+  /**
+   * Candidate function C name -> file that defines it.
+   */
+  private readonly candidates: Map<string, string> = new Map();
+
+  /**
+   * Referenced C name -> files that reference it.
+   */
+  private readonly references: Map<string, Set<string>> = new Map();
+
+  /**
+   * Collect candidates and references from one file.
+   *
+   * @param tree - Parsed C-Next program
+   * @param sourcePath - Path of the file the tree came from
+   */
+  collectFile(tree: Parser.ProgramContext, sourcePath: string): void {
+    const listener = new LinkageListener();
+    ParseTreeWalker.DEFAULT.walk(listener, tree);
+
+    for (const name of listener.candidates) {
+      this.candidates.set(name, sourcePath);
+    }
+    for (const name of listener.references) {
+      const files = this.references.get(name);
+      if (files) {
+        files.add(sourcePath);
+      } else {
+        this.references.set(name, new Set([sourcePath]));
+      }
+    }
+  }
+
+  /**
+   * Get the C names of candidate functions no other file references.
+   */
+  getInternalFunctions(): Set<string> {
+    const result = new Set<string>();
+    for (const [name, definingFile] of this.candidates) {
+      const files = this.references.get(name);
+      const isReferencedElsewhere =
+        files !== undefined && [...files].some((f) => f !== definingFile);
+      if (!isReferencedElsewhere) {
+        result.add(name);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Get the C names of all candidate functions. In an amalgamated build
+   * with internalLinkage every caller is in the same translation unit, so
+   * all of them qualify.
+   */
+  getCandidateFunctions(): Set<string> {
+    return new Set(this.candidates.keys());
+  }
+
+  /**
+   * Clear all accumulated state.
+   */
+  clear(): void {
+    this.candidates.clear();
+    this.references.clear();
+  }
+}
+
+export default InternalLinkageAnalyzer;
@@ -0,0 +1,539 @@
+/**
+ * Parameter Alias Analyzer
+ * Proves which pointer parameters can be restrict-qualified (restrictParams)
+ *
+ * Array, struct and string parameters are lowered to pointers, and C must
+ * assume any two of them alias. C-Next has no address-of operator and no
+ * pointer variables, so the storage an argument can refer to is its root
+ * variable: a local of the caller, a global or scope variable, or a
+ * parameter of the caller (which may refer to anything).
+ *
+ * Only functions whose every call site is in this file qualify: private
+ * scope functions and scope functions made static by internalLinkage, as
+ * long as they are never used as a callback. A parameter is proven when,
+ * at every call site, the root of its argument:
+ * 1. Differs from the roots of the other arguments
+ * 2. Is not a variable the callee, or a function of this file it calls,
+ *    accesses directly (a call leaving the file may access any of them)
+ * 3. Is not a caller parameter, unless the other arguments are locals of
+ *    the caller and the callee accesses no global variables
+ *
+ * Call sites that break the proof are reported as warnings.
+ */
+
+import { ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../parser/grammar/CNextListener";
+import * as Parser from "../parser/grammar/CNextParser";
+import ExpressionUnwrapper from "../../../utils/ExpressionUnwrapper";
+
+/** Access set entry for calls that leave the file */
+const ANY_GLOBAL = "*";
+
+/**
+ * Storage an argument refers to
+ */
+interface IStorageRoot {
+  /** Caller local, global/scope variable (C name) or caller parameter */
+  kind: "local" | "global" | "param";
+  name: string;
+}
+
+/**
+ * A function definition of this file
+ */
+interface IFunctionInfo {
+  /** C name (Scope_fn) */
+  cName: string;
+  /** Source name for messages (Scope.fn) */
+  displayName: string;
+  scope: string | null;
+  params: string[];
+  locals: Set<string>;
+  /** Private, or static through internalLinkage */
+  isInternal: boolean;
+}
+
+/**
+ * A direct call to a function of this file
+ */
+interface ICallSite {
+  callee: string;
+  caller: IFunctionInfo | null;
+  args: Parser.ExpressionContext[];
+  line: number;
+}
+
+/**
+ * A resolved name: what it refers to and the first postfix op after it
+ */
+interface IResolvedName {
+  root: IStorageRoot;
+  next: number;
+}
+
+function globalName(name: string, next: number): IResolvedName {
+  return { root: { kind: "global", name }, next };
+}
+
+/**
+ * Analysis result
+ */
+interface IParameterAliasResult {
+  /** Function C name -> parameters proven free of aliasing */
+  restrictParams: Map<string, Set<string>>;
+  /** Call sites that keep parameters from being restrict-qualified */
+  warnings: string[];
+}
+
+/**
+ * First pass: scopes, scope variables, functions and their locals
+ */
+class DeclarationListener extends CNextListener {
+  private currentScope: string | null = null;
+
+  private currentFunction: IFunctionInfo | null = null;
+
+  constructor(
+    private readonly analyzer: ParameterAliasAnalyzer,
+    private readonly internalFunctions: ReadonlySet<string>,
+  ) {
+    super();
+  }
+
+  override enterScopeDeclaration = (
+    ctx: Parser.ScopeDeclarationContext,
+  ): void => {
+    this.currentScope = ctx.IDENTIFIER().getText();
+    this.analyzer.scopes.add(this.currentScope);
+  };
+
+  override exitScopeDeclaration = (): void => {
+    this.currentScope = null;
+  };
+
+  override enterScopeMember = (ctx: Parser.ScopeMemberContext): void => {
+    const variable = ctx.variableDeclaration();
+    if (variable) {
+      this.analyzer.scopeVariables.add(
+        `${this.currentScope}_${variable.IDENTIFIER().getText()}`,
+      );
+    }
+  };
+
+  override enterFunctionDeclaration = (
+    ctx: Parser.FunctionDeclarationContext,
+  ): void => {
+    const name = ctx.IDENTIFIER().getText();
+    const scope = this.currentScope;
+    const cName = scope ? `${scope}_${name}` : name;
+    const member = ctx.parent;
+    const isPrivate =
+      member instanceof Parser.ScopeMemberContext &&
+      member.visibilityModifier()?.getText() === "private";
+
+    this.currentFunction = {
+      cName,
+      displayName: scope ? `${scope}.${name}` : name,
+      scope,
+      params: (ctx.parameterList()?.parameter() ?? []).map((p) =>
+        p.IDENTIFIER().getText(),
+      ),
+      locals: new Set(),
+      isInternal: isPrivate || this.internalFunctions.has(cName),
+    };
+    this.analyzer.functions.set(cName, this.currentFunction);
+  };
+
+  override exitFunctionDeclaration = (): void => {
+    this.currentFunction = null;
+  };
+
+  override enterVariableDeclaration = (
+    ctx: Parser.VariableDeclarationContext,
+  ): void => {
+    this.currentFunction?.locals.add(ctx.IDENTIFIER().getText());
+  };
+
+  override enterForVarDecl = (ctx: Parser.ForVarDeclContext): void => {
+    this.currentFunction?.locals.add(ctx.IDENTIFIER().getText());
+  };
+}
+
+/**
+ * Second pass: call sites, callbacks and direct variable accesses
+ */
+class ReferenceListener extends CNextListener {
+  private currentFunction: IFunctionInfo | null = null;
+
+  constructor(private readonly analyzer: ParameterAliasAnalyzer) {
+    super();
+  }
+
+  override enterFunctionDeclaration = (
+    ctx: Parser.FunctionDeclarationContext,
+  ): void => {
+    const scope = ParameterAliasAnalyzer.getEnclosingScope(ctx);
+    const name = ctx.IDENTIFIER().getText();
+    this.currentFunction =
+      this.analyzer.functions.get(scope ? `${scope}_${name}` : name) ?? null;
+  };
+
+  override exitFunctionDeclaration = (): void => {
+    this.currentFunction = null;
+  };
+
+  override enterPostfixExpression = (
+    ctx: Parser.PostfixExpressionContext,
+  ): void => {
+    this.analyzer.visitPostfix(ctx, this.currentFunction);
+  };
+
+  override enterAssignmentTarget = (
+    ctx: Parser.AssignmentTargetContext,
+  ): void => {
+    this.analyzer.visitTarget(ctx, this.currentFunction);
+  };
+}
+
+/**
+ * Analyzer that proves restrict-qualified parameters for one file.
+ */
+class ParameterAliasAnalyzer {
+  readonly scopes: Set<string> = new Set();
+
+  /** Scope variables by C name (Scope_var) */
+  readonly scopeVariables: Set<string> = new Set();
+
+  readonly functions: Map<string, IFunctionInfo> = new Map();
+
+  private readonly callSites: ICallSite[] = [];
+
+  /** Functions used as a value (callbacks): call sites unknown */
+  private readonly escaped: Set<string> = new Set();
+
+  /** Function -> global roots it accesses, ANY_GLOBAL for outside calls */
+  private readonly accesses: Map<string, Set<string>> = new Map();
+
+  /** Function -> functions of this file it calls */
+  private readonly callees: Map<string, Set<string>> = new Map();
+
+  /**
+   * Find the parameters of internal functions that no call site aliases.
+   *
+   * @param tree - Parsed C-Next program
+   * @param sourcePath - File the tree came from (for warnings)
+   * @param internalFunctions - Scope functions static through internalLinkage
+   */
+  analyze(
+    tree: Parser.ProgramContext,
+    sourcePath: string,
+    internalFunctions: ReadonlySet<string> = new Set(),
+  ): IParameterAliasResult {
+    ParseTreeWalker.DEFAULT.walk(
+      new DeclarationListener(this, internalFunctions),
+      tree,
+    );
+    ParseTreeWalker.DEFAULT.walk(new ReferenceListener(this), tree);
+    const closure = this.computeAccessClosure();
+
+    const restrictParams = new Map<string, Set<string>>();
+    for (const func of this.functions.values()) {
+      if (func.isInternal && !this.escaped.has(func.cName)) {
+        restrictParams.set(func.cName, new Set(func.params));
+      }
+    }
+
+    const warnings: string[] = [];
+    for (const site of this.callSites) {
+      const proven = restrictParams.get(site.callee);
+      const callee = this.functions.get(site.callee)!;
+      if (!proven || site.args.length !== callee.params.length) {
+        continue;
+      }
+      const conflict = this.findConflict(
+        site,
+        closure.get(site.callee)!,
+        proven,
+      );
+      if (conflict) {
+        warnings.push(
+          `Warning: ${sourcePath}:${site.line}: ${callee.displayName}() parameters ${conflict.params.join(", ")} not restrict-qualified: ${conflict.reason}`,
+        );
+      }
+    }
+
+    return { restrictParams, warnings };
+  }
+
+  /**
+   * Record a call, a callback use or a variable access.
+   */
+  visitPostfix(
+    ctx: Parser.PostfixExpressionContext,
+    func: IFunctionInfo | null,
+  ): void {
+    const primary = ctx.primaryExpression();
+    const ops = ctx.postfixOp();
+    const members = ops.map((op) => op.IDENTIFIER()?.getText());
+    const resolved = this.resolve(primary, members, func);
+    const isCall = (op: Parser.PostfixOpContext | undefined): boolean =>
+      op?.getChild(0)?.getText() === "(";
+
+    if (
+      resolved?.root.kind === "global" &&
+      this.functions.has(resolved.root.name)
+    ) {
+      const next = ops[resolved.next];
+      if (!isCall(next)) {
+        this.escaped.add(resolved.root.name);
+        return;
+      }
+      this.callSites.push({
+        callee: resolved.root.name,
+        caller: func,
+        args: next.argumentList()?.expression() ?? [],
+        line: ctx.start?.line ?? 0,
+      });
+      if (func) {
+        this.getSet(this.callees, func.cName).add(resolved.root.name);
+      }
+      return;
+    }
+
+    if (!func) {
+      return;
+    }
+    if (ops.some(isCall)) {
+      this.getSet(this.accesses, func.cName).add(ANY_GLOBAL);
+    } else if (resolved?.root.kind === "global") {
+      this.getSet(this.accesses, func.cName).add(resolved.root.name);
+    }
+  }
+
+  /**
+   * Record the variable an assignment writes.
+   */
+  visitTarget(
+    ctx: Parser.AssignmentTargetContext,
+    func: IFunctionInfo | null,
+  ): void {
+    const ops = ctx.postfixTargetOp().map((op) => op.IDENTIFIER()?.getText());
+    const id = ctx.IDENTIFIER().getText();
+    let root: IStorageRoot | null;
+    if (ctx.THIS()) {
+      root = this.resolveMember("this", [id, ...ops], func)?.root ?? null;
+    } else if (ctx.GLOBAL()) {
+      root = this.resolveMember("global", [id, ...ops], func)?.root ?? null;
+    } else {
+      root = this.resolveIdentifier(id, ops, func).root;
+    }
+    if (func && root?.kind === "global") {
+      this.getSet(this.accesses, func.cName).add(root.name);
+    }
+  }
+
+  static getEnclosingScope(
+    ctx: Parser.FunctionDeclarationContext,
+  ): string | null {
+    const scope = ctx.parent?.parent;
+    return scope instanceof Parser.ScopeDeclarationContext
+      ? scope.IDENTIFIER().getText()
+      : null;
+  }
+
+  /**
+   * The first argument of a call site that may alias, for each parameter
+   * still proven; parameters that fail are removed from `proven`.
+   */
+  private findConflict(
+    site: ICallSite,
+    accessed: ReadonlySet<string>,
+    proven: Set<string>,
+  ): { params: string[]; reason: string } | null {
+    const callee = this.functions.get(site.callee)!;
+    const roots = site.args.map((arg) => this.rootOf(arg, site.caller));
+    const failed: string[] = [];
+    let reason = "";
+
+    roots.forEach((root, i) => {
+      const param = callee.params[i];
+      const why = root ? this.aliasReason(root, i, roots, site, accessed) : "";
+      if (!why || !proven.has(param)) {
+        return;
+      }
+      proven.delete(param);
+      failed.push(param);
+      reason ||= why;
+    });
+
+    return failed.length > 0 ? { params: failed, reason } : null;
+  }
+
+  private aliasReason(
+    root: IStorageRoot,
+    index: number,
+    roots: (IStorageRoot | null)[],
+    site: ICallSite,
+    accessed: ReadonlySet<string>,
+  ): string {
+    const text = site.args[index].getText();
+    for (let j = 0; j < roots.length; j++) {
+      const other = roots[j];
+      if (j === index || !other) {
+        continue;
+      }
+      if (ParameterAliasAnalyzer.mayOverlap(root, other)) {
+        return `arguments '${text}' and '${site.args[j].getText()}' may overlap`;
+      }
+    }
+    const callee = this.functions.get(site.callee)!.displayName;
+    if (
+      root.kind === "global" &&
+      (accessed.has(ANY_GLOBAL) || accessed.has(root.name))
+    ) {
+      return `'${text}' may also be accessed inside ${callee}()`;
+    }
+    if (root.kind === "param" && accessed.size > 0) {
+      return `parameter '${text}' may alias a variable ${callee}() accesses`;
+    }
+    return "";
+  }
+
+  /**
+   * Same variable, or a caller parameter and storage outside the caller
+   * (the caller's locals are never visible to its own caller)
+   */
+  private static mayOverlap(a: IStorageRoot, b: IStorageRoot): boolean {
+    if (a.kind === b.kind && a.name === b.name) {
+      return true;
+    }
+    return (
+      (a.kind === "param" && b.kind !== "local") ||
+      (b.kind === "param" && a.kind !== "local")
+    );
+  }
+
+  /**
+   * Root variable of an argument, null for computed values
+   */
+  private rootOf(
+    expr: Parser.ExpressionContext,
+    func: IFunctionInfo | null,
+  ): IStorageRoot | null {
+    const postfix = ExpressionUnwrapper.getPostfixExpression(expr);
+    if (!postfix) {
+      return null;
+    }
+    const primary = postfix.primaryExpression();
+    const ops = postfix.postfixOp();
+    if (ops.some((op) => op.getChild(0)?.getText() === "(")) {
+      return null;
+    }
+    const inner = primary.expression();
+    if (inner && ops.length === 0) {
+      return this.rootOf(inner, func);
+    }
+    const members = ops.map((op) => op.IDENTIFIER()?.getText());
+    return this.resolve(primary, members, func)?.root ?? null;
+  }
+
+  private resolve(
+    primary: Parser.PrimaryExpressionContext,
+    members: (string | undefined)[],
+    func: IFunctionInfo | null,
+  ): IResolvedName | null {
+    if (primary.THIS()) {
+      return this.resolveMember("this", members, func);
+    }
+    if (primary.GLOBAL()) {
+      return this.resolveMember("global", members, func);
+    }
+    const id = primary.IDENTIFIER()?.getText();
+    return id ? this.resolveIdentifier(id, members, func) : null;
+  }
+
+  /**
+   * this.x / global.x / global.Scope.x
+   */
+  private resolveMember(
+    prefix: "this" | "global",
+    members: (string | undefined)[],
+    func: IFunctionInfo | null,
+  ): IResolvedName | null {
+    const [first, second] = members;
+    if (!first) {
+      return null;
+    }
+    if (prefix === "this") {
+      return func?.scope ? globalName(`${func.scope}_${first}`, 1) : null;
+    }
+    if (this.scopes.has(first) && second) {
+      return globalName(`${first}_${second}`, 2);
+    }
+    return globalName(first, 1);
+  }
+
+  /**
+   * Bare identifier: parameter, local, Scope.x, then scope member and global
+   */
+  private resolveIdentifier(
+    id: string,
+    members: (string | undefined)[],
+    func: IFunctionInfo | null,
+  ): IResolvedName {
+    if (func?.params.includes(id)) {
+      return { root: { kind: "param", name: id }, next: 0 };
+    }
+    if (func?.locals.has(id)) {
+      return { root: { kind: "local", name: id }, next: 0 };
+    }
+    if (this.scopes.has(id) && members[0]) {
+      return globalName(`${id}_${members[0]}`, 1);
+    }
+    const scoped = func?.scope ? `${func.scope}_${id}` : null;
+    if (
+      scoped &&
+      (this.functions.has(scoped) || this.scopeVariables.has(scoped))
+    ) {
+      return globalName(scoped, 0);
+    }
+    return globalName(id, 0);
+  }
+
+  /**
+   * Global roots each function accesses, through the functions it calls
+   */
+  private computeAccessClosure(): Map<string, Set<string>> {
+    const closure = new Map<string, Set<string>>();
+    for (const name of this.functions.keys()) {
+      closure.set(name, new Set(this.accesses.get(name)));
+    }
+    let changed = true;
+    while (changed) {
+      changed = false;
+      for (const [name, callees] of this.callees) {
+        const own = closure.get(name)!;
+        for (const callee of callees) {
+          for (const root of closure.get(callee)!) {
+            if (!own.has(root)) {
+              own.add(root);
+              changed = true;
+            }
+          }
+        }
+      }
+    }
+    return closure;
+  }
+
+  private getSet(map: Map<string, Set<string>>, key: string): Set<string> {
+    let set = map.get(key);
+    if (!set) {
+      set = new Set();
+      map.set(key, set);
+    }
+    return set;
+  }
+}
+
+export default ParameterAliasAnalyzer;
@@ -0,0 +1,106 @@
+/**
+ * Unit tests for DeadSymbolAnalyzer
+ * Tests project-wide reachability for dead code elimination
+ */
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../parser/grammar/CNextLexer";
+import { CNextParser } from "../../parser/grammar/CNextParser";
+import DeadSymbolAnalyzer from "../DeadSymbolAnalyzer";
+
+/**
+ * Helper to parse C-Next code and return the AST
+ */
+function parse(source: string) {
+  const charStream = CharStream.fromString(source);
+  const lexer = new CNextLexer(charStream);
+  const tokenStream = new CommonTokenStream(lexer);
+  const parser = new CNextParser(tokenStream);
+  return parser.program();
+}
+
+const LIB = `
+  scope Util {
+    u32 hits;
+    u32 spare;
+    private u32 count() { this.hits +<- 1; return this.hits; }
+    private u32 step() { return this.count(); }
+    private u32 unused() { return 0; }
+    u32 exported() { return 2; }
+    public u32 api() { return 1; }
+  }
+`;
+
+describe("DeadSymbolAnalyzer", () => {
+  it("keeps only what main reaches, plus the header API", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.collectFile(parse("u32 main() { return Util.exported(); }"));
+
+    expect(analyzer.getDeadSymbols()).toEqual(
+      new Set([
+        "Util_spare",
+        "Util_unused",
+        "Util_count",
+        "Util_step",
+        "Util_hits",
+      ]),
+    );
+  });
+
+  it("keeps default-visibility functions the header exports", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.collectFile(parse("u32 main() { return 0; }"));
+
+    const dead = analyzer.getDeadSymbols();
+    expect(dead.has("Util_exported")).toBe(false);
+    expect(dead.has("Util_api")).toBe(false);
+  });
+
+  it("drops functions internalLinkage made static when unreachable", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.collectFile(parse("u32 main() { return 0; }"));
+
+    const dead = analyzer.getDeadSymbols(new Set(["Util_exported"]));
+    expect(dead.has("Util_exported")).toBe(true);
+    expect(dead.has("Util_api")).toBe(false);
+  });
+
+  it("treats every top-level function as a root", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.collectFile(parse("void SysTick_Handler() { Util.step(); }"));
+
+    const dead = analyzer.getDeadSymbols();
+    expect(dead.has("Util_step")).toBe(false);
+    expect(dead.has("Util_count")).toBe(false);
+    expect(dead.has("Util_unused")).toBe(true);
+  });
+
+  it("follows references from global initializers and assignments", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.collectFile(
+      parse(`
+        u32 seed <- Util.count();
+        void main() { global.Util.spare <- 1; }
+      `),
+    );
+
+    const dead = analyzer.getDeadSymbols();
+    expect(dead.has("Util_count")).toBe(false);
+    expect(dead.has("Util_hits")).toBe(false);
+    expect(dead.has("Util_spare")).toBe(false);
+    expect(dead.has("Util_step")).toBe(true);
+  });
+
+  it("clears accumulated state", () => {
+    const analyzer = new DeadSymbolAnalyzer();
+    analyzer.collectFile(parse(LIB));
+    analyzer.clear();
+
+    expect(analyzer.getDeadSymbols().size).toBe(0);
+  });
+});
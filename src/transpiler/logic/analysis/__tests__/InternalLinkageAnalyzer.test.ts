@@ -0,0 +1,108 @@
+/**
+ * Unit tests for InternalLinkageAnalyzer
+ * Tests whole-program linkage inference for scope functions
+ */
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../parser/grammar/CNextLexer";
+import { CNextParser } from "../../parser/grammar/CNextParser";
+import InternalLinkageAnalyzer from "../InternalLinkageAnalyzer";
+
+/**
+ * Helper to parse C-Next code and return the AST
+ */
+function parse(source: string) {
+  const charStream = CharStream.fromString(source);
+  const lexer = new CNextLexer(charStream);
+  const tokenStream = new CommonTokenStream(lexer);
+  const parser = new CNextParser(tokenStream);
+  return parser.program();
+}
+
+const LIB = `
+  scope Math {
+    u32 twice(u32 a) { return a + a; }
+    u32 square(u32 a) { return a * a; }
+    public u32 cube(u32 a) { return a * a * a; }
+    private u32 half(u32 a) { return a / 2; }
+  }
+`;
+
+describe("InternalLinkageAnalyzer", () => {
+  it("marks default-visibility functions no file calls as internal", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(parse(LIB), "lib.cnx");
+
+    expect(analyzer.getInternalFunctions()).toEqual(
+      new Set(["Math_twice", "Math_square"]),
+    );
+  });
+
+  it("keeps functions called from another file external", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(parse(LIB), "lib.cnx");
+    analyzer.collectFile(
+      parse(`
+        u32 main() {
+          u32 x <- Math.twice(2);
+          return x;
+        }
+      `),
+      "main.cnx",
+    );
+
+    expect(analyzer.getInternalFunctions()).toEqual(new Set(["Math_square"]));
+  });
+
+  it("counts global.Scope.member references", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(parse(LIB), "lib.cnx");
+    analyzer.collectFile(
+      parse(`
+        scope App {
+          u32 run() { return global.Math.square(3); }
+        }
+      `),
+      "app.cnx",
+    );
+
+    expect(analyzer.getInternalFunctions().has("Math_square")).toBe(false);
+    expect(analyzer.getInternalFunctions().has("App_run")).toBe(true);
+  });
+
+  it("ignores references from the defining file", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(
+      parse(`
+        scope Math {
+          u32 twice(u32 a) { return a + a; }
+        }
+        u32 main() { return Math.twice(1); }
+      `),
+      "main.cnx",
+    );
+
+    expect(analyzer.getInternalFunctions()).toEqual(new Set(["Math_twice"]));
+  });
+
+  it("returns every candidate for an amalgamated build", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(parse(LIB), "lib.cnx");
+    analyzer.collectFile(
+      parse("u32 main() { return Math.twice(2); }"),
+      "main.cnx",
+    );
+
+    expect(analyzer.getCandidateFunctions()).toEqual(
+      new Set(["Math_twice", "Math_square"]),
+    );
+  });
+
+  it("clears accumulated state", () => {
+    const analyzer = new InternalLinkageAnalyzer();
+    analyzer.collectFile(parse(LIB), "lib.cnx");
+    analyzer.clear();
+
+    expect(analyzer.getInternalFunctions().size).toBe(0);
+  });
+});
@@ -0,0 +1,149 @@
+/**
+ * Unit tests for ParameterAliasAnalyzer
+ * Tests which parameters can be restrict-qualified from the call sites
+ */
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../parser/grammar/CNextLexer";
+import { CNextParser } from "../../parser/grammar/CNextParser";
+import ParameterAliasAnalyzer from "../ParameterAliasAnalyzer";
+
+/**
+ * Helper to parse C-Next code and return the AST
+ */
+function parse(source: string) {
+  const charStream = CharStream.fromString(source);
+  const lexer = new CNextLexer(charStream);
+  const tokenStream = new CommonTokenStream(lexer);
+  const parser = new CNextParser(tokenStream);
+  return parser.program();
+}
+
+function analyze(source: string, internalFunctions?: Set<string>) {
+  return new ParameterAliasAnalyzer().analyze(
+    parse(source),
+    "buf.cnx",
+    internalFunctions,
+  );
+}
+
+/**
+ * A Buffer scope whose private copy() is called from fill() with `call`
+ */
+function buffer(call: string, copyBody = ""): string {
+  return `
+    scope Buffer {
+      u8[16] rx;
+      u8[16] tx;
+
+      private void copy(u8[16] dst, u8[16] src) {
+        for (u32 i <- 0; i < 16; i +<- 1) {
+          dst[i] <- src[i];
+        }
+        ${copyBody}
+      }
+
+      public void fill(u8[16] input) {
+        u8[16] local;
+        ${call}
+      }
+    }
+  `;
+}
+
+describe("ParameterAliasAnalyzer", () => {
+  it("proves distinct locals and scope variables", () => {
+    const result = analyze(
+      buffer("this.copy(local, this.rx); this.copy(this.tx, local);"),
+    );
+
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(
+      new Set(["dst", "src"]),
+    );
+    expect(result.warnings).toEqual([]);
+  });
+
+  it("only considers functions with internal linkage", () => {
+    const result = analyze(
+      buffer("this.copy(local, this.rx);"),
+      new Set(["Buffer_fill"]),
+    );
+
+    expect([...result.restrictParams.keys()]).toEqual([
+      "Buffer_copy",
+      "Buffer_fill",
+    ]);
+    expect(result.restrictParams.get("Buffer_fill")).toEqual(
+      new Set(["input"]),
+    );
+  });
+
+  it("diagnoses arguments sharing storage", () => {
+    const result = analyze(buffer("this.copy(this.rx, this.rx);"));
+
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(new Set());
+    expect(result.warnings).toEqual([
+      "Warning: buf.cnx:15: Buffer.copy() parameters dst, src not restrict-qualified: arguments 'this.rx' and 'this.rx' may overlap",
+    ]);
+  });
+
+  it("treats caller parameters as possibly aliasing other arguments", () => {
+    const result = analyze(buffer("this.copy(local, input);"));
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(
+      new Set(["dst", "src"]),
+    );
+
+    const aliased = analyze(buffer("this.copy(this.tx, input);"));
+    expect(aliased.restrictParams.get("Buffer_copy")).toEqual(new Set());
+  });
+
+  it("rejects globals the callee accesses directly", () => {
+    const result = analyze(
+      buffer("this.copy(local, this.rx);", "this.rx[0] <- 0;"),
+    );
+
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(
+      new Set(["dst"]),
+    );
+    expect(result.warnings[0]).toContain(
+      "parameters src not restrict-qualified: 'this.rx' may also be accessed inside Buffer.copy()",
+    );
+  });
+
+  it("assumes calls outside the file access any global", () => {
+    const result = analyze(
+      buffer("this.copy(local, this.rx);", "Serial.flush();"),
+    );
+
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(
+      new Set(["dst"]),
+    );
+  });
+
+  it("follows accesses through functions of the same file", () => {
+    const result = analyze(`
+      u8[16] shared;
+      void touch() { shared[0] <- 1; }
+      scope Buffer {
+        private void copy(u8[16] dst, u8[16] src) { global.touch(); }
+        public void run() {
+          u8[16] local;
+          this.copy(local, global.shared);
+        }
+      }
+    `);
+
+    expect(result.restrictParams.get("Buffer_copy")).toEqual(
+      new Set(["dst"]),
+    );
+  });
+
+  it("skips functions used as callbacks", () => {
+    const result = analyze(
+      buffer("this.copy(local, this.rx);") +
+        "void attach() { Buffer.onData(Buffer.copy); }",
+    );
+
+    expect(result.restrictParams.has("Buffer_copy")).toBe(false);
+  });
+});
@@ -0,0 +1,138 @@
+/**
+ * ParseCache
+ * Parse results shared by the Transpiler runs of a multi-configuration
+ * build (--configs).
+ *
+ * Configurations differ only in defines and target, so every .cnx file
+ * parses the same way in all of them. Headers are split into two sets on
+ * first read:
+ *   - configuration-independent: no #if expression that needs the
+ *     preprocessor (Transpiler.needsConditionalPreprocessing), so every
+ *     configuration uses the raw content;
+ *   - configuration-dependent: preprocessed with each configuration's
+ *     defines.
+ * A parse is reused when a file's content matches the content it was
+ * parsed from: always for .cnx files and independent headers, and for a
+ * dependent header whose preprocessed output did not change.
+ */
+
+import { CompilationUnitContext } from "./c/grammar/CParser";
+import { TranslationUnitContext } from "./cpp/grammar/CPP14Parser";
+import CNextSourceParser from "./CNextSourceParser";
+import HeaderParser from "./HeaderParser";
+
+type TCNextParse = ReturnType<typeof CNextSourceParser.parse>;
+
+/**
+ * A parse and the content it was parsed from
+ */
+interface ICachedParse<T> {
+  content: string;
+  result: T;
+}
+
+/**
+ * Raw content of a header and which set it belongs to
+ */
+interface IClassifiedHeader {
+  content: string;
+  configDependent: boolean;
+}
+
+class ParseCache {
+  private readonly cnextParses = new Map<string, ICachedParse<TCNextParse>>();
+  private readonly cHeaderParses = new Map<
+    string,
+    ICachedParse<CompilationUnitContext | null>
+  >();
+  private readonly cppHeaderParses = new Map<
+    string,
+    ICachedParse<TranslationUnitContext | null>
+  >();
+  private readonly headers = new Map<string, IClassifiedHeader>();
+
+  /**
+   * Parse a C-Next source file (CNextSourceParser.parse)
+   */
+  parseCNext(path: string, source: string): TCNextParse {
+    return ParseCache.lookup(this.cnextParses, path, source, () =>
+      CNextSourceParser.parse(source),
+    );
+  }
+
+  /**
+   * Parse a C header (HeaderParser.parseC)
+   */
+  parseCHeader(path: string, content: string): CompilationUnitContext | null {
+    return ParseCache.lookup(
+      this.cHeaderParses,
+      path,
+      content,
+      () => HeaderParser.parseC(content).tree,
+    );
+  }
+
+  /**
+   * Parse a C++ header (HeaderParser.parseCpp)
+   */
+  parseCppHeader(
+    path: string,
+    content: string,
+  ): TranslationUnitContext | null {
+    return ParseCache.lookup(
+      this.cppHeaderParses,
+      path,
+      content,
+      () => HeaderParser.parseCpp(content).tree,
+    );
+  }
+
+  /**
+   * Raw content of a header and whether it is configuration-dependent.
+   * The first configuration to include it reads and classifies it.
+   *
+   * @param read - Reads the header
+   * @param isConfigDependent - Whether the content needs preprocessing
+   */
+  getHeader(
+    path: string,
+    read: () => string,
+    isConfigDependent: (content: string) => boolean,
+  ): IClassifiedHeader {
+    let header = this.headers.get(path);
+    if (!header) {
+      const content = read();
+      header = { content, configDependent: isConfigDependent(content) };
+      this.headers.set(path, header);
+    }
+    return header;
+  }
+
+  /**
+   * Headers classified so far, by set
+   */
+  getHeaderSets(): { independent: string[]; dependent: string[] } {
+    const sets = { independent: [] as string[], dependent: [] as string[] };
+    for (const [path, header] of this.headers) {
+      sets[header.configDependent ? "dependent" : "independent"].push(path);
+    }
+    return sets;
+  }
+
+  private static lookup<T>(
+    parses: Map<string, ICachedParse<T>>,
+    path: string,
+    content: string,
+    parse: () => T,
+  ): T {
+    const cached = parses.get(path);
+    if (cached?.content === content) {
+      return cached.result;
+    }
+    const result = parse();
+    parses.set(path, { content, result });
+    return result;
+  }
+}
+
+export default ParseCache;
@@ -0,0 +1,56 @@
+/**
+ * Unit tests for ParseCache
+ */
+
+import { describe, it, expect, vi } from "vitest";
+import ParseCache from "../ParseCache";
+
+describe("ParseCache", () => {
+  it("reuses a C-Next parse while the source is unchanged", () => {
+    const cache = new ParseCache();
+    const source = "u32 add(u32 a, u32 b) { return a + b; }";
+
+    const first = cache.parseCNext("/src/math.cnx", source);
+    const second = cache.parseCNext("/src/math.cnx", source);
+    const edited = cache.parseCNext("/src/math.cnx", `${source}\n`);
+
+    expect(second).toBe(first);
+    expect(edited).not.toBe(first);
+    expect(edited.errors).toEqual([]);
+  });
+
+  it("keys header parses by path and content", () => {
+    const cache = new ParseCache();
+    const content = "int read_pin(int pin);";
+
+    const tree = cache.parseCHeader("/include/pins.h", content);
+
+    expect(tree).not.toBeNull();
+    expect(cache.parseCHeader("/include/pins.h", content)).toBe(tree);
+    expect(cache.parseCHeader("/include/other.h", content)).not.toBe(tree);
+    expect(cache.parseCHeader("/include/pins.h", `${content}\n`)).not.toBe(
+      tree,
+    );
+  });
+
+  it("reads and classifies each header once", () => {
+    const cache = new ParseCache();
+    const read = vi.fn(() => "#if LED_PIN > 0\n#endif\n");
+    const isConfigDependent = vi.fn((content: string) =>
+      content.includes("#if "),
+    );
+
+    const first = cache.getHeader("/include/board.h", read, isConfigDependent);
+    const second = cache.getHeader("/include/board.h", read, isConfigDependent);
+    cache.getHeader("/include/types.h", () => "typedef int i;", () => false);
+
+    expect(second).toBe(first);
+    expect(first.configDependent).toBe(true);
+    expect(read).toHaveBeenCalledTimes(1);
+    expect(isConfigDependent).toHaveBeenCalledTimes(1);
+    expect(cache.getHeaderSets()).toEqual({
+      independent: ["/include/types.h"],
+      dependent: ["/include/board.h"],
+    });
+  });
+});
@@ -4,6 +4,7 @@
 
 import * as Parser from "../../../parser/grammar/CNextParser";
 import CNEXT_TO_C_TYPE_MAP from "../../../../../utils/constants/TypeMappings";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
 
 /**
  * Common interface for type contexts that share the same type accessors.
@@ -119,7 +120,11 @@ class TypeUtils {
    * @returns The C type name
    */
   static cnextTypeToCType(typeName: string): string {
-    return CNEXT_TO_C_TYPE_MAP[typeName] ?? typeName;
+    return (
+      CNEXT_TO_C_TYPE_MAP[typeName] ??
+      FixedPointUtils.parse(typeName)?.cType ??
+      typeName
+    );
   }
 }
 
@@ -0,0 +1,105 @@
+/**
+ * AmalgamationBuilder
+ *
+ * Joins the per-file output of a project into one translation unit
+ * (amalgamate option). Each file contributes its generated header followed
+ * by its generated source, in dependency order, so every declaration is
+ * seen before it is used. Includes of the project's own generated headers
+ * are dropped because their content is already inlined above.
+ *
+ * A source that does not include its own header defines the header's types
+ * itself, so that header is left out and only its include guard is defined,
+ * which keeps hand-written headers that include it from redefining them.
+ *
+ * Helper de-duplication and static linkage happen during code generation
+ * (CodeGenState.emittedHelpers, CodeGenState.internalFunctions).
+ */
+
+import { basename } from "node:path";
+import IAmalgamationUnit from "../types/IAmalgamationUnit";
+
+/** Matches an include directive, capturing the included path */
+const INCLUDE_RE = /^\s*#\s*include\s*["<]([^">]+)[">]/;
+
+/** Matches the include guard opening a generated header, if it is a valid name */
+const GUARD_RE = /^#ifndef ([A-Za-z_]\w*)\n#define \1\b/;
+
+class AmalgamationBuilder {
+  /**
+   * Build the amalgamated translation unit.
+   *
+   * @param units - Per-file output in dependency order
+   * @param projectHeaders - File names of the project's generated headers
+   */
+  static build(
+    units: readonly IAmalgamationUnit[],
+    projectHeaders: ReadonlySet<string>,
+  ): string {
+    const lines: string[] = [
+      "/**",
+      " * Generated by C-Next Transpiler",
+      ` * Amalgamation of ${units.length} file(s)`,
+      " * A safer C for embedded systems",
+      " */",
+      "",
+    ];
+    for (const unit of units) {
+      lines.push(`/* ==== ${basename(unit.sourcePath)} ==== */`, "");
+      if (unit.headerCode) {
+        lines.push(
+          ...AmalgamationBuilder.headerLines(unit, projectHeaders),
+          "",
+        );
+      }
+      lines.push(
+        ...AmalgamationBuilder.stripProjectIncludes(unit.code, projectHeaders),
+        "",
+      );
+    }
+    return lines.join("\n");
+  }
+
+  /**
+   * Lines contributed by a unit's header: the header itself, or just its
+   * include guard when the unit's code defines the header's content.
+   */
+  private static headerLines(
+    unit: IAmalgamationUnit,
+    projectHeaders: ReadonlySet<string>,
+  ): string[] {
+    const headerCode = unit.headerCode ?? "";
+    if (AmalgamationBuilder.includesHeader(unit.code, unit.headerName)) {
+      return AmalgamationBuilder.stripProjectIncludes(
+        headerCode,
+        projectHeaders,
+      );
+    }
+    const guard = GUARD_RE.exec(headerCode);
+    return guard ? [`#define ${guard[1]}`] : [];
+  }
+
+  /**
+   * Check if code includes the named header.
+   */
+  static includesHeader(code: string, headerName: string): boolean {
+    return code.split("\n").some((line) => {
+      const match = INCLUDE_RE.exec(line);
+      return match !== null && basename(match[1]) === headerName;
+    });
+  }
+
+  /**
+   * Remove includes of the project's own generated headers.
+   */
+  static stripProjectIncludes(
+    code: string,
+    projectHeaders: ReadonlySet<string>,
+  ): string[] {
+    return code.split("\n").filter((line) => {
+      const match = INCLUDE_RE.exec(line);
+      return !match || !projectHeaders.has(basename(match[1]));
+    });
+  }
+}
+
+export default AmalgamationBuilder;
@@ -0,0 +1,93 @@
+/**
+ * Unit tests for AmalgamationBuilder
+ */
+
+import { describe, it, expect } from "vitest";
+import AmalgamationBuilder from "../AmalgamationBuilder";
+
+const PROJECT_HEADERS = new Set(["lib.h", "main.h"]);
+
+describe("AmalgamationBuilder", () => {
+  describe("stripProjectIncludes", () => {
+    it("drops includes of project headers", () => {
+      const code = ['#include "lib.h"', "#include <stdint.h>", "int x;"];
+      expect(
+        AmalgamationBuilder.stripProjectIncludes(
+          code.join("\n"),
+          PROJECT_HEADERS,
+        ),
+      ).toEqual(["#include <stdint.h>", "int x;"]);
+    });
+
+    it("matches project headers by file name", () => {
+      expect(
+        AmalgamationBuilder.stripProjectIncludes(
+          '#include "../include/lib.h"',
+          PROJECT_HEADERS,
+        ),
+      ).toEqual([]);
+    });
+
+    it("keeps includes of other headers", () => {
+      expect(
+        AmalgamationBuilder.stripProjectIncludes(
+          '#include "vendor.h"',
+          PROJECT_HEADERS,
+        ),
+      ).toEqual(['#include "vendor.h"']);
+    });
+  });
+
+  describe("build", () => {
+    it("joins header and code of each unit in order", () => {
+      const output = AmalgamationBuilder.build(
+        [
+          {
+            sourcePath: "/src/lib.cnx",
+            headerCode: "void lib_init(void);",
+            headerName: "lib.h",
+            code: '#include "lib.h"\nvoid lib_init(void) {}',
+          },
+          {
+            sourcePath: "/src/main.cnx",
+            headerCode: null,
+            headerName: "main.h",
+            code: '#include "lib.h"\nint main(void) { lib_init(); }',
+          },
+        ],
+        PROJECT_HEADERS,
+      );
+
+      expect(output).toContain("Amalgamation of 2 file(s)");
+      expect(output).not.toContain('#include "lib.h"');
+      const order = [
+        "/* ==== lib.cnx ==== */",
+        "void lib_init(void);",
+        "void lib_init(void) {}",
+        "/* ==== main.cnx ==== */",
+        "int main(void)",
+      ].map((s) => output.indexOf(s));
+      expect(order.every((pos) => pos >= 0)).toBe(true);
+      expect(order).toEqual([...order].sort((a, b) => a - b));
+    });
+
+    it("leaves out the header of a source that does not include it", () => {
+      const output = AmalgamationBuilder.build(
+        [
+          {
+            sourcePath: "/src/main.cnx",
+            headerCode:
+              "#ifndef MAIN_H\n#define MAIN_H\ntypedef enum { RED } Color;\n#endif",
+            headerName: "main.h",
+            code: "typedef enum { RED } Color;\nint main(void) { return 0; }",
+          },
+        ],
+        PROJECT_HEADERS,
+      );
+
+      expect(output.split("typedef enum").length).toBe(2);
+      expect(output).toContain("#define MAIN_H");
+      expect(output).not.toContain("#ifndef MAIN_H");
+    });
+  });
+});
@@ -51,6 +51,7 @@ import scopeGenerator from "./generators/declarationGenerators/ScopeGenerator";
 import BitUtils from "../../../utils/BitUtils";
 import CppNamespaceUtils from "../../../utils/CppNamespaceUtils";
 import FormatUtils from "../../../utils/FormatUtils";
+import FixedPointUtils from "../../../utils/FixedPointUtils";
 import StringUtils from "../../../utils/StringUtils";
 import TypeCheckUtils from "../../../utils/TypeCheckUtils";
 import ExpressionUtils from "../../../utils/ExpressionUtils";
@@ -102,6 +103,12 @@ import SetMapHelper from "./helpers/SetMapHelper";
 import SymbolLookupHelper from "./helpers/SymbolLookupHelper";
 // Issue #644: Assignment validation coordinator helper
 import AssignmentValidator from "./helpers/AssignmentValidator";
+// Whole-array arithmetic (element-wise statements and reductions)
+import ArrayArithmeticHelper from "./helpers/ArrayArithmeticHelper";
+// likely/unlikely conditions and cold/hot functions
+import BranchHintHelper from "./helpers/BranchHintHelper";
+// ADR-106: Static vector tables
+import VectorTableHelper from "./helpers/VectorTableHelper";
 // Issue #696: Variable modifier extraction helper
 // Note: VariableModifierBuilder is now used via VariableDeclHelper
 // Issue #792: Variable declaration helper
@@ -131,6 +138,10 @@ import TransitiveModificationPropagator from "../../logic/analysis/helpers/Trans
 import TypeGenerationHelper from "./helpers/TypeGenerationHelper";
 // Phase 5: Cast validation helper for improved testability
 import CastValidator from "./helpers/CastValidator";
+// reorderStructs: emitted field order for designated initializers
+import StructLayoutHelper from "./helpers/StructLayoutHelper";
+// strengthReduce: safe division by constant divisors
+import ConstantDivisorHelper from "./helpers/ConstantDivisorHelper";
 // Issue #793: Function context lifecycle and parameter processing helper
 import FunctionContextManager from "./helpers/FunctionContextManager";
 import IFunctionContextCallbacks from "./types/IFunctionContextCallbacks";
@@ -138,6 +149,8 @@ import IFunctionContextCallbacks from "./types/IFunctionContextCallbacks";
 import CodeGenState from "../../state/CodeGenState";
 // Issue #269: Pass-by-value analysis extracted from CodeGenerator
 import PassByValueAnalyzer from "../../logic/analysis/PassByValueAnalyzer";
+import ParameterAliasAnalyzer from "../../logic/analysis/ParameterAliasAnalyzer";
+import IndexRangeAnalyzer from "./analysis/IndexRangeAnalyzer";
 // Unified parameter generation (Phase 1)
 import ParameterInputAdapter from "./helpers/ParameterInputAdapter";
 import ParameterSignatureBuilder from "./helpers/ParameterSignatureBuilder";
@@ -151,8 +164,11 @@ import QualifiedNameGenerator from "./utils/QualifiedNameGenerator";
 import MisraSuppressionUtils from "../MisraSuppressionUtils";
 
 const {
+  RUNTIME_NAME,
   generateOverflowHelpers: helperGenerateOverflowHelpers,
   generateSafeDivHelpers: helperGenerateSafeDivHelpers,
+  generateVectorHelpers: helperGenerateVectorHelpers,
+  generateBranchHintMacros: helperGenerateBranchHintMacros,
 } = helperGenerators;
 
 const {
@@ -203,16 +219,37 @@ interface TargetCapabilities {
   wordSize: 8 | 16 | 32;
   hasLdrexStrex: boolean;
   hasBasepri: boolean;
+  hasDsp?: boolean;
 }
 
 /**
  * ADR-049: Target platform capability map
  */
 const TARGET_CAPABILITIES: Record<string, TargetCapabilities> = {
-  teensy41: { wordSize: 32, hasLdrexStrex: true, hasBasepri: true },
-  teensy40: { wordSize: 32, hasLdrexStrex: true, hasBasepri: true },
-  "cortex-m7": { wordSize: 32, hasLdrexStrex: true, hasBasepri: true },
-  "cortex-m4": { wordSize: 32, hasLdrexStrex: true, hasBasepri: true },
+  teensy41: {
+    wordSize: 32,
+    hasLdrexStrex: true,
+    hasBasepri: true,
+    hasDsp: true,
+  },
+  teensy40: {
+    wordSize: 32,
+    hasLdrexStrex: true,
+    hasBasepri: true,
+    hasDsp: true,
+  },
+  "cortex-m7": {
+    wordSize: 32,
+    hasLdrexStrex: true,
+    hasBasepri: true,
+    hasDsp: true,
+  },
+  "cortex-m4": {
+    wordSize: 32,
+    hasLdrexStrex: true,
+    hasBasepri: true,
+    hasDsp: true,
+  },
   "cortex-m3": { wordSize: 32, hasLdrexStrex: true, hasBasepri: true },
   "cortex-m0+": { wordSize: 32, hasLdrexStrex: true, hasBasepri: false },
   "cortex-m0": { wordSize: 32, hasLdrexStrex: false, hasBasepri: false },
@@ -408,6 +445,10 @@ export default class CodeGenerator implements IOrchestrator {
       callbackFieldTypes: CodeGenState.callbackFieldTypes,
       targetCapabilities: CodeGenState.targetCapabilities,
       debugMode: CodeGenState.debugMode,
+      cppMode: CodeGenState.cppMode,
+      compactEnums: CodeGenState.compactEnums,
+      switchTables: CodeGenState.switchTables,
+      strengthReduce: CodeGenState.strengthReduce,
     };
   }
 
@@ -550,6 +591,9 @@ export default class CodeGenerator implements IOrchestrator {
       case "irq_wrappers":
         CodeGenState.needsIrqWrappers = true;
         break;
+      case "branch_hints":
+        CodeGenState.needsBranchHints = true;
+        break;
     }
   }
 
@@ -1052,8 +1096,13 @@ export default class CodeGenerator implements IOrchestrator {
     } else if (ctx.assignmentStatement()) {
       result = this.generateAssignment(ctx.assignmentStatement()!);
     } else if (ctx.expressionStatement()) {
-      result =
-        this.generateExpression(ctx.expressionStatement()!.expression()) + ";";
+      const expression = ctx.expressionStatement()!.expression();
+      const code = ConstantDivisorHelper.isSafeDivCall(expression)
+        ? CodeGenState.withSafeDivStatement(() =>
+            this.generateExpression(expression),
+          )
+        : this.generateExpression(expression);
+      result = `${code};`;
     } else if (ctx.ifStatement()) {
       result = this.generateIf(ctx.ifStatement()!);
     } else if (ctx.whileStatement()) {
@@ -2220,6 +2269,31 @@ export default class CodeGenerator implements IOrchestrator {
     // Second pass: register all variable types in the type registry
     this.registerAllVariableTypes(tree);
 
+    // ADR-106: Vector tables and their bindings, before handlers are emitted
+    if (CodeGenState.staticVectors) {
+      VectorTableHelper.collect(tree);
+    }
+
+    // restrictParams: prove which pointer parameters no call site aliases
+    if (CodeGenState.restrictParams) {
+      const aliasing = new ParameterAliasAnalyzer().analyze(
+        tree,
+        CodeGenState.sourcePath ?? "",
+        CodeGenState.internalFunctions,
+      );
+      CodeGenState.restrictQualified = aliasing.restrictParams;
+      CodeGenState.aliasWarnings = aliasing.warnings;
+    }
+
+    // ADR-054: range-check array subscripts for the bounds report
+    if (CodeGenState.boundsReport) {
+      CodeGenState.boundsEntries = IndexRangeAnalyzer.analyze(
+        tree,
+        CodeGenState.sourcePath ?? "",
+        CodeGenState.constValues,
+      ).entries;
+    }
+
     // Assemble and return the output
     return this.assembleGeneratedOutput(tree, options);
   }
@@ -2232,6 +2306,27 @@ export default class CodeGenerator implements IOrchestrator {
     tokenStream: CommonTokenStream | undefined,
   ): void {
     CodeGenState.debugMode = options?.debugMode ?? false;
+    CodeGenState.compactEnums = options?.compactEnums ?? false;
+    CodeGenState.packedBoolArrays = options?.packedBoolArrays ?? false;
+    CodeGenState.soaStructs = new Set(options?.soaStructs ?? []);
+    CodeGenState.internalFunctions = options?.internalFunctions ?? new Set();
+    CodeGenState.deadSymbols = options?.deadSymbols ?? new Set();
+    CodeGenState.emittedHelpers = options?.emittedHelpers ?? null;
+    CodeGenState.sharedHelpers = options?.sharedHelpers ?? false;
+    CodeGenState.cmsisDsp = options?.cmsisDsp ?? false;
+    CodeGenState.switchTables = options?.switchTables ?? false;
+    CodeGenState.strengthReduce = options?.strengthReduce ?? false;
+    CodeGenState.branchHints = options?.branchHints ?? false;
+    CodeGenState.coldFunctions = new Set(
+      (options?.coldFunctions ?? []).map(BranchHintHelper.toCName),
+    );
+    CodeGenState.hotFunctions = new Set(
+      (options?.hotFunctions ?? []).map(BranchHintHelper.toCName),
+    );
+    CodeGenState.staticVectors = options?.staticVectors ?? false;
+    CodeGenState.isrSection = options?.isrSection || null;
+    CodeGenState.restrictParams = options?.restrictParams ?? false;
+    CodeGenState.boundsReport = options?.boundsReport ?? false;
     CodeGenState.sourcePath = options?.sourcePath ?? null;
     CodeGenState.includeDirs = options?.includeDirs ?? [];
     CodeGenState.inputs = options?.inputs ?? [];
@@ -2296,6 +2391,31 @@ export default class CodeGenerator implements IOrchestrator {
     PassByValueAnalyzer.analyze(tree);
   }
 
+  /**
+   * Check if any public scope member stays in the header. Functions made
+   * static by internalLinkage or dropped as dead code no longer need the
+   * self-include.
+   */
+  private hasExportedScopeMembers(symbols: ICodeGenSymbols): boolean {
+    const { internalFunctions, deadSymbols } = CodeGenState;
+    if (internalFunctions.size === 0 && deadSymbols.size === 0) {
+      return symbols.hasPublicSymbols();
+    }
+    for (const [scopeName, members] of symbols.scopeMemberVisibility) {
+      for (const [memberName, visibility] of members) {
+        const cName = `${scopeName}_${memberName}`;
+        if (
+          visibility === "public" &&
+          !internalFunctions.has(cName) &&
+          !deadSymbols.has(cName)
+        ) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
   /**
    * Assemble the final generated output.
    */
@@ -2320,7 +2440,7 @@ export default class CodeGenerator implements IOrchestrator {
     );
 
     // Self-include for extern "C" linkage
-    if (symbols.hasPublicSymbols() && CodeGenState.sourcePath) {
+    if (this.hasExportedScopeMembers(symbols) && CodeGenState.sourcePath) {
       const pathToUse =
         options?.sourceRelativePath ||
         CodeGenState.sourcePath.replace(/^.*[\\/]/, "");
@@ -2347,6 +2467,9 @@ export default class CodeGenerator implements IOrchestrator {
     // Add the declarations
     output.push(...declarations);
 
+    // ADR-106: Vector tables reference handlers, so they come last
+    output.push(...VectorTableHelper.generateTables());
+
     return output.join("\n");
   }
 
@@ -2442,6 +2565,7 @@ export default class CodeGenerator implements IOrchestrator {
     if (CodeGenState.needsStdbool) autoIncludes.push("#include <stdbool.h>");
     if (CodeGenState.needsString) autoIncludes.push("#include <string.h>");
     if (CodeGenState.needsCMSIS) autoIncludes.push("#include <cmsis_gcc.h>");
+    if (CodeGenState.needsArmMath) autoIncludes.push('#include "arm_math.h"');
     if (CodeGenState.needsLimits) autoIncludes.push("#include <limits.h>");
 
     if (autoIncludes.length > 0) {
@@ -2453,7 +2577,21 @@ export default class CodeGenerator implements IOrchestrator {
    * Add generated helpers (static asserts, IRQ wrappers, typedefs, etc.).
    */
   private addGeneratedHelpers(output: string[]): void {
-    if (CodeGenState.needsFloatStaticAssert) {
+    if (this.needsBranchHintMacros() && this.claimHelper("branch-hints")) {
+      output.push(...helperGenerateBranchHintMacros());
+    }
+
+    if (
+      CodeGenState.vectorTables.size > 0 &&
+      this.claimHelper("vector-tables")
+    ) {
+      output.push(...VectorTableHelper.generateMacros());
+    }
+
+    if (
+      CodeGenState.needsFloatStaticAssert &&
+      this.claimHelper("float-static-assert")
+    ) {
       // Use static_assert for C++ (standard), _Static_assert for C11
       const assertKeyword = this.isCppMode()
         ? "static_assert"
@@ -2465,11 +2603,11 @@ export default class CodeGenerator implements IOrchestrator {
       );
     }
 
-    if (CodeGenState.needsIrqWrappers) {
+    if (CodeGenState.needsIrqWrappers && this.claimHelper("irq-wrappers")) {
       output.push(...this.generateIrqWrappers());
     }
 
-    if (CodeGenState.needsISR) {
+    if (CodeGenState.needsISR && this.claimHelper("isr-typedef")) {
       output.push(
         "/* ADR-040: ISR function pointer type */",
         "typedef void (*ISR)(void);",
@@ -2477,6 +2615,22 @@ export default class CodeGenerator implements IOrchestrator {
       );
     }
 
+    const vectorHelpers = this.generateVectorHelpers();
+    if (vectorHelpers.length > 0) {
+      output.push(...vectorHelpers);
+    }
+
+    // sharedHelpers: the Transpiler writes the project's helpers once
+    if (CodeGenState.sharedHelpers) {
+      if (
+        CodeGenState.usedClampOps.size > 0 ||
+        CodeGenState.usedSafeDivOps.size > 0
+      ) {
+        output.push(`#include "${RUNTIME_NAME}.h"`, "");
+      }
+      return;
+    }
+
     const helpers = this.generateOverflowHelpers();
     if (helpers.length > 0) {
       output.push(...helpers);
@@ -2488,6 +2642,42 @@ export default class CodeGenerator implements IOrchestrator {
     }
   }
 
+  /**
+   * Branch hint macros: used by source hints or by hinted inline helpers
+   */
+  private needsBranchHintMacros(): boolean {
+    const usesHelpers =
+      CodeGenState.usedClampOps.size > 0 ||
+      CodeGenState.usedSafeDivOps.size > 0;
+    return (
+      CodeGenState.needsBranchHints ||
+      (CodeGenState.branchHints && usesHelpers && !CodeGenState.sharedHelpers)
+    );
+  }
+
+  /**
+   * Amalgamation: claim a helper for the shared translation unit.
+   * Returns false when an earlier file already emitted it.
+   */
+  private claimHelper(key: string): boolean {
+    const emitted = CodeGenState.emittedHelpers;
+    if (!emitted) {
+      return true;
+    }
+    if (emitted.has(key)) {
+      return false;
+    }
+    emitted.add(key);
+    return true;
+  }
+
+  /**
+   * Amalgamation: the subset of used helper operations not yet emitted.
+   */
+  private claimHelpers(kind: string, ops: ReadonlySet<string>): Set<string> {
+    return new Set([...ops].filter((op) => this.claimHelper(`${kind}:${op}`)));
+  }
+
   /**
    * ADR-049: Resolve target capabilities with priority: CLI > pragma > default
    * @param tree - The parsed program tree
@@ -2609,6 +2799,7 @@ export default class CodeGenerator implements IOrchestrator {
           funcName,
         );
         CodeGenState.knownFunctions.add(fullName);
+        CodeGenState.functionDeclarations.set(fullName, funcDecl);
         // ADR-013: Track function signature for const checking
         const sig = this.extractFunctionSignature(
           fullName,
@@ -2654,6 +2845,7 @@ export default class CodeGenerator implements IOrchestrator {
   ): void {
     const name = funcDecl.IDENTIFIER().getText();
     CodeGenState.knownFunctions.add(name);
+    CodeGenState.functionDeclarations.set(name, funcDecl);
     // ADR-013: Track function signature for const checking
     const sig = this.extractFunctionSignature(
       name,
@@ -3124,6 +3316,14 @@ export default class CodeGenerator implements IOrchestrator {
     // Get the base identifier to find the struct type
     const primary = postfix.primaryExpression();
     if (!primary) return "not-array";
+
+    // this.arr / global.arr / Scope.arr name a scope or global variable
+    const variable = this.getQualifiedVariableName(primary, ops);
+    if (variable) {
+      const varInfo = CodeGenState.getVariableTypeInfo(variable);
+      return varInfo?.isArray && !varInfo.isString ? "array" : "not-array";
+    }
+
     const baseId = primary.IDENTIFIER()?.getText();
     if (!baseId) return "not-array";
 
@@ -3156,6 +3356,31 @@ export default class CodeGenerator implements IOrchestrator {
     return memberInfo.isArray ? "array" : "not-array";
   }
 
+  /**
+   * C name of the variable a single-suffix this.x, global.x or Scope.x
+   * refers to, or null for other expressions (e.g. struct member access).
+   */
+  private getQualifiedVariableName(
+    primary: Parser.PrimaryExpressionContext,
+    ops: Parser.PostfixOpContext[],
+  ): string | null {
+    const memberName = ops.length === 1 ? ops[0].IDENTIFIER()?.getText() : null;
+    if (!memberName) return null;
+
+    if (primary.THIS()) {
+      const scope = CodeGenState.currentScope;
+      return scope ? `${scope}_${memberName}` : null;
+    }
+    if (primary.GLOBAL()) {
+      return memberName;
+    }
+    const baseId = primary.IDENTIFIER()?.getText();
+    if (baseId && CodeGenState.isKnownScope(baseId)) {
+      return `${baseId}_${memberName}`;
+    }
+    return null;
+  }
+
   // ========================================================================
   // Declarations
   // ========================================================================
@@ -3617,11 +3842,38 @@ export default class CodeGenerator implements IOrchestrator {
     }
 
     // For C-Next/C structs, generate designated initializer
-    const fieldInits = fields.map((f) => `.${f.fieldName} = ${f.value}`);
+    const fieldInits = this._orderFieldInitializers(typeName, fields).map(
+      (f) => `.${f.fieldName} = ${f.value}`,
+    );
 
     return this.formatStructInitializer(typeName, castType, fieldInits);
   }
 
+  /**
+   * C++ requires designators in member declaration order, so for reordered
+   * structs the initializers follow the emitted field order.
+   * C accepts designators in any order and keeps the source order.
+   */
+  private _orderFieldInitializers<T extends { fieldName: string }>(
+    typeName: string,
+    fields: T[],
+  ): T[] {
+    if (
+      !CodeGenState.cppMode ||
+      !CodeGenState.symbols ||
+      !StructLayoutHelper.isReordered(CodeGenState.symbols, typeName)
+    ) {
+      return fields;
+    }
+    const layout = StructLayoutHelper.getReorderedLayout(
+      CodeGenState.symbols,
+      typeName,
+      CodeGenState.targetCapabilities.wordSize,
+      CodeGenState.compactEnums,
+    );
+    return StructLayoutHelper.orderByLayout(fields, (f) => f.fieldName, layout);
+  }
+
   private formatStructInitializer(
     typeName: string,
     castType: string,
@@ -3894,6 +4146,11 @@ export default class CodeGenerator implements IOrchestrator {
       isOpaqueType: (t) => CodeGenState.isOpaqueType(t),
     });
 
+    // restrictParams: no call site passes storage this parameter can alias
+    input.isRestrict = CodeGenState.restrictQualified
+      .get(CodeGenState.currentFunctionName ?? "")
+      ?.has(name);
+
     // Use shared builder with C/C++ mode
     return ParameterSignatureBuilder.build(input, CppModeHelper.refOrPtr());
   }
@@ -3945,9 +4202,10 @@ export default class CodeGenerator implements IOrchestrator {
    * Check if type should use pass-by-value semantics
    */
   private _isPassByValueType(typeName: string, name: string): boolean {
-    // ISR, float, enum types
+    // ISR, float, Q, enum types
     if (typeName === "ISR") return true;
     if (this._isFloatType(typeName)) return true;
+    if (FixedPointUtils.isFixedPoint(typeName)) return true;
     if (CodeGenState.symbols?.knownEnums.has(typeName)) return true;
 
     // Small unmodified primitives
@@ -4360,6 +4618,22 @@ export default class CodeGenerator implements IOrchestrator {
   private generateAssignment(ctx: Parser.AssignmentStatementContext): string {
     const targetCtx = ctx.assignmentTarget();
 
+    // ADR-106: R.M <- handler is an entry of a static vector table
+    const vectorBinding = VectorTableHelper.tryGenerateBinding(ctx);
+    if (vectorBinding !== null) {
+      return vectorBinding;
+    }
+
+    // Whole-array arithmetic: out <- a + b, out *<- k
+    const arrayArithmetic = ArrayArithmeticHelper.tryGenerateAssignment(ctx, {
+      generateUnaryExpr: (unaryCtx) => this.generateUnaryExpr(unaryCtx),
+      generateAssignmentTarget: (assignCtx) =>
+        this.generateAssignmentTarget(assignCtx),
+    });
+    if (arrayArithmetic !== null) {
+      return arrayArithmetic;
+    }
+
     // Issue #644: Set expected type for inferred struct initializers and overflow behavior
     // Delegated to AssignmentExpectedTypeResolver helper
     const savedAssignmentContext = { ...CodeGenState.assignmentContext };
@@ -4517,6 +4791,8 @@ export default class CodeGenerator implements IOrchestrator {
           separatorCtx,
           separatorDeps,
         ),
+      isStructOfArrays: (target: string) =>
+        CodeGenState.getVariableTypeInfo(target)?.isStructOfArrays === true,
     };
   }
 
@@ -4756,6 +5032,16 @@ export default class CodeGenerator implements IOrchestrator {
       }
     }
 
+    // Q types: explicit conversions rescale between raw and real values
+    const fixedPointCast = this.generateFixedPointCast(
+      ctx,
+      targetType,
+      targetTypeName,
+    );
+    if (fixedPointCast !== null) {
+      return fixedPointCast;
+    }
+
     const expr = this.generateUnaryExpr(ctx.unaryExpression());
 
     // Issue #632: Float-to-integer casts must clamp to avoid undefined behavior
@@ -4788,6 +5074,69 @@ export default class CodeGenerator implements IOrchestrator {
     return CppModeHelper.cast(targetType, expr);
   }
 
+  /**
+   * Generate a cast to or from a Q type, or null if neither side is one.
+   * - numeric literal -> Q: converted at transpile time
+   * - Q -> float: raw / 2^F
+   * - Q -> integer: raw >> F (rounds toward negative infinity)
+   * - float -> Q: clamping cast of value * 2^F
+   * - integer or other Q -> Q: rescaled in 64 bits, then saturated
+   */
+  private generateFixedPointCast(
+    ctx: Parser.CastExpressionContext,
+    targetType: string,
+    targetTypeName: string,
+  ): string | null {
+    const operand = ctx.unaryExpression();
+    const sourceType = this.getUnaryExpressionType(operand);
+    const source = FixedPointUtils.parse(sourceType);
+    const target = FixedPointUtils.parse(targetTypeName);
+    if (!source && !target) {
+      return null;
+    }
+    if (target && /^-*(\d|\.\d)/.test(operand.getText())) {
+      return CodeGenState.withExpectedType(targetTypeName, () =>
+        this.generateUnaryExpr(operand),
+      );
+    }
+
+    const expr = CodeGenState.withoutExpectedType(() =>
+      this.generateUnaryExpr(operand),
+    );
+    if (source && !target) {
+      if (this._isFloatType(targetTypeName)) {
+        const suffix = targetTypeName === "f32" ? "f" : "";
+        const scale = `${2 ** source.fracBits}.0${suffix}`;
+        return `(${CppModeHelper.cast(targetType, expr)} / ${scale})`;
+      }
+      return CppModeHelper.cast(targetType, `(${expr} >> ${source.fracBits})`);
+    }
+
+    const format = target!;
+    if (source?.name === format.name) {
+      return expr;
+    }
+    if (sourceType && this._isFloatType(sourceType)) {
+      const suffix = sourceType === "f32" ? "f" : "";
+      return this.generateFloatToIntClampCast(
+        `(${expr}) * ${2 ** format.fracBits}.0${suffix}`,
+        targetType,
+        format.storageType,
+        sourceType,
+      );
+    }
+
+    // Integers have 0 fractional bits
+    const shift = format.fracBits - (source?.fracBits ?? 0);
+    const wide = `(int64_t)${expr}`;
+    const rescaled =
+      shift >= 0
+        ? `${wide} * ((int64_t)1 << ${shift})`
+        : `${wide} >> ${-shift}`;
+    CodeGenState.markClampOpUsed("from", format.name);
+    return `cnx_clamp_from_${format.name}(${rescaled})`;
+  }
+
   /**
    * Issue #632: Generate clamping cast for float-to-integer conversions
    * In C, casting an out-of-range float to an integer is undefined behavior.
@@ -4910,8 +5259,9 @@ export default class CodeGenerator implements IOrchestrator {
    */
   private generateOverflowHelpers(): string[] {
     return helperGenerateOverflowHelpers(
-      CodeGenState.usedClampOps,
+      this.claimHelpers("clamp", CodeGenState.usedClampOps),
       CodeGenState.debugMode,
+      CodeGenState.branchHints,
     );
   }
 
@@ -5019,6 +5369,20 @@ export default class CodeGenerator implements IOrchestrator {
    * ADR-053 A5: Delegates to HelperGenerator
    */
   private generateSafeDivHelpers(): string[] {
-    return helperGenerateSafeDivHelpers(CodeGenState.usedSafeDivOps);
+    return helperGenerateSafeDivHelpers(
+      this.claimHelpers("safe-div", CodeGenState.usedSafeDivOps),
+      CodeGenState.branchHints,
+    );
+  }
+
+  /**
+   * Generate array reduction helpers (a.sum, a.min, a.max, (a * b).sum)
+   */
+  private generateVectorHelpers(): string[] {
+    return helperGenerateVectorHelpers(
+      this.claimHelpers("vector", CodeGenState.usedVectorOps),
+      CodeGenState.usesCmsisDsp(),
+      this.isCppMode(),
+    );
   }
 }
@@ -448,6 +448,16 @@ class TypeResolver {
       return TypeResolver.resolveRegistryLookup(scopedName);
     }
 
+    // Whole-array reductions: integer sums are 64-bit totals, flags.any is bool
+    if (current.isArray && ["sum", "min", "max", "any"].includes(memberName)) {
+      const isInteger = TypeResolver.isIntegerType(current.baseType);
+      if (memberName === "sum" && isInteger) {
+        const isUnsigned = TypeResolver.isUnsignedType(current.baseType);
+        return { stop: true, type: isUnsigned ? "u64" : "i64" };
+      }
+      return { stop: true, type: current.baseType };
+    }
+
     const memberInfo = TypeResolver.getMemberTypeInfo(
       current.baseType,
       memberName,
@@ -0,0 +1,121 @@
+/**
+ * DeclarationLayoutResolver - Target size of a declared variable
+ *
+ * Resolves the type of a variable or parameter declaration to a C-Next type
+ * name (Scope_Type for scoped types), applies all array dimensions and
+ * returns its size and alignment for the configured target. Shared by the
+ * stack and memory reports so both size declarations the same way.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import TypeLayoutCalculator from "./TypeLayoutCalculator";
+import ArrayDimensionParser from "../helpers/ArrayDimensionParser";
+import PackedBoolArrayHelper from "../helpers/PackedBoolArrayHelper";
+import TYPE_WIDTH from "../types/TYPE_WIDTH";
+import ITypeLayout from "../types/ITypeLayout";
+
+/** Target data needed to size declarations */
+interface IDeclarationLayoutOptions {
+  /** Layouts for the configured target */
+  layout: TypeLayoutCalculator;
+  /** Target word size (ITargetCapabilities.wordSize) */
+  wordSize: 8 | 16 | 32;
+  /** Const values for array dimensions (CodeGenState.constValues) */
+  constValues: Map<string, number>;
+  /** packedBoolArrays option: bool[N] is stored as uint32_t words */
+  packedBoolArrays?: boolean;
+}
+
+class DeclarationLayoutResolver {
+  constructor(private readonly options: IDeclarationLayoutOptions) {}
+
+  /**
+   * Size of a data pointer (and return address) on the target.
+   */
+  get pointerSize(): number {
+    return this.options.wordSize === 32 ? 4 : 2;
+  }
+
+  /**
+   * Layout of a declared type including all array dimensions, or null if
+   * the element type or a dimension is unknown.
+   *
+   * @param typeCtx - Declared type
+   * @param extraDims - Dimensions written after the name
+   * @param scopeName - Enclosing scope (resolves this.Type)
+   */
+  getLayout(
+    typeCtx: Parser.TypeContext,
+    extraDims: Parser.ArrayDimensionContext[],
+    scopeName: string | null,
+  ): ITypeLayout | null {
+    const arrayCtx = typeCtx.arrayType();
+    const typeName = this.getTypeName(arrayCtx ?? typeCtx, scopeName);
+    const element =
+      typeName === "ISR"
+        ? { size: this.pointerSize, align: this.pointerSize }
+        : typeName && this.options.layout.getLayout(typeName);
+    if (!element) {
+      return null;
+    }
+
+    const dimCtxs = [...(arrayCtx?.arrayTypeDimension() ?? []), ...extraDims];
+    const dims: number[] = [];
+    for (const dim of dimCtxs) {
+      const expr = dim.expression();
+      const value = expr
+        ? ArrayDimensionParser.parseSingleDimension(expr, {
+            constValues: this.options.constValues,
+            typeWidths: TYPE_WIDTH,
+          })
+        : undefined;
+      if (value === undefined) {
+        return null;
+      }
+      dims.push(value);
+    }
+
+    if (
+      this.options.packedBoolArrays &&
+      PackedBoolArrayHelper.isEligible(typeName!, dims, dims.length)
+    ) {
+      return { size: PackedBoolArrayHelper.wordCount(dims[0]) * 4, align: 4 };
+    }
+    const count = dims.reduce((product, dim) => product * dim, 1);
+    return { size: element.size * count, align: element.align };
+  }
+
+  /**
+   * C-Next type name as used by the symbol tables, or null for types
+   * without a known layout (templates).
+   */
+  getTypeName(
+    ctx: Parser.TypeContext | Parser.ArrayTypeContext,
+    scopeName: string | null,
+  ): string | null {
+    const scoped = ctx.scopedType();
+    const qualified = ctx.qualifiedType();
+    if (ctx.primitiveType()) {
+      return ctx.primitiveType()!.getText();
+    }
+    if (ctx.stringType()) {
+      return ctx.stringType()!.getText();
+    }
+    if (scoped) {
+      const name = scoped.IDENTIFIER().getText();
+      return scopeName ? `${scopeName}_${name}` : name;
+    }
+    if (ctx.globalType()) {
+      return ctx.globalType()!.IDENTIFIER().getText();
+    }
+    if (qualified) {
+      return qualified
+        .IDENTIFIER()
+        .map((id) => id.getText())
+        .join("_");
+    }
+    return ctx.userType()?.getText() ?? null;
+  }
+}
+
+export default DeclarationLayoutResolver;
@@ -0,0 +1,1174 @@
+/**
+ * IndexRangeAnalyzer - Array subscripts proven in bounds (--bounds-report)
+ *
+ * ADR-054: A flow-sensitive interval analysis over each function body. An
+ * integer variable starts at its declared type range and is narrowed by
+ * - initializers and assignments (u8 i <- 3)
+ * - if/while/for conditions inside the guarded statement, and the negated
+ *   condition after it (if (i >= N) { return; } proves i < N below)
+ * - for-loop counters: i +<- k keeps i at or above its initial value
+ * Subscripts follow constants, .element_count, masks (& 15), modulo, shifts,
+ * casts and the element type of lookup tables (data[i] of u8 indexing a
+ * 256-entry table).
+ *
+ * An access whose index range lies within [0, size - 1] needs no runtime
+ * clamp/wrap check. Facts on a variable end at any assignment to it, at any
+ * call it is passed to (it may be passed by reference) and, for scope and
+ * global variables, at any call at all. Loops drop facts on everything they
+ * assign before the body is analyzed. Arithmetic that may leave
+ * [0, INT32_MAX] yields no range, so unsigned wrap-around never proves an
+ * access.
+ */
+
+import { ParseTree, ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../../../logic/parser/grammar/CNextListener";
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import ArrayDimensionParser from "../helpers/ArrayDimensionParser";
+import TYPE_RANGES from "../types/TYPE_RANGES";
+import LiteralUtils from "../../../../utils/LiteralUtils";
+import IBoundsReportEntry from "../../../types/IBoundsReportEntry";
+
+/** Inclusive integer interval; bounds may be infinite */
+interface IRange {
+  lo: number;
+  hi: number;
+}
+
+/** A parameter, local, scope or global variable */
+interface IVariable {
+  /** Declared range of an integer scalar (null for anything else) */
+  range: IRange | null;
+  /** Element count per array dimension (null if not constant) */
+  dims: (number | null)[];
+  /** Declared range of an integer array's elements */
+  elementRange: IRange | null;
+  /** Volatile and atomic variables may change between two reads */
+  isVolatile: boolean;
+}
+
+/** A variable an access chain starts with */
+interface IResolved {
+  /** Fact key: local name, or global.<C name> */
+  key: string;
+  cName: string;
+  variable: IVariable;
+  /** Member steps naming the variable (this.x and Scope.x: 1) */
+  consumed: number;
+}
+
+/** One postfix step: .member, [index], [start, width] or (args) */
+interface IStep {
+  text: string;
+  member: string | null;
+  /** One expression for a subscript, two for a bit range, else none */
+  indices: Parser.ExpressionContext[];
+}
+
+/** this/global/identifier followed by its postfix steps */
+interface IChain {
+  root: string;
+  steps: IStep[];
+}
+
+/** Narrowed ranges by variable key */
+type TFacts = Map<string, IRange>;
+
+/** Variables a statement may change */
+interface IClobbered {
+  keys: Set<string>;
+  /** Any call may change scope and global variables */
+  hasCall: boolean;
+}
+
+interface IIndexRangeResult {
+  entries: IBoundsReportEntry[];
+  /** Subscript expressions proven within their dimension */
+  proven: Set<Parser.ExpressionContext>;
+}
+
+const INT32_MAX = 2147483647;
+
+const BOOL_RANGE: IRange = { lo: 0, hi: 1 };
+
+const NEGATED: Record<string, string> = {
+  "<": ">=",
+  "<=": ">",
+  ">": "<=",
+  ">=": "<",
+};
+
+const MIRRORED: Record<string, string> = {
+  "<": ">",
+  "<=": ">=",
+  ">": "<",
+  ">=": "<=",
+  "=": "=",
+};
+
+/**
+ * Collects the postfix expressions and assignment targets of a subtree.
+ */
+class ChainCollector extends CNextListener {
+  readonly postfixes: Parser.PostfixExpressionContext[] = [];
+
+  readonly targets: Parser.AssignmentTargetContext[] = [];
+
+  override enterPostfixExpression = (
+    ctx: Parser.PostfixExpressionContext,
+  ): void => {
+    this.postfixes.push(ctx);
+  };
+
+  override enterAssignmentTarget = (
+    ctx: Parser.AssignmentTargetContext,
+  ): void => {
+    this.targets.push(ctx);
+  };
+
+  static collect(nodes: (ParseTree | null | undefined)[]): ChainCollector {
+    const collector = new ChainCollector();
+    for (const node of nodes) {
+      if (node) {
+        ParseTreeWalker.DEFAULT.walk(collector, node);
+      }
+    }
+    return collector;
+  }
+}
+
+class IndexRangeAnalyzer {
+  private readonly entries: IBoundsReportEntry[] = [];
+
+  private readonly proven = new Set<Parser.ExpressionContext>();
+
+  private readonly globals = new Map<string, IVariable>();
+
+  /** Parameters, then one map per enclosing block */
+  private locals: Map<string, IVariable>[] = [];
+
+  private currentScope: string | null = null;
+
+  private constructor(
+    private readonly sourcePath: string,
+    private readonly constValues: Map<string, number>,
+  ) {}
+
+  /**
+   * Check every array subscript of one file.
+   *
+   * @param tree - Parsed C-Next program
+   * @param sourcePath - Path of the file the tree came from
+   * @param constValues - Compile-time constants by C name
+   */
+  static analyze(
+    tree: Parser.ProgramContext,
+    sourcePath: string,
+    constValues: Map<string, number>,
+  ): IIndexRangeResult {
+    const analyzer = new IndexRangeAnalyzer(sourcePath, constValues);
+    analyzer.collectGlobals(tree);
+    for (const decl of tree.declaration()) {
+      const func = decl.functionDeclaration();
+      if (func) {
+        analyzer.analyzeFunction(func, null);
+      }
+      const scope = decl.scopeDeclaration();
+      for (const member of scope?.scopeMember() ?? []) {
+        const scoped = member.functionDeclaration();
+        if (scoped) {
+          analyzer.analyzeFunction(scoped, scope!.IDENTIFIER().getText());
+        }
+      }
+    }
+    return { entries: analyzer.entries, proven: analyzer.proven };
+  }
+
+  // ===========================================================================
+  // Declarations
+  // ===========================================================================
+
+  private collectGlobals(tree: Parser.ProgramContext): void {
+    for (const decl of tree.declaration()) {
+      const variable = decl.variableDeclaration();
+      if (variable) {
+        this.globals.set(
+          variable.IDENTIFIER().getText(),
+          this.declareVariable(variable),
+        );
+      }
+      const scope = decl.scopeDeclaration();
+      for (const member of scope?.scopeMember() ?? []) {
+        const scoped = member.variableDeclaration();
+        if (scoped) {
+          const name = `${scope!.IDENTIFIER().getText()}_${scoped.IDENTIFIER().getText()}`;
+          this.globals.set(name, this.declareVariable(scoped));
+        }
+      }
+    }
+  }
+
+  private declareVariable(
+    ctx: Parser.VariableDeclarationContext | Parser.ForVarDeclContext,
+  ): IVariable {
+    const isVolatile =
+      ctx.atomicModifier() !== null || ctx.volatileModifier() !== null;
+    return this.declare(ctx.type(), ctx.arrayDimension(), isVolatile);
+  }
+
+  private declare(
+    typeCtx: Parser.TypeContext,
+    dimensions: Parser.ArrayDimensionContext[],
+    isVolatile: boolean,
+  ): IVariable {
+    const arrayType = typeCtx.arrayType();
+    const dims = [
+      ...(arrayType?.arrayTypeDimension() ?? []).map((dim) =>
+        this.evaluateDimension(dim.expression()),
+      ),
+      ...dimensions.map((dim) => this.evaluateDimension(dim.expression())),
+    ];
+    const primitive = arrayType
+      ? arrayType.primitiveType()
+      : typeCtx.primitiveType();
+    const range = primitive
+      ? IndexRangeAnalyzer.typeRange(primitive.getText())
+      : null;
+    if (dims.length > 0) {
+      return { range: null, dims, elementRange: range, isVolatile };
+    }
+    return { range, dims, elementRange: null, isVolatile };
+  }
+
+  private evaluateDimension(
+    expr: Parser.ExpressionContext | null,
+  ): number | null {
+    if (!expr) {
+      return null;
+    }
+    const size = ArrayDimensionParser.parseSingleDimension(expr, {
+      constValues: this.constValues,
+    });
+    return size ?? null;
+  }
+
+  private static typeRange(typeName: string): IRange | null {
+    if (typeName === "bool") {
+      return BOOL_RANGE;
+    }
+    const bounds = TYPE_RANGES[typeName];
+    if (!bounds) {
+      return null;
+    }
+    const toNumber = (value: bigint): number => {
+      if (value > BigInt(Number.MAX_SAFE_INTEGER)) {
+        return Infinity;
+      }
+      return value < BigInt(Number.MIN_SAFE_INTEGER)
+        ? -Infinity
+        : Number(value);
+    };
+    return { lo: toNumber(bounds[0]), hi: toNumber(bounds[1]) };
+  }
+
+  // ===========================================================================
+  // Statements
+  // ===========================================================================
+
+  private analyzeFunction(
+    func: Parser.FunctionDeclarationContext,
+    scope: string | null,
+  ): void {
+    this.currentScope = scope;
+    const params = new Map<string, IVariable>();
+    for (const param of func.parameterList()?.parameter() ?? []) {
+      params.set(
+        param.IDENTIFIER().getText(),
+        this.declare(param.type(), param.arrayDimension(), false),
+      );
+    }
+    this.locals = [params];
+    this.visitBlock(func.block(), new Map());
+    this.currentScope = null;
+  }
+
+  /**
+   * @returns Facts after the statement, null if it never completes normally
+   */
+  private visitStatement(
+    stmt: Parser.StatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    const decl = stmt.variableDeclaration();
+    if (decl) {
+      this.visitDeclaration(decl, decl.expression(), facts);
+      return facts;
+    }
+    const assignment = stmt.assignmentStatement();
+    if (assignment) {
+      this.visitAssignment(assignment, facts);
+      return facts;
+    }
+    const expression = stmt.expressionStatement()?.expression();
+    if (expression) {
+      this.visitExpression(expression, facts);
+      return facts;
+    }
+    const returned = stmt.returnStatement();
+    if (returned) {
+      const value = returned.expression();
+      if (value) {
+        this.visitExpression(value, facts);
+      }
+      return null;
+    }
+    return this.visitCompound(stmt, facts);
+  }
+
+  private visitCompound(
+    stmt: Parser.StatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    const ifStmt = stmt.ifStatement();
+    if (ifStmt) {
+      return this.visitIf(ifStmt, facts);
+    }
+    const whileStmt = stmt.whileStatement();
+    if (whileStmt) {
+      return this.visitWhile(whileStmt, facts);
+    }
+    const doWhile = stmt.doWhileStatement();
+    if (doWhile) {
+      return this.visitDoWhile(doWhile, facts);
+    }
+    const forStmt = stmt.forStatement();
+    if (forStmt) {
+      return this.visitFor(forStmt, facts);
+    }
+    const forever = stmt.foreverStatement();
+    if (forever) {
+      const entry = IndexRangeAnalyzer.forget(
+        this.clobbered([forever]),
+        facts,
+      );
+      this.visitBlock(forever.block(), entry);
+      return null;
+    }
+    const switchStmt = stmt.switchStatement();
+    if (switchStmt) {
+      return this.visitSwitch(switchStmt, facts);
+    }
+    const block = stmt.block() ?? stmt.criticalStatement()?.block();
+    return block ? this.visitBlock(block, facts) : facts;
+  }
+
+  private visitBlock(
+    block: Parser.BlockContext,
+    facts: TFacts,
+  ): TFacts | null {
+    this.locals.push(new Map());
+    let current = facts;
+    let isReachable = true;
+    for (const stmt of block.statement()) {
+      const after = this.visitStatement(stmt, current);
+      if (after) {
+        current = after;
+      } else {
+        // Still report accesses after a return, without any facts
+        isReachable = false;
+        current = new Map();
+      }
+    }
+    this.locals.pop();
+    return isReachable ? current : null;
+  }
+
+  private visitDeclaration(
+    decl: Parser.VariableDeclarationContext | Parser.ForVarDeclContext,
+    init: Parser.ExpressionContext | null,
+    facts: TFacts,
+  ): void {
+    if (init) {
+      this.visitExpression(init, facts);
+    }
+    const name = decl.IDENTIFIER().getText();
+    const variable = this.declareVariable(decl);
+    this.locals.at(-1)!.set(name, variable);
+    facts.delete(name);
+    if (init) {
+      this.assignFact(name, variable, this.rangeOf(init, facts), facts);
+    }
+  }
+
+  private visitAssignment(
+    ctx:
+      | Parser.AssignmentStatementContext
+      | Parser.ForAssignmentContext
+      | Parser.ForUpdateContext,
+    facts: TFacts,
+  ): void {
+    const value = ctx.expression();
+    const chain = IndexRangeAnalyzer.targetChain(ctx.assignmentTarget());
+    this.visitExpression(value, facts);
+    this.checkChain(chain, facts);
+    for (const step of chain.steps) {
+      step.indices.forEach((index) => this.visitExpression(index, facts));
+    }
+
+    const resolved = this.resolve(chain);
+    if (!resolved) {
+      return;
+    }
+    if (resolved.consumed < chain.steps.length) {
+      // Element, member or bit writes
+      facts.delete(resolved.key);
+      return;
+    }
+    const current = this.rangeOfVariable(resolved, facts);
+    const operand = this.rangeOf(value, facts);
+    const op = ctx.assignmentOperator().getText();
+    let range: IRange | null = null;
+    if (op === "<-") {
+      range = operand;
+    } else if (op === "+<-" || op === "-<-") {
+      range = IndexRangeAnalyzer.apply(op.charAt(0), current, operand);
+    }
+    this.assignFact(resolved.key, resolved.variable, range, facts);
+  }
+
+  private assignFact(
+    key: string,
+    variable: IVariable,
+    range: IRange | null,
+    facts: TFacts,
+  ): void {
+    const declared = variable.range;
+    if (
+      range &&
+      declared &&
+      !variable.isVolatile &&
+      range.lo >= declared.lo &&
+      range.hi <= declared.hi
+    ) {
+      facts.set(key, range);
+    } else {
+      facts.delete(key);
+    }
+  }
+
+  private visitIf(
+    ctx: Parser.IfStatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    const condition = ctx.expression();
+    this.visitExpression(condition, facts);
+    const [thenStmt, elseStmt] = ctx.statement();
+    const afterThen = this.visitStatement(
+      thenStmt,
+      this.narrow(condition, facts, true),
+    );
+    const whenFalse = this.narrow(condition, facts, false);
+    const afterElse = elseStmt
+      ? this.visitStatement(elseStmt, whenFalse)
+      : whenFalse;
+    return IndexRangeAnalyzer.join(afterThen, afterElse);
+  }
+
+  private visitWhile(
+    ctx: Parser.WhileStatementContext,
+    facts: TFacts,
+  ): TFacts {
+    const condition = ctx.expression();
+    const entry = IndexRangeAnalyzer.forget(this.clobbered([ctx]), facts);
+    this.visitExpression(condition, entry);
+    this.visitStatement(ctx.statement(), this.narrow(condition, entry, true));
+    return this.narrow(condition, entry, false);
+  }
+
+  private visitDoWhile(
+    ctx: Parser.DoWhileStatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    const condition = ctx.expression();
+    const entry = IndexRangeAnalyzer.forget(this.clobbered([ctx]), facts);
+    const afterBody = this.visitBlock(ctx.block(), entry);
+    this.visitExpression(condition, afterBody ?? new Map());
+    return afterBody ? this.narrow(condition, afterBody, false) : null;
+  }
+
+  private visitFor(
+    ctx: Parser.ForStatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    this.locals.push(new Map());
+    const before = new Map(facts);
+    const init = ctx.forInit();
+    const varDecl = init?.forVarDecl();
+    const initAssignment = init?.forAssignment();
+    if (varDecl) {
+      this.visitDeclaration(varDecl, varDecl.expression(), before);
+    } else if (initAssignment) {
+      this.visitAssignment(initAssignment, before);
+    }
+
+    const condition = ctx.expression();
+    const update = ctx.forUpdate();
+    const body = ctx.statement();
+    const entry = IndexRangeAnalyzer.forget(
+      this.clobbered([body, condition, update]),
+      before,
+    );
+    if (condition && update) {
+      this.keepInitialBound(update, body, condition, before, entry);
+    }
+    if (condition) {
+      this.visitExpression(condition, entry);
+    }
+    const head = condition ? this.narrow(condition, entry, true) : entry;
+    this.visitStatement(body, new Map(head));
+    if (update) {
+      this.visitAssignment(update, new Map(head));
+    }
+    this.locals.pop();
+    return condition ? this.narrow(condition, entry, false) : null;
+  }
+
+  /**
+   * i +<- k (k >= 0) keeps i at or above its initial value, i -<- k at or
+   * below it, as long as nothing else assigns i and the step cannot wrap
+   * past what the condition allows.
+   */
+  private keepInitialBound(
+    update: Parser.ForUpdateContext,
+    body: Parser.StatementContext,
+    condition: Parser.ExpressionContext,
+    before: TFacts,
+    entry: TFacts,
+  ): void {
+    const op = update.assignmentOperator().getText();
+    const chain = IndexRangeAnalyzer.targetChain(update.assignmentTarget());
+    const resolved = this.resolve(chain);
+    const declared = resolved?.variable.range;
+    if (
+      (op !== "+<-" && op !== "-<-") ||
+      !resolved ||
+      !declared ||
+      resolved.consumed < chain.steps.length ||
+      IndexRangeAnalyzer.isClobbered(
+        resolved.key,
+        this.clobbered([body, condition, update.expression()]),
+      )
+    ) {
+      return;
+    }
+    const initial = before.get(resolved.key);
+    const step = this.rangeOf(update.expression(), entry);
+    if (!initial || !step || step.lo < 0) {
+      return;
+    }
+    const head =
+      this.narrow(condition, entry, true).get(resolved.key) ?? declared;
+    if (op === "+<-" && head.hi + step.hi <= declared.hi) {
+      entry.set(resolved.key, { lo: initial.lo, hi: declared.hi });
+    } else if (op === "-<-" && head.lo - step.hi >= declared.lo) {
+      entry.set(resolved.key, { lo: declared.lo, hi: initial.hi });
+    }
+  }
+
+  private visitSwitch(
+    ctx: Parser.SwitchStatementContext,
+    facts: TFacts,
+  ): TFacts | null {
+    this.visitExpression(ctx.expression(), facts);
+    const defaultCase = ctx.defaultCase();
+    const blocks = ctx.switchCase().map((c) => c.block());
+    if (defaultCase) {
+      blocks.push(defaultCase.block());
+    }
+    // Without a default, no case may match
+    let result: TFacts | null = defaultCase ? null : facts;
+    for (const block of blocks) {
+      result = IndexRangeAnalyzer.join(
+        result,
+        this.visitBlock(block, new Map(facts)),
+      );
+    }
+    return result;
+  }
+
+  /**
+   * Hull of the facts on two paths; null stands for a path that returned.
+   */
+  private static join(a: TFacts | null, b: TFacts | null): TFacts | null {
+    if (!a || !b) {
+      return a ?? b;
+    }
+    const joined: TFacts = new Map();
+    for (const [key, range] of a) {
+      const other = b.get(key);
+      if (other) {
+        joined.set(key, {
+          lo: Math.min(range.lo, other.lo),
+          hi: Math.max(range.hi, other.hi),
+        });
+      }
+    }
+    return joined;
+  }
+
+  // ===========================================================================
+  // Side effects
+  // ===========================================================================
+
+  /**
+   * Check the subscripts of an expression, then drop facts its calls may
+   * invalidate.
+   */
+  private visitExpression(
+    expr: Parser.ExpressionContext,
+    facts: TFacts,
+  ): void {
+    const found = ChainCollector.collect([expr]);
+    for (const postfix of found.postfixes) {
+      const chain = this.postfixChain(postfix);
+      if (chain) {
+        this.checkChain(chain, facts);
+      }
+    }
+    const clobbered: IClobbered = { keys: new Set(), hasCall: false };
+    this.addCallEffects(found, clobbered);
+    for (const key of facts.keys()) {
+      if (IndexRangeAnalyzer.isClobbered(key, clobbered)) {
+        facts.delete(key);
+      }
+    }
+  }
+
+  private clobbered(nodes: (ParseTree | null | undefined)[]): IClobbered {
+    const found = ChainCollector.collect(nodes);
+    const clobbered: IClobbered = { keys: new Set(), hasCall: false };
+    for (const target of found.targets) {
+      const resolved = this.resolve(IndexRangeAnalyzer.targetChain(target));
+      if (resolved) {
+        clobbered.keys.add(resolved.key);
+      }
+    }
+    this.addCallEffects(found, clobbered);
+    return clobbered;
+  }
+
+  private addCallEffects(found: ChainCollector, clobbered: IClobbered): void {
+    for (const postfix of found.postfixes) {
+      for (const op of postfix.postfixOp()) {
+        if (op.getChild(0)?.getText() !== "(") {
+          continue;
+        }
+        clobbered.hasCall = true;
+        for (const arg of op.argumentList()?.expression() ?? []) {
+          const resolved = this.soleVariable(arg);
+          if (resolved) {
+            clobbered.keys.add(resolved.key);
+          }
+        }
+      }
+    }
+  }
+
+  private static isClobbered(key: string, clobbered: IClobbered): boolean {
+    return (
+      clobbered.keys.has(key) ||
+      (clobbered.hasCall && key.startsWith("global."))
+    );
+  }
+
+  private static forget(clobbered: IClobbered, facts: TFacts): TFacts {
+    const kept: TFacts = new Map();
+    for (const [key, range] of facts) {
+      if (!IndexRangeAnalyzer.isClobbered(key, clobbered)) {
+        kept.set(key, range);
+      }
+    }
+    return kept;
+  }
+
+  // ===========================================================================
+  // Subscripts
+  // ===========================================================================
+
+  private checkChain(chain: IChain, facts: TFacts): void {
+    const resolved = this.resolve(chain);
+    if (!resolved || resolved.variable.dims.length === 0) {
+      return;
+    }
+    const { dims } = resolved.variable;
+    let access =
+      chain.root +
+      chain.steps
+        .slice(0, resolved.consumed)
+        .map((step) => step.text)
+        .join("");
+    for (let dim = 0; dim < dims.length; dim++) {
+      // Members, calls and bit ranges end the array part of the chain
+      const step = chain.steps[resolved.consumed + dim];
+      if (step?.indices.length !== 1) {
+        return;
+      }
+      access += step.text;
+      this.record(step.indices[0], access, dims[dim], facts);
+    }
+  }
+
+  private record(
+    index: Parser.ExpressionContext,
+    access: string,
+    size: number | null,
+    facts: TFacts,
+  ): void {
+    const range = this.rangeOf(index, facts);
+    const isProven =
+      size !== null && range !== null && range.lo >= 0 && range.hi < size;
+    if (isProven) {
+      this.proven.add(index);
+    }
+    const isBounded =
+      range !== null && Number.isFinite(range.lo) && Number.isFinite(range.hi);
+    this.entries.push({
+      sourcePath: this.sourcePath,
+      line: index.start?.line ?? 0,
+      column: index.start?.column ?? 0,
+      access,
+      size,
+      isProven,
+      indexRange: isBounded ? `${range.lo}..${range.hi}` : null,
+    });
+  }
+
+  // ===========================================================================
+  // Names
+  // ===========================================================================
+
+  private postfixChain(ctx: Parser.PostfixExpressionContext): IChain | null {
+    const primary = ctx.primaryExpression();
+    let root: string;
+    if (primary.THIS()) {
+      root = "this";
+    } else if (primary.GLOBAL()) {
+      root = "global";
+    } else if (primary.IDENTIFIER()) {
+      root = primary.IDENTIFIER()!.getText();
+    } else {
+      return null;
+    }
+    const steps = ctx.postfixOp().map((op) => IndexRangeAnalyzer.toStep(op));
+    return { root, steps };
+  }
+
+  private static targetChain(ctx: Parser.AssignmentTargetContext): IChain {
+    const steps = ctx.postfixTargetOp().map((op) => this.toStep(op));
+    const id = ctx.IDENTIFIER().getText();
+    if (!ctx.THIS() && !ctx.GLOBAL()) {
+      return { root: id, steps };
+    }
+    const member: IStep = { text: `.${id}`, member: id, indices: [] };
+    return { root: ctx.THIS() ? "this" : "global", steps: [member, ...steps] };
+  }
+
+  private static toStep(
+    op: Parser.PostfixOpContext | Parser.PostfixTargetOpContext,
+  ): IStep {
+    // Call arguments sit inside argumentList, so calls have no indices
+    return {
+      text: op.getText(),
+      member: op.IDENTIFIER()?.getText() ?? null,
+      indices: op.expression(),
+    };
+  }
+
+  /**
+   * x, this.x, global.x, global.Scope.x or Scope.x
+   */
+  private resolve(chain: IChain): IResolved | null {
+    const { root, steps } = chain;
+    const first = steps[0]?.member;
+    const second = steps[1]?.member;
+    if (root === "this") {
+      return this.currentScope && first
+        ? this.lookupGlobal(`${this.currentScope}_${first}`, 1)
+        : null;
+    }
+    if (root === "global") {
+      if (!first) {
+        return null;
+      }
+      const scoped = second ? this.lookupGlobal(`${first}_${second}`, 2) : null;
+      return scoped ?? this.lookupGlobal(first, 1);
+    }
+    for (let i = this.locals.length - 1; i >= 0; i--) {
+      const variable = this.locals[i].get(root);
+      if (variable) {
+        return { key: root, cName: root, variable, consumed: 0 };
+      }
+    }
+    const scopeMember = this.currentScope
+      ? this.lookupGlobal(`${this.currentScope}_${root}`, 0)
+      : null;
+    const qualified = first ? this.lookupGlobal(`${root}_${first}`, 1) : null;
+    return scopeMember ?? this.lookupGlobal(root, 0) ?? qualified;
+  }
+
+  private lookupGlobal(cName: string, consumed: number): IResolved | null {
+    const variable = this.globals.get(cName);
+    return variable
+      ? { key: `global.${cName}`, cName, variable, consumed }
+      : null;
+  }
+
+  /**
+   * The integer variable an operand consists of (x, this.x, &x)
+   */
+  private soleVariable(ctx: ParseTree): IResolved | null {
+    let node: ParseTree | null = ctx;
+    while (node && !(node instanceof Parser.PostfixExpressionContext)) {
+      const isAddressOf =
+        node instanceof Parser.UnaryExpressionContext &&
+        node.getChild(0)?.getText() === "&";
+      if (node.getChildCount() !== 1 && !isAddressOf) {
+        return null;
+      }
+      node = node.getChild(node.getChildCount() - 1);
+    }
+    const chain = node ? this.postfixChain(node) : null;
+    const resolved = chain ? this.resolve(chain) : null;
+    if (
+      !resolved?.variable.range ||
+      resolved.consumed !== chain!.steps.length
+    ) {
+      return null;
+    }
+    return resolved;
+  }
+
+  // ===========================================================================
+  // Ranges
+  // ===========================================================================
+
+  private rangeOfVariable(resolved: IResolved, facts: TFacts): IRange | null {
+    return facts.get(resolved.key) ?? resolved.variable.range;
+  }
+
+  private rangeOf(ctx: ParseTree, facts: TFacts): IRange | null {
+    if (ctx instanceof Parser.PostfixExpressionContext) {
+      return this.rangeOfPostfix(ctx, facts);
+    }
+    if (ctx instanceof Parser.TernaryExpressionContext) {
+      const branches = ctx.orExpression();
+      if (branches.length === 3) {
+        const a = this.rangeOf(branches[1], facts);
+        const b = this.rangeOf(branches[2], facts);
+        return a && b
+          ? { lo: Math.min(a.lo, b.lo), hi: Math.max(a.hi, b.hi) }
+          : null;
+      }
+    }
+    if (ctx.getChildCount() === 1) {
+      return this.rangeOf(ctx.getChild(0)!, facts);
+    }
+    if (ctx instanceof Parser.UnaryExpressionContext) {
+      return this.rangeOfUnary(ctx, facts);
+    }
+    if (
+      ctx instanceof Parser.OrExpressionContext ||
+      ctx instanceof Parser.AndExpressionContext ||
+      ctx instanceof Parser.EqualityExpressionContext ||
+      ctx instanceof Parser.RelationalExpressionContext
+    ) {
+      return BOOL_RANGE;
+    }
+    if (
+      ctx instanceof Parser.BitwiseOrExpressionContext ||
+      ctx instanceof Parser.BitwiseXorExpressionContext ||
+      ctx instanceof Parser.BitwiseAndExpressionContext ||
+      ctx instanceof Parser.ShiftExpressionContext ||
+      ctx instanceof Parser.AdditiveExpressionContext ||
+      ctx instanceof Parser.MultiplicativeExpressionContext
+    ) {
+      let result = this.rangeOf(ctx.getChild(0)!, facts);
+      for (let i = 1; i + 1 < ctx.getChildCount(); i += 2) {
+        const right = this.rangeOf(ctx.getChild(i + 1)!, facts);
+        result = IndexRangeAnalyzer.apply(
+          ctx.getChild(i)!.getText(),
+          result,
+          right,
+        );
+      }
+      return result;
+    }
+    return null;
+  }
+
+  private rangeOfUnary(
+    ctx: Parser.UnaryExpressionContext,
+    facts: TFacts,
+  ): IRange | null {
+    const op = ctx.getChild(0)!.getText();
+    const operand = ctx.unaryExpression();
+    if (op === "!") {
+      return BOOL_RANGE;
+    }
+    // Only negative literals: negating an unsigned value wraps
+    const literal = operand?.postfixExpression()?.primaryExpression().literal();
+    const value = literal ? IndexRangeAnalyzer.literalValue(literal) : null;
+    return op === "-" && value !== null ? { lo: -value, hi: -value } : null;
+  }
+
+  private rangeOfPostfix(
+    ctx: Parser.PostfixExpressionContext,
+    facts: TFacts,
+  ): IRange | null {
+    const primary = ctx.primaryExpression();
+    if (ctx.postfixOp().length === 0) {
+      const literal = primary.literal();
+      if (literal) {
+        const value = IndexRangeAnalyzer.literalValue(literal);
+        return value === null ? null : { lo: value, hi: value };
+      }
+      const inner = primary.expression();
+      if (inner) {
+        return this.rangeOf(inner, facts);
+      }
+      const cast = primary.castExpression();
+      if (cast) {
+        return this.rangeOfCast(cast, facts);
+      }
+    }
+
+    const chain = this.postfixChain(ctx);
+    const resolved = chain ? this.resolve(chain) : null;
+    if (!chain || !resolved) {
+      const constant =
+        chain?.steps.length === 0
+          ? this.constValues.get(chain.root)
+          : undefined;
+      return constant === undefined ? null : { lo: constant, hi: constant };
+    }
+    const rest = chain.steps.slice(resolved.consumed);
+    const { variable } = resolved;
+    if (variable.dims.length === 0) {
+      const constant = resolved.key.startsWith("global.")
+        ? this.constValues.get(resolved.cName)
+        : undefined;
+      if (rest.length === 0) {
+        return constant === undefined
+          ? this.rangeOfVariable(resolved, facts)
+          : { lo: constant, hi: constant };
+      }
+      // Single bit of an integer
+      const isBit = rest.length === 1 && rest[0].indices.length === 1;
+      return isBit && variable.range ? BOOL_RANGE : null;
+    }
+
+    const indexed = rest.findIndex((step) => step.indices.length !== 1);
+    const depth = indexed === -1 ? rest.length : indexed;
+    if (depth === rest.length) {
+      return depth === variable.dims.length ? variable.elementRange : null;
+    }
+    const member = rest[depth].member;
+    const size = variable.dims[depth];
+    const isCount = member === "element_count" || member === "length";
+    if (isCount && depth + 1 === rest.length && size !== null) {
+      return { lo: size, hi: size };
+    }
+    return null;
+  }
+
+  /**
+   * (u8)x is within u8 whatever x is
+   */
+  private rangeOfCast(
+    ctx: Parser.CastExpressionContext,
+    facts: TFacts,
+  ): IRange | null {
+    const target = IndexRangeAnalyzer.typeRange(ctx.type().getText());
+    const inner = this.rangeOf(ctx.unaryExpression(), facts);
+    if (inner && target && inner.lo >= target.lo && inner.hi <= target.hi) {
+      return inner;
+    }
+    return target;
+  }
+
+  private static literalValue(ctx: Parser.LiteralContext): number | null {
+    const text = ctx.getText();
+    if (text === "true" || text === "false") {
+      return text === "true" ? 1 : 0;
+    }
+    if (ctx.CHAR_LITERAL()) {
+      return text.length === 3 ? text.codePointAt(1)! : null;
+    }
+    const unsuffixed = text.replace(/[ui](8|16|32|64)$/, "");
+    return LiteralUtils.parseIntegerLiteral(unsuffixed) ?? null;
+  }
+
+  /**
+   * One binary operator on two operand ranges. Results of + - * << outside
+   * [0, INT32_MAX] are dropped: they may have wrapped.
+   */
+  private static apply(
+    op: string,
+    a: IRange | null,
+    b: IRange | null,
+  ): IRange | null {
+    if (op === "&") {
+      // Either non-negative operand bounds the result
+      const masks = [a, b].filter((r): r is IRange => r !== null && r.lo >= 0);
+      return masks.length > 0
+        ? { lo: 0, hi: Math.min(...masks.map((mask) => mask.hi)) }
+        : null;
+    }
+    if (!a || !b) {
+      return null;
+    }
+    const isNonNegative = a.lo >= 0 && b.lo >= 0;
+    switch (op) {
+      case "+":
+        return this.window(a.lo + b.lo, a.hi + b.hi);
+      case "-":
+        return this.window(a.lo - b.hi, a.hi - b.lo);
+      case "*": {
+        const products = [a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi];
+        return this.window(Math.min(...products), Math.max(...products));
+      }
+      case "<<":
+        return isNonNegative && b.hi < 32
+          ? this.window(a.lo * 2 ** b.lo, a.hi * 2 ** b.hi)
+          : null;
+      case ">>":
+        return isNonNegative
+          ? {
+              lo: Math.floor(a.lo / 2 ** b.hi),
+              hi: Math.floor(a.hi / 2 ** b.lo),
+            }
+          : null;
+      case "/":
+        return a.lo >= 0 && b.lo >= 1
+          ? { lo: Math.floor(a.lo / b.hi), hi: Math.floor(a.hi / b.lo) }
+          : null;
+      case "%":
+        return a.lo >= 0 && b.lo >= 1
+          ? { lo: 0, hi: Math.min(a.hi, b.hi - 1) }
+          : null;
+      case "|":
+      case "^": {
+        const hi = Math.max(a.hi, b.hi);
+        return isNonNegative && hi <= INT32_MAX
+          ? { lo: 0, hi: 2 ** Math.ceil(Math.log2(hi + 1)) - 1 }
+          : null;
+      }
+      default:
+        return null;
+    }
+  }
+
+  private static window(lo: number, hi: number): IRange | null {
+    return lo >= 0 && hi <= INT32_MAX ? { lo, hi } : null;
+  }
+
+  // ===========================================================================
+  // Conditions
+  // ===========================================================================
+
+  /**
+   * Facts that hold where `ctx` evaluated to `truth`
+   */
+  private narrow(
+    ctx: Parser.ExpressionContext,
+    facts: TFacts,
+    truth: boolean,
+  ): TFacts {
+    const narrowed = new Map(facts);
+    this.applyCondition(ctx, narrowed, truth);
+    return narrowed;
+  }
+
+  private applyCondition(ctx: ParseTree, facts: TFacts, truth: boolean): void {
+    if (ctx instanceof Parser.OrExpressionContext) {
+      // !(a || b) is !a && !b
+      const terms = ctx.andExpression();
+      if (terms.length === 1 || !truth) {
+        terms.forEach((term) => this.applyCondition(term, facts, truth));
+      }
+    } else if (ctx instanceof Parser.AndExpressionContext) {
+      const terms = ctx.equalityExpression();
+      if (terms.length === 1 || truth) {
+        terms.forEach((term) => this.applyCondition(term, facts, truth));
+      }
+    } else if (ctx instanceof Parser.EqualityExpressionContext) {
+      const sides = ctx.relationalExpression();
+      const isEqual = ctx.getChild(1)?.getText() === "=";
+      if (sides.length === 1) {
+        this.applyCondition(sides[0], facts, truth);
+      } else if (sides.length === 2 && isEqual === truth) {
+        this.applyComparison(sides[0], "=", sides[1], facts);
+      }
+    } else if (ctx instanceof Parser.RelationalExpressionContext) {
+      const sides = ctx.bitwiseOrExpression();
+      const op = ctx.getChild(1)?.getText() ?? "";
+      if (sides.length === 2) {
+        const tested = truth ? op : NEGATED[op];
+        this.applyComparison(sides[0], tested, sides[1], facts);
+      } else if (sides.length === 1) {
+        this.applyCondition(sides[0], facts, truth);
+      }
+    } else if (ctx instanceof Parser.UnaryExpressionContext) {
+      if (ctx.getChild(0)?.getText() === "!") {
+        this.applyCondition(ctx.unaryExpression()!, facts, !truth);
+      } else if (ctx.postfixExpression()) {
+        this.applyCondition(ctx.postfixExpression()!, facts, truth);
+      }
+    } else if (ctx instanceof Parser.PostfixExpressionContext) {
+      // (i < N) && ...
+      const inner = ctx.primaryExpression().expression();
+      if (inner && ctx.postfixOp().length === 0) {
+        this.applyCondition(inner, facts, truth);
+      }
+    } else if (ctx.getChildCount() === 1) {
+      this.applyCondition(ctx.getChild(0)!, facts, truth);
+    }
+  }
+
+  private applyComparison(
+    left: ParseTree,
+    op: string,
+    right: ParseTree,
+    facts: TFacts,
+  ): void {
+    const leftRange = this.rangeOf(left, facts);
+    const rightRange = this.rangeOf(right, facts);
+    this.narrowVariable(left, op, rightRange, facts);
+    this.narrowVariable(right, MIRRORED[op], leftRange, facts);
+  }
+
+  private narrowVariable(
+    side: ParseTree,
+    op: string,
+    bound: IRange | null,
+    facts: TFacts,
+  ): void {
+    const resolved = this.soleVariable(side);
+    if (!bound || !resolved || resolved.variable.isVolatile) {
+      return;
+    }
+    let { lo, hi } = this.rangeOfVariable(resolved, facts)!;
+    if (op === "<" || op === "<=") {
+      hi = Math.min(hi, op === "<" ? bound.hi - 1 : bound.hi);
+    } else if (op === ">" || op === ">=") {
+      lo = Math.max(lo, op === ">" ? bound.lo + 1 : bound.lo);
+    } else if (op === "=") {
+      lo = Math.max(lo, bound.lo);
+      hi = Math.min(hi, bound.hi);
+    }
+    if (lo <= hi) {
+      facts.set(resolved.key, { lo, hi });
+    }
+  }
+}
+
+export default IndexRangeAnalyzer;
@@ -0,0 +1,136 @@
+/**
+ * MemoryFootprintEstimator - Static storage per variable (--memory-report)
+ *
+ * All allocation is static (ADR-003), so every top-level and scope variable
+ * has a size known at transpile time. Each one is assigned to the section
+ * the C compiler places it in:
+ * - const variables: .rodata (flash)
+ * - no initializer, or an all-zero one: .bss (RAM, zeroed at startup)
+ * - anything else: .data (RAM, copied from flash at startup)
+ *
+ * Private non-array constants are inlined (Issue #282) and registers are
+ * memory-mapped, so neither takes storage. Function locals are covered by
+ * the stack report.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import DeclarationLayoutResolver from "./DeclarationLayoutResolver";
+import ScopeUtils from "../../../../utils/ScopeUtils";
+import IMemoryReportEntry from "../../../types/IMemoryReportEntry";
+
+/** Initializers the compiler places in .bss: 0, 0x00, 0.0, false, [0*] */
+const ZERO_INITIALIZER =
+  /^(?:\[)?(?:0+[uUlL]*|0[xXbB]0+|0+\.0*[fF]?|false)(?:\*\])?$/;
+
+class MemoryFootprintEstimator {
+  /**
+   * Estimate the storage of every variable defined in one file.
+   *
+   * @param tree - Parsed C-Next program
+   * @param sourcePath - Path of the file the tree came from
+   * @param resolver - Declaration sizes for the target
+   * @param deadSymbols - C names removed by dead code elimination
+   */
+  static estimate(
+    tree: Parser.ProgramContext,
+    sourcePath: string,
+    resolver: DeclarationLayoutResolver,
+    deadSymbols: ReadonlySet<string> = new Set(),
+  ): IMemoryReportEntry[] {
+    const entries: IMemoryReportEntry[] = [];
+    const add = (
+      varDecl: Parser.VariableDeclarationContext,
+      scope: string | null,
+    ): void => {
+      const id = varDecl.IDENTIFIER().getText();
+      const name = scope ? `${scope}_${id}` : id;
+      if (!deadSymbols.has(name)) {
+        entries.push(
+          MemoryFootprintEstimator.createEntry(
+            varDecl,
+            name,
+            scope,
+            sourcePath,
+            resolver,
+          ),
+        );
+      }
+    };
+
+    for (const decl of tree.declaration()) {
+      const varDecl = decl.variableDeclaration();
+      if (varDecl) {
+        add(varDecl, null);
+      }
+      const scopeDecl = decl.scopeDeclaration();
+      if (!scopeDecl) {
+        continue;
+      }
+      const scopeName = scopeDecl.IDENTIFIER().getText();
+      for (const member of scopeDecl.scopeMember()) {
+        const memberVar = member.variableDeclaration();
+        if (!memberVar) {
+          continue;
+        }
+        // ADR-016: variables default to private
+        const visibility =
+          member.visibilityModifier()?.getText() ??
+          ScopeUtils.getDefaultVisibility(false);
+        const isPrivate = visibility === "private";
+        if (!isPrivate || !MemoryFootprintEstimator.isInlinedConst(memberVar)) {
+          add(memberVar, scopeName);
+        }
+      }
+    }
+    return entries;
+  }
+
+  private static createEntry(
+    varDecl: Parser.VariableDeclarationContext,
+    name: string,
+    scope: string | null,
+    sourcePath: string,
+    resolver: DeclarationLayoutResolver,
+  ): IMemoryReportEntry {
+    // C++ constructor syntax: class objects have no known layout
+    const layout = varDecl.constructorArgumentList()
+      ? null
+      : resolver.getLayout(varDecl.type(), varDecl.arrayDimension(), scope);
+    return {
+      sourcePath,
+      scope,
+      name,
+      size: layout?.size ?? null,
+      align: layout?.align ?? 0,
+      section: MemoryFootprintEstimator.getSection(varDecl),
+    };
+  }
+
+  private static getSection(
+    varDecl: Parser.VariableDeclarationContext,
+  ): IMemoryReportEntry["section"] {
+    if (varDecl.constModifier()) {
+      return "rodata";
+    }
+    const init = varDecl.expression();
+    if (varDecl.constructorArgumentList() || !init) {
+      return "bss";
+    }
+    return ZERO_INITIALIZER.test(init.getText()) ? "bss" : "data";
+  }
+
+  /**
+   * Private scalar constants are inlined at their uses (Issue #282).
+   */
+  private static isInlinedConst(
+    varDecl: Parser.VariableDeclarationContext,
+  ): boolean {
+    return (
+      varDecl.constModifier() !== null &&
+      varDecl.arrayDimension().length === 0 &&
+      varDecl.type().arrayType() === null
+    );
+  }
+}
+
+export default MemoryFootprintEstimator;
@@ -0,0 +1,89 @@
+/**
+ * MemoryReportBuilder - Totals and baseline diff for the memory report
+ *
+ * RAM is .data plus .bss, flash is .rodata. .data initializers also occupy
+ * flash (copied to RAM at startup) but are counted as RAM only, matching
+ * how the report is read: what a change costs in the scarcer resource.
+ */
+
+import IMemoryReportEntry from "../../../types/IMemoryReportEntry";
+import IMemoryDiffEntry from "../../../types/IMemoryDiffEntry";
+
+/** RAM and flash bytes of a group of variables */
+interface IMemoryTotals {
+  ram: number;
+  flash: number;
+}
+
+class MemoryReportBuilder {
+  /**
+   * Sum RAM and flash bytes. Variables of unknown size count as 0.
+   */
+  static totals(entries: readonly IMemoryReportEntry[]): IMemoryTotals {
+    const totals: IMemoryTotals = { ram: 0, flash: 0 };
+    for (const entry of entries) {
+      if (entry.section === "rodata") {
+        totals.flash += entry.size ?? 0;
+      } else {
+        totals.ram += entry.size ?? 0;
+      }
+    }
+    return totals;
+  }
+
+  /**
+   * Group entries by a key (source file or scope), keeping first-seen order.
+   */
+  static groupBy(
+    entries: readonly IMemoryReportEntry[],
+    key: (entry: IMemoryReportEntry) => string,
+  ): Map<string, IMemoryReportEntry[]> {
+    const groups = new Map<string, IMemoryReportEntry[]>();
+    for (const entry of entries) {
+      const group = groups.get(key(entry));
+      if (group) {
+        group.push(entry);
+      } else {
+        groups.set(key(entry), [entry]);
+      }
+    }
+    return groups;
+  }
+
+  /**
+   * Variables whose size changed, appeared or disappeared since the
+   * baseline, largest growth first.
+   */
+  static diff(
+    baseline: readonly IMemoryReportEntry[],
+    current: readonly IMemoryReportEntry[],
+  ): IMemoryDiffEntry[] {
+    const before = new Map(baseline.map((e) => [e.name, e]));
+    const after = new Map(current.map((e) => [e.name, e]));
+    const names = new Set([...before.keys(), ...after.keys()]);
+
+    const changes: IMemoryDiffEntry[] = [];
+    for (const name of names) {
+      const old = before.get(name);
+      const now = after.get(name);
+      const baselineSize = old?.size ?? 0;
+      const size = now?.size ?? 0;
+      if (old && now && baselineSize === size) {
+        continue;
+      }
+      changes.push({
+        name,
+        baselineSize,
+        size,
+        isFlash: (now ?? old)!.section === "rodata",
+      });
+    }
+    return changes.sort(
+      (a, b) =>
+        b.size - b.baselineSize - (a.size - a.baselineSize) ||
+        a.name.localeCompare(b.name),
+    );
+  }
+}
+
+export default MemoryReportBuilder;
@@ -0,0 +1,170 @@
+/**
+ * StackFrameEstimator - Per-function stack frame estimates (--stack-report)
+ *
+ * C-Next has no recursion (define-before-use) and no heap (ADR-003), and
+ * every local has a declared type and array size, so a function's frame can
+ * be bounded from the source alone. A frame is the sum of:
+ * - parameters: primitives by value (at least one pointer-sized slot);
+ *   structs, strings and arrays by reference (one pointer)
+ * - every local in the body, as if all blocks were live at once
+ * - call overhead: return address and saved frame pointer
+ *
+ * Register spills and compiler temporaries are only covered by the call
+ * overhead; calls into C/C++ code are not counted.
+ */
+
+import { ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../../../logic/parser/grammar/CNextListener";
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import TypeLayoutCalculator from "./TypeLayoutCalculator";
+import DeclarationLayoutResolver from "./DeclarationLayoutResolver";
+import TYPE_WIDTH from "../types/TYPE_WIDTH";
+import IStackFrame from "../../../types/IStackFrame";
+
+/**
+ * Collects one frame per function definition in a file.
+ */
+class FrameListener extends CNextListener {
+  readonly frames: IStackFrame[] = [];
+
+  private currentScope: string | null = null;
+
+  private current: IStackFrame | null = null;
+
+  private callees: Set<string> = new Set();
+
+  constructor(
+    private readonly sourcePath: string,
+    private readonly resolver: DeclarationLayoutResolver,
+  ) {
+    super();
+  }
+
+  private get pointerSize(): number {
+    return this.resolver.pointerSize;
+  }
+
+  override enterScopeDeclaration = (
+    ctx: Parser.ScopeDeclarationContext,
+  ): void => {
+    this.currentScope = ctx.IDENTIFIER().getText();
+  };
+
+  override exitScopeDeclaration = (): void => {
+    this.currentScope = null;
+  };
+
+  override enterFunctionDeclaration = (
+    ctx: Parser.FunctionDeclarationContext,
+  ): void => {
+    const name = ctx.IDENTIFIER().getText();
+    this.current = {
+      name: this.currentScope ? `${this.currentScope}_${name}` : name,
+      sourcePath: this.sourcePath,
+      isTopLevel: !this.currentScope,
+      frameSize: 2 * this.pointerSize,
+      callees: [],
+      isComplete: true,
+    };
+    this.callees = new Set();
+    for (const param of ctx.parameterList()?.parameter() ?? []) {
+      this.current.frameSize += this.getParameterSize(param);
+    }
+  };
+
+  override exitFunctionDeclaration = (): void => {
+    if (this.current) {
+      this.current.callees = [...this.callees];
+      this.frames.push(this.current);
+      this.current = null;
+    }
+  };
+
+  /**
+   * Locals (scope variables are outside any function and skipped)
+   */
+  override enterVariableDeclaration = (
+    ctx: Parser.VariableDeclarationContext,
+  ): void => {
+    if (!this.current) {
+      return;
+    }
+    const layout = this.resolver.getLayout(
+      ctx.type(),
+      ctx.arrayDimension(),
+      this.currentScope,
+    );
+    if (!layout) {
+      this.current.isComplete = false;
+      return;
+    }
+    this.current.frameSize =
+      TypeLayoutCalculator.alignUp(this.current.frameSize, layout.align) +
+      layout.size;
+  };
+
+  /**
+   * fn, Scope.fn, this.fn and global.Scope.fn, called or passed as callbacks
+   */
+  override enterPostfixExpression = (
+    ctx: Parser.PostfixExpressionContext,
+  ): void => {
+    if (!this.current) {
+      return;
+    }
+    const primary = ctx.primaryExpression();
+    const members = ctx
+      .postfixOp()
+      .map((op) => op.IDENTIFIER()?.getText())
+      .filter((id): id is string => id !== undefined);
+    if (primary.IDENTIFIER()) {
+      const id = primary.IDENTIFIER()!.getText();
+      this.callees.add(id);
+      if (members[0]) {
+        this.callees.add(`${id}_${members[0]}`);
+      }
+    } else if (primary.THIS() && members[0] && this.currentScope) {
+      this.callees.add(`${this.currentScope}_${members[0]}`);
+    } else if (primary.GLOBAL() && members[0]) {
+      this.callees.add(members[0]);
+      if (members[1]) {
+        this.callees.add(`${members[0]}_${members[1]}`);
+      }
+    }
+  };
+
+  /**
+   * Primitives are passed by value, everything else by reference.
+   */
+  private getParameterSize(param: Parser.ParameterContext): number {
+    const typeCtx = param.type();
+    const isArray =
+      typeCtx.arrayType() !== null || param.arrayDimension().length > 0;
+    const typeName = this.resolver.getTypeName(typeCtx, this.currentScope);
+    if (isArray || !typeName || !TYPE_WIDTH[typeName]) {
+      return this.pointerSize;
+    }
+    return Math.max(TYPE_WIDTH[typeName] / 8, this.pointerSize);
+  }
+}
+
+class StackFrameEstimator {
+  /**
+   * Estimate the frame of every function defined in one file.
+   *
+   * @param tree - Parsed C-Next program
+   * @param sourcePath - Path of the file the tree came from
+   * @param resolver - Declaration sizes for the target
+   */
+  static estimate(
+    tree: Parser.ProgramContext,
+    sourcePath: string,
+    resolver: DeclarationLayoutResolver,
+  ): IStackFrame[] {
+    const listener = new FrameListener(sourcePath, resolver);
+    ParseTreeWalker.DEFAULT.walk(listener, tree);
+    return listener.frames;
+  }
+}
+
+export default StackFrameEstimator;
@@ -0,0 +1,111 @@
+/**
+ * StackReportBuilder - Worst-case stack depth per entry point (--stack-report)
+ *
+ * Combines the per-function frames of every file into call paths. Entry
+ * points are `main` and every top-level function no C-Next code calls
+ * (interrupt handlers, startup hooks). Without recursion the call graph is
+ * acyclic, so the deepest path from each entry point is a sound bound on
+ * its C-Next frames.
+ *
+ * Interrupt nesting: with nested interrupts enabled, every handler can
+ * preempt main and each other once, so the combined worst case is the sum
+ * of all entry points.
+ */
+
+import IStackFrame from "../../../types/IStackFrame";
+import IStackReportEntry from "../../../types/IStackReportEntry";
+
+/** Deepest path below one function */
+interface IStackPath {
+  size: number;
+  path: string[];
+  isComplete: boolean;
+}
+
+class StackReportBuilder {
+  /**
+   * Build one report entry per entry point, main first.
+   */
+  static build(frames: readonly IStackFrame[]): IStackReportEntry[] {
+    const byName = new Map(frames.map((f) => [f.name, f]));
+    const called = new Set(
+      frames.flatMap((f) => f.callees.filter((c) => c !== f.name)),
+    );
+    const memo = new Map<string, IStackPath>();
+
+    return frames
+      .filter((f) => f.isTopLevel && (f.name === "main" || !called.has(f.name)))
+      .map((f) => {
+        const worst = StackReportBuilder.deepestPath(
+          f.name,
+          byName,
+          memo,
+          new Set(),
+        );
+        return {
+          name: f.name,
+          sourcePath: f.sourcePath,
+          worstCase: worst.size,
+          callPath: worst.path,
+          isComplete: worst.isComplete,
+        };
+      })
+      .sort((a, b) => {
+        if (a.name === "main" || b.name === "main") {
+          return a.name === "main" ? -1 : 1;
+        }
+        return a.name.localeCompare(b.name);
+      });
+  }
+
+  /**
+   * Stack needed when every interrupt handler nests on top of main.
+   */
+  static nestedWorstCase(entries: readonly IStackReportEntry[]): number {
+    return entries.reduce((sum, entry) => sum + entry.worstCase, 0);
+  }
+
+  private static deepestPath(
+    name: string,
+    byName: ReadonlyMap<string, IStackFrame>,
+    memo: Map<string, IStackPath>,
+    visiting: Set<string>,
+  ): IStackPath {
+    const cached = memo.get(name);
+    if (cached) {
+      return cached;
+    }
+    const frame = byName.get(name)!;
+    visiting.add(name);
+
+    let deepest: IStackPath = { size: 0, path: [], isComplete: true };
+    let isComplete = frame.isComplete;
+    for (const callee of frame.callees) {
+      // Unknown names are variables or C/C++ functions
+      if (!byName.has(callee) || visiting.has(callee)) {
+        continue;
+      }
+      const sub = StackReportBuilder.deepestPath(
+        callee,
+        byName,
+        memo,
+        visiting,
+      );
+      isComplete &&= sub.isComplete;
+      if (sub.size > deepest.size) {
+        deepest = sub;
+      }
+    }
+
+    visiting.delete(name);
+    const result = {
+      size: frame.frameSize + deepest.size,
+      path: [name, ...deepest.path],
+      isComplete,
+    };
+    memo.set(name, result);
+    return result;
+  }
+}
+
+export default StackReportBuilder;
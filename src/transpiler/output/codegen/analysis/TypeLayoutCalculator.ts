@@ -0,0 +1,228 @@
+/**
+ * TypeLayoutCalculator - Computes target sizes and alignments of C-Next types
+ *
+ * Mirrors the C layout rules the generated code is compiled with: fields are
+ * placed in emission order at their natural alignment, and structs are
+ * padded to a multiple of their largest member alignment. Used for the
+ * layout report, compact enum sizing and struct field reordering.
+ */
+
+import TYPE_WIDTH from "../types/TYPE_WIDTH";
+import C_TYPE_WIDTH from "../types/C_TYPE_WIDTH";
+import ITypeLayout from "../types/ITypeLayout";
+import IStructLayout from "../types/IStructLayout";
+import TLayoutSymbols from "../types/TLayoutSymbols";
+import CompactEnumHelper from "../helpers/CompactEnumHelper";
+import FixedPointUtils from "../../../../utils/FixedPointUtils";
+
+/** Layout options for the configured target */
+interface ILayoutOptions {
+  /** Target word size (ITargetCapabilities.wordSize) */
+  wordSize: 8 | 16 | 32;
+  /** Compact enum storage (enums use the smallest backing width) */
+  compactEnums: boolean;
+  /** Reorder the fields of every struct to minimize padding */
+  reorderFields?: boolean;
+  /** Ignore the symbols' reordered structs (declaration-order baseline) */
+  declarationOrder?: boolean;
+}
+
+/** Layout of one field before placement */
+type TFieldEntry = { name: string } & ITypeLayout;
+
+class TypeLayoutCalculator {
+  private readonly structCache = new Map<string, IStructLayout | null>();
+
+  constructor(
+    private readonly symbols: TLayoutSymbols,
+    private readonly options: ILayoutOptions,
+  ) {}
+
+  /**
+   * Size of a plain `int`-backed enum on the target (AVR/MSP430: 2, ARM: 4).
+   */
+  get defaultEnumSize(): number {
+    return this.options.wordSize === 32 ? 4 : 2;
+  }
+
+  /**
+   * Get the layout of a C-Next type name, or null if it is not known
+   * (external C types, callbacks, opaque handles).
+   */
+  getLayout(typeName: string): ITypeLayout | null {
+    const primitiveBits =
+      TYPE_WIDTH[typeName] ??
+      C_TYPE_WIDTH[typeName] ??
+      FixedPointUtils.parse(typeName)?.width;
+    if (primitiveBits) {
+      return this.scalarLayout(primitiveBits / 8);
+    }
+
+    // string<N> -> char[N+1]
+    const stringMatch = /^string<(\d+)>$/.exec(typeName);
+    if (stringMatch) {
+      return { size: Number.parseInt(stringMatch[1], 10) + 1, align: 1 };
+    }
+
+    const members = this.symbols.enumMembers.get(typeName);
+    if (members) {
+      return this.scalarLayout(this.getEnumSize(members));
+    }
+
+    const bitmapBacking = this.symbols.bitmapBackingType.get(typeName);
+    if (bitmapBacking && C_TYPE_WIDTH[bitmapBacking]) {
+      return this.scalarLayout(C_TYPE_WIDTH[bitmapBacking] / 8);
+    }
+
+    return this.getStructLayout(typeName);
+  }
+
+  /**
+   * Get the storage size of an enum with the configured options.
+   */
+  getEnumSize(members: ReadonlyMap<string, number>): number {
+    if (!this.options.compactEnums) {
+      return this.defaultEnumSize;
+    }
+    return CompactEnumHelper.inferBitWidth(members) / 8;
+  }
+
+  /**
+   * Compute the layout of a struct in emission order: declaration order, or
+   * the padding-minimizing order when reorderFields is set (or the struct is
+   * one of the symbols' reordered structs) and it is smaller.
+   * Returns null if any field has an unknown layout.
+   */
+  getStructLayout(structName: string): IStructLayout | null {
+    if (this.structCache.has(structName)) {
+      return this.structCache.get(structName)!;
+    }
+    const fields = this.symbols.structFields.get(structName);
+    if (!fields) {
+      return null;
+    }
+    // Guard against self-reference while computing
+    this.structCache.set(structName, null);
+
+    const dimensions = this.symbols.structFieldDimensions.get(structName);
+    const entries: TFieldEntry[] = [];
+    for (const [fieldName, fieldType] of fields) {
+      const field = this.getFieldLayout(fieldType, dimensions?.get(fieldName));
+      if (!field) {
+        return null;
+      }
+      entries.push({ name: fieldName, ...field });
+    }
+
+    let result = TypeLayoutCalculator.placeFields(entries);
+    if (this.shouldReorder(structName)) {
+      const reordered = TypeLayoutCalculator.placeFields(
+        TypeLayoutCalculator.sortForPadding(entries),
+      );
+      if (reordered.size < result.size) {
+        result = reordered;
+      }
+    }
+
+    this.structCache.set(structName, result);
+    return result;
+  }
+
+  /**
+   * Whether a struct may be emitted in padding-minimizing order.
+   */
+  private shouldReorder(structName: string): boolean {
+    if (this.options.reorderFields) {
+      return true;
+    }
+    return (
+      !this.options.declarationOrder &&
+      (this.symbols.reorderedStructs?.has(structName) ?? false)
+    );
+  }
+
+  /**
+   * Get the field emission order of a struct, or null if its layout is
+   * unknown (the struct is then emitted in declaration order).
+   */
+  getFieldOrder(structName: string): string[] | null {
+    const layout = this.getStructLayout(structName);
+    return layout ? layout.fields.map((f) => f.name) : null;
+  }
+
+  /**
+   * Stable sort by descending alignment. Every field then starts at an
+   * offset that is already a multiple of its alignment, so only tail padding
+   * remains. Sizes are multiples of alignment, which keeps this optimal.
+   */
+  private static sortForPadding(entries: TFieldEntry[]): TFieldEntry[] {
+    return entries
+      .map((entry, index) => ({ entry, index }))
+      .sort((a, b) => b.entry.align - a.entry.align || a.index - b.index)
+      .map(({ entry }) => entry);
+  }
+
+  /**
+   * Place fields in the given order at their natural alignment.
+   */
+  private static placeFields(entries: readonly TFieldEntry[]): IStructLayout {
+    const result: IStructLayout = {
+      size: 0,
+      align: 1,
+      padding: 0,
+      fields: [],
+    };
+
+    for (const entry of entries) {
+      const offset = TypeLayoutCalculator.alignUp(result.size, entry.align);
+      result.padding += offset - result.size;
+      result.fields.push({ ...entry, offset });
+      result.size = offset + entry.size;
+      result.align = Math.max(result.align, entry.align);
+    }
+
+    const paddedSize = TypeLayoutCalculator.alignUp(result.size, result.align);
+    result.padding += paddedSize - result.size;
+    result.size = paddedSize;
+    return result;
+  }
+
+  /**
+   * Layout of a struct field, including array dimensions.
+   * String field dimensions already include the character capacity.
+   */
+  private getFieldLayout(
+    fieldType: string,
+    dims: readonly number[] | undefined,
+  ): ITypeLayout | null {
+    const hasDims = dims !== undefined && dims.length > 0;
+    const element =
+      hasDims && fieldType.startsWith("string<")
+        ? { size: 1, align: 1 }
+        : this.getLayout(fieldType);
+    if (!element) {
+      return null;
+    }
+    const count = hasDims ? dims.reduce((a, b) => a * b, 1) : 1;
+    return { size: element.size * count, align: element.align };
+  }
+
+  /**
+   * Natural alignment of a scalar, capped by the target ABI
+   * (AAPCS: 8, 16-bit targets: 2, 8-bit targets: 1).
+   */
+  private scalarLayout(size: number): ITypeLayout {
+    const maxAlign =
+      this.options.wordSize === 32 ? 8 : this.options.wordSize / 8;
+    return { size, align: Math.min(size, maxAlign) };
+  }
+
+  /**
+   * Round offset up to the next multiple of align.
+   */
+  static alignUp(offset: number, align: number): number {
+    return Math.ceil(offset / align) * align;
+  }
+}
+
+export default TypeLayoutCalculator;
@@ -0,0 +1,199 @@
+/**
+ * Unit tests for IndexRangeAnalyzer
+ */
+
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../../../logic/parser/grammar/CNextLexer";
+import { CNextParser } from "../../../../logic/parser/grammar/CNextParser";
+import IndexRangeAnalyzer from "../IndexRangeAnalyzer";
+
+function parse(source: string) {
+  const lexer = new CNextLexer(CharStream.fromString(source));
+  const parser = new CNextParser(new CommonTokenStream(lexer));
+  return parser.program();
+}
+
+function analyze(source: string, constValues = new Map<string, number>()) {
+  return IndexRangeAnalyzer.analyze(parse(source), "main.cnx", constValues);
+}
+
+/**
+ * Access, whether it was proven and the derived index range per subscript
+ */
+function summarize(source: string) {
+  return analyze(source).entries.map(
+    (entry): [string, boolean, string | null] => [
+      entry.access,
+      entry.isProven,
+      entry.indexRange,
+    ],
+  );
+}
+
+describe("IndexRangeAnalyzer", () => {
+  it("proves for-loop counters below the bound", () => {
+    expect(
+      summarize(`
+        u8[16] buf;
+        void clear() {
+          for (u32 i <- 0; i < 16; i +<- 1) { buf[i] <- 0; }
+          for (u32 j <- 0; j <= 16; j +<- 1) { buf[j] <- 0; }
+          for (u32 k <- 16; k > 0; k -<- 1) { buf[k - 1] <- 0; }
+        }
+      `),
+    ).toEqual([
+      ["buf[i]", true, "0..15"],
+      ["buf[j]", false, "0..16"],
+      ["buf[k-1]", true, "0..15"],
+    ]);
+  });
+
+  it("does not keep the initial bound when the counter can wrap", () => {
+    expect(
+      summarize(`
+        u8[16] buf;
+        void clear() {
+          for (u32 k <- 15; k >= 0; k -<- 1) { buf[k] <- 0; }
+        }
+      `),
+    ).toEqual([["buf[k]", false, "0..4294967295"]]);
+  });
+
+  it("narrows indices with if guards and early returns", () => {
+    expect(
+      summarize(`
+        u8[8] table;
+        u8 lookup(u32 n) {
+          if (n < 8) {
+            return table[n];
+          }
+          return 0;
+        }
+        u8 guarded(u32 n) {
+          if (n >= table.element_count) {
+            return 0;
+          }
+          return table[n];
+        }
+        u8 unguarded(u32 n) {
+          return table[n];
+        }
+      `),
+    ).toEqual([
+      ["table[n]", true, "0..7"],
+      ["table[n]", true, "0..7"],
+      ["table[n]", false, "0..4294967295"],
+    ]);
+  });
+
+  it("follows masks, modulo, shifts and lookup element types", () => {
+    expect(
+      summarize(`
+        u8[16] lut;
+        u8[256] table;
+        void decode(u32 x, u8[4] data) {
+          u8 a <- lut[x & 0xF];
+          u8 b <- lut[x % 16];
+          u8 c <- lut[x >> 28];
+          u8 d <- table[data[0]];
+          u8 e <- lut[x & 0x1F];
+        }
+      `),
+    ).toEqual([
+      ["lut[x&0xF]", true, "0..15"],
+      ["lut[x%16]", true, "0..15"],
+      ["lut[x>>28]", true, "0..15"],
+      ["table[data[0]]", true, "0..255"],
+      ["data[0]", true, "0..0"],
+      ["lut[x&0x1F]", false, "0..31"],
+    ]);
+  });
+
+  it("drops facts when the index is reassigned or passed to a call", () => {
+    expect(
+      summarize(`
+        u8[4] buf;
+        void fill(u32 i) {
+          if (i < 4) {
+            buf[i] <- 1;
+            i <- i + 4;
+            buf[i] <- 2;
+          }
+          if (i < 4) {
+            update(i);
+            buf[i] <- 3;
+          }
+        }
+      `),
+    ).toEqual([
+      ["buf[i]", true, "0..3"],
+      ["buf[i]", false, "4..7"],
+      ["buf[i]", false, "0..4294967295"],
+    ]);
+  });
+
+  it("does not prove indices that may have wrapped", () => {
+    expect(
+      summarize(`
+        u8[16] buf;
+        void shift(u32 i) {
+          if (i < 16) {
+            buf[i - 1] <- 0;
+            buf[(i - 1) & 15] <- 0;
+          }
+        }
+      `),
+    ).toEqual([
+      ["buf[i-1]", false, null],
+      ["buf[(i-1)&15]", true, "0..15"],
+    ]);
+  });
+
+  it("checks every dimension of scope arrays", () => {
+    expect(
+      summarize(`
+        scope Grid {
+          u8[4][8] cells;
+          public void mark(u32 row, u32 col) {
+            if (row < 4 && col < 8) {
+              this.cells[row][col] <- 1;
+            }
+            this.cells[row][0] <- 0;
+          }
+        }
+      `),
+    ).toEqual([
+      ["this.cells[row]", true, "0..3"],
+      ["this.cells[row][col]", true, "0..7"],
+      ["this.cells[row]", false, "0..4294967295"],
+      ["this.cells[row][0]", true, "0..0"],
+    ]);
+  });
+
+  it("sizes arrays with constants and marks proven subscripts", () => {
+    const result = analyze(
+      `
+        const u32 SIZE <- 4;
+        u8[SIZE] buf;
+        void clear() {
+          for (u32 i <- 0; i < SIZE; i +<- 1) { buf[i] <- 0; }
+        }
+      `,
+      new Map([["SIZE", 4]]),
+    );
+
+    expect(result.entries).toEqual([
+      {
+        sourcePath: "main.cnx",
+        line: 5,
+        column: 52,
+        access: "buf[i]",
+        size: 4,
+        isProven: true,
+        indexRange: "0..3",
+      },
+    ]);
+    expect(result.proven.size).toBe(1);
+  });
+});
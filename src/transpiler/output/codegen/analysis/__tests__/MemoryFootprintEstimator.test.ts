@@ -0,0 +1,125 @@
+/**
+ * Unit tests for MemoryFootprintEstimator
+ */
+
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../../../logic/parser/grammar/CNextLexer";
+import { CNextParser } from "../../../../logic/parser/grammar/CNextParser";
+import MemoryFootprintEstimator from "../MemoryFootprintEstimator";
+import TypeLayoutCalculator from "../TypeLayoutCalculator";
+import DeclarationLayoutResolver from "../DeclarationLayoutResolver";
+
+function parse(source: string) {
+  const lexer = new CNextLexer(CharStream.fromString(source));
+  const parser = new CNextParser(new CommonTokenStream(lexer));
+  return parser.program();
+}
+
+const layout = new TypeLayoutCalculator(
+  {
+    structFields: new Map(),
+    structFieldDimensions: new Map(),
+    enumMembers: new Map(),
+    bitmapBackingType: new Map(),
+  },
+  { wordSize: 32, compactEnums: false },
+);
+
+function estimate(
+  source: string,
+  options: { packedBoolArrays?: boolean; deadSymbols?: Set<string> } = {},
+) {
+  const resolver = new DeclarationLayoutResolver({
+    layout,
+    wordSize: 32,
+    constValues: new Map([["SIZE", 8]]),
+    packedBoolArrays: options.packedBoolArrays,
+  });
+  return MemoryFootprintEstimator.estimate(
+    parse(source),
+    "/src/main.cnx",
+    resolver,
+    options.deadSymbols,
+  );
+}
+
+describe("MemoryFootprintEstimator", () => {
+  it("assigns sections by const and initializer", () => {
+    const entries = estimate(`
+      u32 ticks;
+      u16 zeroed <- 0;
+      u8 flags[SIZE] <- [0*];
+      i32 offset <- 5;
+      const u16 table[4] <- [1, 2, 3, 4];
+    `);
+
+    expect(entries.map((e) => [e.name, e.size, e.section])).toEqual([
+      ["ticks", 4, "bss"],
+      ["zeroed", 2, "bss"],
+      ["flags", 8, "bss"],
+      ["offset", 4, "data"],
+      ["table", 8, "rodata"],
+    ]);
+  });
+
+  it("names scope variables and skips inlined private constants", () => {
+    const entries = estimate(`
+      scope Motor {
+        u32 speed;
+        const u8 LIMIT <- 10;
+        public const u8 MAX <- 20;
+        string<15> label;
+        void stop() {
+          u32 local <- 0;
+        }
+      }
+    `);
+
+    expect(entries).toEqual([
+      {
+        sourcePath: "/src/main.cnx",
+        scope: "Motor",
+        name: "Motor_speed",
+        size: 4,
+        align: 4,
+        section: "bss",
+      },
+      {
+        sourcePath: "/src/main.cnx",
+        scope: "Motor",
+        name: "Motor_MAX",
+        size: 1,
+        align: 1,
+        section: "rodata",
+      },
+      {
+        sourcePath: "/src/main.cnx",
+        scope: "Motor",
+        name: "Motor_label",
+        size: 16,
+        align: 1,
+        section: "bss",
+      },
+    ]);
+  });
+
+  it("sizes packed bool arrays as words and skips dead variables", () => {
+    const entries = estimate(
+      `
+      bool ready[40];
+      u32 unused;
+    `,
+      { packedBoolArrays: true, deadSymbols: new Set(["unused"]) },
+    );
+
+    expect(entries).toHaveLength(1);
+    expect(entries[0]).toMatchObject({ name: "ready", size: 8, align: 4 });
+  });
+
+  it("reports unknown types with a null size", () => {
+    const [entry] = estimate(`ExternalHandle handle;`);
+
+    expect(entry).toMatchObject({ name: "handle", size: null, align: 0 });
+  });
+});
@@ -0,0 +1,56 @@
+/**
+ * Unit tests for MemoryReportBuilder
+ */
+
+import { describe, it, expect } from "vitest";
+import MemoryReportBuilder from "../MemoryReportBuilder";
+import IMemoryReportEntry from "../../../../types/IMemoryReportEntry";
+
+function entry(
+  name: string,
+  size: number | null,
+  section: IMemoryReportEntry["section"] = "bss",
+  sourcePath = "/src/main.cnx",
+): IMemoryReportEntry {
+  return { sourcePath, scope: null, name, size, align: 4, section };
+}
+
+describe("MemoryReportBuilder", () => {
+  it("splits totals into RAM and flash", () => {
+    const totals = MemoryReportBuilder.totals([
+      entry("a", 4, "bss"),
+      entry("b", 8, "data"),
+      entry("c", 16, "rodata"),
+      entry("d", null, "data"),
+    ]);
+
+    expect(totals).toEqual({ ram: 12, flash: 16 });
+  });
+
+  it("groups entries in first-seen order", () => {
+    const groups = MemoryReportBuilder.groupBy(
+      [
+        entry("a", 4, "bss", "/b.cnx"),
+        entry("b", 4),
+        entry("c", 4, "bss", "/b.cnx"),
+      ],
+      (e) => e.sourcePath,
+    );
+
+    expect([...groups.keys()]).toEqual(["/b.cnx", "/src/main.cnx"]);
+    expect(groups.get("/b.cnx")!.map((e) => e.name)).toEqual(["a", "c"]);
+  });
+
+  it("diffs against a baseline, largest growth first", () => {
+    const changes = MemoryReportBuilder.diff(
+      [entry("same", 4), entry("grown", 8), entry("gone", 16, "rodata")],
+      [entry("same", 4), entry("grown", 40), entry("added", 2)],
+    );
+
+    expect(changes).toEqual([
+      { name: "grown", baselineSize: 8, size: 40, isFlash: false },
+      { name: "added", baselineSize: 0, size: 2, isFlash: false },
+      { name: "gone", baselineSize: 16, size: 0, isFlash: true },
+    ]);
+  });
+});
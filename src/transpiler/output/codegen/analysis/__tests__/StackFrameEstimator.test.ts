@@ -0,0 +1,97 @@
+/**
+ * Unit tests for StackFrameEstimator
+ */
+
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../../../logic/parser/grammar/CNextLexer";
+import { CNextParser } from "../../../../logic/parser/grammar/CNextParser";
+import StackFrameEstimator from "../StackFrameEstimator";
+import TypeLayoutCalculator from "../TypeLayoutCalculator";
+import DeclarationLayoutResolver from "../DeclarationLayoutResolver";
+
+function parse(source: string) {
+  const lexer = new CNextLexer(CharStream.fromString(source));
+  const parser = new CNextParser(new CommonTokenStream(lexer));
+  return parser.program();
+}
+
+const layout = new TypeLayoutCalculator(
+  {
+    structFields: new Map([
+      [
+        "Point",
+        new Map([
+          ["x", "i32"],
+          ["y", "i32"],
+        ]),
+      ],
+    ]),
+    structFieldDimensions: new Map(),
+    enumMembers: new Map(),
+    bitmapBackingType: new Map(),
+  },
+  { wordSize: 32, compactEnums: false },
+);
+
+function estimate(source: string, constValues = new Map<string, number>()) {
+  return StackFrameEstimator.estimate(
+    parse(source),
+    "/src/main.cnx",
+    new DeclarationLayoutResolver({ layout, wordSize: 32, constValues }),
+  );
+}
+
+describe("StackFrameEstimator", () => {
+  it("counts call overhead, parameters and locals", () => {
+    const [frame] = estimate(`
+      u32 sum(u8 a, Point p) {
+        u8 tag <- 1;
+        u32 total <- a;
+        return total;
+      }
+    `);
+
+    // 8 overhead + 4 (u8 slot) + 4 (Point by reference) + 1 + pad 3 + 4
+    expect(frame).toMatchObject({
+      name: "sum",
+      isTopLevel: true,
+      frameSize: 24,
+      isComplete: true,
+    });
+  });
+
+  it("sizes arrays with const dimensions and structs", () => {
+    const [frame] = estimate(
+      `
+        void fill() {
+          u16[N] samples;
+          Point origin;
+        }
+      `,
+      new Map([["N", 10]]),
+    );
+
+    expect(frame.frameSize).toBe(8 + 20 + 8);
+  });
+
+  it("records scope callees and marks unknown locals", () => {
+    const frames = estimate(`
+      scope Motor {
+        void stop() { }
+        void update() {
+          Handle h;
+          this.stop();
+          global.Pid.step();
+        }
+      }
+    `);
+
+    const update = frames.find((f) => f.name === "Motor_update")!;
+    expect(update.isTopLevel).toBe(false);
+    expect(update.isComplete).toBe(false);
+    expect(update.callees).toEqual(
+      expect.arrayContaining(["Motor_stop", "Pid_step"]),
+    );
+  });
+});
@@ -0,0 +1,72 @@
+/**
+ * Unit tests for StackReportBuilder
+ */
+
+import { describe, it, expect } from "vitest";
+import StackReportBuilder from "../StackReportBuilder";
+import IStackFrame from "../../../../types/IStackFrame";
+
+function frame(
+  name: string,
+  frameSize: number,
+  callees: string[] = [],
+  overrides: Partial<IStackFrame> = {},
+): IStackFrame {
+  return {
+    name,
+    sourcePath: "/src/main.cnx",
+    isTopLevel: !name.includes("_"),
+    frameSize,
+    callees,
+    isComplete: true,
+    ...overrides,
+  };
+}
+
+describe("StackReportBuilder", () => {
+  const frames = [
+    frame("Pid_step", 40),
+    frame("Log_write", 64),
+    frame("Motor_update", 16, ["Pid_step", "Log_write", "printf"]),
+    frame("main", 8, ["Motor_update"]),
+    frame("SysTick_Handler", 12, ["Pid_step"], { isTopLevel: true }),
+  ];
+
+  it("reports the deepest path per entry point, main first", () => {
+    const entries = StackReportBuilder.build(frames);
+
+    expect(entries.map((e) => e.name)).toEqual(["main", "SysTick_Handler"]);
+    expect(entries[0]).toMatchObject({
+      worstCase: 8 + 16 + 64,
+      callPath: ["main", "Motor_update", "Log_write"],
+      isComplete: true,
+    });
+    expect(entries[1].worstCase).toBe(12 + 40);
+  });
+
+  it("does not treat called top-level functions as entry points", () => {
+    const entries = StackReportBuilder.build([
+      frame("helper", 4),
+      frame("main", 8, ["helper"]),
+    ]);
+
+    expect(entries.map((e) => e.name)).toEqual(["main"]);
+    expect(entries[0].worstCase).toBe(12);
+  });
+
+  it("propagates unknown frame sizes to callers", () => {
+    const entries = StackReportBuilder.build([
+      frame("Util_scan", 4, [], { isComplete: false }),
+      frame("Util_idle", 100),
+      frame("main", 8, ["Util_scan", "Util_idle"]),
+    ]);
+
+    expect(entries[0].worstCase).toBe(108);
+    expect(entries[0].isComplete).toBe(false);
+  });
+
+  it("sums entry points for interrupt nesting", () => {
+    const entries = StackReportBuilder.build(frames);
+    expect(StackReportBuilder.nestedWorstCase(entries)).toBe(88 + 52);
+  });
+});
@@ -0,0 +1,280 @@
+/**
+ * Unit tests for TypeLayoutCalculator
+ */
+
+import { describe, it, expect } from "vitest";
+import TypeLayoutCalculator from "../TypeLayoutCalculator";
+
+function createSymbols(
+  structFields: Map<string, Map<string, string>>,
+  structFieldDimensions: Map<string, Map<string, number[]>> = new Map(),
+) {
+  return {
+    structFields,
+    structFieldDimensions,
+    enumMembers: new Map([
+      [
+        "State",
+        new Map([
+          ["IDLE", 0],
+          ["FAULT", 200],
+        ]),
+      ],
+    ]),
+    bitmapBackingType: new Map([["Flags", "uint16_t"]]),
+  };
+}
+
+describe("TypeLayoutCalculator", () => {
+  describe("getLayout", () => {
+    const calc = new TypeLayoutCalculator(createSymbols(new Map()), {
+      wordSize: 32,
+      compactEnums: false,
+    });
+
+    it("sizes primitives", () => {
+      expect(calc.getLayout("u8")).toEqual({ size: 1, align: 1 });
+      expect(calc.getLayout("u32")).toEqual({ size: 4, align: 4 });
+      expect(calc.getLayout("f64")).toEqual({ size: 8, align: 8 });
+    });
+
+    it("sizes strings as char[N+1]", () => {
+      expect(calc.getLayout("string<15>")).toEqual({ size: 16, align: 1 });
+    });
+
+    it("sizes bitmaps by backing type", () => {
+      expect(calc.getLayout("Flags")).toEqual({ size: 2, align: 2 });
+    });
+
+    it("sizes enums as int by default", () => {
+      expect(calc.getLayout("State")).toEqual({ size: 4, align: 4 });
+    });
+
+    it("returns null for unknown types", () => {
+      expect(calc.getLayout("ExternalThing")).toBeNull();
+    });
+  });
+
+  describe("compact enums", () => {
+    it("sizes enums by inferred backing width", () => {
+      const calc = new TypeLayoutCalculator(createSymbols(new Map()), {
+        wordSize: 32,
+        compactEnums: true,
+      });
+      expect(calc.getLayout("State")).toEqual({ size: 1, align: 1 });
+    });
+
+    it("shrinks structs holding enums", () => {
+      const fields = new Map([
+        [
+          "Channel",
+          new Map([
+            ["state", "State"],
+            ["id", "u8"],
+          ]),
+        ],
+      ]);
+      const before = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+      });
+      const after = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: true,
+      });
+
+      expect(before.getStructLayout("Channel")?.size).toBe(8);
+      expect(after.getStructLayout("Channel")?.size).toBe(2);
+    });
+  });
+
+  describe("getStructLayout", () => {
+    it("computes offsets and padding in declaration order", () => {
+      const fields = new Map([
+        [
+          "Mixed",
+          new Map([
+            ["a", "u8"],
+            ["b", "u32"],
+            ["c", "u16"],
+          ]),
+        ],
+      ]);
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+      });
+
+      const layout = calc.getStructLayout("Mixed")!;
+
+      expect(layout.fields.map((f) => f.offset)).toEqual([0, 4, 8]);
+      expect(layout.size).toBe(12);
+      expect(layout.align).toBe(4);
+      expect(layout.padding).toBe(5);
+    });
+
+    it("uses byte alignment on 8-bit targets", () => {
+      const fields = new Map([
+        [
+          "Mixed",
+          new Map([
+            ["a", "u8"],
+            ["b", "u32"],
+          ]),
+        ],
+      ]);
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 8,
+        compactEnums: false,
+      });
+
+      expect(calc.getStructLayout("Mixed")).toMatchObject({
+        size: 5,
+        align: 1,
+        padding: 0,
+      });
+    });
+
+    it("multiplies array field dimensions", () => {
+      const fields = new Map([
+        [
+          "Buf",
+          new Map([
+            ["len", "u16"],
+            ["data", "u8"],
+            ["name", "string<7>"],
+          ]),
+        ],
+      ]);
+      const dims = new Map([
+        [
+          "Buf",
+          new Map([
+            ["data", [10]],
+            ["name", [8]],
+          ]),
+        ],
+      ]);
+      const calc = new TypeLayoutCalculator(createSymbols(fields, dims), {
+        wordSize: 32,
+        compactEnums: false,
+      });
+
+      expect(calc.getStructLayout("Buf")?.size).toBe(20);
+    });
+
+    it("returns null when a field type is unknown", () => {
+      const fields = new Map([["Opaque", new Map([["h", "Handle"]])]]);
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+      });
+
+      expect(calc.getStructLayout("Opaque")).toBeNull();
+    });
+  });
+
+  describe("reorderFields", () => {
+    const fields = new Map([
+      [
+        "Mixed",
+        new Map([
+          ["a", "u8"],
+          ["b", "u32"],
+          ["c", "u16"],
+        ]),
+      ],
+      [
+        "Ordered",
+        new Map([
+          ["first", "u8"],
+          ["second", "u16"],
+          ["third", "u32"],
+        ]),
+      ],
+      [
+        "Outer",
+        new Map([
+          ["tag", "u8"],
+          ["inner", "Mixed"],
+        ]),
+      ],
+    ]);
+
+    it("sorts fields by descending alignment", () => {
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+        reorderFields: true,
+      });
+
+      const layout = calc.getStructLayout("Mixed")!;
+
+      expect(calc.getFieldOrder("Mixed")).toEqual(["b", "c", "a"]);
+      expect(layout.fields.map((f) => f.offset)).toEqual([0, 4, 6]);
+      expect(layout.size).toBe(8);
+      expect(layout.padding).toBe(1);
+    });
+
+    it("keeps declaration order when reordering does not shrink", () => {
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+        reorderFields: true,
+      });
+
+      expect(calc.getFieldOrder("Ordered")).toEqual([
+        "first",
+        "second",
+        "third",
+      ]);
+    });
+
+    it("sizes nested structs with their reordered layout", () => {
+      const calc = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+        reorderFields: true,
+      });
+
+      const declared = new TypeLayoutCalculator(createSymbols(fields), {
+        wordSize: 32,
+        compactEnums: false,
+      });
+
+      expect(declared.getStructLayout("Outer")?.size).toBe(16);
+      expect(calc.getStructLayout("Outer")?.size).toBe(12);
+    });
+
+    it("returns null order for unknown layouts", () => {
+      const calc = new TypeLayoutCalculator(
+        createSymbols(new Map([["Opaque", new Map([["h", "Handle"]])]])),
+        { wordSize: 32, compactEnums: false, reorderFields: true },
+      );
+
+      expect(calc.getFieldOrder("Opaque")).toBeNull();
+    });
+
+    it("reorders structs declared with struct reorder", () => {
+      const symbols = {
+        ...createSymbols(fields),
+        reorderedStructs: new Set(["Mixed"]),
+      };
+      const calc = new TypeLayoutCalculator(symbols, {
+        wordSize: 32,
+        compactEnums: false,
+      });
+      const baseline = new TypeLayoutCalculator(symbols, {
+        wordSize: 32,
+        compactEnums: false,
+        declarationOrder: true,
+      });
+
+      expect(calc.getFieldOrder("Mixed")).toEqual(["b", "c", "a"]);
+      expect(calc.getStructLayout("Outer")?.fields.map((f) => f.name)).toEqual(
+        ["tag", "inner"],
+      );
+      expect(baseline.getFieldOrder("Mixed")).toEqual(["a", "b", "c"]);
+    });
+  });
+});
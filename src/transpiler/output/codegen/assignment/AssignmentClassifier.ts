@@ -13,6 +13,7 @@ import CodeGenState from "../../../state/CodeGenState";
 import SubscriptClassifier from "../subscript/SubscriptClassifier";
 import TTypeInfo from "../types/TTypeInfo";
 import TypeCheckUtils from "../../../../utils/TypeCheckUtils";
+import FixedPointUtils from "../../../../utils/FixedPointUtils";
 import QualifiedNameGenerator from "../utils/QualifiedNameGenerator";
 
 /**
@@ -61,6 +62,17 @@ class AssignmentClassifier {
       return bitmapKind;
     }
 
+    // === Priority 1b: Packed bool array element (any prefix) ===
+    if (AssignmentClassifier.isPackedBoolElement(ctx)) {
+      return AssignmentKind.PACKED_BOOL_ELEMENT;
+    }
+
+    // === Priority 1c: Struct-of-arrays element or field (any prefix) ===
+    const soaKind = AssignmentClassifier.classifyStructOfArrays(ctx);
+    if (soaKind !== null) {
+      return soaKind;
+    }
+
     // === Priority 2: Member access with subscripts (arrays, register bits) ===
     const memberSubscriptKind =
       AssignmentClassifier.classifyMemberWithSubscript(ctx);
@@ -408,6 +420,52 @@ class AssignmentClassifier {
     return null;
   }
 
+  /**
+   * Check for a single-index write into a bit-packed bool array:
+   * flags[i], this.flags[i], global.Scope.flags[i]
+   */
+  private static isPackedBoolElement(ctx: IAssignmentContext): boolean {
+    if (
+      !CodeGenState.packedBoolArrays ||
+      ctx.subscripts.length !== 1 ||
+      ctx.lastSubscriptExprCount !== 1 ||
+      ctx.postfixOps.at(-1)?.IDENTIFIER()
+    ) {
+      return false;
+    }
+    const typeInfo = CodeGenState.getVariableTypeInfo(
+      ctx.resolvedBaseIdentifier,
+    );
+    return typeInfo?.isPackedBool === true;
+  }
+
+  /**
+   * Classify writes to a struct-of-arrays array (soaStructs).
+   * samples[i] scatters a whole element; samples[i].x is a plain member
+   * chain because the target builder already emits samples.x[i].
+   */
+  private static classifyStructOfArrays(
+    ctx: IAssignmentContext,
+  ): AssignmentKind | null {
+    if (CodeGenState.soaStructs.size === 0 || ctx.subscripts.length === 0) {
+      return null;
+    }
+    const typeInfo = CodeGenState.getVariableTypeInfo(
+      ctx.resolvedBaseIdentifier,
+    );
+    if (!typeInfo?.isStructOfArrays) {
+      return null;
+    }
+    if (ctx.subscripts.length === 1 && ctx.lastSubscriptExprCount === 1) {
+      return ctx.postfixOps.at(-1)?.IDENTIFIER()
+        ? AssignmentKind.MEMBER_CHAIN
+        : AssignmentKind.SOA_ELEMENT;
+    }
+    throw new Error(
+      `Error: Struct-of-arrays array '${ctx.resolvedBaseIdentifier}' can only be assigned by element or by field`,
+    );
+  }
+
   /**
    * Classify global.* patterns: global.reg[bit], global.arr[i], global.member
    */
@@ -630,6 +688,14 @@ class AssignmentClassifier {
       return AssignmentKind.OVERFLOW_CLAMP;
     }
 
+    // Q types always saturate, and /= needs the scaling helper too
+    if (
+      FixedPointUtils.isFixedPoint(typeInfo.baseType) &&
+      (ARITHMETIC_COMPOUND_OPS.has(ctx.cOp) || ctx.cOp === "/=")
+    ) {
+      return AssignmentKind.OVERFLOW_CLAMP;
+    }
+
     return null;
   }
 
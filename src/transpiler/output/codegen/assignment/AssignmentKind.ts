@@ -88,6 +88,12 @@ enum AssignmentKind {
   /** buffer[0, 10] <- source (slice assignment: per-element little-endian writes, ADR-007/#1081) */
   ARRAY_SLICE,
 
+  /** flags[i] <- true (bool array stored bit-packed, packedBoolArrays) */
+  PACKED_BOOL_ELEMENT,
+
+  /** samples[i] <- s (whole struct-of-arrays element, soaStructs) */
+  SOA_ELEMENT,
+
   // === Special operations ===
 
   /** atomic counter +<- 1 (atomic read-modify-write) */
@@ -349,6 +349,61 @@ describe("AssignmentClassifier - Array Access", () => {
 
     expect(AssignmentClassifier.classify(ctx)).toBe(AssignmentKind.ARRAY_SLICE);
   });
+
+  it("classifies packed bool array element", () => {
+    CodeGenState.packedBoolArrays = true;
+    CodeGenState.setVariableTypeInfo(
+      "Motor_flags",
+      createTypeInfo({
+        baseType: "bool",
+        bitWidth: 8,
+        isArray: true,
+        arrayDimensions: [64],
+        isPackedBool: true,
+      }),
+    );
+
+    const ctx = createMockContext({
+      identifiers: ["flags"],
+      resolvedTarget: "Motor_flags[i]",
+      subscripts: [{} as IAssignmentContext["subscripts"][0]],
+      postfixOps: [
+        { IDENTIFIER: () => null } as unknown as IAssignmentContext["postfixOps"][0],
+      ],
+      hasThis: true,
+      hasArrayAccess: true,
+      postfixOpsCount: 1,
+      isSimpleIdentifier: false,
+    });
+
+    expect(AssignmentClassifier.classify(ctx)).toBe(
+      AssignmentKind.PACKED_BOOL_ELEMENT,
+    );
+  });
+
+  it("keeps byte storage semantics when packing is disabled", () => {
+    CodeGenState.setVariableTypeInfo(
+      "flags",
+      createTypeInfo({
+        baseType: "bool",
+        bitWidth: 8,
+        isArray: true,
+        arrayDimensions: [64],
+      }),
+    );
+
+    const ctx = createMockContext({
+      identifiers: ["flags"],
+      resolvedTarget: "flags[i]",
+      subscripts: [{} as IAssignmentContext["subscripts"][0]],
+      hasArrayAccess: true,
+      isSimpleIdentifier: false,
+    });
+
+    expect(AssignmentClassifier.classify(ctx)).toBe(
+      AssignmentKind.ARRAY_ELEMENT,
+    );
+  });
 });
 
 // ========================================================================
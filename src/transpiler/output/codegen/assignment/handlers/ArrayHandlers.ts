@@ -5,6 +5,8 @@
  * - ARRAY_ELEMENT: arr[i] <- value
  * - MULTI_DIM_ARRAY_ELEMENT: matrix[i][j] <- value
  * - ARRAY_SLICE: buffer[0, 10] <- source
+ * - PACKED_BOOL_ELEMENT: flags[i] <- true (packedBoolArrays)
+ * - SOA_ELEMENT: samples[i] <- s (soaStructs)
  */
 import AssignmentKind from "../AssignmentKind";
 import IAssignmentContext from "../IAssignmentContext";
@@ -14,6 +16,8 @@ import TypeValidator from "../../TypeValidator";
 import type TTypeInfo from "../../types/TTypeInfo";
 import CNEXT_TO_C_TYPE_MAP from "../../../../../utils/constants/TypeMappings";
 import TypeResolver from "../../TypeResolver";
+import PackedBoolArrayHelper from "../../helpers/PackedBoolArrayHelper";
+import StructOfArraysHelper from "../../helpers/StructOfArraysHelper";
 
 /** Matches the unsigned C-Next integer types (u8/u16/u32/u64). */
 const UNSIGNED_INT_RE = /^u(8|16|32|64)$/;
@@ -550,6 +554,52 @@ function handleArraySlice(ctx: IAssignmentContext): string {
   );
 }
 
+/**
+ * Handle packed bool array element: flags[i] <- true
+ *
+ * Lowers to a read-modify-write of the containing uint32_t word.
+ */
+function handlePackedBoolElement(ctx: IAssignmentContext): string {
+  if (ctx.isCompound) {
+    throw new Error(
+      `Compound assignment operators not supported for packed bool arrays: ${ctx.cnextOp}`,
+    );
+  }
+  const index = CodeGenState.withExpectedType("size_t", () =>
+    CodeGenState.requireGenerator().generateExpression(ctx.subscripts[0]),
+  );
+  return PackedBoolArrayHelper.write(
+    ctx.resolvedBaseIdentifier,
+    index,
+    ctx.generatedValue,
+  );
+}
+
+/**
+ * Handle whole struct-of-arrays element: samples[i] <- s
+ *
+ * Scatters the struct value into one write per field array.
+ */
+function handleStructOfArraysElement(ctx: IAssignmentContext): string {
+  if (ctx.isCompound) {
+    throw new Error(
+      `Compound assignment operators not supported for struct-of-arrays elements: ${ctx.cnextOp}`,
+    );
+  }
+  const typeInfo = CodeGenState.getVariableTypeInfo(
+    ctx.resolvedBaseIdentifier,
+  )!;
+  const index = CodeGenState.withExpectedType("size_t", () =>
+    CodeGenState.requireGenerator().generateExpression(ctx.subscripts[0]),
+  );
+  return StructOfArraysHelper.scatterElement(
+    typeInfo.baseType,
+    ctx.resolvedBaseIdentifier,
+    index,
+    ctx.generatedValue,
+  );
+}
+
 /**
  * All array handlers for registration.
  */
@@ -557,6 +607,8 @@ const arrayHandlers: ReadonlyArray<[AssignmentKind, TAssignmentHandler]> = [
   [AssignmentKind.ARRAY_ELEMENT, handleArrayElement],
   [AssignmentKind.MULTI_DIM_ARRAY_ELEMENT, handleMultiDimArrayElement],
   [AssignmentKind.ARRAY_SLICE, handleArraySlice],
+  [AssignmentKind.PACKED_BOOL_ELEMENT, handlePackedBoolElement],
+  [AssignmentKind.SOA_ELEMENT, handleStructOfArraysElement],
 ];
 
 export default arrayHandlers;
@@ -3,7 +3,7 @@
  *
  * Handles special compound assignment operations:
  * - ATOMIC_RMW: atomic counter +<- 1
- * - OVERFLOW_CLAMP: clamp u8 saturated +<- 200
+ * - OVERFLOW_CLAMP: clamp u8 saturated +<- 200, q15 gain *<- 0.5
  */
 import AssignmentKind from "../AssignmentKind";
 import IAssignmentContext from "../IAssignmentContext";
@@ -11,6 +11,7 @@ import TypeCheckUtils from "../../../../../utils/TypeCheckUtils";
 import TAssignmentHandler from "./TAssignmentHandler";
 import CodeGenState from "../../../../state/CodeGenState";
 import TTypeInfo from "../../types/TTypeInfo";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
 
 /** Maps C operators to clamp helper operation names */
 const CLAMP_OP_MAP: Record<string, string> = {
@@ -19,6 +20,12 @@ const CLAMP_OP_MAP: Record<string, string> = {
   "*=": "mul",
 };
 
+/** Q types also scale on division */
+const FIXED_POINT_OP_MAP: Record<string, string> = {
+  ...CLAMP_OP_MAP,
+  "/=": "div",
+};
+
 /**
  * Get typeInfo for assignment target.
  * Handles simple identifiers, this.member, and global.member patterns.
@@ -72,7 +79,8 @@ function handleAtomicRMW(ctx: IAssignmentContext): string {
  * Handle overflow-clamped compound assignment: clamp u8 saturated +<- 200
  *
  * Generates calls to cnx_clamp_add_u8, cnx_clamp_sub_u8, etc.
- * Only applies to integers (floats use native C arithmetic with infinity).
+ * Only applies to integers (floats use native C arithmetic with infinity)
+ * and Q types (cnx_clamp_mul_q15, cnx_clamp_div_q15).
  */
 function handleOverflowClamp(ctx: IAssignmentContext): string {
   const { typeInfo } = getTargetTypeInfo(ctx);
@@ -85,7 +93,10 @@ function handleOverflowClamp(ctx: IAssignmentContext): string {
     return `${target} ${ctx.cOp} ${ctx.generatedValue};`;
   }
 
-  const helperOp = CLAMP_OP_MAP[ctx.cOp];
+  const opMap = FixedPointUtils.isFixedPoint(typeInfo!.baseType)
+    ? FIXED_POINT_OP_MAP
+    : CLAMP_OP_MAP;
+  const helperOp = opMap[ctx.cOp];
 
   if (helperOp) {
     CodeGenState.markClampOpUsed(helperOp, typeInfo!.baseType);
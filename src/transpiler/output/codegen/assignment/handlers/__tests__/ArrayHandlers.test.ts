@@ -94,10 +94,12 @@ describe("ArrayHandlers", () => {
       expect(kinds).toContain(AssignmentKind.ARRAY_ELEMENT);
       expect(kinds).toContain(AssignmentKind.MULTI_DIM_ARRAY_ELEMENT);
       expect(kinds).toContain(AssignmentKind.ARRAY_SLICE);
+      expect(kinds).toContain(AssignmentKind.PACKED_BOOL_ELEMENT);
+      expect(kinds).toContain(AssignmentKind.SOA_ELEMENT);
     });
 
-    it("exports exactly 3 handlers", () => {
-      expect(arrayHandlers.length).toBe(3);
+    it("exports exactly 5 handlers", () => {
+      expect(arrayHandlers.length).toBe(5);
     });
   });
 
@@ -959,4 +961,78 @@ describe("ArrayHandlers", () => {
       expect(() => getHandler()!(ctx)).toThrow("Cannot determine buffer size");
     });
   });
+
+  describe("handlePackedBoolElement (PACKED_BOOL_ELEMENT)", () => {
+    const getHandler = () =>
+      arrayHandlers.find(
+        ([kind]) => kind === AssignmentKind.PACKED_BOOL_ELEMENT,
+      )?.[1];
+
+    it("writes the bit in the containing word", () => {
+      const ctx = createMockContext({
+        identifiers: ["flags"],
+        generatedValue: "true",
+      });
+
+      expect(getHandler()!(ctx)).toBe(
+        "flags[(i) >> 5U] = (flags[(i) >> 5U] & ~(1U << ((i) & 31U))) | (1U << ((i) & 31U));",
+      );
+    });
+
+    it("folds constant indices", () => {
+      const ctx = createMockContext({
+        identifiers: ["flags"],
+        subscripts: [{ mockValue: "37U", start: { line: 1 } } as never],
+        generatedValue: "ok",
+      });
+
+      expect(getHandler()!(ctx)).toBe(
+        "flags[1U] = (flags[1U] & ~(1U << 5U)) | ((ok ? 1U : 0U) << 5U);",
+      );
+    });
+
+    it("evaluates a compound index once", () => {
+      CodeGenState.tempVarCounter = 0;
+      const ctx = createMockContext({
+        identifiers: ["flags"],
+        subscripts: [{ mockValue: "i + 1U", start: { line: 1 } } as never],
+        generatedValue: "true",
+      });
+
+      expect(getHandler()!(ctx)).toBe(
+        [
+          "{",
+          "    const uint32_t _cnx_tmp_0 = i + 1U;",
+          "    flags[(_cnx_tmp_0) >> 5U] = (flags[(_cnx_tmp_0) >> 5U] & ~(1U << ((_cnx_tmp_0) & 31U))) | (1U << ((_cnx_tmp_0) & 31U));",
+          "}",
+        ].join("\n"),
+      );
+    });
+
+    it("uses the scope-resolved name", () => {
+      const ctx = createMockContext({
+        identifiers: ["flags"],
+        resolvedBaseIdentifier: "Motor_flags",
+        subscripts: [{ mockValue: "0U", start: { line: 1 } } as never],
+        generatedValue: "false",
+      });
+
+      expect(getHandler()!(ctx)).toBe(
+        "Motor_flags[0U] = (Motor_flags[0U] & ~(1U << 0U)) | (0U << 0U);",
+      );
+    });
+
+    it("rejects compound assignment", () => {
+      const ctx = createMockContext({
+        identifiers: ["flags"],
+        isCompound: true,
+        cnextOp: "|<-",
+        cOp: "|=",
+      });
+
+      expect(() => getHandler()!(ctx)).toThrow(
+        "Compound assignment operators not supported for packed bool arrays",
+      );
+    });
+  });
 });
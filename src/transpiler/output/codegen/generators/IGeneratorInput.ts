@@ -43,6 +43,18 @@ interface IGeneratorInput {
 
   /** Debug mode - affects overflow helper generation */
   readonly debugMode: boolean;
+
+  /** C++ output mode (default: false) */
+  readonly cppMode?: boolean;
+
+  /** Compact enum storage - smallest-width enum backing types (default: false) */
+  readonly compactEnums?: boolean;
+
+  /** Dense value-mapping switches lower to lookup tables (default: false) */
+  readonly switchTables?: boolean;
+
+  /** Safe division by constant divisors skips the helpers (default: false) */
+  readonly strengthReduce?: boolean;
 }
 
 export default IGeneratorInput;
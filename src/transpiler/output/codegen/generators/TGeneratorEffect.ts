@@ -17,7 +17,11 @@ type TGeneratorEffect =
 
   // === Helper Function Effects ===
   | { type: "helper"; operation: string; cnxType: string } // Overflow clamp helper
-  | { type: "safe-div"; operation: "div" | "mod"; cnxType: string } // Safe division helper
+  | {
+      type: "safe-div";
+      operation: "div" | "mod" | "divmod";
+      cnxType: string;
+    } // Safe division helper
 
   // === Type Registration Effects ===
   | { type: "register-type"; name: string; info: TTypeInfo } // Register variable type
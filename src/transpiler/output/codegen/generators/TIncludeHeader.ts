@@ -9,6 +9,7 @@
  * - float_static_assert: Static assert for float bit indexing size verification
  * - limits: limits.h for float-to-int clamp casts
  * - isr: ISR function pointer typedef (ADR-040)
+ * - branch_hints: CNX_LIKELY/CNX_UNLIKELY/CNX_EXPECT/CNX_COLD/CNX_HOT macros
  */
 type TIncludeHeader =
   | "stdint"
@@ -18,6 +19,7 @@ type TIncludeHeader =
   | "irq_wrappers"
   | "float_static_assert"
   | "limits"
-  | "isr";
+  | "isr"
+  | "branch_hints";
 
 export default TIncludeHeader;
@@ -11,6 +11,10 @@
  *       State_RUNNING = 1,
  *       State_ERROR = 255
  *   } State;
+ *
+ * With compactEnums, the typedef gets the smallest backing width:
+ *   typedef enum : uint8_t { ... } State;                 (C++)
+ *   typedef enum __attribute__((packed)) { ... } State;   (C, GCC/Clang)
  */
 import * as Parser from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorInput from "../IGeneratorInput";
@@ -18,6 +22,8 @@ import IGeneratorState from "../IGeneratorState";
 import IGeneratorOutput from "../IGeneratorOutput";
 import IOrchestrator from "../IOrchestrator";
 import TGeneratorFn from "../TGeneratorFn";
+import TGeneratorEffect from "../TGeneratorEffect";
+import CompactEnumHelper from "../../helpers/CompactEnumHelper";
 
 /**
  * Generate a C typedef enum from a C-Next enum declaration.
@@ -37,15 +43,17 @@ const generateEnum: TGeneratorFn<Parser.EnumDeclarationContext> = (
   const prefix = state.currentScope ? `${state.currentScope}_` : "";
   const fullName = `${prefix}${name}`;
 
-  const lines: string[] = [];
-  lines.push(`typedef enum {`);
-
   // Look up enum members from symbols (collected by SymbolCollector)
   const members = input.symbols?.enumMembers.get(fullName);
   if (!members) {
     throw new Error(`Error: Enum ${fullName} not found in registry`);
   }
 
+  const compact = input.compactEnums ?? false;
+  const cppMode = input.cppMode ?? false;
+  const lines: string[] = [];
+  lines.push(CompactEnumHelper.getTypedefOpening(members, compact, cppMode));
+
   const memberEntries = Array.from(members.entries());
 
   for (let i = 0; i < memberEntries.length; i++) {
@@ -58,10 +66,13 @@ const generateEnum: TGeneratorFn<Parser.EnumDeclarationContext> = (
 
   lines.push(`} ${fullName};`, "");
 
-  // No side effects needed for enum generation
+  // C++ fixed underlying types (enum : uint8_t) need stdint
+  const effects: TGeneratorEffect[] =
+    compact && cppMode ? [{ type: "include", header: "stdint" }] : [];
+
   return {
     code: lines.join("\n"),
-    effects: [],
+    effects,
   };
 };
 
@@ -10,6 +10,7 @@
  *
  * ADR-006: Pass-by-reference semantics for non-array, non-float parameters.
  * ADR-029: Callback typedef generation for functions used as types.
+ * coldFunctions/hotFunctions: CNX_COLD/CNX_HOT on the definition.
  */
 import * as Parser from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorInput from "../IGeneratorInput";
@@ -17,6 +18,8 @@ import IGeneratorState from "../IGeneratorState";
 import IGeneratorOutput from "../IGeneratorOutput";
 import IOrchestrator from "../IOrchestrator";
 import TGeneratorFn from "../TGeneratorFn";
+import BranchHintHelper from "../../helpers/BranchHintHelper";
+import VectorTableHelper from "../../helpers/VectorTableHelper";
 
 /**
  * Generate a C function from a C-Next function declaration.
@@ -89,7 +92,10 @@ const generateFunction: TGeneratorFn<Parser.FunctionDeclarationContext> = (
   orchestrator.setCurrentFunctionReturnType(null); // Issue #477: Clear return type
   orchestrator.clearParameters();
 
-  const functionCode = `${actualReturnType} ${name}(${params}) ${body}\n`;
+  const attribute =
+    BranchHintHelper.getFunctionAttribute(name) +
+    VectorTableHelper.getHandlerAttribute(name);
+  const functionCode = `${attribute}${actualReturnType} ${name}(${params}) ${body}\n`;
 
   // ADR-029: Generate callback typedef only if this function is used as a type
   if (name !== "main" && orchestrator.isCallbackTypeUsedAsFieldType(name)) {
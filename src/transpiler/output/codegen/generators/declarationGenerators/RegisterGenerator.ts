@@ -13,6 +13,9 @@
  *   // Register: GPIO7 @ 0x42004000
  *   #define GPIO7_DR (*(volatile uint32_t const *)(0x42004000 + 0x00))
  *   #define GPIO7_DR_SET (*(volatile uint32_t*)(0x42004000 + 0x04))
+ *
+ * ADR-106: With staticVectors, ISR members of a register are slots of a
+ * const vector table (VectorTableHelper) instead of volatile macros.
  */
 import * as Parser from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorInput from "../IGeneratorInput";
@@ -21,6 +24,8 @@ import IGeneratorOutput from "../IGeneratorOutput";
 import IOrchestrator from "../IOrchestrator";
 import TGeneratorFn from "../TGeneratorFn";
 import generateRegisterMacros from "./RegisterMacroGenerator";
+import CodeGenState from "../../../../state/CodeGenState";
+import VectorTableHelper from "../../helpers/VectorTableHelper";
 
 /**
  * Generate C #define macros from a C-Next register declaration.
@@ -36,15 +41,17 @@ const generateRegister: TGeneratorFn<Parser.RegisterDeclarationContext> = (
 ): IGeneratorOutput => {
   const name = node.IDENTIFIER().getText();
   const baseAddress = orchestrator.generateExpression(node.expression());
+  const table = CodeGenState.vectorTables.get(name);
+  const members = table
+    ? node
+        .registerMember()
+        .filter((member) => !table.members.has(member.IDENTIFIER().getText()))
+    : node.registerMember();
 
   const lines: string[] = [
     `/* Register: ${name} @ ${baseAddress} */`,
-    ...generateRegisterMacros(
-      node.registerMember(),
-      name,
-      baseAddress,
-      orchestrator,
-    ),
+    ...generateRegisterMacros(members, name, baseAddress, orchestrator),
+    ...(table ? VectorTableHelper.generateDeclaration(table) : []),
     "",
   ];
 
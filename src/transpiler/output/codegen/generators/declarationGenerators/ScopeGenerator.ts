@@ -27,6 +27,11 @@ import QualifiedNameGenerator from "../../utils/QualifiedNameGenerator";
 import CodeGenState from "../../../../state/CodeGenState";
 import ScopeUtils from "../../../../../utils/ScopeUtils";
 import VariableModifierBuilder from "../../helpers/VariableModifierBuilder";
+import VariableDeclHelper from "../../helpers/VariableDeclHelper";
+import PackedBoolArrayHelper from "../../helpers/PackedBoolArrayHelper";
+import StructOfArraysHelper from "../../helpers/StructOfArraysHelper";
+import BranchHintHelper from "../../helpers/BranchHintHelper";
+import VectorTableHelper from "../../helpers/VectorTableHelper";
 
 /**
  * Generate initializer expression for a variable declaration.
@@ -222,6 +227,27 @@ function generateRegularVariable(
   const volatilePrefix = modifiers.atomic || modifiers.volatile;
   const constPrefix = isConst ? "const " : "";
 
+  // Packed bool arrays: word storage with whole-word initializers
+  const typeInfo = CodeGenState.getVariableTypeInfo(fullName);
+  if (typeInfo?.isPackedBool) {
+    return VariableDeclHelper.generatePackedBoolDecl(
+      varDecl,
+      `${staticPrefix}${volatilePrefix}${constPrefix}${PackedBoolArrayHelper.WORD_TYPE} ${fullName}`,
+      typeInfo.arrayDimensions![0],
+      (expr) => orchestrator.generateExpression(expr),
+    );
+  }
+
+  // Struct-of-arrays: one array per field, zero-initialized
+  if (typeInfo?.isStructOfArrays) {
+    return StructOfArraysHelper.generateDecl(
+      `${staticPrefix}${volatilePrefix}`,
+      typeInfo.baseType,
+      fullName,
+      typeInfo.arrayDimensions![0],
+    );
+  }
+
   // Build declaration with all dimensions
   let decl = `${staticPrefix}${volatilePrefix}${constPrefix}${type} ${fullName}`;
   decl += ArrayDimensionUtils.generateArrayTypeDimension(
@@ -270,7 +296,9 @@ function generateScopeFunction(
     scopeName,
     funcName,
   );
-  const prefix = isPrivate ? "static " : "";
+  // internalLinkage: functions no other file calls are static too
+  const isInternal = isPrivate || CodeGenState.internalFunctions.has(fullName);
+  const prefix = isInternal ? "static " : "";
 
   // Issue #269: Set current function name for pass-by-value lookup
   orchestrator.setCurrentFunctionName(fullName);
@@ -299,7 +327,13 @@ function generateScopeFunction(
   orchestrator.clearParameters();
 
   const lines: string[] = [];
-  lines.push("", `${prefix}${returnType} ${fullName}(${params}) ${body}`);
+  const attribute =
+    BranchHintHelper.getFunctionAttribute(fullName) +
+    VectorTableHelper.getHandlerAttribute(fullName);
+  lines.push(
+    "",
+    `${attribute}${prefix}${returnType} ${fullName}(${params}) ${body}`,
+  );
 
   // ADR-029: Generate callback typedef only if used as a type
   if (orchestrator.isCallbackTypeUsedAsFieldType(fullName)) {
@@ -365,6 +399,17 @@ function processScopeMember(
     explicitVisibility ?? ScopeUtils.getDefaultVisibility(isFunction);
   const isPrivate = visibility === "private";
 
+  // eliminateDeadCode: drop functions and variables no root reaches
+  const memberName =
+    member.functionDeclaration()?.IDENTIFIER().getText() ??
+    member.variableDeclaration()?.IDENTIFIER().getText();
+  if (
+    memberName &&
+    CodeGenState.deadSymbols.has(`${scopeName}_${memberName}`)
+  ) {
+    return [];
+  }
+
   // Handle variable declarations
   if (member.variableDeclaration()) {
     const varDecl = member.variableDeclaration()!;
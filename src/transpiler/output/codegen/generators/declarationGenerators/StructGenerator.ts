@@ -13,6 +13,10 @@
  *
  * ADR-029: Structs with callback fields get an auto-generated init function.
  * ADR-036: Multi-dimensional array support in struct fields.
+ *
+ * With reorderStructs (or reorderedStructs), fields are emitted in
+ * padding-minimizing order and the computed size is checked with a static
+ * assertion.
  */
 import * as Parser from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorInput from "../IGeneratorInput";
@@ -23,6 +27,8 @@ import TGeneratorFn from "../TGeneratorFn";
 import TGeneratorEffect from "../TGeneratorEffect";
 import ICodeGenSymbols from "../../../../types/ICodeGenSymbols";
 import ArrayDimensionUtils from "./ArrayDimensionUtils";
+import StructLayoutHelper from "../../helpers/StructLayoutHelper";
+import IStructLayout from "../../types/IStructLayout";
 
 /**
  * Generate a callback field declaration for a struct.
@@ -102,6 +108,29 @@ function getTrackedFieldDimensions(
   return fieldDims && fieldDims.length > 0 ? fieldDims : undefined;
 }
 
+/**
+ * Get the emitted layout of a struct when it is reordered (reorderStructs
+ * or reorderedStructs). Returns null when reordering is off or the layout
+ * is unknown.
+ */
+function getReorderedLayout(
+  structName: string,
+  input: IGeneratorInput,
+): IStructLayout | null {
+  if (
+    !input.symbols ||
+    !StructLayoutHelper.isReordered(input.symbols, structName)
+  ) {
+    return null;
+  }
+  return StructLayoutHelper.getReorderedLayout(
+    input.symbols,
+    structName,
+    input.targetCapabilities.wordSize,
+    input.compactEnums ?? false,
+  );
+}
+
 /**
  * Generate a C typedef struct from a C-Next struct declaration.
  *
@@ -121,11 +150,18 @@ const generateStruct: TGeneratorFn<Parser.StructDeclarationContext> = (
   const name = node.IDENTIFIER().getText();
   const callbackFields: Array<{ fieldName: string; callbackType: string }> = [];
 
+  const layout = getReorderedLayout(name, input);
+  const members = StructLayoutHelper.orderByLayout(
+    node.structMember(),
+    (member) => member.IDENTIFIER().getText(),
+    layout,
+  );
+
   const lines: string[] = [];
   // Issue #296: Use named struct for forward declaration compatibility
   lines.push(`typedef struct ${name} {`);
 
-  for (const member of node.structMember()) {
+  for (const member of members) {
     const fieldName = member.IDENTIFIER().getText();
     const typeName = orchestrator.getTypeName(member.type());
     // ADR-036: arrayDimension() now returns an array for multi-dimensional support
@@ -169,7 +205,17 @@ const generateStruct: TGeneratorFn<Parser.StructDeclarationContext> = (
     }
   }
 
-  lines.push(`} ${name};`, "");
+  lines.push(`} ${name};`);
+  if (layout) {
+    lines.push(
+      StructLayoutHelper.generateSizeAssert(
+        name,
+        layout.size,
+        input.cppMode ?? false,
+      ),
+    );
+  }
+  lines.push("");
 
   // ADR-029: Generate init function if struct has callback fields
   if (callbackFields.length > 0) {
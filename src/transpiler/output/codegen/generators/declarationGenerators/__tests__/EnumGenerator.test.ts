@@ -27,6 +27,7 @@ function createMockEnumContext(name: string): Parser.EnumDeclarationContext {
 function createMockInput(
   enumName: string,
   members: Map<string, number>,
+  overrides: Partial<IGeneratorInput> = {},
 ): IGeneratorInput {
   return {
     symbols: {
@@ -60,6 +61,7 @@ function createMockInput(
     callbackFieldTypes: new Map(),
     targetCapabilities: { hasAtomicSupport: false },
     debugMode: false,
+    ...overrides,
   } as unknown as IGeneratorInput;
 }
 
@@ -214,4 +216,59 @@ describe("EnumGenerator", () => {
       expect(result.effects).toEqual([]);
     });
   });
+
+  describe("compact enums", () => {
+    it("emits packed enum in C mode", () => {
+      const members = new Map([
+        ["IDLE", 0],
+        ["ERROR", 255],
+      ]);
+      const input = createMockInput("State", members, { compactEnums: true });
+
+      const result = generateEnum(
+        createMockEnumContext("State"),
+        input,
+        createMockState(),
+        createMockOrchestrator(),
+      );
+
+      expect(result.code).toContain("typedef enum __attribute__((packed)) {");
+      expect(result.effects).toEqual([]);
+    });
+
+    it("emits fixed underlying type in C++ mode", () => {
+      const members = new Map([
+        ["IDLE", 0],
+        ["ERROR", 256],
+      ]);
+      const input = createMockInput("State", members, {
+        compactEnums: true,
+        cppMode: true,
+      });
+
+      const result = generateEnum(
+        createMockEnumContext("State"),
+        input,
+        createMockState(),
+        createMockOrchestrator(),
+      );
+
+      expect(result.code).toContain("typedef enum : uint16_t {");
+      expect(result.effects).toEqual([{ type: "include", header: "stdint" }]);
+    });
+
+    it("keeps plain enum in C++ mode when compactEnums is off", () => {
+      const members = new Map([["IDLE", 0]]);
+      const input = createMockInput("State", members, { cppMode: true });
+
+      const result = generateEnum(
+        createMockEnumContext("State"),
+        input,
+        createMockState(),
+        createMockOrchestrator(),
+      );
+
+      expect(result.code).toContain("typedef enum {");
+    });
+  });
 });
@@ -55,10 +55,19 @@ function createMockInput(
   options: {
     callbackTypes?: Map<string, { typedefName: string }>;
     structFieldDimensions?: Map<string, Map<string, readonly number[]>>;
+    structFields?: Map<string, Map<string, string>>;
+    reorderedStructs?: Set<string>;
+    cppMode?: boolean;
   } = {},
 ): IGeneratorInput {
   return {
     callbackTypes: options.callbackTypes ?? new Map(),
+    cppMode: options.cppMode,
+    targetCapabilities: {
+      wordSize: 32,
+      hasLdrexStrex: true,
+      hasBasepri: true,
+    },
     symbols: {
       structFieldDimensions: options.structFieldDimensions ?? new Map(),
       // Other fields not used
@@ -69,7 +78,8 @@ function createMockInput(
       knownBitmaps: new Set(),
       scopeMembers: new Map(),
       scopeMemberVisibility: new Map(),
-      structFields: new Map(),
+      structFields: options.structFields ?? new Map(),
+      reorderedStructs: options.reorderedStructs,
       structFieldArrays: new Map(),
       enumMembers: new Map(),
       bitmapFields: new Map(),
@@ -396,4 +406,122 @@ describe("StructGenerator", () => {
       expect(result.code).toContain("typedef struct Node {");
     });
   });
+
+  describe("reordered structs", () => {
+    const members = [
+      { name: "a", type: "u8", cType: "uint8_t" },
+      { name: "b", type: "u32", cType: "uint32_t" },
+      { name: "c", type: "u16", cType: "uint16_t" },
+    ];
+    const structFields = new Map([
+      [
+        "Mixed",
+        new Map([
+          ["a", "u8"],
+          ["b", "u32"],
+          ["c", "u16"],
+        ]),
+      ],
+    ]);
+
+    it("keeps declaration order by default", () => {
+      const ctx = createMockStructContext("Mixed", members);
+      const input = createMockInput({ structFields });
+
+      const result = generateStruct(
+        ctx,
+        input,
+        createMockState(),
+        createMockOrchestrator(standardTypes),
+      );
+
+      expect(result.code).toBe(
+        `typedef struct Mixed {
+    uint8_t a;
+    uint32_t b;
+    uint16_t c;
+} Mixed;
+`,
+      );
+    });
+
+    it("emits fields by descending alignment with a size assertion", () => {
+      const ctx = createMockStructContext("Mixed", members);
+      const input = createMockInput({
+        structFields,
+        reorderedStructs: new Set(["Mixed"]),
+      });
+
+      const result = generateStruct(
+        ctx,
+        input,
+        createMockState(),
+        createMockOrchestrator(standardTypes),
+      );
+
+      expect(result.code).toBe(
+        `typedef struct Mixed {
+    uint32_t b;
+    uint16_t c;
+    uint8_t a;
+} Mixed;
+_Static_assert(sizeof(Mixed) == 8, "Mixed size differs from the computed layout");
+`,
+      );
+    });
+
+    it("uses static_assert in C++ mode", () => {
+      const ctx = createMockStructContext("Mixed", members);
+      const input = createMockInput({
+        structFields,
+        reorderedStructs: new Set(["Mixed"]),
+        cppMode: true,
+      });
+
+      const result = generateStruct(
+        ctx,
+        input,
+        createMockState(),
+        createMockOrchestrator(standardTypes),
+      );
+
+      expect(result.code).toContain(
+        'static_assert(sizeof(Mixed) == 8, "Mixed size differs from the computed layout");',
+      );
+    });
+
+    it("leaves structs with unknown field layouts untouched", () => {
+      const ctx = createMockStructContext("Wrapper", [
+        { name: "flag", type: "u8", cType: "uint8_t" },
+        { name: "handle", type: "ExtHandle", cType: "ExtHandle" },
+      ]);
+      const input = createMockInput({
+        structFields: new Map([
+          [
+            "Wrapper",
+            new Map([
+              ["flag", "u8"],
+              ["handle", "ExtHandle"],
+            ]),
+          ],
+        ]),
+        reorderedStructs: new Set(["Wrapper"]),
+      });
+
+      const result = generateStruct(
+        ctx,
+        input,
+        createMockState(),
+        createMockOrchestrator(standardTypes),
+      );
+
+      expect(result.code).toBe(
+        `typedef struct Wrapper {
+    uint8_t flag;
+    ExtHandle handle;
+} Wrapper;
+`,
+      );
+    });
+  });
 });
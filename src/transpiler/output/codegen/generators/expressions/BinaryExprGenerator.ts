@@ -10,6 +10,7 @@
  * - Arithmetic: +, -, *, /, %
  *
  * Issue #235: Includes constant folding for compile-time constant expressions.
+ * Q types: arithmetic on fixed-point operands becomes saturating helper calls.
  */
 import * as Parser from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorOutput from "../IGeneratorOutput";
@@ -19,6 +20,8 @@ import IGeneratorState from "../IGeneratorState";
 import IOrchestrator from "../IOrchestrator";
 import BinaryExprUtils from "./BinaryExprUtils";
 import CodeGenState from "../../../../state/CodeGenState";
+import TypeResolver from "../../TypeResolver";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
 
 /**
  * Generator context passed to child generators.
@@ -70,6 +73,114 @@ function accumulateBinaryExprs<T>(
   return { code: result, effects };
 }
 
+/** Fixed-point helper operation for each arithmetic operator */
+const FIXED_POINT_OPS: Record<string, string> = {
+  "+": "add",
+  "-": "sub",
+  "*": "mul",
+  "/": "div",
+};
+
+/**
+ * Unsuffixed or suffixed numeric literal, optionally negated.
+ */
+function isNumericLiteral(expr: Parser.UnaryExpressionContext): boolean {
+  return /^-*(\d|\.\d)/.test(expr.getText());
+}
+
+/**
+ * Resolve the Q type of an arithmetic or comparison over the given operands.
+ * Literals take the Q type of the other operands; with only literals (or
+ * unresolved operands) the expected type decides. Throws when a Q operand
+ * is mixed with another Q type or a typed non-Q operand.
+ */
+function resolveFixedPointType(
+  operands: Parser.UnaryExpressionContext[],
+): string | null {
+  let fixedType: string | null = null;
+  let otherType: string | null = null;
+  for (const operand of operands) {
+    if (isNumericLiteral(operand)) {
+      continue;
+    }
+    const type = TypeResolver.getUnaryExpressionType(operand);
+    if (!FixedPointUtils.isFixedPoint(type)) {
+      otherType ??= type;
+    } else if (fixedType && fixedType !== type) {
+      throw new Error(
+        `Error: Cannot mix ${fixedType} and ${type} in one expression; convert with a cast`,
+      );
+    } else {
+      fixedType = type;
+    }
+  }
+
+  if (fixedType && otherType) {
+    throw new Error(
+      `Error: Cannot mix ${fixedType} and ${otherType} in one expression; convert with a cast`,
+    );
+  }
+  const expected = CodeGenState.expectedType;
+  if (fixedType || otherType !== null) {
+    return fixedType;
+  }
+  return FixedPointUtils.isFixedPoint(expected) ? expected : null;
+}
+
+/**
+ * Operands of a comparison side that is a plain additive expression
+ * (no bitwise or shift operators), for Q type detection.
+ */
+function getComparisonOperands(
+  expr: Parser.BitwiseOrExpressionContext,
+): Parser.UnaryExpressionContext[] {
+  const xors = expr.bitwiseXorExpression();
+  const ands = xors.length === 1 ? xors[0].bitwiseAndExpression() : [];
+  const shifts = ands.length === 1 ? ands[0].shiftExpression() : [];
+  const adds = shifts.length === 1 ? shifts[0].additiveExpression() : [];
+  if (adds.length !== 1) {
+    return [];
+  }
+  return adds[0]
+    .multiplicativeExpression()
+    .flatMap((mult) => mult.unaryExpression());
+}
+
+/**
+ * Q type shared by the sides of a comparison, or null.
+ */
+function getComparisonFixedPointType(
+  exprs: Parser.BitwiseOrExpressionContext[],
+): string | null {
+  return CodeGenState.withoutExpectedType(() =>
+    resolveFixedPointType(exprs.flatMap(getComparisonOperands)),
+  );
+}
+
+/**
+ * Chain saturating Q helper calls: a + b - c -> sub(add(a, b), c).
+ */
+function generateFixedPointChain(
+  operandCodes: string[],
+  operators: string[],
+  fixedType: string,
+  effects: TGeneratorEffect[],
+): string {
+  let result = operandCodes[0];
+  for (let i = 1; i < operandCodes.length; i++) {
+    const op = operators[i - 1];
+    const operation = FIXED_POINT_OPS[op];
+    if (!operation) {
+      throw new Error(
+        `Error: Operator '${op}' is not supported for fixed-point type ${fixedType}`,
+      );
+    }
+    effects.push({ type: "helper", operation, cnxType: fixedType });
+    result = `cnx_clamp_${operation}_${fixedType}(${result}, ${operandCodes[i]})`;
+  }
+  return result;
+}
+
 /**
  * Generate C code for an OR expression (lowest precedence binary op).
  */
@@ -182,6 +293,23 @@ const generateEqualityExpr = (
   // ADR-001: C-Next uses = for equality, transpile to ==
   const operators = orchestrator.getOperatorsFromChildren(node);
 
+  // Q types: literals compare as raw fixed-point values (x = 0.5)
+  const fixedType = getComparisonFixedPointType(
+    exprs.flatMap((expr) => expr.bitwiseOrExpression()),
+  );
+  if (fixedType) {
+    return CodeGenState.withExpectedType(fixedType, () =>
+      accumulateBinaryExprs(
+        exprs,
+        operators,
+        "=",
+        generateRelationalExpr,
+        { input, state, orchestrator },
+        BinaryExprUtils.mapEqualityOperator,
+      ),
+    );
+  }
+
   // Issue #1032: Clear expectedType for equality comparisons.
   // The U suffix for MISRA 7.2 compliance applies to assignments, not comparisons.
   // Use CodeGenState.withoutExpectedType() to clear the global state that
@@ -220,6 +348,18 @@ const generateRelationalExpr = (
   // Issue #152: Extract operators in order from parse tree children
   const operators = orchestrator.getOperatorsFromChildren(node);
 
+  // Q types: literals compare as raw fixed-point values (x < 0.5)
+  const fixedType = getComparisonFixedPointType(exprs);
+  if (fixedType) {
+    return CodeGenState.withExpectedType(fixedType, () =>
+      accumulateBinaryExprs(exprs, operators, "<", generateBitwiseOrExpr, {
+        input,
+        state,
+        orchestrator,
+      }),
+    );
+  }
+
   // Issue #1032: Clear expectedType for relational comparisons.
   // The U suffix for MISRA 7.2 compliance applies to assignments, not comparisons.
   // Comparing `i32 < 0` should NOT generate `signedIdx < 0U` because that
@@ -371,6 +511,32 @@ const generateAdditiveExpr = (
   // Issue #152: Extract operators in order from parse tree children
   const operators = orchestrator.getOperatorsFromChildren(node);
 
+  // Q types: saturating helpers, operands generated in the Q type context
+  const fixedType = resolveFixedPointType(
+    exprs.flatMap((expr) => expr.unaryExpression()),
+  );
+  if (fixedType) {
+    const operandCodes = CodeGenState.withExpectedType(fixedType, () =>
+      exprs.map((expr) => {
+        const result = generateMultiplicativeExpr(
+          expr,
+          input,
+          state,
+          orchestrator,
+        );
+        effects.push(...result.effects);
+        return result.code;
+      }),
+    );
+    const code = generateFixedPointChain(
+      operandCodes,
+      operators,
+      fixedType,
+      effects,
+    );
+    return { code, effects };
+  }
+
   // Generate code for all operands
   const operandResults = exprs.map((expr) =>
     generateMultiplicativeExpr(expr, input, state, orchestrator),
@@ -419,6 +585,22 @@ const generateMultiplicativeExpr = (
   // Issue #152: Extract operators in order from parse tree children
   const operators = orchestrator.getOperatorsFromChildren(node);
 
+  // Q types: rounding, saturating mul/div helpers
+  const fixedType = resolveFixedPointType(exprs);
+  if (fixedType) {
+    const effects: TGeneratorEffect[] = [];
+    const fixedOperands = CodeGenState.withExpectedType(fixedType, () =>
+      exprs.map((expr) => orchestrator.generateUnaryExpr(expr)),
+    );
+    const code = generateFixedPointChain(
+      fixedOperands,
+      operators,
+      fixedType,
+      effects,
+    );
+    return { code, effects };
+  }
+
   // Generate code for all operands
   const operandCodes = exprs.map((expr) =>
     orchestrator.generateUnaryExpr(expr),
@@ -2,7 +2,8 @@
  * Function Call Expression Generator (ADR-053 A2 Phase 5)
  *
  * Generates C code for function calls:
- * - safe_div/safe_mod built-in functions (ADR-051)
+ * - safe_div/safe_mod/safe_divmod built-in functions (ADR-051)
+ * - likely/unlikely outside an if condition or switch expression (error)
  * - C-Next function calls with pass-by-reference semantics
  * - C function calls with pass-by-value semantics
  * - Const-to-non-const validation (ADR-013)
@@ -19,6 +20,14 @@ import IOrchestrator from "../IOrchestrator";
 import CallExprUtils from "./CallExprUtils";
 import CodeGenState from "../../../../state/CodeGenState";
 import C_TYPE_WIDTH from "../../types/C_TYPE_WIDTH";
+import StructOfArraysHelper from "../../helpers/StructOfArraysHelper";
+import PackedBoolArrayHelper from "../../helpers/PackedBoolArrayHelper";
+import ConstantDivisorHelper from "../../helpers/ConstantDivisorHelper";
+import ExpressionUtils from "../../../../../utils/ExpressionUtils";
+import TypeResolver from "../../TypeResolver";
+
+/** ADR-051 built-ins that write through output arguments */
+const SAFE_DIV_BUILTINS = new Set(["safe_div", "safe_mod", "safe_divmod"]);
 
 /**
  * Issue #304: Wrap argument with static_cast if it's a C++ enum class
@@ -194,6 +203,51 @@ const _generateCFunctionArg = (
   );
 };
 
+/**
+ * Reject packed bool arrays as call arguments (packedBoolArrays).
+ * Their uint32_t word storage does not match a bool[] parameter.
+ */
+const _validateNotPackedBoolArray = (e: ExpressionContext): void => {
+  const packed = PackedBoolArrayHelper.findArgument(e);
+  if (packed && !packed.isElement) {
+    throw new Error(
+      `Error: Packed bool array '${packed.text}' cannot be passed to a function. ` +
+        `Its elements are bits in uint32_t words, not a bool[]; copy them into an unpacked local array first.`,
+    );
+  }
+};
+
+/**
+ * Reject a packed bool element passed by reference (packedBoolArrays).
+ * The element is a bit inside a word and has no address.
+ */
+const _validateNotPackedBoolElementByRef = (
+  e: ExpressionContext,
+  funcExpr: string,
+): void => {
+  const packed = PackedBoolArrayHelper.findArgument(e);
+  if (packed?.isElement) {
+    throw new Error(
+      `Error: Packed bool element '${packed.text}' cannot be passed by reference to '${funcExpr}', which modifies the parameter. ` +
+        `Copy it into a local bool, pass that, and assign it back.`,
+    );
+  }
+};
+
+/**
+ * Reject struct-of-arrays arrays and whole elements as call arguments
+ * (soaStructs). Their per-field storage has no addressable Struct object.
+ */
+const _validateNotStructOfArrays = (e: ExpressionContext): void => {
+  const escaping = StructOfArraysHelper.findEscapingArgument(e);
+  if (escaping) {
+    throw new Error(
+      `Error: Struct-of-arrays value '${escaping}' cannot be passed to a function. ` +
+        `Copy the element into a local struct or pass individual fields instead.`,
+    );
+  }
+};
+
 /**
  * Determine if a C-Next parameter should be passed by value.
  */
@@ -269,9 +323,34 @@ const generateFunctionCall = (
   // Check if this is a C-Next function (uses pass-by-reference)
   const isCNextFunc = orchestrator.isCNextFunction(funcExpr);
 
-  // ADR-051: Handle safe_div() and safe_mod() built-in functions
-  if (funcExpr === "safe_div" || funcExpr === "safe_mod") {
-    return generateSafeDivMod(funcExpr, argExprs, input, orchestrator, effects);
+  // Branch hints are consumed by the if/switch generators
+  if ((funcExpr === "likely" || funcExpr === "unlikely") && !isCNextFunc) {
+    throw new Error(
+      `Error: ${funcExpr}() is only allowed as an if condition or a switch expression`,
+    );
+  }
+
+  // ADR-051: Handle safe_div(), safe_mod() and safe_divmod() built-ins
+  if (SAFE_DIV_BUILTINS.has(funcExpr)) {
+    // Only this call is the statement; nested calls are values
+    const isStatement = CodeGenState.inSafeDivStatement;
+    CodeGenState.inSafeDivStatement = false;
+    return funcExpr === "safe_divmod"
+      ? generateSafeDivModPair(
+          argExprs,
+          isStatement,
+          input,
+          orchestrator,
+          effects,
+        )
+      : generateSafeDivMod(
+          funcExpr,
+          argExprs,
+          isStatement,
+          input,
+          orchestrator,
+          effects,
+        );
   }
 
   // Regular function call handling
@@ -290,6 +369,9 @@ const generateFunctionCall = (
   const args = CodeGenState.withoutDeclarationInit(() =>
     argExprs
       .map((e, idx) => {
+        _validateNotPackedBoolArray(e);
+        _validateNotStructOfArrays(e);
+
         // Get parameter type info from local signature or cross-file SymbolTable
         const resolved = CallExprUtils.resolveTargetParam(
           sig,
@@ -329,6 +411,7 @@ const generateFunctionCall = (
         }
 
         // Target parameter is pass-by-reference: use & logic
+        _validateNotPackedBoolElementByRef(e, funcExpr);
         return orchestrator.generateFunctionArg(e, targetParam?.baseType);
       })
       .join(", "),
@@ -337,6 +420,91 @@ const generateFunctionCall = (
   return { code: `${funcExpr}(${args})`, effects };
 };
 
+/**
+ * Resolve the C-Next type of a safe_div/safe_mod/safe_divmod output
+ * parameter; the helper is chosen by it.
+ */
+const resolveSafeDivOutputType = (
+  funcName: string,
+  outputExpr: ExpressionContext,
+  argument: string,
+  orchestrator: IOrchestrator,
+): string => {
+  const outputArgId = orchestrator.getSimpleIdentifier(outputExpr);
+  if (!outputArgId) {
+    throw new Error(`${funcName} requires a variable as the ${argument}`);
+  }
+
+  // Look up the type of the output parameter
+  const typeInfo = CodeGenState.getVariableTypeInfo(outputArgId);
+  if (!typeInfo) {
+    throw new Error(
+      `Cannot determine type of output parameter '${outputArgId}' for ${funcName}`,
+    );
+  }
+
+  // Map C-Next type to helper function suffix
+  const cnxType = typeInfo.baseType;
+  if (!cnxType) {
+    throw new Error(
+      `Output parameter '${outputArgId}' has no C-Next type for ${funcName}`,
+    );
+  }
+  return cnxType;
+};
+
+/**
+ * strengthReduce: Check whether a safe division with these numerator,
+ * divisor and default arguments can skip the helper. Returns the constant
+ * divisor, or undefined if the helper is needed.
+ */
+const getInlineDivisor = (
+  operation: "div" | "mod" | "divmod",
+  [numeratorExpr, divisorExpr, defaultExpr]: ExpressionContext[],
+  cnxType: string,
+  input: IGeneratorInput,
+  orchestrator: IOrchestrator,
+): number | undefined => {
+  if (!input.strengthReduce) {
+    return undefined;
+  }
+  const divisor = orchestrator.tryEvaluateConstant(divisorExpr);
+  if (
+    divisor === undefined ||
+    !ConstantDivisorHelper.isInlineDivisor(divisor, cnxType)
+  ) {
+    return undefined;
+  }
+  // The helper evaluates the default once; a call there must still run
+  if (ExpressionUtils.hasFunctionCall(defaultExpr)) {
+    return undefined;
+  }
+  if (
+    ConstantDivisorHelper.readsNumeratorTwice(operation, divisor, cnxType) &&
+    ExpressionUtils.hasFunctionCall(numeratorExpr)
+  ) {
+    return undefined;
+  }
+  return divisor;
+};
+
+/**
+ * Numerator of an inlined safe division as an operand of the output type.
+ * Only a plain variable of that type skips the cast; arithmetic such as
+ * `head + 1` is computed in int and must wrap like the helper's parameter.
+ */
+const generateInlineNumerator = (
+  numeratorExpr: ExpressionContext,
+  cnxType: string,
+  orchestrator: IOrchestrator,
+): string =>
+  ConstantDivisorHelper.operand(
+    orchestrator.generateExpression(numeratorExpr),
+    cnxType,
+    ExpressionUtils.extractIdentifier(numeratorExpr) === null ||
+      TypeResolver.getIntegerExpressionType(numeratorExpr) !== cnxType,
+  );
+
 /**
  * Generate code for safe_div() or safe_mod() built-in functions (ADR-051).
  *
@@ -345,10 +513,16 @@ const generateFunctionCall = (
  * - numerator: The dividend
  * - divisor: The divisor
  * - defaultValue: Value to use if divisor is 0
+ *
+ * With strengthReduce, a call that is a whole expression statement and has a
+ * constant non-zero divisor skips the helper: the statement becomes the
+ * assignment (a shift or mask for powers of two). A call whose result is
+ * used keeps the helper, so no comma expression is needed (MISRA 12.3).
  */
 const generateSafeDivMod = (
   funcName: string,
   argExprs: ExpressionContext[],
+  isStatement: boolean,
   input: IGeneratorInput,
   orchestrator: IOrchestrator,
   effects: TGeneratorEffect[],
@@ -359,28 +533,29 @@ const generateSafeDivMod = (
     );
   }
 
-  // Get the output parameter (first argument) to determine type
-  const outputArgId = orchestrator.getSimpleIdentifier(argExprs[0]);
-  if (!outputArgId) {
-    throw new Error(
-      `${funcName} requires a variable as the first argument (output parameter)`,
-    );
-  }
-
-  // Look up the type of the output parameter
-  const typeInfo = CodeGenState.getVariableTypeInfo(outputArgId);
-  if (!typeInfo) {
-    throw new Error(
-      `Cannot determine type of output parameter '${outputArgId}' for ${funcName}`,
-    );
-  }
+  const cnxType = resolveSafeDivOutputType(
+    funcName,
+    argExprs[0],
+    "first argument (output parameter)",
+    orchestrator,
+  );
+  const opType: "div" | "mod" = funcName === "safe_div" ? "div" : "mod";
 
-  // Map C-Next type to helper function suffix
-  const cnxType = typeInfo.baseType;
-  if (!cnxType) {
-    throw new Error(
-      `Output parameter '${outputArgId}' has no C-Next type for ${funcName}`,
+  const divisor = isStatement
+    ? getInlineDivisor(opType, argExprs.slice(1), cnxType, input, orchestrator)
+    : undefined;
+  if (divisor !== undefined) {
+    const output = orchestrator.generateExpression(argExprs[0]);
+    const numerator = generateInlineNumerator(
+      argExprs[1],
+      cnxType,
+      orchestrator,
     );
+    const value =
+      opType === "div"
+        ? ConstantDivisorHelper.quotient(numerator, divisor, cnxType)
+        : ConstantDivisorHelper.remainder(numerator, divisor, cnxType);
+    return { code: `${output} = ${value}`, effects };
   }
 
   // Generate arguments: &output, numerator, divisor, defaultValue
@@ -395,7 +570,6 @@ const generateSafeDivMod = (
   );
 
   // Track that this operation is used for helper generation
-  const opType: "div" | "mod" = funcName === "safe_div" ? "div" : "mod";
   effects.push({ type: "safe-div", operation: opType, cnxType });
 
   return {
@@ -404,6 +578,80 @@ const generateSafeDivMod = (
   };
 };
 
+/**
+ * Generate code for the safe_divmod() built-in function (ADR-051).
+ *
+ * Takes 5 arguments: quotient, remainder (outputs of the same type),
+ * numerator, divisor and defaultValue (stored in both outputs if the
+ * divisor is 0). cnx_safe_divmod_* computes both from one division; the
+ * strengthReduce statement form assigns both outputs.
+ */
+const generateSafeDivModPair = (
+  argExprs: ExpressionContext[],
+  isStatement: boolean,
+  input: IGeneratorInput,
+  orchestrator: IOrchestrator,
+  effects: TGeneratorEffect[],
+): IGeneratorOutput => {
+  if (argExprs.length !== 5) {
+    throw new Error(
+      "safe_divmod requires exactly 5 arguments: quotient, remainder, numerator, divisor, defaultValue",
+    );
+  }
+
+  const cnxType = resolveSafeDivOutputType(
+    "safe_divmod",
+    argExprs[0],
+    "first argument (quotient)",
+    orchestrator,
+  );
+  const remainderType = resolveSafeDivOutputType(
+    "safe_divmod",
+    argExprs[1],
+    "second argument (remainder)",
+    orchestrator,
+  );
+  if (remainderType !== cnxType) {
+    throw new Error(
+      `safe_divmod requires quotient and remainder of the same type, got ${cnxType} and ${remainderType}`,
+    );
+  }
+
+  const divisor = isStatement
+    ? getInlineDivisor(
+        "divmod",
+        argExprs.slice(2),
+        cnxType,
+        input,
+        orchestrator,
+      )
+    : undefined;
+  const quotient = orchestrator.generateExpression(argExprs[0]);
+  if (divisor !== undefined) {
+    const numerator = generateInlineNumerator(
+      argExprs[2],
+      cnxType,
+      orchestrator,
+    );
+    // The remainder reads the numerator after the quotient is stored
+    if (!ConstantDivisorHelper.numeratorReads(numerator, quotient)) {
+      const remainder = orchestrator.generateExpression(argExprs[1]);
+      const q = ConstantDivisorHelper.quotient(numerator, divisor, cnxType);
+      const r = ConstantDivisorHelper.remainder(numerator, divisor, cnxType);
+      // Two statements; the caller terminates the last one
+      return { code: `${quotient} = ${q};\n${remainder} = ${r}`, effects };
+    }
+  }
+
+  const args = argExprs.map((expr, index) => {
+    const code = index === 0 ? quotient : orchestrator.generateExpression(expr);
+    return index < 2 ? `&${code}` : code;
+  });
+  effects.push({ type: "safe-div", operation: "divmod", cnxType });
+
+  return { code: `cnx_safe_divmod_${cnxType}(${args.join(", ")})`, effects };
+};
+
 /**
  * Validate const-to-non-const parameter passing (ADR-013).
  *
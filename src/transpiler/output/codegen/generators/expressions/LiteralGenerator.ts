@@ -6,9 +6,14 @@
  * - Float literals with C-Next suffixes (f32 → f, f64 → no suffix)
  * - Integer literals with C-Next suffixes (u64 → ULL, i64 → LL, strip 8/16/32)
  * - MISRA Rule 7.2: Unsigned suffix for unsigned integer types
+ * - Numeric literals in Q type context → raw fixed-point integers
  * - String and numeric literals pass through unchanged
  */
-import { LiteralContext } from "../../../../logic/parser/grammar/CNextParser";
+import {
+  LiteralContext,
+  PostfixExpressionContext,
+  UnaryExpressionContext,
+} from "../../../../logic/parser/grammar/CNextParser";
 import IGeneratorOutput from "../IGeneratorOutput";
 import TGeneratorEffect from "../TGeneratorEffect";
 import IGeneratorInput from "../IGeneratorInput";
@@ -16,6 +21,7 @@ import IGeneratorState from "../IGeneratorState";
 import IOrchestrator from "../IOrchestrator";
 import NarrowingCastHelper from "../../helpers/NarrowingCastHelper.js";
 import CodeGenState from "../../../../state/CodeGenState";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
 
 /**
  * Unsigned type patterns for MISRA Rule 7.2 compliance.
@@ -71,6 +77,24 @@ function hasUnsignedSuffix(text: string): boolean {
   return /[uU]([lL]{0,2})$/.test(text);
 }
 
+/**
+ * Check if a literal is the direct operand of a unary minus (-0.5).
+ * Literal -> primary -> postfix (no ops) -> unary -> '-' unary.
+ */
+function isNegatedLiteral(node: LiteralContext): boolean {
+  const postfix = node.parent?.parent;
+  if (
+    !(postfix instanceof PostfixExpressionContext) ||
+    postfix.postfixOp().length > 0
+  ) {
+    return false;
+  }
+  const outer = postfix.parent?.parent;
+  return (
+    outer instanceof UnaryExpressionContext && outer.getText().startsWith("-")
+  );
+}
+
 /**
  * Generate C code for a literal value.
  *
@@ -110,6 +134,21 @@ const generateLiteral = (
     return { code: literalText, effects };
   }
 
+  // Q types: numeric literals are converted to raw storage at transpile time
+  // (q15: 0.5 -> 16384). The sign stays with the enclosing unary minus.
+  const fixedPoint = FixedPointUtils.parse(state?.expectedType);
+  if (fixedPoint) {
+    const raw = FixedPointUtils.toRaw(
+      literalText,
+      fixedPoint,
+      isNegatedLiteral(node),
+    );
+    if (raw !== null) {
+      const suffix = fixedPoint.isSigned ? "" : "U";
+      return { code: `${raw}${suffix}`, effects };
+    }
+  }
+
   // ADR-024: Transform C-Next float suffixes to standard C syntax
   // 3.14f32 -> 3.14f (C float)
   // 3.14f64 -> 3.14 (C double, no suffix needed)
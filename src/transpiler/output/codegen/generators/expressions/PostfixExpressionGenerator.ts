@@ -7,6 +7,7 @@
  * - Bit access (value[3] or value[0, 8])
  * - Function calls (func())
  * - Property access (.length, .capacity, .size)
+ * - Whole-array reductions (.sum, .min, .max, (a * b).sum)
  *
  * This generator was extracted from CodeGenerator._generatePostfixExpr
  * to reduce the size and complexity of CodeGenerator.ts.
@@ -23,12 +24,17 @@ import memberAccessChain from "../../memberAccessChain";
 import MemberAccessValidator from "../../helpers/MemberAccessValidator";
 import BitmapAccessHelper from "./BitmapAccessHelper";
 import NarrowingCastHelper from "../../helpers/NarrowingCastHelper";
+import CompactEnumHelper from "../../helpers/CompactEnumHelper";
+import PackedBoolArrayHelper from "../../helpers/PackedBoolArrayHelper";
+import StructOfArraysHelper from "../../helpers/StructOfArraysHelper";
+import ArrayArithmeticHelper from "../../helpers/ArrayArithmeticHelper";
 import TypeCheckUtils from "../../../../../utils/TypeCheckUtils";
 import SubscriptClassifier from "../../subscript/SubscriptClassifier";
 import TYPE_WIDTH from "../../types/TYPE_WIDTH";
 import C_TYPE_WIDTH from "../../types/C_TYPE_WIDTH";
 import TTypeInfo from "../../types/TTypeInfo";
 import CodeGenState from "../../../../state/CodeGenState";
+import VectorTableHelper from "../../helpers/VectorTableHelper";
 
 // ========================================================================
 // Tracking State
@@ -49,6 +55,8 @@ interface ITrackingState {
   subscriptDepth: number;
   isGlobalAccess: boolean;
   isCppAccessChain: boolean;
+  /** Pending element index into a struct-of-arrays array (soaStructs) */
+  soaIndex: string | undefined;
 }
 
 /**
@@ -100,6 +108,7 @@ const initializeTrackingState = (
     subscriptDepth: 0,
     isGlobalAccess: false,
     isCppAccessChain,
+    soaIndex: undefined,
   };
 };
 
@@ -146,6 +155,21 @@ const generatePostfixExpression = (
   const primary = ctx.primaryExpression();
   const ops = ctx.postfixOp();
 
+  // (a * b).sum: dot product of two whole arrays
+  const groupedExpr =
+    ops.length === 1 && ops[0].IDENTIFIER()?.getText() === "sum"
+      ? primary.expression()
+      : null;
+  if (groupedExpr) {
+    const dotProduct = ArrayArithmeticHelper.tryGenerateDotProduct(
+      groupedExpr,
+      (unary) => orchestrator.generateUnaryExpr(unary),
+    );
+    if (dotProduct !== null) {
+      return { code: dotProduct, effects };
+    }
+  }
+
   // Check if this is a struct parameter - we may need to handle -> access
   const rootIdentifier = primary.IDENTIFIER()?.getText();
   const paramInfo = rootIdentifier
@@ -194,6 +218,10 @@ const generatePostfixExpression = (
     if (op.IDENTIFIER()) {
       const memberName = op.IDENTIFIER()!.getText();
       handleMemberOp(memberName, tracking, postfixCtx);
+    } else if (tracking.soaIndex !== undefined) {
+      throw new Error(
+        `Error: Struct-of-arrays element '${tracking.result}[${tracking.soaIndex}]' can only be read by field or copied whole`,
+      );
     } else if (op.expression().length > 0) {
       const subscriptResult = generateSubscriptAccess(
         {
@@ -222,6 +250,7 @@ const generatePostfixExpression = (
         subscriptResult.remainingArrayDims ?? tracking.remainingArrayDims;
       tracking.subscriptDepth =
         subscriptResult.subscriptDepth ?? tracking.subscriptDepth;
+      tracking.soaIndex = subscriptResult.soaIndex;
     } else {
       const callResult = generateFunctionCall(
         tracking.result,
@@ -249,6 +278,18 @@ const generatePostfixExpression = (
     };
   }
 
+  // Whole struct-of-arrays element: gather every field into a struct value
+  if (tracking.soaIndex !== undefined) {
+    return {
+      code: StructOfArraysHelper.gatherElement(
+        tracking.currentStructType!,
+        tracking.result,
+        tracking.soaIndex,
+      ),
+      effects,
+    };
+  }
+
   return { code: tracking.result, effects };
 };
 
@@ -306,6 +347,12 @@ const handleMemberOp = (
     return;
   }
 
+  // Struct-of-arrays element field: samples[i].x -> samples.x[i]
+  if (tracking.soaIndex !== undefined) {
+    handleStructOfArraysField(memberName, tracking, ctx.orchestrator);
+    return;
+  }
+
   // Handle bitmap field access, scope member access, enum member access, etc.
   const memberResult = generateMemberAccess(
     {
@@ -342,6 +389,30 @@ const handleMemberOp = (
   tracking.previousMemberName = memberResult.previousMemberName;
 };
 
+/**
+ * Handle a field read on a struct-of-arrays element (soaStructs).
+ * The pending element index moves behind the field: samples.x[i].
+ */
+const handleStructOfArraysField = (
+  memberName: string,
+  tracking: ITrackingState,
+  orchestrator: IOrchestrator,
+): void => {
+  const structType = tracking.currentStructType!;
+  tracking.result = StructOfArraysHelper.fieldElement(
+    structType,
+    tracking.result,
+    memberName,
+    tracking.soaIndex!,
+  );
+  tracking.soaIndex = undefined;
+  tracking.previousStructType = structType;
+  tracking.previousMemberName = memberName;
+  tracking.currentStructType =
+    orchestrator.getMemberTypeInfo(structType, memberName)?.baseType;
+  tracking.currentMemberIsArray = false;
+};
+
 /**
  * Handle `global.X` prefix. Returns true if handled (caller should skip).
  */
@@ -578,6 +649,10 @@ const tryPropertyAccess = (
     );
   }
 
+  if (ArrayArithmeticHelper.isReduction(memberName)) {
+    return tryReductionProperty(memberName, tracking);
+  }
+
   if (memberName === "capacity") {
     const typeInfo = resolveStringTypeInfo(
       tracking,
@@ -607,6 +682,46 @@ const tryPropertyAccess = (
   return false;
 };
 
+/**
+ * Try handling a whole-array reduction (.sum, .min, .max, .any).
+ * Returns false when the value is not a whole array variable, so a struct
+ * field of the same name is still reached.
+ */
+const tryReductionProperty = (
+  memberName: string,
+  tracking: ITrackingState,
+): boolean => {
+  if (
+    tracking.subscriptDepth > 0 ||
+    tracking.previousStructType !== undefined ||
+    !tracking.resolvedIdentifier
+  ) {
+    return false;
+  }
+  const typeInfo = CodeGenState.getVariableTypeInfo(
+    tracking.resolvedIdentifier,
+  );
+  // Packed bool arrays test whole storage words
+  if (memberName === "any" && typeInfo?.isPackedBool) {
+    applyPropertyResult(
+      tracking,
+      PackedBoolArrayHelper.any(tracking.result, typeInfo.arrayDimensions![0]),
+    );
+    return true;
+  }
+  const result = ArrayArithmeticHelper.generateReduction(
+    memberName,
+    tracking.result,
+    typeInfo,
+    tracking.resolvedIdentifier,
+  );
+  if (result === null) {
+    return false;
+  }
+  applyPropertyResult(tracking, result);
+  return true;
+};
+
 // ========================================================================
 // ADR-058: Explicit Length Properties
 // ========================================================================
@@ -642,7 +757,11 @@ const getNumericBitWidth = (
   }
   // Check if it's a known enum (default to 32 bits per ADR-017)
   if (bitWidth === 0 && input.symbols?.knownEnums?.has(typeName)) {
-    bitWidth = 32;
+    const members = input.symbols.enumMembers.get(typeName);
+    bitWidth =
+      input.compactEnums && members
+        ? CompactEnumHelper.inferBitWidth(members)
+        : 32;
   }
   // Check bitmap types
   if (bitWidth === 0 && input.symbols?.bitmapBitWidth) {
@@ -873,10 +992,19 @@ const generateTypeInfoBitLength = (
     isBitmap?: boolean;
     bitmapTypeName?: string;
     stringCapacity?: number;
+    isPackedBool?: boolean;
   },
   subscriptDepth: number,
   input: IGeneratorInput,
 ): string => {
+  // Packed bool array: storage is whole uint32_t words
+  if (typeInfo.isPackedBool && subscriptDepth === 0) {
+    return String(
+      PackedBoolArrayHelper.wordCount(typeInfo.arrayDimensions![0] as number) *
+        32,
+    );
+  }
+
   // String type: bit_length = (capacity + 1) * 8 (buffer size in bits)
   if (typeInfo.isString) {
     if (typeInfo.stringCapacity !== undefined) {
@@ -1527,6 +1655,7 @@ interface SubscriptAccessResult {
   currentMemberIsArray?: boolean;
   remainingArrayDims?: number;
   subscriptDepth?: number;
+  soaIndex?: string;
 }
 
 /**
@@ -1606,6 +1735,12 @@ const handleSingleSubscript = (
   const isRegisterAccess = checkRegisterAccess(ctx, input);
   const identifierTypeInfo = getIdentifierTypeInfo(ctx, input);
 
+  // ADR-106: ISR[N] member of a static vector table reads a slot
+  if (isRegisterAccess && VectorTableHelper.isSlotRange(ctx.result)) {
+    output.result = `${ctx.result}[${index}]`;
+    return output;
+  }
+
   // Register access: bit extraction
   if (isRegisterAccess) {
     // Skip shift when index is 0 (either "0" or "0U" with MISRA suffix)
@@ -1630,6 +1765,29 @@ const handleSingleSubscript = (
     return output;
   }
 
+  // Packed bool array: shift/mask read of the containing word
+  if (identifierTypeInfo?.isPackedBool && ctx.subscriptDepth === 0) {
+    PackedBoolArrayHelper.checkReadIndex(expr, ctx.result);
+    output.result = PackedBoolArrayHelper.read(ctx.result, index);
+    output.remainingArrayDims = 0;
+    output.subscriptDepth = 1;
+    return output;
+  }
+
+  // Struct-of-arrays: defer the index until the field is known.
+  // Looked up by C name so bare scope members (samples -> Scope_samples) match.
+  const soaTypeInfo =
+    ctx.subscriptDepth === 0
+      ? CodeGenState.getVariableTypeInfo(ctx.result)
+      : undefined;
+  if (soaTypeInfo?.isStructOfArrays) {
+    output.soaIndex = index;
+    output.currentStructType = soaTypeInfo.baseType;
+    output.remainingArrayDims = 0;
+    output.subscriptDepth = 1;
+    return output;
+  }
+
   // Multi-dimensional array access
   if (ctx.remainingArrayDims > 0) {
     return handleRemainingArrayDims(ctx, index, output);
@@ -3,7 +3,10 @@ import generateFunctionCall from "../CallExprGenerator";
 import IGeneratorInput from "../../IGeneratorInput";
 import IGeneratorState from "../../IGeneratorState";
 import IOrchestrator from "../../IOrchestrator";
+import { CharStream, CommonTokenStream } from "antlr4ng";
 import * as Parser from "../../../../../logic/parser/grammar/CNextParser";
+import { CNextLexer } from "../../../../../logic/parser/grammar/CNextLexer";
+import { CNextParser } from "../../../../../logic/parser/grammar/CNextParser";
 import CodeGenState from "../../../../../state/CodeGenState";
 import TTypeInfo from "../../../types/TTypeInfo";
 
@@ -17,6 +20,11 @@ function createMockExpressionContext(text: string): Parser.ExpressionContext {
   } as unknown as Parser.ExpressionContext;
 }
 
+function parseExpression(text: string): Parser.ExpressionContext {
+  const lexer = new CNextLexer(CharStream.fromString(text));
+  return new CNextParser(new CommonTokenStream(lexer)).expression();
+}
+
 function createMockArgListContext(
   expressions: Parser.ExpressionContext[],
 ): Parser.ArgumentListContext {
@@ -1115,6 +1123,156 @@ describe("CallExprGenerator", () => {
     });
   });
 
+  describe("safe_divmod and constant divisors (ADR-051)", () => {
+    const u32 = {
+      baseType: "u32",
+      bitWidth: 32,
+      isArray: false,
+      isConst: false,
+    };
+    const i32 = {
+      baseType: "i32",
+      bitWidth: 32,
+      isArray: false,
+      isConst: false,
+    };
+
+    function generateSafeCall(
+      funcName: string,
+      args: string[],
+      strengthReduce: boolean,
+      isStatement = true,
+    ) {
+      const typeRegistry = new Map([
+        ["q", u32],
+        ["r", u32],
+        ["head", u32],
+        ["s", i32],
+        ["x", i32],
+      ]);
+      const input = createMockInput({ typeRegistry, strengthReduce });
+      const orchestrator = createMockOrchestrator({
+        tryEvaluateConstant: vi.fn((ctx: Parser.ExpressionContext) =>
+          /^\d+$/.test(ctx.getText())
+            ? Number.parseInt(ctx.getText(), 10)
+            : undefined,
+        ),
+      });
+      CodeGenState.inSafeDivStatement = isStatement;
+      return generateFunctionCall(
+        funcName,
+        createMockArgListContext(args.map(parseExpression)),
+        input,
+        createMockState(),
+        orchestrator,
+      );
+    }
+
+    it("generates the safe_divmod helper call and effect", () => {
+      const result = generateSafeCall(
+        "safe_divmod",
+        ["q", "r", "head", "d", "0"],
+        false,
+      );
+
+      expect(result.code).toBe("cnx_safe_divmod_u32(&q, &r, head, d, 0)");
+      expect(result.effects).toEqual([
+        { type: "safe-div", operation: "divmod", cnxType: "u32" },
+      ]);
+    });
+
+    it("requires safe_divmod outputs of the same type", () => {
+      expect(() =>
+        generateSafeCall("safe_divmod", ["q", "s", "head", "d", "0"], false),
+      ).toThrow(
+        "safe_divmod requires quotient and remainder of the same type, got u32 and i32",
+      );
+    });
+
+    it("keeps the helper for constant divisors without strengthReduce", () => {
+      const result = generateSafeCall(
+        "safe_mod",
+        ["q", "head", "64", "0"],
+        false,
+      );
+      expect(result.code).toBe("cnx_safe_mod_u32(&q, head, 64, 0)");
+    });
+
+    it("inlines unsigned powers of two as masks and shifts", () => {
+      const mod = generateSafeCall(
+        "safe_mod",
+        ["q", "head+1", "64", "0"],
+        true,
+      );
+      expect(mod.code).toBe("q = (uint32_t)(head+1) & 0x3FU");
+      expect(mod.effects).toEqual([]);
+
+      const divmod = generateSafeCall(
+        "safe_divmod",
+        ["q", "r", "head", "16", "0"],
+        true,
+      );
+      expect(divmod.code).toBe("q = head >> 4;\nr = head & 0xFU");
+    });
+
+    it("inlines signed powers of two with the sign fix-up", () => {
+      const result = generateSafeCall("safe_div", ["s", "x", "4", "0"], true);
+      expect(result.code).toBe(
+        "s = (x < 0 ? -(int32_t)((0U - (uint32_t)x) >> 2) : (int32_t)((uint32_t)x >> 2))",
+      );
+    });
+
+    it("keeps the helper when the lowering would skip or repeat a call", () => {
+      expect(
+        generateSafeCall("safe_div", ["s", "read()", "4", "0"], true).code,
+      ).toBe("cnx_safe_div_i32(&s, read(), 4, 0)");
+      expect(
+        generateSafeCall("safe_div", ["q", "head", "4", "fallback()"], true)
+          .code,
+      ).toBe("cnx_safe_div_u32(&q, head, 4, fallback())");
+      expect(
+        generateSafeCall("safe_div", ["q", "read()", "4", "0"], true).code,
+      ).toBe("q = (uint32_t)(read()) >> 2");
+    });
+
+    it("casts compound numerators so they wrap in the output type", () => {
+      expect(
+        generateSafeCall("safe_div", ["q", "head", "4", "0"], true).code,
+      ).toBe("q = head >> 2");
+      expect(
+        generateSafeCall("safe_div", ["q", "head*2", "4", "0"], true).code,
+      ).toBe("q = (uint32_t)(head*2) >> 2");
+    });
+
+    it("keeps the divmod helper when the numerator reads the quotient", () => {
+      expect(
+        generateSafeCall("safe_divmod", ["q", "r", "q", "8", "0"], true).code,
+      ).toBe("cnx_safe_divmod_u32(&q, &r, q, 8, 0)");
+      expect(
+        generateSafeCall("safe_divmod", ["q", "r", "q+head", "8", "0"], true)
+          .code,
+      ).toBe("cnx_safe_divmod_u32(&q, &r, q+head, 8, 0)");
+      expect(
+        generateSafeCall("safe_divmod", ["q", "r", "r", "8", "0"], true).code,
+      ).toBe("q = r >> 3;\nr = r & 0x7U");
+    });
+
+    it("keeps the helper when the result is used", () => {
+      const result = generateSafeCall(
+        "safe_divmod",
+        ["q", "r", "head", "16", "0"],
+        true,
+        false,
+      );
+      expect(result.code).toBe("cnx_safe_divmod_u32(&q, &r, head, 16, 0)");
+    });
+
+    it("consumes the statement flag before generating arguments", () => {
+      generateSafeCall("safe_div", ["q", "head", "16", "0"], true);
+      expect(CodeGenState.inSafeDivStatement).toBe(false);
+    });
+  });
+
   describe("const-to-non-const validation (ADR-013)", () => {
     it("throws error when const value passed to non-const parameter", () => {
       const argExprs = [createMockExpressionContext("MY_CONST")];
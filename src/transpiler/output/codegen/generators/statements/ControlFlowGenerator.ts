@@ -3,7 +3,7 @@
  *
  * Generates C code for control flow statements:
  * - return statements
- * - if/else statements
+ * - if/else statements, including likely()/unlikely() conditions
  * - while loops
  * - do-while loops
  * - for loops
@@ -25,6 +25,7 @@ import IGeneratorInput from "../IGeneratorInput";
 import IGeneratorState from "../IGeneratorState";
 import IOrchestrator from "../IOrchestrator";
 import VariableModifierBuilder from "../../helpers/VariableModifierBuilder";
+import BranchHintHelper from "../../helpers/BranchHintHelper";
 import ExpressionUtils from "../../../../../utils/ExpressionUtils";
 import ASSIGNMENT_OPERATOR_MAP from "../../../../../utils/constants/OperatorMappings";
 
@@ -102,10 +103,12 @@ const generateIf = (
   const effects: TGeneratorEffect[] = [];
   const statements = node.statement();
 
+  // if (likely(cond)) / if (unlikely(cond)): validate and generate cond
+  const hint = BranchHintHelper.getConditionHint(node.expression(), "if");
+  const conditionExpr = hint?.condition ?? node.expression();
+
   // Analyze condition and body for repeated .length accesses (strlen optimization)
-  const lengthCounts = orchestrator.countStringLengthAccesses(
-    node.expression(),
-  );
+  const lengthCounts = orchestrator.countStringLengthAccesses(conditionExpr);
 
   // Also count in the then branch if it's a block
   const thenStmt = statements[0];
@@ -117,13 +120,17 @@ const generateIf = (
   const cacheDecls = orchestrator.setupLengthCache(lengthCounts);
 
   // Issue #254: Validate no function calls in condition (E0702)
-  orchestrator.validateConditionNoFunctionCall(node.expression(), "if");
+  orchestrator.validateConditionNoFunctionCall(conditionExpr, "if");
 
   // Issue #884: Validate condition is a boolean expression (E0701)
-  orchestrator.validateConditionIsBoolean(node.expression(), "if");
+  orchestrator.validateConditionIsBoolean(conditionExpr, "if");
 
   // Generate with cache enabled
-  const condition = orchestrator.generateExpression(node.expression());
+  let condition = orchestrator.generateExpression(conditionExpr);
+  if (hint) {
+    condition = `${hint.macro}(${condition})`;
+    effects.push({ type: "include", header: "branch_hints" });
+  }
 
   // Issue #250: Flush any temp vars from condition BEFORE generating branches
   const conditionTemps = orchestrator.flushPendingTempDeclarations();
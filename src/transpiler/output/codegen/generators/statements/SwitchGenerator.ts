@@ -5,6 +5,8 @@
  * - switch statement dispatch
  * - case labels (including fall-through with ||)
  * - default case
+ * - lookup tables for dense value-mapping switches (switchTables option)
+ * - switch (likely(key, value)) expected-case hints
  */
 import {
   SwitchStatementContext,
@@ -18,6 +20,8 @@ import TGeneratorEffect from "../TGeneratorEffect";
 import IGeneratorInput from "../IGeneratorInput";
 import IGeneratorState from "../IGeneratorState";
 import IOrchestrator from "../IOrchestrator";
+import SwitchTableHelper from "../../helpers/SwitchTableHelper";
+import BranchHintHelper from "../../helpers/BranchHintHelper";
 
 /**
  * Generate case/default block body: statements + break + closing brace.
@@ -299,7 +303,9 @@ const generateSwitch = (
   orchestrator: IOrchestrator,
 ): IGeneratorOutput => {
   const effects: TGeneratorEffect[] = [];
-  const switchExpr = node.expression();
+  // switch (likely(key, value)): dispatch on key, expecting value
+  const hint = BranchHintHelper.getSwitchHint(node.expression());
+  const switchExpr = hint?.key ?? node.expression();
   const exprCode = orchestrator.generateExpression(switchExpr);
 
   // ADR-025: Semantic validation
@@ -308,8 +314,29 @@ const generateSwitch = (
   // Issue #471: Get the enum type of the switch expression for case label resolution
   const switchEnumType = orchestrator.getExpressionEnumType(switchExpr);
 
+  // Constant-per-case switches over a dense key range become a table lookup
+  // (a hinted switch keeps its dispatch: the hint names the hot case)
+  if (input.switchTables && !hint) {
+    const table = SwitchTableHelper.tryGenerate(
+      node,
+      exprCode,
+      switchEnumType,
+      input,
+      orchestrator,
+    );
+    if (table) {
+      return table;
+    }
+  }
+
   // Build the switch statement
-  const lines: string[] = [`switch (${exprCode}) {`];
+  let dispatchCode = exprCode;
+  if (hint) {
+    const expected = orchestrator.generateExpression(hint.expected);
+    dispatchCode = `CNX_EXPECT(${exprCode}, ${expected})`;
+    effects.push({ type: "include", header: "branch_hints" });
+  }
+  const lines: string[] = [`switch (${dispatchCode}) {`];
 
   // Generate cases
   for (const caseCtx of node.switchCase()) {
@@ -175,7 +175,10 @@ function createMockDefaultCase(
  * Create a mock expression context
  */
 function createMockExpression(): Parser.ExpressionContext {
-  return {} as Parser.ExpressionContext;
+  // Not a single postfix expression, so never a likely() hint
+  return {
+    ternaryExpression: () => ({ orExpression: () => [] }),
+  } as unknown as Parser.ExpressionContext;
 }
 
 /**
@@ -10,6 +10,16 @@
  */
 import TYPE_MAP from "../../types/TYPE_MAP";
 import OverflowHelperTemplates from "./OverflowHelperTemplates";
+import VectorHelperTemplates from "./VectorHelperTemplates";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
+
+/**
+ * Split "add_u8" / "mul_uq16_16" into operation and C-Next type.
+ */
+const splitOp = (op: string): [string, string] => {
+  const separator = op.indexOf("_");
+  return [op.slice(0, separator), op.slice(separator + 1)];
+};
 
 /**
  * Generate a safe arithmetic helper function (div or mod).
@@ -20,9 +30,10 @@ const generateSafeArithmeticHelper = (
   opSymbol: string,
   cnxType: string,
   cType: string,
+  hints: boolean,
 ): string[] => [
   `static inline bool cnx_safe_${opName}_${cnxType}(${cType}* output, ${cType} numerator, ${cType} divisor, ${cType} defaultValue) {`,
-  `    if (divisor == 0) {`,
+  hints ? `    if (CNX_UNLIKELY(divisor == 0)) {` : `    if (divisor == 0) {`,
   `        *output = defaultValue;`,
   `        return true;  // Error occurred`,
   `    }`,
@@ -32,13 +43,62 @@ const generateSafeArithmeticHelper = (
   "",
 ];
 
+/**
+ * Generate the safe_divmod helper: quotient and remainder from one division
+ * (compilers fold the / and % of the same operands into one instruction).
+ */
+const generateSafeDivModHelper = (
+  cnxType: string,
+  cType: string,
+  hints: boolean,
+): string[] => [
+  `static inline bool cnx_safe_divmod_${cnxType}(${cType}* quotient, ${cType}* remainder, ${cType} numerator, ${cType} divisor, ${cType} defaultValue) {`,
+  hints ? `    if (CNX_UNLIKELY(divisor == 0)) {` : `    if (divisor == 0) {`,
+  `        *quotient = defaultValue;`,
+  `        *remainder = defaultValue;`,
+  `        return true;  // Error occurred`,
+  `    }`,
+  `    *quotient = numerator / divisor;`,
+  `    *remainder = numerator % divisor;`,
+  `    return false;  // Success`,
+  `}`,
+  "",
+];
+
+/**
+ * Branch hint macros: __builtin_expect and the cold/hot attributes on GCC
+ * and Clang, plain expressions and no attributes elsewhere.
+ */
+const generateBranchHintMacros = (): string[] => [
+  "// Branch hint macros",
+  "#ifndef CNX_LIKELY",
+  "#if defined(__GNUC__) || defined(__clang__)",
+  "#define CNX_LIKELY(x) __builtin_expect(!!(x), 1)",
+  "#define CNX_UNLIKELY(x) __builtin_expect(!!(x), 0)",
+  "#define CNX_EXPECT(x, v) __builtin_expect((x), (v))",
+  "#define CNX_COLD __attribute__((cold))",
+  "#define CNX_HOT __attribute__((hot))",
+  "#else",
+  "#define CNX_LIKELY(x) (x)",
+  "#define CNX_UNLIKELY(x) (x)",
+  "#define CNX_EXPECT(x, v) (x)",
+  "#define CNX_COLD",
+  "#define CNX_HOT",
+  "#endif",
+  "#endif",
+  "",
+];
+
 /**
  * Generate all needed overflow helper functions
  * ADR-044: Overflow helper functions with clamping or panic behavior
+ *
+ * @param hints - Mark saturation and panic branches CNX_UNLIKELY
  */
 const generateOverflowHelpers = (
   usedClampOps: ReadonlySet<string>,
   debugMode: boolean,
+  hints: boolean = false,
 ): string[] => {
   if (usedClampOps.size === 0) {
     return [];
@@ -65,11 +125,24 @@ const generateOverflowHelpers = (
   // Sort for deterministic output
   const sortedOps = Array.from(usedClampOps).sort((a, b) => a.localeCompare(b));
 
+  // Q type helpers use the ACLE saturating intrinsics on DSP-capable cores
+  const usesFixedPoint = sortedOps.some((op) =>
+    FixedPointUtils.isFixedPoint(splitOp(op)[1]),
+  );
+  if (usesFixedPoint && !debugMode) {
+    lines.push(
+      "#if defined(__ARM_FEATURE_DSP)",
+      "#include <arm_acle.h>",
+      "#endif",
+      "",
+    );
+  }
+
   for (const op of sortedOps) {
-    const [operation, cnxType] = op.split("_");
+    const [operation, cnxType] = splitOp(op);
     const helper = debugMode
-      ? OverflowHelperTemplates.generatePanicHelper(operation, cnxType)
-      : OverflowHelperTemplates.generateClampHelper(operation, cnxType);
+      ? OverflowHelperTemplates.generatePanicHelper(operation, cnxType, hints)
+      : OverflowHelperTemplates.generateClampHelper(operation, cnxType, hints);
     if (helper) {
       lines.push(helper, "");
     }
@@ -81,9 +154,12 @@ const generateOverflowHelpers = (
 /**
  * Generate safe division helper functions for used integer types only
  * ADR-051: Safe division helpers that return error flag on division by zero
+ *
+ * @param hints - Mark the division-by-zero branch CNX_UNLIKELY
  */
 const generateSafeDivHelpers = (
   usedSafeDivOps: ReadonlySet<string>,
+  hints: boolean = false,
 ): string[] => {
   if (usedSafeDivOps.size === 0) {
     return [];
@@ -102,8 +178,9 @@ const generateSafeDivHelpers = (
   for (const cnxType of integerTypes) {
     const needsDiv = usedSafeDivOps.has(`div_${cnxType}`);
     const needsMod = usedSafeDivOps.has(`mod_${cnxType}`);
+    const needsDivMod = usedSafeDivOps.has(`divmod_${cnxType}`);
 
-    if (!needsDiv && !needsMod) {
+    if (!needsDiv && !needsMod && !needsDivMod) {
       continue; // Skip types that aren't used
     }
 
@@ -111,22 +188,173 @@ const generateSafeDivHelpers = (
 
     // Generate safe_div helper if needed
     if (needsDiv) {
-      lines.push(...generateSafeArithmeticHelper("div", "/", cnxType, cType));
+      lines.push(
+        ...generateSafeArithmeticHelper("div", "/", cnxType, cType, hints),
+      );
     }
 
     // Generate safe_mod helper if needed
     if (needsMod) {
-      lines.push(...generateSafeArithmeticHelper("mod", "%", cnxType, cType));
+      lines.push(
+        ...generateSafeArithmeticHelper("mod", "%", cnxType, cType, hints),
+      );
+    }
+
+    // Generate safe_divmod helper if needed
+    if (needsDivMod) {
+      lines.push(...generateSafeDivModHelper(cnxType, cType, hints));
+    }
+  }
+
+  return lines;
+};
+
+/**
+ * Generate array reduction helpers (sum, min, max, dot).
+ * Always static inline: each loop is meant to be inlined and vectorized at
+ * its call site, so they are not moved to the shared runtime files.
+ *
+ * @param usedVectorOps - Operations such as "sum_f32", "dot_q15"
+ * @param useCmsis - Call CMSIS-DSP where it has the operation
+ * @param cppMode - Spell restrict as __restrict for C++
+ */
+const generateVectorHelpers = (
+  usedVectorOps: ReadonlySet<string>,
+  useCmsis: boolean,
+  cppMode: boolean,
+): string[] => {
+  if (usedVectorOps.size === 0) {
+    return [];
+  }
+
+  const lines: string[] = ["// Array reduction helpers", ""];
+  const restrict = cppMode ? "__restrict" : "restrict";
+  const sortedOps = Array.from(usedVectorOps).sort((a, b) =>
+    a.localeCompare(b),
+  );
+  for (const op of sortedOps) {
+    const [operation, cnxType] = splitOp(op);
+    const helper = VectorHelperTemplates.generate(
+      operation,
+      cnxType,
+      useCmsis,
+      restrict,
+    );
+    if (helper) {
+      lines.push(helper, "");
     }
   }
 
   return lines;
 };
 
+/** Base name of the project-wide helper files (sharedHelpers option) */
+const RUNTIME_NAME = "cnx_runtime";
+
+const STATIC_INLINE = "static inline ";
+
+/**
+ * All helper definitions for the given operations, one line per element.
+ */
+const generateHelperLines = (
+  usedClampOps: ReadonlySet<string>,
+  usedSafeDivOps: ReadonlySet<string>,
+  debugMode: boolean,
+  hints: boolean,
+): string[] =>
+  [
+    ...(hints ? generateBranchHintMacros() : []),
+    ...generateOverflowHelpers(usedClampOps, debugMode, hints),
+    ...generateSafeDivHelpers(usedSafeDivOps, hints),
+  ].flatMap((chunk) => chunk.split("\n"));
+
+/**
+ * Generate the shared helper header: prototypes of every helper the project
+ * uses. Generated files include it instead of carrying static inline copies.
+ */
+const generateRuntimeHeader = (
+  usedClampOps: ReadonlySet<string>,
+  usedSafeDivOps: ReadonlySet<string>,
+  debugMode: boolean,
+  hints: boolean = false,
+): string => {
+  const guard = `${RUNTIME_NAME.toUpperCase()}_H`;
+  const prototypes = generateHelperLines(
+    usedClampOps,
+    usedSafeDivOps,
+    debugMode,
+    hints,
+  )
+    .filter((line) => line.startsWith(STATIC_INLINE) && line.endsWith(" {"))
+    .map((line) => `${line.slice(STATIC_INLINE.length, -2)};`);
+
+  return [
+    "/**",
+    " * Generated by C-Next Transpiler",
+    " * Shared runtime helpers used by this project",
+    " */",
+    "",
+    `#ifndef ${guard}`,
+    `#define ${guard}`,
+    "",
+    "#include <stdint.h>",
+    "#include <stdbool.h>",
+    "",
+    "#ifdef __cplusplus",
+    'extern "C" {',
+    "#endif",
+    "",
+    ...prototypes,
+    "",
+    "#ifdef __cplusplus",
+    "}",
+    "#endif",
+    "",
+    `#endif /* ${guard} */`,
+    "",
+  ].join("\n");
+};
+
+/**
+ * Generate the shared helper source: one external definition of every
+ * helper the project uses.
+ */
+const generateRuntimeSource = (
+  usedClampOps: ReadonlySet<string>,
+  usedSafeDivOps: ReadonlySet<string>,
+  debugMode: boolean,
+  hints: boolean = false,
+): string => {
+  const definitions = generateHelperLines(
+    usedClampOps,
+    usedSafeDivOps,
+    debugMode,
+    hints,
+  ).map((line) =>
+    line.startsWith(STATIC_INLINE) ? line.slice(STATIC_INLINE.length) : line,
+  );
+
+  return [
+    "/**",
+    " * Generated by C-Next Transpiler",
+    " * Shared runtime helpers used by this project",
+    " */",
+    "",
+    `#include "${RUNTIME_NAME}.h"`,
+    "",
+    ...definitions,
+  ].join("\n");
+};
+
 // Export as an object for consistent module pattern
 const helperGenerators = {
+  RUNTIME_NAME,
   generateOverflowHelpers,
   generateSafeDivHelpers,
+  generateVectorHelpers,
+  generateBranchHintMacros,
+  generateRuntimeHeader,
+  generateRuntimeSource,
 };
 
 export default helperGenerators;
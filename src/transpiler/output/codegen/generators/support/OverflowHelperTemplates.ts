@@ -6,11 +6,20 @@
  * by extracting common type resolution and function structure.
  *
  * Issue #707: Extracted from HelperGenerator.ts to reduce code duplication.
+ *
+ * Fixed-point Q types (q15, q31, uq16_16) share the same clamp/panic helper
+ * names and always saturate. Their add/sub/mul use the ACLE saturating
+ * intrinsics when the compiler defines __ARM_FEATURE_DSP.
+ *
+ * With branch hints on, every saturation and panic check is wrapped in
+ * CNX_UNLIKELY so the in-range path stays the fall-through path.
  */
 
 import TYPE_MAP from "../../types/TYPE_MAP";
 import WIDER_TYPE_MAP from "../../types/WIDER_TYPE_MAP";
 import TYPE_LIMITS from "../../types/TYPE_LIMITS";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
+import IFixedPointFormat from "../../../../../utils/types/IFixedPointFormat";
 
 const { TYPE_MAX, TYPE_MIN } = TYPE_LIMITS;
 
@@ -84,6 +93,8 @@ const OPERATION_NAMES: Record<string, string> = {
   add: "addition",
   sub: "subtraction",
   mul: "multiplication",
+  div: "division",
+  from: "conversion",
 };
 
 /**
@@ -318,11 +329,172 @@ ${generatePanicBlock(info.cnxType, opName)}
   }
 }
 
+/**
+ * Templates for fixed-point Q types.
+ * Products and quotients are computed in 64 bits, rounded to nearest for
+ * mul, then saturated to the storage type. Division by zero saturates
+ * toward the sign of the dividend.
+ */
+class FixedPointTemplates {
+  static generate(
+    operation: string,
+    format: IFixedPointFormat,
+    debugMode: boolean,
+  ): string | null {
+    const body = FixedPointTemplates.body(operation, format);
+    if (!body) {
+      return null;
+    }
+    const { cType, name } = format;
+    const params =
+      operation === "from" ? "int64_t a" : `${cType} a, ${cType} b`;
+    const sig = `static inline ${cType} cnx_clamp_${operation}_${name}(${params})`;
+    const fast = debugMode ? null : FixedPointTemplates.dsp(operation, format);
+    const saturate = FixedPointTemplates.saturate(operation, format, debugMode);
+    const lines = [body, ...saturate, `    return (${cType})result;`];
+    if (fast) {
+      return `${sig} {
+#if defined(__ARM_FEATURE_DSP)
+    ${fast}
+#else
+${lines.join("\n")}
+#endif
+}`;
+    }
+    return `${sig} {
+${lines.join("\n")}
+}`;
+  }
+
+  /**
+   * Wide result computation (declares `result`).
+   */
+  private static body(
+    operation: string,
+    format: IFixedPointFormat,
+  ): string | null {
+    const wide = format.isSigned ? "int64_t" : "uint64_t";
+    const one = `((${wide})1 << ${format.fracBits})`;
+    switch (operation) {
+      case "add":
+        return "    int64_t result = (int64_t)a + b;";
+      case "sub":
+        return "    int64_t result = (int64_t)a - b;";
+      case "mul":
+        return `    ${wide} result = ((${wide})a * b + ((${wide})1 << ${format.fracBits - 1})) >> ${format.fracBits};`;
+      case "div":
+        return `${FixedPointTemplates.divByZero(format)}
+    ${wide} result = (${wide})a * ${one} / b;`;
+      case "from":
+        return "    int64_t result = a;";
+      default:
+        return null;
+    }
+  }
+
+  private static divByZero(format: IFixedPointFormat): string {
+    const max = TYPE_MAX[format.storageType];
+    if (!format.isSigned) {
+      return `    if (b == 0) return ${max};`;
+    }
+    const min = TYPE_MIN[format.storageType];
+    return `    if (b == 0) return a < 0 ? ${min} : ${max};`;
+  }
+
+  /**
+   * Range checks on `result` (clamp or panic).
+   */
+  private static saturate(
+    operation: string,
+    format: IFixedPointFormat,
+    debugMode: boolean,
+  ): string[] {
+    const max = TYPE_MAX[format.storageType];
+    const min = TYPE_MIN[format.storageType];
+    // uint64_t results (unsigned mul/div) cannot go below zero
+    const hasLowerBound =
+      format.isSigned ||
+      operation === "sub" ||
+      operation === "add" ||
+      operation === "from";
+    const lowerCheck = format.isSigned ? `result < ${min}` : "result < 0";
+    if (debugMode) {
+      const condition = hasLowerBound
+        ? `result > ${max} || ${lowerCheck}`
+        : `result > ${max}`;
+      return [
+        `    if (${condition}) {`,
+        `        fprintf(stderr, "PANIC: Fixed-point overflow in ${format.name} ${OPERATION_NAMES[operation]}${C_NEWLINE}");`,
+        "        abort();",
+        "    }",
+      ];
+    }
+    const lines = [`    if (result > ${max}) return ${max};`];
+    if (hasLowerBound) {
+      lines.push(`    if (${lowerCheck}) return ${min};`);
+    }
+    return lines;
+  }
+
+  /**
+   * Single-instruction saturating forms for signed 16/32-bit storage.
+   */
+  private static dsp(
+    operation: string,
+    format: IFixedPointFormat,
+  ): string | null {
+    if (!format.isSigned) {
+      return null;
+    }
+    if (format.width === 16) {
+      switch (operation) {
+        case "add":
+          return "return (int16_t)__ssat((int32_t)a + b, 16);";
+        case "sub":
+          return "return (int16_t)__ssat((int32_t)a - b, 16);";
+        case "mul":
+          return `return (int16_t)__ssat(((int32_t)a * b + (1 << ${format.fracBits - 1})) >> ${format.fracBits}, 16);`;
+        default:
+          return null;
+      }
+    }
+    if (format.width === 32) {
+      switch (operation) {
+        case "add":
+          return "return __qadd(a, b);";
+        case "sub":
+          return "return __qsub(a, b);";
+        default:
+          return null;
+      }
+    }
+    return null;
+  }
+}
+
+// Guards that are not error branches (i64 mul zero checks)
+const FAST_PATH_CONDITIONS = new Set(["a == 0 || b == 0", "a != 0 && b != 0"]);
+
+/**
+ * Wrap the single-line saturation and panic checks of a helper in
+ * CNX_UNLIKELY.
+ */
+function markErrorBranchesUnlikely(helper: string): string {
+  return helper.replaceAll(
+    /^( *)if \((.+)\) (return |\{$)/gm,
+    (line, indent: string, condition: string, rest: string) =>
+      FAST_PATH_CONDITIONS.has(condition)
+        ? line
+        : `${indent}if (CNX_UNLIKELY(${condition})) ${rest}`,
+  );
+}
+
 /**
  * Generate an overflow helper function for the given operation and type
  *
- * @param operation - The arithmetic operation (add, sub, mul)
- * @param cnxType - The C-Next type (u8, i32, etc.)
+ * @param operation - The arithmetic operation (add, sub, mul; div and from
+ *   for Q types)
+ * @param cnxType - The C-Next type (u8, i32, q15, etc.)
  * @param debugMode - If true, generate panic helpers; otherwise, clamp helpers
  * @returns The generated helper function or null if type is invalid
  */
@@ -331,6 +503,11 @@ function generateHelper(
   cnxType: string,
   debugMode: boolean,
 ): string | null {
+  const fixedPoint = FixedPointUtils.parse(cnxType);
+  if (fixedPoint) {
+    return FixedPointTemplates.generate(operation, fixedPoint, debugMode);
+  }
+
   const info = resolveTypeInfo(cnxType);
   if (!info) {
     return null;
@@ -384,8 +561,12 @@ class OverflowHelperTemplates {
   static generateClampHelper(
     operation: string,
     cnxType: string,
+    hints: boolean = false,
   ): string | null {
-    return generateHelper(operation, cnxType, false);
+    return OverflowHelperTemplates.withHints(
+      generateHelper(operation, cnxType, false),
+      hints,
+    );
   }
 
   /**
@@ -394,8 +575,19 @@ class OverflowHelperTemplates {
   static generatePanicHelper(
     operation: string,
     cnxType: string,
+    hints: boolean = false,
+  ): string | null {
+    return OverflowHelperTemplates.withHints(
+      generateHelper(operation, cnxType, true),
+      hints,
+    );
+  }
+
+  private static withHints(
+    helper: string | null,
+    hints: boolean,
   ): string | null {
-    return generateHelper(operation, cnxType, true);
+    return helper && hints ? markErrorBranchesUnlikely(helper) : helper;
   }
 
   /**
@@ -0,0 +1,264 @@
+/**
+ * Vector Helper Templates
+ *
+ * Reduction helpers for whole-array arithmetic (a.sum, a.min, a.max and the
+ * (a * b).sum dot product) and the flags.any test on bool arrays. Each
+ * helper is a counted loop over read-only restrict pointers with a uint32_t
+ * index, the form GCC auto-vectorizes.
+ * Float sums only vectorize when the compiler may reassociate
+ * (-ffast-math / -fassociative-math).
+ *
+ * - Integer sums and dot products accumulate in 64 bits and return the
+ *   64-bit total
+ * - Q type sums and dot products accumulate in 64 bits and saturate to the
+ *   Q range
+ * - any returns on the first set element of a byte-stored bool array
+ * - With cmsisDsp, f32 and q7/q15/q31 operations that CMSIS-DSP provides
+ *   call the library instead
+ */
+
+import TYPE_MAP from "../../types/TYPE_MAP";
+import TYPE_LIMITS from "../../types/TYPE_LIMITS";
+import FixedPointUtils from "../../../../../utils/FixedPointUtils";
+import IFixedPointFormat from "../../../../../utils/types/IFixedPointFormat";
+
+const { TYPE_MAX, TYPE_MIN } = TYPE_LIMITS;
+
+/**
+ * Element and accumulator types for one C-Next element type
+ */
+interface IVectorTypeInfo {
+  cnxType: string;
+  cType: string;
+  /** Type sums and dot products accumulate in */
+  accType: string;
+  isFloat: boolean;
+  format: IFixedPointFormat | null;
+}
+
+function resolveVectorType(cnxType: string): IVectorTypeInfo | null {
+  const format = FixedPointUtils.parse(cnxType);
+  if (format) {
+    return {
+      cnxType,
+      cType: format.cType,
+      accType: format.isSigned ? "int64_t" : "uint64_t",
+      isFloat: false,
+      format,
+    };
+  }
+  const cType = TYPE_MAP[cnxType];
+  if (!cType || cnxType === "void") {
+    return null;
+  }
+  const isFloat = cnxType === "f32" || cnxType === "f64";
+  let accType = cType;
+  if (!isFloat) {
+    accType = cnxType.startsWith("u") ? "uint64_t" : "int64_t";
+  }
+  return { cnxType, cType, accType, isFloat, format: null };
+}
+
+/**
+ * CMSIS-DSP type suffix (f32, q7, q15, q31), or null if CMSIS has none.
+ */
+function cmsisSuffix(cnxType: string): string | null {
+  if (cnxType === "f32") {
+    return "f32";
+  }
+  const format = FixedPointUtils.parse(cnxType);
+  if (format?.isSigned && format.fracBits === format.width - 1) {
+    return cnxType;
+  }
+  return null;
+}
+
+/**
+ * Clamp a wide Q accumulator to the format's storage range.
+ */
+function saturateLines(format: IFixedPointFormat): string[] {
+  const max = TYPE_MAX[format.storageType];
+  const lines = [`    if (acc > ${max}) return ${max};`];
+  if (format.isSigned) {
+    const min = TYPE_MIN[format.storageType];
+    lines.push(`    if (acc < ${min}) return ${min};`);
+  }
+  lines.push(`    return (${format.cType})acc;`);
+  return lines;
+}
+
+class VectorHelperTemplates {
+  /**
+   * Return type of a helper: the element type, or the 64-bit total for
+   * integer sums and dot products.
+   */
+  static getResultCType(operation: string, cnxType: string): string | null {
+    const info = resolveVectorType(cnxType);
+    if (!info) {
+      return null;
+    }
+    if (operation === "any") {
+      return cnxType === "bool" ? "bool" : null;
+    }
+    if (cnxType === "bool") {
+      return null;
+    }
+    const isTotal = operation === "sum" || operation === "dot";
+    return isTotal && !info.isFloat && !info.format ? info.accType : info.cType;
+  }
+
+  /**
+   * CMSIS-DSP type suffix for an element type (f32, q7, q15, q31), or null
+   * if CMSIS-DSP has no functions for it.
+   */
+  static getCmsisSuffix(cnxType: string): string | null {
+    return cmsisSuffix(cnxType);
+  }
+
+  /**
+   * Generate one reduction helper.
+   *
+   * @param operation - sum, min, max, dot or any
+   * @param cnxType - Element type
+   * @param useCmsis - Call CMSIS-DSP where it has the operation
+   * @param restrict - Pointer qualifier (restrict, or __restrict for C++)
+   */
+  static generate(
+    operation: string,
+    cnxType: string,
+    useCmsis: boolean,
+    restrict: string,
+  ): string | null {
+    const info = resolveVectorType(cnxType);
+    const resultType = VectorHelperTemplates.getResultCType(operation, cnxType);
+    if (!info || !resultType) {
+      return null;
+    }
+    const body =
+      (useCmsis ? VectorHelperTemplates.cmsis(operation, info) : null) ??
+      VectorHelperTemplates.loop(operation, info);
+    if (!body) {
+      return null;
+    }
+    const pointer = `const ${info.cType}* ${restrict}`;
+    const params =
+      operation === "dot"
+        ? `${pointer} a, ${pointer} b, uint32_t n`
+        : `${pointer} a, uint32_t n`;
+    return `static inline ${resultType} cnx_vec_${operation}_${cnxType}(${params}) {
+${body.join("\n")}
+}`;
+  }
+
+  /**
+   * Portable counted loop.
+   */
+  private static loop(
+    operation: string,
+    info: IVectorTypeInfo,
+  ): string[] | null {
+    switch (operation) {
+      case "sum":
+        return VectorHelperTemplates.accumulate(info, "a[i]");
+      case "dot":
+        return VectorHelperTemplates.accumulate(
+          info,
+          info.isFloat ? "a[i] * b[i]" : `(${info.accType})a[i] * b[i]`,
+        );
+      case "any":
+        return [
+          "    for (uint32_t i = 0U; i < n; i++) {",
+          "        if (a[i]) return true;",
+          "    }",
+          "    return false;",
+        ];
+      case "min":
+      case "max": {
+        const compare = operation === "min" ? "<" : ">";
+        return [
+          `    ${info.cType} result = a[0];`,
+          "    for (uint32_t i = 1U; i < n; i++) {",
+          `        result = (a[i] ${compare} result) ? a[i] : result;`,
+          "    }",
+          "    return result;",
+        ];
+      }
+      default:
+        return null;
+    }
+  }
+
+  /**
+   * Sum `term` over the array in the accumulator type.
+   */
+  private static accumulate(info: IVectorTypeInfo, term: string): string[] {
+    const format = info.format;
+    const isDot = term.includes("b[i]");
+    let zero = "0";
+    if (info.isFloat) {
+      zero = info.cnxType === "f32" ? "0.0f" : "0.0";
+    }
+    // 32-bit Q products are rescaled one at a time so the sum fits 64 bits
+    const scaleEach = isDot && format !== null && format.width === 32;
+    const lines = [
+      `    ${info.accType} acc = ${zero};`,
+      "    for (uint32_t i = 0U; i < n; i++) {",
+      scaleEach
+        ? `        acc += (${term}) >> ${format.fracBits};`
+        : `        acc += ${term};`,
+      "    }",
+    ];
+    if (!format) {
+      lines.push("    return acc;");
+      return lines;
+    }
+    if (isDot && !scaleEach) {
+      lines.push(
+        `    acc = (acc + ((${info.accType})1 << ${format.fracBits - 1})) >> ${format.fracBits};`,
+      );
+    }
+    return [...lines, ...saturateLines(format)];
+  }
+
+  /**
+   * CMSIS-DSP call, or null to fall back to the loop.
+   */
+  private static cmsis(
+    operation: string,
+    info: IVectorTypeInfo,
+  ): string[] | null {
+    const suffix = cmsisSuffix(info.cnxType);
+    if (!suffix) {
+      return null;
+    }
+    if (operation === "min" || operation === "max") {
+      const resultType = suffix === "f32" ? "float32_t" : `${suffix}_t`;
+      return [
+        `    ${resultType} result;`,
+        "    uint32_t index;",
+        `    arm_${operation}_${suffix}(a, n, &result, &index);`,
+        "    return result;",
+      ];
+    }
+    if (operation !== "dot" || suffix === "q7") {
+      return null;
+    }
+    if (suffix === "f32") {
+      return [
+        "    float32_t result;",
+        "    arm_dot_prod_f32(a, b, n, &result);",
+        "    return result;",
+      ];
+    }
+    // q15 results are 34.30, q31 results 16.48 (products pre-shifted by 14)
+    const shift = suffix === "q15" ? 15 : 17;
+    return [
+      "    q63_t acc;",
+      `    arm_dot_prod_${suffix}(a, b, n, &acc);`,
+      `    acc = (acc + ((q63_t)1 << ${shift - 1})) >> ${shift};`,
+      ...saturateLines(info.format!),
+    ];
+  }
+}
+
+export default VectorHelperTemplates;
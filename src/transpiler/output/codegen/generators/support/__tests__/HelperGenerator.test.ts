@@ -1,7 +1,13 @@
 import { describe, expect, it } from "vitest";
 import helperGenerators from "../HelperGenerator";
 
-const { generateOverflowHelpers, generateSafeDivHelpers } = helperGenerators;
+const {
+  generateOverflowHelpers,
+  generateSafeDivHelpers,
+  generateRuntimeHeader,
+  generateRuntimeSource,
+  generateBranchHintMacros,
+} = helperGenerators;
 
 describe("HelperGenerator - generateOverflowHelpers", () => {
   describe("empty input", () => {
@@ -151,6 +157,25 @@ describe("HelperGenerator - generateOverflowHelpers", () => {
     });
   });
 
+  describe("fixed-point Q types", () => {
+    it("keeps multi-part Q type names intact", () => {
+      const result = generateOverflowHelpers(new Set(["mul_uq16_16"]), false);
+      expect(result.join("\n")).toContain("cnx_clamp_mul_uq16_16");
+    });
+
+    it("includes arm_acle.h on DSP cores in clamp mode only", () => {
+      const clamp = generateOverflowHelpers(new Set(["add_q15"]), false);
+      const debug = generateOverflowHelpers(new Set(["add_q15"]), true);
+      expect(clamp).toContain("#include <arm_acle.h>");
+      expect(debug).not.toContain("#include <arm_acle.h>");
+    });
+
+    it("omits arm_acle.h for integer-only helpers", () => {
+      const result = generateOverflowHelpers(new Set(["add_u8"]), false);
+      expect(result).not.toContain("#include <arm_acle.h>");
+    });
+  });
+
   describe("invalid operations", () => {
     it("skips unknown operations", () => {
       const result = generateOverflowHelpers(new Set(["unknown_u8"]), false);
@@ -217,6 +242,20 @@ describe("HelperGenerator - generateSafeDivHelpers", () => {
     });
   });
 
+  describe("divmod helpers", () => {
+    it("generates u32 divmod helper with both outputs", () => {
+      const result = generateSafeDivHelpers(new Set(["divmod_u32"]));
+      const code = result.join("\n");
+      expect(code).toContain(
+        "cnx_safe_divmod_u32(uint32_t* quotient, uint32_t* remainder, uint32_t numerator, uint32_t divisor, uint32_t defaultValue)",
+      );
+      expect(code).toContain("*quotient = numerator / divisor;");
+      expect(code).toContain("*remainder = numerator % divisor;");
+      expect(code).toContain("*remainder = defaultValue;");
+      expect(code).not.toContain("cnx_safe_div_u32");
+    });
+  });
+
   describe("multiple helpers", () => {
     it("generates both div and mod for same type", () => {
       const result = generateSafeDivHelpers(new Set(["div_u32", "mod_u32"]));
@@ -272,3 +311,64 @@ describe("HelperGenerator - generateSafeDivHelpers", () => {
     });
   });
 });
+
+describe("HelperGenerator - shared runtime files", () => {
+  const clampOps = new Set(["add_u8"]);
+  const safeDivOps = new Set(["div_u32"]);
+
+  it("declares every used helper in the header", () => {
+    const header = generateRuntimeHeader(clampOps, safeDivOps, false);
+    expect(header).toContain("#ifndef CNX_RUNTIME_H");
+    expect(header).toMatch(/^uint8_t cnx_clamp_add_u8\(.*\);$/m);
+    expect(header).toMatch(/^bool cnx_safe_div_u32\(.*\);$/m);
+    expect(header).not.toContain("static inline");
+    expect(header).not.toContain("__builtin_add_overflow");
+  });
+
+  it("defines every used helper once with external linkage", () => {
+    const source = generateRuntimeSource(clampOps, safeDivOps, false);
+    expect(source).toContain('#include "cnx_runtime.h"');
+    expect(source).toMatch(/^uint8_t cnx_clamp_add_u8\(.*\) \{$/m);
+    expect(source).toMatch(/^bool cnx_safe_div_u32\(.*\) \{$/m);
+    expect(source).not.toContain("static inline");
+  });
+
+  it("uses panic helpers in debug mode", () => {
+    const source = generateRuntimeSource(clampOps, new Set(), true);
+    expect(source).toContain("abort();");
+    expect(source).not.toContain("cnx_safe_div");
+  });
+});
+
+describe("HelperGenerator - branch hints", () => {
+  it("defines the hint macros with portable fallbacks", () => {
+    const macros = generateBranchHintMacros().join("\n");
+    expect(macros).toContain("#ifndef CNX_LIKELY");
+    expect(macros).toContain(
+      "#define CNX_UNLIKELY(x) __builtin_expect(!!(x), 0)",
+    );
+    expect(macros).toContain("#define CNX_COLD __attribute__((cold))");
+    expect(macros).toContain("#else\n#define CNX_LIKELY(x) (x)");
+  });
+
+  it("marks the division-by-zero branch unlikely", () => {
+    const result = generateSafeDivHelpers(new Set(["div_u32"]), true).join(
+      "\n",
+    );
+    expect(result).toContain("    if (CNX_UNLIKELY(divisor == 0)) {");
+  });
+
+  it("passes hints to the overflow helpers", () => {
+    const result = generateOverflowHelpers(new Set(["sub_u8"]), false, true);
+    expect(result.join("\n")).toContain("if (CNX_UNLIKELY(b > (uint32_t)a))");
+  });
+
+  it("defines the macros in the runtime source only", () => {
+    const clampOps = new Set(["add_u8"]);
+    const source = generateRuntimeSource(clampOps, new Set(), false, true);
+    const header = generateRuntimeHeader(clampOps, new Set(), false, true);
+    expect(source).toContain("#define CNX_UNLIKELY(x)");
+    expect(source).toMatch(/^uint8_t cnx_clamp_add_u8\(.*\) \{$/m);
+    expect(header).not.toContain("CNX_UNLIKELY");
+  });
+});
@@ -156,6 +156,135 @@ describe("OverflowHelperTemplates", () => {
     });
   });
 
+  describe("fixed-point Q types", () => {
+    it("should generate rounding, saturating mul for q15", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper("mul", "q15");
+
+      expect(helper).toContain(
+        "static inline int16_t cnx_clamp_mul_q15(int16_t a, int16_t b)",
+      );
+      expect(helper).toContain(
+        "int64_t result = ((int64_t)a * b + ((int64_t)1 << 14)) >> 15;",
+      );
+      expect(helper).toContain("if (result > INT16_MAX) return INT16_MAX;");
+      expect(helper).toContain("if (result < INT16_MIN) return INT16_MIN;");
+    });
+
+    it("should use ACLE intrinsics on DSP cores", () => {
+      const mul = OverflowHelperTemplates.generateClampHelper("mul", "q15");
+      const add = OverflowHelperTemplates.generateClampHelper("add", "q31");
+
+      expect(mul).toContain("#if defined(__ARM_FEATURE_DSP)");
+      expect(mul).toContain("__ssat(");
+      expect(add).toContain("return __qadd(a, b);");
+    });
+
+    it("should saturate division by zero toward the dividend's sign", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper("div", "q15");
+
+      expect(helper).toContain(
+        "if (b == 0) return a < 0 ? INT16_MIN : INT16_MAX;",
+      );
+      expect(helper).toContain(
+        "int64_t result = (int64_t)a * ((int64_t)1 << 15) / b;",
+      );
+    });
+
+    it("should use unsigned 64-bit products for uq formats", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper(
+        "mul",
+        "uq16_16",
+      );
+
+      expect(helper).toContain("uint64_t result = ((uint64_t)a * b");
+      expect(helper).toContain("return UINT32_MAX;");
+      expect(helper).not.toContain("__ssat");
+    });
+
+    it("should generate a from helper taking a 64-bit value", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper(
+        "from",
+        "q8_8",
+      );
+
+      expect(helper).toContain(
+        "static inline int16_t cnx_clamp_from_q8_8(int64_t a)",
+      );
+    });
+
+    it("should panic without intrinsics in debug mode", () => {
+      const helper = OverflowHelperTemplates.generatePanicHelper("add", "q15");
+
+      expect(helper).toContain("Fixed-point overflow in q15 addition");
+      expect(helper).not.toContain("__ARM_FEATURE_DSP");
+    });
+
+    it("should return null for unsupported Q operations", () => {
+      expect(
+        OverflowHelperTemplates.generateClampHelper("mod", "q15"),
+      ).toBeNull();
+    });
+  });
+
+  describe("branch hints", () => {
+    it("marks clamp branches unlikely", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper(
+        "add",
+        "u8",
+        true,
+      );
+
+      expect(helper).toContain(
+        "    if (CNX_UNLIKELY(b > (uint32_t)(UINT8_MAX - a))) return UINT8_MAX;",
+      );
+      expect(helper).toContain(
+        "    if (CNX_UNLIKELY(__builtin_add_overflow(a, (uint8_t)b, &result))) return UINT8_MAX;",
+      );
+    });
+
+    it("marks panic branches unlikely", () => {
+      const helper = OverflowHelperTemplates.generatePanicHelper(
+        "add",
+        "i16",
+        true,
+      );
+
+      expect(helper).toContain(
+        "    if (CNX_UNLIKELY(result > INT16_MAX || result < INT16_MIN)) {",
+      );
+    });
+
+    it("keeps the i64 zero fast path unhinted", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper(
+        "mul",
+        "i64",
+        true,
+      );
+
+      expect(helper).toContain("    if (a == 0 || b == 0) return 0;");
+      expect(helper).toContain("    if (CNX_UNLIKELY(a > 0 && b > 0 &&");
+    });
+
+    it("marks fixed-point saturation unlikely", () => {
+      const helper = OverflowHelperTemplates.generateClampHelper(
+        "div",
+        "q15",
+        true,
+      );
+
+      expect(helper).toContain("    if (CNX_UNLIKELY(b == 0)) return a < 0 ?");
+      expect(helper).toContain(
+        "    if (CNX_UNLIKELY(result > INT16_MAX)) return INT16_MAX;",
+      );
+    });
+
+    it("leaves helpers unchanged by default", () => {
+      expect(
+        OverflowHelperTemplates.generateClampHelper("add", "u8"),
+      ).not.toContain("CNX_UNLIKELY");
+    });
+  });
+
   describe("output consistency", () => {
     it("should produce consistent output for same inputs", () => {
       const helper1 = OverflowHelperTemplates.generateClampHelper("add", "u32");
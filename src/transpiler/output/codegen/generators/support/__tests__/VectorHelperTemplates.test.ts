@@ -0,0 +1,172 @@
+/**
+ * Unit tests for VectorHelperTemplates
+ */
+
+import { describe, it, expect } from "vitest";
+import VectorHelperTemplates from "../VectorHelperTemplates";
+import helperGenerators from "../HelperGenerator";
+
+function generate(operation: string, cnxType: string, useCmsis = false) {
+  return VectorHelperTemplates.generate(
+    operation,
+    cnxType,
+    useCmsis,
+    "restrict",
+  );
+}
+
+describe("VectorHelperTemplates", () => {
+  describe("getResultCType", () => {
+    it("should return the 64-bit total for integer sums and dots", () => {
+      expect(VectorHelperTemplates.getResultCType("sum", "i16")).toBe(
+        "int64_t",
+      );
+      expect(VectorHelperTemplates.getResultCType("dot", "u8")).toBe(
+        "uint64_t",
+      );
+    });
+
+    it("should return the element type otherwise", () => {
+      expect(VectorHelperTemplates.getResultCType("max", "i16")).toBe(
+        "int16_t",
+      );
+      expect(VectorHelperTemplates.getResultCType("sum", "f32")).toBe("float");
+      expect(VectorHelperTemplates.getResultCType("sum", "q15")).toBe(
+        "int16_t",
+      );
+    });
+
+    it("should return null for non-numeric types", () => {
+      expect(VectorHelperTemplates.getResultCType("sum", "bool")).toBeNull();
+      expect(VectorHelperTemplates.getResultCType("sum", "Point")).toBeNull();
+    });
+  });
+
+  describe("getCmsisSuffix", () => {
+    it("should map f32 and signed Q.(N-1) types", () => {
+      expect(VectorHelperTemplates.getCmsisSuffix("f32")).toBe("f32");
+      expect(VectorHelperTemplates.getCmsisSuffix("q7")).toBe("q7");
+      expect(VectorHelperTemplates.getCmsisSuffix("q15")).toBe("q15");
+      expect(VectorHelperTemplates.getCmsisSuffix("q31")).toBe("q31");
+    });
+
+    it("should return null for types CMSIS-DSP does not cover", () => {
+      expect(VectorHelperTemplates.getCmsisSuffix("f64")).toBeNull();
+      expect(VectorHelperTemplates.getCmsisSuffix("i16")).toBeNull();
+      expect(VectorHelperTemplates.getCmsisSuffix("q8_8")).toBeNull();
+    });
+  });
+
+  describe("generate - portable loops", () => {
+    it("should sum floats in the element type", () => {
+      const code = generate("sum", "f32");
+
+      expect(code).toContain(
+        "static inline float cnx_vec_sum_f32(const float* restrict a, uint32_t n) {",
+      );
+      expect(code).toContain("float acc = 0.0f;");
+      expect(code).toContain("acc += a[i];");
+    });
+
+    it("should sum integers in 64 bits", () => {
+      const code = generate("sum", "u8");
+
+      expect(code).toContain("static inline uint64_t cnx_vec_sum_u8(");
+      expect(code).toContain("uint64_t acc = 0;");
+    });
+
+    it("should scan for min and max", () => {
+      const code = generate("min", "i32");
+
+      expect(code).toContain("int32_t result = a[0];");
+      expect(code).toContain("result = (a[i] < result) ? a[i] : result;");
+    });
+
+    it("should take two restrict pointers for dot products", () => {
+      const code = generate("dot", "i16");
+
+      expect(code).toContain(
+        "(const int16_t* restrict a, const int16_t* restrict b, uint32_t n)",
+      );
+      expect(code).toContain("acc += (int64_t)a[i] * b[i];");
+    });
+
+    it("should round and saturate Q dot products", () => {
+      const code = generate("dot", "q15");
+
+      expect(code).toContain("acc = (acc + ((int64_t)1 << 14)) >> 15;");
+      expect(code).toContain("if (acc > INT16_MAX) return INT16_MAX;");
+      expect(code).toContain("if (acc < INT16_MIN) return INT16_MIN;");
+      expect(code).toContain("return (int16_t)acc;");
+    });
+
+    it("should rescale each q31 product", () => {
+      const code = generate("dot", "q31");
+
+      expect(code).toContain("acc += ((int64_t)a[i] * b[i]) >> 31;");
+    });
+
+    it("should return on the first set element of a bool array for any", () => {
+      expect(generate("any", "bool")).toContain(
+        "static inline bool cnx_vec_any_bool(const bool* restrict a, uint32_t n) {",
+      );
+      expect(generate("any", "bool")).toContain("if (a[i]) return true;");
+      expect(generate("any", "u32")).toBeNull();
+    });
+
+    it("should return null for unknown operations", () => {
+      expect(generate("avg", "f32")).toBeNull();
+    });
+  });
+
+  describe("generate - CMSIS-DSP", () => {
+    it("should call arm_max for f32", () => {
+      const code = generate("max", "f32", true);
+
+      expect(code).toContain("arm_max_f32(a, n, &result, &index);");
+    });
+
+    it("should call arm_dot_prod and rescale q15 results", () => {
+      const code = generate("dot", "q15", true);
+
+      expect(code).toContain("arm_dot_prod_q15(a, b, n, &acc);");
+      expect(code).toContain("acc = (acc + ((q63_t)1 << 14)) >> 15;");
+    });
+
+    it("should fall back to the loop for sums", () => {
+      const code = generate("sum", "f32", true);
+
+      expect(code).toContain("acc += a[i];");
+      expect(code).not.toContain("arm_");
+    });
+  });
+});
+
+describe("HelperGenerator - generateVectorHelpers", () => {
+  const { generateVectorHelpers } = helperGenerators;
+
+  it("should return nothing when no helpers are used", () => {
+    expect(generateVectorHelpers(new Set(), false, false)).toEqual([]);
+  });
+
+  it("should emit helpers in sorted order", () => {
+    const code = generateVectorHelpers(
+      new Set(["sum_f32", "max_f32"]),
+      false,
+      false,
+    ).join("\n");
+
+    expect(code).toContain("// Array reduction helpers");
+    expect(code.indexOf("cnx_vec_max_f32")).toBeLessThan(
+      code.indexOf("cnx_vec_sum_f32"),
+    );
+  });
+
+  it("should use __restrict in C++ mode", () => {
+    const code = generateVectorHelpers(new Set(["sum_f32"]), false, true).join(
+      "\n",
+    );
+
+    expect(code).toContain("const float* __restrict a");
+  });
+});
@@ -0,0 +1,596 @@
+/**
+ * ArrayArithmeticHelper
+ *
+ * Whole-array arithmetic on same-size one-dimensional numeric arrays
+ * (integers, floats and Q types):
+ * - element-wise: out <- a + b, out <- a * k, out <- k - a, out +<- a
+ * - reductions: a.sum, a.min, a.max and the (a * b).sum dot product
+ * - flags.any on byte-stored bool arrays (packed arrays test their
+ *   storage words in PackedBoolArrayHelper)
+ *
+ * Element-wise statements lower to one counted loop with a uint32_t index
+ * and a constant bound, the form GCC auto-vectorizes. Distinct arrays are
+ * distinct objects, and for array parameters (which may alias) GCC adds
+ * its own overlap check; reading a[i] before writing out[i] keeps in-place
+ * forms (out <- out * k) correct. Reductions call cnx_vec_* helpers.
+ *
+ * Arithmetic keeps the scalar semantics: integer `+ - *` are plain C as in
+ * `x <- a + b`, compound forms on `clamp` integer arrays and every Q type
+ * operation saturate through the cnx_clamp_* helpers.
+ *
+ * With the cmsisDsp option on a DSP-capable target, f32 and q7/q15/q31
+ * operations with a CMSIS-DSP equivalent call the library instead.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper";
+import FixedPointUtils from "../../../../utils/FixedPointUtils";
+import TypeCheckUtils from "../../../../utils/TypeCheckUtils";
+import FormatUtils from "../../../../utils/FormatUtils";
+import TYPE_MAP from "../types/TYPE_MAP";
+import TTypeInfo from "../types/TTypeInfo";
+import VectorHelperTemplates from "../generators/support/VectorHelperTemplates";
+
+/** Element-wise operators and their helper operation names */
+const ELEMENT_OPS: Record<string, string> = {
+  "+": "add",
+  "-": "sub",
+  "*": "mul",
+};
+
+/** Compound assignment operators and their element operator */
+const COMPOUND_OPS: Record<string, string> = {
+  "+<-": "+",
+  "-<-": "-",
+  "*<-": "*",
+};
+
+/** CMSIS-DSP element-wise function names (array op array) */
+const CMSIS_OPS: Record<string, string> = {
+  "+": "add",
+  "-": "sub",
+  "*": "mult",
+};
+
+/** Whole-array reduction properties */
+const REDUCTIONS = new Set(["sum", "min", "max", "any"]);
+
+/** Loop index of generated element-wise loops */
+const INDEX = "_cnx_i";
+
+/**
+ * A whole one-dimensional numeric array
+ */
+interface IWholeArray {
+  /** Name as written, for error messages */
+  name: string;
+  /** C-Next element type */
+  baseType: string;
+  /** Element count */
+  length: number;
+}
+
+/**
+ * One side of an element-wise operation: an array or a scalar
+ */
+interface IOperand {
+  unary: Parser.UnaryExpressionContext;
+  array: IWholeArray | null;
+}
+
+/**
+ * Callbacks into CodeGenerator
+ */
+interface IArrayArithmeticDeps {
+  generateUnaryExpr: (ctx: Parser.UnaryExpressionContext) => string;
+  generateAssignmentTarget: (ctx: Parser.AssignmentTargetContext) => string;
+}
+
+class ArrayArithmeticHelper {
+  /**
+   * Check if a member name is a whole-array reduction (.sum, .min, .max,
+   * .any).
+   */
+  static isReduction(memberName: string): boolean {
+    return REDUCTIONS.has(memberName);
+  }
+
+  /**
+   * Lower a whole-array assignment, or return null if the statement is not
+   * one (the normal assignment path handles it).
+   *
+   * @throws Error if the arrays have different element types or lengths
+   */
+  static tryGenerateAssignment(
+    ctx: Parser.AssignmentStatementContext,
+    deps: IArrayArithmeticDeps,
+  ): string | null {
+    const targetCtx = ctx.assignmentTarget();
+    const targetKey = ArrayArithmeticHelper.getTargetKey(targetCtx);
+    const targetInfo = targetKey
+      ? CodeGenState.getVariableTypeInfo(targetKey)
+      : undefined;
+    if (!targetKey || !targetInfo?.isArray || targetInfo.isString) {
+      return null;
+    }
+
+    const cnextOp = ctx.assignmentOperator().getText();
+    const operands = ArrayArithmeticHelper.getOperands(
+      ctx.expression(),
+      cnextOp,
+    );
+    if (!operands) {
+      return null;
+    }
+    const [op, left, right] = operands;
+    const isCompound = cnextOp !== "<-";
+    if (!isCompound && !left?.array && !right.array) {
+      return null;
+    }
+
+    const targetName = targetCtx.getText();
+    const target = ArrayArithmeticHelper.toWholeArray(targetInfo, targetName);
+    if (targetInfo.isConst) {
+      throw new Error(`cannot assign to const variable '${targetName}'`);
+    }
+    for (const operand of [left, right]) {
+      if (operand?.array) {
+        ArrayArithmeticHelper.checkSameShape(target, operand.array);
+      }
+    }
+
+    CodeGenState.requireStdint();
+    const targetCode = deps.generateAssignmentTarget(targetCtx);
+    const length = `${target.length}U`;
+    const decls: string[] = [];
+    const leftCode = left
+      ? ArrayArithmeticHelper.generateOperand(left, target, decls, deps)
+      : targetCode;
+    const rightCode = ArrayArithmeticHelper.generateOperand(
+      right,
+      target,
+      decls,
+      deps,
+    );
+    const leftArray = left ? left.array : target;
+
+    const cmsisCall = ArrayArithmeticHelper.tryCmsis(
+      op,
+      target.baseType,
+      { code: leftCode, isArray: leftArray !== null },
+      { code: rightCode, isArray: right.array !== null },
+      `${targetCode}, ${length}`,
+    );
+    if (cmsisCall) {
+      CodeGenState.requireArmMath();
+      return cmsisCall;
+    }
+
+    const element = (code: string, isArray: boolean): string =>
+      isArray ? `${code}[${INDEX}]` : code;
+    const body = ArrayArithmeticHelper.generateElement(
+      op,
+      target.baseType,
+      `${targetCode}[${INDEX}]`,
+      element(leftCode, leftArray !== null),
+      element(rightCode, right.array !== null),
+      isCompound &&
+        targetInfo.overflowBehavior === "clamp" &&
+        TypeCheckUtils.isInteger(target.baseType),
+      !left,
+    );
+    const loop = [
+      `for (uint32_t ${INDEX} = 0U; ${INDEX} < ${length}; ${INDEX}++) {`,
+      `${FormatUtils.indent(1)}${body}`,
+      "}",
+    ];
+    if (decls.length === 0) {
+      return loop.join("\n");
+    }
+    // Scalars are evaluated once, before the loop
+    const inner = [...decls, ...loop].map(
+      (line) => FormatUtils.indent(1) + line,
+    );
+    return ["{", ...inner, "}"].join("\n");
+  }
+
+  /**
+   * Generate `a.sum`, `a.min`, `a.max` or `flags.any`, or return null if
+   * the value is not a whole array.
+   *
+   * @param operation - sum, min, max or any
+   * @param code - C expression naming the array
+   * @param typeInfo - Type of the array
+   * @param name - Name as written, for error messages
+   */
+  static generateReduction(
+    operation: string,
+    code: string,
+    typeInfo: TTypeInfo | undefined,
+    name: string,
+  ): string | null {
+    if (!typeInfo?.isArray) {
+      return null;
+    }
+    if (operation === "any") {
+      return ArrayArithmeticHelper.generateAny(code, typeInfo, name);
+    }
+    const array = ArrayArithmeticHelper.toWholeArray(typeInfo, name);
+    ArrayArithmeticHelper.useVectorHelper(operation, array.baseType);
+    return `cnx_vec_${operation}_${array.baseType}(${code}, ${array.length}U)`;
+  }
+
+  /**
+   * Generate `flags.any`: true if any element of a bool array is set.
+   *
+   * @throws Error unless the array is a one-dimensional sized bool array
+   */
+  private static generateAny(
+    code: string,
+    typeInfo: TTypeInfo,
+    name: string,
+  ): string {
+    const dims = typeInfo.arrayDimensions ?? [];
+    if (
+      typeInfo.baseType !== "bool" ||
+      dims.length !== 1 ||
+      !(dims[0] > 0) ||
+      typeInfo.isStructOfArrays
+    ) {
+      throw new Error(
+        `Error: .any needs a one-dimensional bool array with a constant size: '${name}'`,
+      );
+    }
+    CodeGenState.requireStdbool();
+    ArrayArithmeticHelper.useVectorHelper("any", "bool");
+    return `cnx_vec_any_bool(${code}, ${dims[0]}U)`;
+  }
+
+  /**
+   * Generate the `(a * b).sum` dot product, or return null if the
+   * parenthesized expression is not a product of two whole arrays.
+   */
+  static tryGenerateDotProduct(
+    expr: Parser.ExpressionContext,
+    generateUnaryExpr: (ctx: Parser.UnaryExpressionContext) => string,
+  ): string | null {
+    const operands = ArrayArithmeticHelper.getOperands(expr, "<-");
+    if (!operands) {
+      return null;
+    }
+    const [op, left, right] = operands;
+    if (op !== "*" || !left?.array || !right.array) {
+      return null;
+    }
+    ArrayArithmeticHelper.checkSameShape(left.array, right.array);
+    const { baseType, length } = left.array;
+    ArrayArithmeticHelper.useVectorHelper("dot", baseType);
+    const a = generateUnaryExpr(left.unary);
+    const b = generateUnaryExpr(right.unary);
+    return `cnx_vec_dot_${baseType}(${a}, ${b}, ${length}U)`;
+  }
+
+  /**
+   * Check if operations on an element type call CMSIS-DSP.
+   */
+  private static usesCmsis(baseType: string): boolean {
+    return (
+      CodeGenState.usesCmsisDsp() &&
+      VectorHelperTemplates.getCmsisSuffix(baseType) !== null
+    );
+  }
+
+  /**
+   * Mark a reduction helper and the headers its body needs.
+   */
+  private static useVectorHelper(operation: string, baseType: string): void {
+    CodeGenState.markVectorOpUsed(operation, baseType);
+    CodeGenState.requireStdint();
+    if (ArrayArithmeticHelper.usesCmsis(baseType)) {
+      CodeGenState.requireArmMath();
+    }
+  }
+
+  // ========================================================================
+  // Operand analysis
+  // ========================================================================
+
+  /**
+   * Registry key of a whole-variable assignment target (x, this.x, global.x).
+   */
+  private static getTargetKey(
+    targetCtx: Parser.AssignmentTargetContext,
+  ): string | null {
+    if (targetCtx.postfixTargetOp().length > 0) {
+      return null;
+    }
+    const id = targetCtx.IDENTIFIER().getText();
+    if (targetCtx.THIS()) {
+      return CodeGenState.currentScope
+        ? `${CodeGenState.currentScope}_${id}`
+        : null;
+    }
+    return id;
+  }
+
+  /**
+   * Split the value into `[operator, left, right]`. For compound operators
+   * the left side is the target (null).
+   */
+  private static getOperands(
+    expr: Parser.ExpressionContext,
+    cnextOp: string,
+  ): [string, IOperand | null, IOperand] | null {
+    const compoundOp = COMPOUND_OPS[cnextOp];
+    if (compoundOp) {
+      const unary = ExpressionUnwrapper.getUnaryExpression(expr);
+      return unary
+        ? [compoundOp, null, ArrayArithmeticHelper.toOperand(unary)]
+        : null;
+    }
+    if (cnextOp !== "<-") {
+      return null;
+    }
+
+    const additive = ExpressionUnwrapper.getAdditiveExpression(expr);
+    if (!additive) {
+      return null;
+    }
+    const terms = additive.multiplicativeExpression();
+    let op: string;
+    let unaries: Parser.UnaryExpressionContext[];
+    if (terms.length === 2) {
+      op = additive.getChild(1)!.getText();
+      unaries = terms.flatMap((term) => term.unaryExpression());
+    } else if (terms.length === 1) {
+      op = terms[0].getChild(1)?.getText() ?? "";
+      unaries = terms[0].unaryExpression();
+    } else {
+      return null;
+    }
+    if (!ELEMENT_OPS[op] || unaries.length !== 2) {
+      return null;
+    }
+    return [
+      op,
+      ArrayArithmeticHelper.toOperand(unaries[0]),
+      ArrayArithmeticHelper.toOperand(unaries[1]),
+    ];
+  }
+
+  private static toOperand(unary: Parser.UnaryExpressionContext): IOperand {
+    return { unary, array: ArrayArithmeticHelper.resolveArray(unary) };
+  }
+
+  /**
+   * Resolve a bare array reference (a, this.a, global.a).
+   *
+   * @returns The array, or null if the operand is a scalar
+   * @throws Error if it names an array that cannot take part
+   */
+  private static resolveArray(
+    unary: Parser.UnaryExpressionContext,
+  ): IWholeArray | null {
+    const postfix = unary.postfixExpression();
+    if (!postfix) {
+      return null;
+    }
+    const primary = postfix.primaryExpression();
+    const members = postfix.postfixOp().map((op) => op.IDENTIFIER()?.getText());
+    let key: string | null = null;
+    if (primary.IDENTIFIER() && members.length === 0) {
+      key = primary.IDENTIFIER()!.getText();
+    } else if (members.length === 1 && members[0]) {
+      if (primary.THIS() && CodeGenState.currentScope) {
+        key = `${CodeGenState.currentScope}_${members[0]}`;
+      } else if (primary.GLOBAL()) {
+        key = members[0];
+      }
+    }
+    const typeInfo = key ? CodeGenState.getVariableTypeInfo(key) : undefined;
+    if (!typeInfo?.isArray || typeInfo.isString) {
+      return null;
+    }
+    return ArrayArithmeticHelper.toWholeArray(typeInfo, postfix.getText());
+  }
+
+  /**
+   * @throws Error unless the array is one-dimensional, numeric and sized
+   */
+  private static toWholeArray(typeInfo: TTypeInfo, name: string): IWholeArray {
+    const dims = typeInfo.arrayDimensions ?? [];
+    const baseType = typeInfo.baseType;
+    const isNumeric =
+      TypeCheckUtils.isInteger(baseType) ||
+      TypeCheckUtils.isFloat(baseType) ||
+      FixedPointUtils.isFixedPoint(baseType);
+    if (
+      dims.length !== 1 ||
+      !(dims[0] > 0) ||
+      !isNumeric ||
+      typeInfo.isPackedBool ||
+      typeInfo.isStructOfArrays
+    ) {
+      throw new Error(
+        `Error: Whole-array arithmetic needs a one-dimensional numeric array with a constant size: '${name}'`,
+      );
+    }
+    return { name, baseType, length: dims[0] };
+  }
+
+  private static checkSameShape(a: IWholeArray, b: IWholeArray): void {
+    if (a.baseType !== b.baseType) {
+      throw new Error(
+        `Error: Whole-array arithmetic on different element types: '${a.name}' is ${a.baseType}, '${b.name}' is ${b.baseType}`,
+      );
+    }
+    if (a.length !== b.length) {
+      throw new Error(
+        `Error: Whole-array arithmetic on different lengths: '${a.name}' has ${a.length} elements, '${b.name}' has ${b.length}`,
+      );
+    }
+  }
+
+  // ========================================================================
+  // Code generation
+  // ========================================================================
+
+  /**
+   * Generate an operand. Scalars that are not a plain variable or literal
+   * are evaluated once into a temporary (declaration pushed to `decls`).
+   */
+  private static generateOperand(
+    operand: IOperand,
+    target: IWholeArray,
+    decls: string[],
+    deps: IArrayArithmeticDeps,
+  ): string {
+    if (operand.array) {
+      return deps.generateUnaryExpr(operand.unary);
+    }
+    const elementType = target.baseType;
+    ArrayArithmeticHelper.checkScalarType(operand.unary, elementType);
+    const code = CodeGenState.withExpectedType(elementType, () =>
+      deps.generateUnaryExpr(operand.unary),
+    );
+    if (ArrayArithmeticHelper.isInvariant(operand.unary)) {
+      return code;
+    }
+    const cType =
+      FixedPointUtils.parse(elementType)?.cType ?? TYPE_MAP[elementType];
+    const temp = `_cnx_tmp_${CodeGenState.tempVarCounter++}`;
+    decls.push(`const ${cType} ${temp} = ${code};`);
+    return temp;
+  }
+
+  /**
+   * Q arrays only combine with the same Q type or a numeric literal.
+   */
+  private static checkScalarType(
+    unary: Parser.UnaryExpressionContext,
+    elementType: string,
+  ): void {
+    if (!FixedPointUtils.isFixedPoint(elementType)) {
+      return;
+    }
+    if (ArrayArithmeticHelper.getLiteral(unary)) {
+      return;
+    }
+    const postfix = unary.postfixExpression();
+    const id = postfix?.primaryExpression().IDENTIFIER()?.getText();
+    const scalarType =
+      id && postfix!.postfixOp().length === 0
+        ? CodeGenState.getVariableTypeInfo(id)?.baseType
+        : undefined;
+    if (scalarType && scalarType !== elementType) {
+      throw new Error(
+        `Error: Cannot mix ${elementType} and ${scalarType} in fixed-point arithmetic; cast explicitly`,
+      );
+    }
+  }
+
+  /**
+   * A literal (optionally negated), or null.
+   */
+  private static getLiteral(
+    unary: Parser.UnaryExpressionContext,
+  ): Parser.LiteralContext | null {
+    const inner = unary.unaryExpression();
+    if (inner) {
+      return unary.getChild(0)?.getText() === "-"
+        ? ArrayArithmeticHelper.getLiteral(inner)
+        : null;
+    }
+    const postfix = unary.postfixExpression();
+    if (!postfix || postfix.postfixOp().length > 0) {
+      return null;
+    }
+    return postfix.primaryExpression().literal();
+  }
+
+  /**
+   * Literals and plain variables cannot change while the loop runs.
+   */
+  private static isInvariant(unary: Parser.UnaryExpressionContext): boolean {
+    if (ArrayArithmeticHelper.getLiteral(unary)) {
+      return true;
+    }
+    const postfix = unary.postfixExpression();
+    return (
+      postfix !== null &&
+      postfix.postfixOp().length === 0 &&
+      postfix.primaryExpression().IDENTIFIER() !== null
+    );
+  }
+
+  /**
+   * One element of the loop body.
+   *
+   * @param saturate - Integer compound form on a clamp array
+   * @param isCompound - Left side is the target element itself
+   */
+  private static generateElement(
+    op: string,
+    baseType: string,
+    targetElement: string,
+    left: string,
+    right: string,
+    saturate: boolean,
+    isCompound: boolean,
+  ): string {
+    const helperOp = ELEMENT_OPS[op];
+    if (FixedPointUtils.isFixedPoint(baseType) || saturate) {
+      CodeGenState.markClampOpUsed(helperOp, baseType);
+      return `${targetElement} = cnx_clamp_${helperOp}_${baseType}(${left}, ${right});`;
+    }
+    if (isCompound) {
+      return `${targetElement} ${op}= ${right};`;
+    }
+    return `${targetElement} = ${left} ${op} ${right};`;
+  }
+
+  /**
+   * CMSIS-DSP call for an element-wise operation, or null if the library
+   * has no function with the same semantics.
+   *
+   * @param tail - Destination and block size arguments
+   */
+  private static tryCmsis(
+    op: string,
+    baseType: string,
+    left: { code: string; isArray: boolean },
+    right: { code: string; isArray: boolean },
+    tail: string,
+  ): string | null {
+    if (!ArrayArithmeticHelper.usesCmsis(baseType)) {
+      return null;
+    }
+    const suffix = VectorHelperTemplates.getCmsisSuffix(baseType)!;
+    if (left.isArray && right.isArray) {
+      // arm_mult_q15/q31 truncate; the Q helpers round
+      if (suffix !== "f32" && op === "*") {
+        return null;
+      }
+      return `arm_${CMSIS_OPS[op]}_${suffix}(${left.code}, ${right.code}, ${tail});`;
+    }
+    if (suffix !== "f32") {
+      return null;
+    }
+    const [array, scalar] = left.isArray
+      ? [left.code, right.code]
+      : [right.code, left.code];
+    if (op === "*") {
+      return `arm_scale_f32(${array}, ${scalar}, ${tail});`;
+    }
+    if (op === "+") {
+      return `arm_offset_f32(${array}, ${scalar}, ${tail});`;
+    }
+    if (op === "-" && left.isArray) {
+      return `arm_offset_f32(${array}, -(${scalar}), ${tail});`;
+    }
+    return null;
+  }
+}
+
+export default ArrayArithmeticHelper;
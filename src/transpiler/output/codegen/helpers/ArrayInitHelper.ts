@@ -6,6 +6,7 @@
  * Handles:
  * - Array initializers with size inference: u8 data[] <- [1, 2, 3]
  * - Fill-all syntax: u8 data[10] <- [0*]
+ * - Table generators: u32 crc[256] <- [crcEntry*] (evaluated at transpile time)
  * - Array size validation
  *
  * Migrated to use CodeGenState instead of constructor DI.
@@ -13,6 +14,9 @@
 
 import * as Parser from "../../../logic/parser/grammar/CNextParser.js";
 import CodeGenState from "../../../state/CodeGenState.js";
+import TypeCheckUtils from "../../../../utils/TypeCheckUtils.js";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper.js";
+import ConstTableEvaluator from "./ConstTableEvaluator.js";
 
 /**
  * Result from processing array initialization.
@@ -26,6 +30,19 @@ interface IArrayInitResult {
   initValue: string;
 }
 
+/** Source text of a fill-all naming a function: [fn*], [Scope.fn*] */
+const GENERATOR_TEXT = /^\[(?:[A-Za-z_]\w*\.)?[A-Za-z_]\w*\*\]$/;
+
+/**
+ * A table generator initializer: [fn*] on an integer array
+ */
+interface ITableGenerator {
+  /** Generator function (C name) */
+  functionName: string;
+  /** C-Next element type */
+  elementType: string;
+}
+
 /**
  * Callbacks required for array initialization.
  * These need CodeGenerator context and cannot be replaced with static state.
@@ -68,6 +85,22 @@ class ArrayInitHelper {
     CodeGenState.lastArrayInitCount = 0;
     CodeGenState.lastArrayFillValue = undefined;
 
+    const generator = ArrayInitHelper._getTableGenerator(
+      typeCtx,
+      expression,
+      callbacks,
+    );
+    if (generator) {
+      return ArrayInitHelper._processTableGenerator(
+        name,
+        generator,
+        typeCtx,
+        arrayDims,
+        declaredSize,
+        callbacks,
+      );
+    }
+
     const initValue = ArrayInitHelper._generateArrayInitValue(
       typeCtx,
       expression,
@@ -97,6 +130,64 @@ class ArrayInitHelper {
     return { isArrayInit: true, dimensionSuffix, initValue: finalInitValue };
   }
 
+  /**
+   * Detect a table generator: a fill-all initializer naming a function of
+   * this file, on an integer array (callback arrays fill with the function).
+   */
+  private static _getTableGenerator(
+    typeCtx: Parser.TypeContext,
+    expression: Parser.ExpressionContext,
+    callbacks: IArrayInitCallbacks,
+  ): ITableGenerator | null {
+    if (!GENERATOR_TEXT.test(expression.getText())) {
+      return null;
+    }
+    const elementType = callbacks.getTypeName(typeCtx);
+    if (!TypeCheckUtils.isInteger(elementType)) {
+      return null;
+    }
+    const init = ExpressionUnwrapper.getPostfixExpression(expression)
+      ?.primaryExpression()
+      .arrayInitializer();
+    const fillValue = init?.expression();
+    if (!fillValue || init!.getChild(2)?.getText() !== "*") {
+      return null;
+    }
+    const functionName = ConstTableEvaluator.resolveGenerator(fillValue);
+    return functionName ? { functionName, elementType } : null;
+  }
+
+  /**
+   * Evaluate a table generator into a literal initializer
+   */
+  private static _processTableGenerator(
+    name: string,
+    generator: ITableGenerator,
+    typeCtx: Parser.TypeContext,
+    arrayDims: Parser.ArrayDimensionContext[],
+    declaredSize: number | null,
+    callbacks: IArrayInitCallbacks,
+  ): IArrayInitResult {
+    const typeDims = typeCtx.arrayType()?.arrayTypeDimension().length ?? 0;
+    if (declaredSize === null || arrayDims.length + typeDims !== 1) {
+      throw new Error(
+        `Error: Table generator [${generator.functionName}*] requires a one-dimensional array with explicit size`,
+      );
+    }
+    const values = ConstTableEvaluator.evaluateTable(
+      generator.functionName,
+      declaredSize,
+      generator.elementType,
+      name,
+    );
+    CodeGenState.localArrays.add(name);
+    return {
+      isArrayInit: true,
+      dimensionSuffix: callbacks.generateArrayDimensions(arrayDims),
+      initValue: ConstTableEvaluator.formatTable(values),
+    };
+  }
+
   /**
    * Generate the array initializer value with proper expected type
    */
@@ -0,0 +1,136 @@
+/**
+ * BranchHintHelper
+ *
+ * Branch probability hints:
+ * - if (unlikely(fault)) / if (likely(ready)) wrap the condition in
+ *   CNX_UNLIKELY / CNX_LIKELY
+ * - switch (likely(state, State.IDLE)) marks the expected case with
+ *   CNX_EXPECT(state, State_IDLE)
+ * - coldFunctions / hotFunctions put CNX_COLD / CNX_HOT on definitions
+ * - branchHints marks the clamp and safe-div error branches unlikely
+ *
+ * The macros expand to __builtin_expect and the cold/hot attributes on GCC
+ * and Clang and to the plain expression (or nothing) on other compilers.
+ * `likely` and `unlikely` are only hints while no function of that name is
+ * defined.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper";
+
+/** Hint names and the macros they lower to */
+const HINT_MACROS: Record<string, string> = {
+  likely: "CNX_LIKELY",
+  unlikely: "CNX_UNLIKELY",
+};
+
+/**
+ * A likely()/unlikely() call
+ */
+interface IBranchHint {
+  /** "likely" or "unlikely" */
+  name: string;
+  /** Call arguments */
+  args: Parser.ExpressionContext[];
+}
+
+/**
+ * A hinted if condition
+ */
+interface IConditionHint {
+  /** CNX_LIKELY or CNX_UNLIKELY */
+  macro: string;
+  /** The condition inside the hint */
+  condition: Parser.ExpressionContext;
+}
+
+/**
+ * A hinted switch expression
+ */
+interface ISwitchHint {
+  /** The switch key */
+  key: Parser.ExpressionContext;
+  /** The value of the expected case */
+  expected: Parser.ExpressionContext;
+}
+
+class BranchHintHelper {
+  /**
+   * Recognize `likely(cond)` / `unlikely(cond)` as an if condition.
+   */
+  static getConditionHint(
+    expr: Parser.ExpressionContext,
+    statement: string,
+  ): IConditionHint | null {
+    const hint = BranchHintHelper._getHint(expr);
+    if (!hint) {
+      return null;
+    }
+    if (hint.args.length !== 1) {
+      throw new Error(
+        `Error: ${hint.name}() in an ${statement} condition takes one argument, got ${hint.args.length}`,
+      );
+    }
+    return { macro: HINT_MACROS[hint.name], condition: hint.args[0] };
+  }
+
+  /**
+   * Recognize `likely(key, value)` as a switch expression.
+   */
+  static getSwitchHint(expr: Parser.ExpressionContext): ISwitchHint | null {
+    const hint = BranchHintHelper._getHint(expr);
+    if (!hint) {
+      return null;
+    }
+    if (hint.name !== "likely" || hint.args.length !== 2) {
+      throw new Error(
+        `Error: switch expects likely(key, value) to mark the expected case, not ${hint.name}() with ${hint.args.length} argument(s)`,
+      );
+    }
+    return { key: hint.args[0], expected: hint.args[1] };
+  }
+
+  /**
+   * Attribute macro for a function definition (C name), with trailing space
+   */
+  static getFunctionAttribute(cName: string): string {
+    if (CodeGenState.coldFunctions.has(cName)) {
+      CodeGenState.requireBranchHints();
+      return "CNX_COLD ";
+    }
+    if (CodeGenState.hotFunctions.has(cName)) {
+      CodeGenState.requireBranchHints();
+      return "CNX_HOT ";
+    }
+    return "";
+  }
+
+  /**
+   * Normalize a configured function name (Scope.fn or Scope_fn) to C
+   */
+  static toCName(name: string): string {
+    return name.replaceAll(".", "_");
+  }
+
+  /**
+   * A call to likely/unlikely that is not a user function
+   */
+  private static _getHint(expr: Parser.ExpressionContext): IBranchHint | null {
+    const postfix = ExpressionUnwrapper.getPostfixExpression(expr);
+    const name = postfix?.primaryExpression().IDENTIFIER()?.getText();
+    if (!name || !(name in HINT_MACROS)) {
+      return null;
+    }
+    const ops = postfix!.postfixOp();
+    if (ops.length !== 1 || ops[0].getChild(0)?.getText() !== "(") {
+      return null;
+    }
+    if (CodeGenState.knownFunctions.has(name)) {
+      return null;
+    }
+    return { name, args: ops[0].argumentList()?.expression() ?? [] };
+  }
+}
+
+export default BranchHintHelper;
@@ -0,0 +1,79 @@
+/**
+ * CompactEnumHelper
+ *
+ * Backing-width inference for compact enum storage (compactEnums option).
+ * Shared by EnumGenerator and the header enum generator so that the .c/.cpp
+ * and .h/.hpp definitions always agree.
+ */
+
+class CompactEnumHelper {
+  /**
+   * Infer the smallest unsigned backing width that holds every member value.
+   * Enum members are non-negative (ADR-017), so unsigned widths suffice;
+   * enums with negative members (external headers) stay int-sized.
+   *
+   * @param members - Enum member values (memberName -> value)
+   * @returns 8, 16 or 32
+   */
+  static inferBitWidth(members: ReadonlyMap<string, number>): number {
+    if (CompactEnumHelper.hasNegativeMember(members)) return 32;
+    let maxValue = 0;
+    for (const value of members.values()) {
+      maxValue = Math.max(maxValue, value);
+    }
+    if (maxValue <= 0xff) return 8;
+    if (maxValue <= 0xffff) return 16;
+    return 32;
+  }
+
+  /**
+   * Check whether any member value is negative.
+   */
+  static hasNegativeMember(members: ReadonlyMap<string, number>): boolean {
+    for (const value of members.values()) {
+      if (value < 0) return true;
+    }
+    return false;
+  }
+
+  /**
+   * Get the stdint backing type for a bit width (e.g., 8 -> "uint8_t").
+   */
+  static getBackingType(bitWidth: number): string {
+    return `uint${bitWidth}_t`;
+  }
+
+  /**
+   * Generate the opening line of a typedef enum.
+   *
+   * - Default: `typedef enum {` (int-sized)
+   * - Compact C++: `typedef enum : uint8_t {` (fixed underlying type)
+   * - Compact C: `typedef enum __attribute__((packed)) {` (GCC/Clang pick
+   *   the smallest type that holds all values, matching inferBitWidth),
+   *   guarded so other compilers see a plain int-sized enum
+   */
+  static getTypedefOpening(
+    members: ReadonlyMap<string, number>,
+    compact: boolean,
+    cppMode: boolean,
+  ): string {
+    if (!compact || CompactEnumHelper.hasNegativeMember(members)) {
+      return "typedef enum {";
+    }
+    if (cppMode) {
+      const backingType = CompactEnumHelper.getBackingType(
+        CompactEnumHelper.inferBitWidth(members),
+      );
+      return `typedef enum : ${backingType} {`;
+    }
+    return [
+      "#if defined(__GNUC__) || defined(__clang__)",
+      "typedef enum __attribute__((packed)) {",
+      "#else",
+      "typedef enum {",
+      "#endif",
+    ].join("\n");
+  }
+}
+
+export default CompactEnumHelper;
@@ -0,0 +1,1041 @@
+/**
+ * ConstTableEvaluator - Transpile-time evaluation of table generators
+ *
+ * A fill-all initializer that names a function fills element i with the
+ * function's result for i:
+ *
+ *   const u32[256] crcTable <- [crc32Entry*];
+ *
+ * The function runs in a small interpreter at transpile time and the table
+ * is emitted as literals, so it is placed in flash with no startup code.
+ *
+ * Evaluable functions are pure integer code:
+ * - integer and bool parameters, locals and return value (no arrays)
+ * - if, while, do-while, for, forever and switch statements
+ * - assignments, compound assignments and bit writes to locals
+ * - reads of global and scope constants
+ * - calls to other evaluable functions in the same file
+ * - bit reads (x[n], x[start, width]) and casts between integer types
+ *
+ * Arithmetic follows the generated C: integer promotion and the usual
+ * arithmetic conversions apply, unsigned results wrap, and signed overflow,
+ * out-of-range shifts and division by zero are errors. Compound + - * on
+ * clamp locals saturate like the cnx_clamp_* helpers.
+ */
+
+import { ParserRuleContext } from "antlr4ng";
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import TYPE_RANGES from "../types/TYPE_RANGES";
+import FormatUtils from "../../../../utils/FormatUtils";
+
+/**
+ * Width and signedness of a C integer type
+ */
+interface IIntType {
+  bits: number;
+  signed: boolean;
+}
+
+/**
+ * A value with its C type
+ */
+interface IValue {
+  value: bigint;
+  type: IIntType;
+}
+
+/**
+ * A local variable or parameter
+ */
+interface ICell {
+  value: bigint;
+  cnxType: string;
+  /** Compound + - * saturate (clamp is the default for locals) */
+  clamp: boolean;
+}
+
+/**
+ * One function activation
+ */
+interface IFrame {
+  name: string;
+  scopeName: string | null;
+  returnType: string;
+  blocks: Map<string, ICell>[];
+}
+
+const INT: IIntType = { bits: 32, signed: true };
+const UINT: IIntType = { bits: 32, signed: false };
+const INT64: IIntType = { bits: 64, signed: true };
+const UINT64: IIntType = { bits: 64, signed: false };
+
+/** C-Next types the interpreter handles */
+const INT_TYPES: Record<string, IIntType> = {
+  bool: { bits: 1, signed: false },
+  u8: { bits: 8, signed: false },
+  u16: { bits: 16, signed: false },
+  u32: UINT,
+  u64: UINT64,
+  i8: { bits: 8, signed: true },
+  i16: { bits: 16, signed: true },
+  i32: INT,
+  i64: INT64,
+};
+
+/** Compound assignment operators and their binary operator */
+const COMPOUND_OPS: Record<string, string> = {
+  "+<-": "+",
+  "-<-": "-",
+  "*<-": "*",
+  "/<-": "/",
+  "%<-": "%",
+  "&<-": "&",
+  "|<-": "|",
+  "^<-": "^",
+  "<<<-": "<<",
+  ">><-": ">>",
+};
+
+/** Compound operators that saturate on clamp variables */
+const SATURATING_OPS = new Set(["+", "-", "*"]);
+
+/** Statements executed per table before giving up (runaway loops) */
+const MAX_STEPS = 10_000_000;
+
+/** Nested call limit (runaway recursion) */
+const MAX_DEPTH = 64;
+
+/** Elements per line of a generated table */
+const VALUES_PER_LINE = 8;
+
+function typeName(type: IIntType): string {
+  if (type.bits === 1) {
+    return "bool";
+  }
+  return `${type.signed ? "i" : "u"}${type.bits}`;
+}
+
+function convert(value: bigint, type: IIntType): bigint {
+  if (type.bits === 1) {
+    return value === 0n ? 0n : 1n;
+  }
+  return type.signed
+    ? BigInt.asIntN(type.bits, value)
+    : BigInt.asUintN(type.bits, value);
+}
+
+function fits(value: bigint, type: IIntType): boolean {
+  return convert(value, type) === value;
+}
+
+/** Integer promotion: everything narrower than int becomes int */
+function promote(type: IIntType): IIntType {
+  return type.bits < 32 ? INT : type;
+}
+
+/** Usual arithmetic conversions */
+function commonType(a: IIntType, b: IIntType): IIntType {
+  const left = promote(a);
+  const right = promote(b);
+  if (left.signed === right.signed) {
+    return left.bits >= right.bits ? left : right;
+  }
+  const [unsigned, signed] = left.signed ? [right, left] : [left, right];
+  return unsigned.bits >= signed.bits ? unsigned : signed;
+}
+
+/**
+ * Exact a op b clamped to the range of a C-Next integer type.
+ */
+function saturate(a: bigint, op: string, b: bigint, cnxType: string): bigint {
+  const [min, max] = TYPE_RANGES[cnxType];
+  let exact = a * b;
+  if (op === "+") {
+    exact = a + b;
+  } else if (op === "-") {
+    exact = a - b;
+  }
+  if (exact < min) {
+    return min;
+  }
+  return exact > max ? max : exact;
+}
+
+function intValue(value: bigint): IValue {
+  return { value, type: INT };
+}
+
+/**
+ * Raised by a return statement to unwind to the call
+ */
+class ReturnSignal {
+  constructor(readonly value: IValue) {}
+}
+
+/**
+ * Interpreter state for one table
+ */
+class Evaluation {
+  private steps = 0;
+  private depth = 0;
+
+  constructor(private readonly tableName: string) {}
+
+  /**
+   * Call a function with already evaluated arguments.
+   */
+  call(functionName: string, args: (IValue | ICell)[]): IValue {
+    const decl = ConstTableEvaluator.getFunction(functionName);
+    const returnType = decl.type().VOID()
+      ? "void"
+      : this.primitiveType(decl.type(), functionName, "return");
+    const params = decl.parameterList()?.parameter() ?? [];
+    if (params.length !== args.length) {
+      this.fail(
+        `'${functionName}' takes ${params.length} argument(s), got ${args.length}`,
+      );
+    }
+    if (++this.depth > MAX_DEPTH) {
+      this.fail(`calls nest deeper than ${MAX_DEPTH} levels`);
+    }
+
+    const frame: IFrame = {
+      name: functionName,
+      scopeName: ConstTableEvaluator.getScopeName(decl),
+      returnType,
+      blocks: [new Map()],
+    };
+    params.forEach((param, i) => {
+      const paramName = param.IDENTIFIER().getText();
+      if (param.arrayDimension().length > 0) {
+        this.fail(`parameter '${paramName}' of '${functionName}' is an array`);
+      }
+      const paramType = this.primitiveType(
+        param.type(),
+        functionName,
+        `parameter '${paramName}'`,
+      );
+      const arg = args[i];
+      // A variable passed to a parameter of its own type is shared, as
+      // C-Next passes modified parameters by reference
+      const cell =
+        "cnxType" in arg && arg.cnxType === paramType
+          ? arg
+          : {
+              value: convert(arg.value, INT_TYPES[paramType]),
+              cnxType: paramType,
+              clamp: false,
+            };
+      frame.blocks[0].set(paramName, cell);
+    });
+
+    try {
+      this.execBlock(decl.block(), frame);
+    } catch (e) {
+      if (e instanceof ReturnSignal) {
+        this.depth--;
+        return e.value;
+      }
+      throw e;
+    }
+    if (returnType !== "void") {
+      this.fail(`'${functionName}' ends without returning a value`);
+    }
+    this.depth--;
+    return intValue(0n);
+  }
+
+  // ========================================================================
+  // Statements
+  // ========================================================================
+
+  private execBlock(ctx: Parser.BlockContext, frame: IFrame): void {
+    frame.blocks.push(new Map());
+    try {
+      for (const stmt of ctx.statement()) {
+        this.execStatement(stmt, frame);
+      }
+    } finally {
+      frame.blocks.pop();
+    }
+  }
+
+  private execStatement(ctx: Parser.StatementContext, frame: IFrame): void {
+    this.countStep();
+    if (ctx.variableDeclaration()) {
+      this.declare(ctx.variableDeclaration()!, frame);
+    } else if (ctx.assignmentStatement()) {
+      const assign = ctx.assignmentStatement()!;
+      this.assign(
+        assign.assignmentTarget(),
+        assign.assignmentOperator().getText(),
+        assign.expression(),
+        frame,
+      );
+    } else if (ctx.expressionStatement()) {
+      this.eval(ctx.expressionStatement()!.expression(), frame, null);
+    } else if (ctx.ifStatement()) {
+      const ifStmt = ctx.ifStatement()!;
+      const branch = this.isTrue(ifStmt.expression(), frame)
+        ? ifStmt.statement(0)
+        : ifStmt.statement(1);
+      if (branch) {
+        this.execStatement(branch, frame);
+      }
+    } else if (ctx.whileStatement()) {
+      const loop = ctx.whileStatement()!;
+      while (this.isTrue(loop.expression(), frame)) {
+        this.execStatement(loop.statement(), frame);
+      }
+    } else if (ctx.doWhileStatement()) {
+      const loop = ctx.doWhileStatement()!;
+      do {
+        this.execBlock(loop.block(), frame);
+      } while (this.isTrue(loop.expression(), frame));
+    } else if (ctx.forStatement()) {
+      this.execFor(ctx.forStatement()!, frame);
+    } else if (ctx.foreverStatement()) {
+      for (;;) {
+        this.execBlock(ctx.foreverStatement()!.block(), frame);
+        this.countStep();
+      }
+    } else if (ctx.switchStatement()) {
+      this.execSwitch(ctx.switchStatement()!, frame);
+    } else if (ctx.returnStatement()) {
+      const expr = ctx.returnStatement()!.expression();
+      if (frame.returnType === "void") {
+        throw new ReturnSignal(intValue(0n));
+      }
+      if (!expr) {
+        this.fail(`'${frame.name}' returns without a value`);
+      }
+      const type = INT_TYPES[frame.returnType];
+      const result = this.eval(expr, frame, type);
+      throw new ReturnSignal({ value: convert(result.value, type), type });
+    } else if (ctx.block()) {
+      this.execBlock(ctx.block()!, frame);
+    } else {
+      this.fail(`'${frame.name}' uses a critical section`);
+    }
+  }
+
+  private countStep(): void {
+    if (++this.steps > MAX_STEPS) {
+      this.fail(`did not finish within ${MAX_STEPS} statements`);
+    }
+  }
+
+  private execFor(ctx: Parser.ForStatementContext, frame: IFrame): void {
+    frame.blocks.push(new Map());
+    try {
+      const init = ctx.forInit();
+      if (init?.forVarDecl()) {
+        const decl = init.forVarDecl()!;
+        this.declareLocal(
+          decl.IDENTIFIER().getText(),
+          decl.type(),
+          decl.arrayDimension().length > 0,
+          decl.overflowModifier()?.getText(),
+          decl.expression(),
+          frame,
+        );
+      } else if (init?.forAssignment()) {
+        const assign = init.forAssignment()!;
+        this.assign(
+          assign.assignmentTarget(),
+          assign.assignmentOperator().getText(),
+          assign.expression(),
+          frame,
+        );
+      }
+      const condition = ctx.expression();
+      const update = ctx.forUpdate();
+      while (!condition || this.isTrue(condition, frame)) {
+        this.execStatement(ctx.statement(), frame);
+        if (update) {
+          this.assign(
+            update.assignmentTarget(),
+            update.assignmentOperator().getText(),
+            update.expression(),
+            frame,
+          );
+        }
+      }
+    } finally {
+      frame.blocks.pop();
+    }
+  }
+
+  private execSwitch(ctx: Parser.SwitchStatementContext, frame: IFrame): void {
+    const subject = this.eval(ctx.expression(), frame, null).value;
+    for (const switchCase of ctx.switchCase()) {
+      const labels = switchCase
+        .caseLabel()
+        .map((label) => this.caseLabelValue(label, frame));
+      if (labels.includes(subject)) {
+        this.execBlock(switchCase.block(), frame);
+        return;
+      }
+    }
+    const defaultCase = ctx.defaultCase();
+    if (defaultCase) {
+      this.execBlock(defaultCase.block(), frame);
+    }
+  }
+
+  private caseLabelValue(ctx: Parser.CaseLabelContext, frame: IFrame): bigint {
+    if (ctx.IDENTIFIER()) {
+      return this.readName(ctx.IDENTIFIER()!.getText(), frame).value;
+    }
+    const token =
+      ctx.INTEGER_LITERAL() ??
+      ctx.HEX_LITERAL() ??
+      ctx.BINARY_LITERAL() ??
+      ctx.CHAR_LITERAL();
+    if (!token) {
+      return this.fail(`case label '${ctx.getText()}' is not an integer`);
+    }
+    const value = this.literalValue(token.getText(), null).value;
+    return ctx.MINUS() ? -value : value;
+  }
+
+  private declare(ctx: Parser.VariableDeclarationContext, frame: IFrame): void {
+    this.declareLocal(
+      ctx.IDENTIFIER().getText(),
+      ctx.type(),
+      ctx.arrayDimension().length > 0,
+      ctx.overflowModifier()?.getText(),
+      ctx.expression(),
+      frame,
+    );
+  }
+
+  private declareLocal(
+    name: string,
+    typeCtx: Parser.TypeContext,
+    isArray: boolean,
+    overflow: string | undefined,
+    init: Parser.ExpressionContext | null,
+    frame: IFrame,
+  ): void {
+    if (isArray) {
+      this.fail(`local '${name}' in '${frame.name}' is an array`);
+    }
+    const cnxType = this.primitiveType(typeCtx, frame.name, `local '${name}'`);
+    const type = INT_TYPES[cnxType];
+    // Locals are zero-initialized
+    const value = init ? convert(this.eval(init, frame, type).value, type) : 0n;
+    frame.blocks.at(-1)!.set(name, {
+      value,
+      cnxType,
+      clamp: overflow !== "wrap",
+    });
+  }
+
+  private assign(
+    target: Parser.AssignmentTargetContext,
+    operator: string,
+    expr: Parser.ExpressionContext,
+    frame: IFrame,
+  ): void {
+    const name = target.IDENTIFIER().getText();
+    if (target.THIS() || target.GLOBAL()) {
+      this.fail(`'${frame.name}' assigns to '${target.getText()}'`);
+    }
+    const cell = this.findCell(name, frame);
+    if (!cell) {
+      return this.fail(`'${frame.name}' assigns to '${name}'`);
+    }
+    const type = INT_TYPES[cell.cnxType];
+    const ops = target.postfixTargetOp();
+    if (ops.length > 0) {
+      this.assignBits(cell, ops, operator, expr, frame);
+      return;
+    }
+    const rhs = this.eval(expr, frame, type);
+    if (operator === "<-") {
+      cell.value = convert(rhs.value, type);
+      return;
+    }
+    const op = COMPOUND_OPS[operator];
+    if (cell.clamp && type.bits > 1 && SATURATING_OPS.has(op)) {
+      cell.value = saturate(cell.value, op, rhs.value, cell.cnxType);
+      return;
+    }
+    const result = this.binary(op, { value: cell.value, type }, rhs);
+    cell.value = convert(result.value, type);
+  }
+
+  /**
+   * Bit writes: x[n] <- v and x[start, width] <- v.
+   */
+  private assignBits(
+    cell: ICell,
+    ops: Parser.PostfixTargetOpContext[],
+    operator: string,
+    expr: Parser.ExpressionContext,
+    frame: IFrame,
+  ): void {
+    const indices = ops[0].expression();
+    if (ops.length > 1 || indices.length === 0 || operator !== "<-") {
+      this.fail(`'${frame.name}' writes '${ops[0].parent!.getText()}'`);
+    }
+    const start = this.eval(indices[0], frame, null).value;
+    const width = indices[1] ? this.eval(indices[1], frame, null).value : 1n;
+    const type = INT_TYPES[cell.cnxType];
+    if (start < 0n || width < 1n || start + width > BigInt(type.bits)) {
+      this.fail(`bit range [${start}, ${width}] is outside ${cell.cnxType}`);
+    }
+    const mask = ((1n << width) - 1n) << start;
+    const bits = (this.eval(expr, frame, null).value << start) & mask;
+    cell.value = convert((cell.value & ~mask) | bits, type);
+  }
+
+  // ========================================================================
+  // Expressions
+  // ========================================================================
+
+  private isTrue(ctx: Parser.ExpressionContext, frame: IFrame): boolean {
+    return this.eval(ctx, frame, null).value !== 0n;
+  }
+
+  /**
+   * Evaluate an expression node.
+   *
+   * @param expected - Type of the receiving variable; unsuffixed literals in
+   *   an unsigned context are unsigned, as the generated U suffix makes them
+   */
+  private eval(
+    node: ParserRuleContext,
+    frame: IFrame,
+    expected: IIntType | null,
+  ): IValue {
+    if (node instanceof Parser.ExpressionContext) {
+      return this.eval(node.ternaryExpression(), frame, expected);
+    }
+    if (node instanceof Parser.TernaryExpressionContext) {
+      const parts = node.orExpression();
+      if (parts.length === 3) {
+        const condition = this.eval(parts[0], frame, null).value !== 0n;
+        return this.eval(condition ? parts[1] : parts[2], frame, expected);
+      }
+      return this.eval(parts[0], frame, expected);
+    }
+    if (
+      node instanceof Parser.OrExpressionContext ||
+      node instanceof Parser.AndExpressionContext
+    ) {
+      return this.logical(node, frame, expected);
+    }
+    if (node instanceof Parser.UnaryExpressionContext) {
+      return this.unary(node, frame, expected);
+    }
+    if (node instanceof Parser.PostfixExpressionContext) {
+      return this.postfix(node, frame, expected);
+    }
+    return this.chain(node, frame, expected);
+  }
+
+  private logical(
+    node: Parser.OrExpressionContext | Parser.AndExpressionContext,
+    frame: IFrame,
+    expected: IIntType | null,
+  ): IValue {
+    const operands = operandsOf(node);
+    if (operands.length === 1) {
+      return this.eval(operands[0], frame, expected);
+    }
+    const isOr = node instanceof Parser.OrExpressionContext;
+    for (const operand of operands) {
+      const isTrue = this.eval(operand, frame, null).value !== 0n;
+      if (isTrue === isOr) {
+        return intValue(isOr ? 1n : 0n);
+      }
+    }
+    return intValue(isOr ? 0n : 1n);
+  }
+
+  /**
+   * Left-associative binary chains (equality through multiplicative).
+   */
+  private chain(
+    node: ParserRuleContext,
+    frame: IFrame,
+    expected: IIntType | null,
+  ): IValue {
+    const count = node.getChildCount();
+    const isComparison =
+      node instanceof Parser.EqualityExpressionContext ||
+      node instanceof Parser.RelationalExpressionContext;
+    const operandExpected = isComparison || count === 1 ? null : expected;
+    let result = this.eval(
+      node.getChild(0) as ParserRuleContext,
+      frame,
+      count === 1 ? expected : operandExpected,
+    );
+    for (let i = 1; i < count; i += 2) {
+      const op = node.getChild(i)!.getText();
+      const isShift = op === "<<" || op === ">>";
+      const right = this.eval(
+        node.getChild(i + 1) as ParserRuleContext,
+        frame,
+        isShift ? null : operandExpected,
+      );
+      result = this.binary(op, result, right);
+    }
+    return result;
+  }
+
+  private binary(op: string, left: IValue, right: IValue): IValue {
+    if (op === "<<" || op === ">>") {
+      return this.shift(op, left, right);
+    }
+    const type = commonType(left.type, right.type);
+    const a = convert(left.value, type);
+    const b = convert(right.value, type);
+    switch (op) {
+      case "=":
+        return intValue(a === b ? 1n : 0n);
+      case "!=":
+        return intValue(a === b ? 0n : 1n);
+      case "<":
+        return intValue(a < b ? 1n : 0n);
+      case ">":
+        return intValue(a > b ? 1n : 0n);
+      case "<=":
+        return intValue(a <= b ? 1n : 0n);
+      case ">=":
+        return intValue(a >= b ? 1n : 0n);
+      case "/":
+      case "%":
+        if (b === 0n) {
+          this.fail("division by zero");
+        }
+        return this.checked(op === "/" ? a / b : a % b, type);
+      case "+":
+        return this.checked(a + b, type);
+      case "-":
+        return this.checked(a - b, type);
+      case "*":
+        return this.checked(a * b, type);
+      case "&":
+        return { value: a & b, type };
+      case "|":
+        return { value: a | b, type };
+      case "^":
+        return { value: convert(a ^ b, type), type };
+      default:
+        return this.fail(`operator '${op}' is not supported`);
+    }
+  }
+
+  private shift(op: string, left: IValue, right: IValue): IValue {
+    const type = promote(left.type);
+    const value = convert(left.value, type);
+    const count = right.value;
+    if (count < 0n || count >= BigInt(type.bits)) {
+      this.fail(`shift by ${count} is out of range for ${typeName(type)}`);
+    }
+    if (op === ">>") {
+      return { value: value >> count, type };
+    }
+    if (type.signed && value < 0n) {
+      this.fail(`left shift of negative value ${value}`);
+    }
+    return this.checked(value << count, type);
+  }
+
+  /**
+   * Unsigned results wrap; signed overflow is undefined in C and an error.
+   */
+  private checked(value: bigint, type: IIntType): IValue {
+    if (type.signed && !fits(value, type)) {
+      this.fail(`${value} overflows ${typeName(type)}`);
+    }
+    return { value: convert(value, type), type };
+  }
+
+  private unary(
+    ctx: Parser.UnaryExpressionContext,
+    frame: IFrame,
+    expected: IIntType | null,
+  ): IValue {
+    if (ctx.postfixExpression()) {
+      return this.postfix(ctx.postfixExpression()!, frame, expected);
+    }
+    const inner = ctx.unaryExpression()!;
+    if (ctx.NOT()) {
+      return intValue(this.eval(inner, frame, null).value === 0n ? 1n : 0n);
+    }
+    const operand = this.eval(inner, frame, expected);
+    const type = promote(operand.type);
+    if (ctx.MINUS()) {
+      return this.checked(-convert(operand.value, type), type);
+    }
+    if (ctx.BITNOT()) {
+      return { value: convert(~operand.value, type), type };
+    }
+    return this.fail(`'${ctx.getText()}' takes an address`);
+  }
+
+  private postfix(
+    ctx: Parser.PostfixExpressionContext,
+    frame: IFrame,
+    expected: IIntType | null,
+  ): IValue {
+    const primary = ctx.primaryExpression();
+    const ops = ctx.postfixOp();
+    let value: IValue;
+    let next = 0;
+
+    const callIndex = ops.findIndex((op) => op.LPAREN() !== null);
+    if (callIndex >= 0) {
+      const name = this.resolveName(primary, ops.slice(0, callIndex), frame);
+      const args = ops[callIndex].argumentList()?.expression() ?? [];
+      value = this.callWith(name, args, frame);
+      next = callIndex + 1;
+    } else if (primary.literal()) {
+      value = this.literalValue(primary.literal()!.getText(), expected);
+    } else if (primary.expression()) {
+      value = this.eval(primary.expression()!, frame, expected);
+    } else if (primary.castExpression()) {
+      const cast = primary.castExpression()!;
+      const cnxType = this.primitiveType(cast.type(), frame.name, "cast");
+      const type = INT_TYPES[cnxType];
+      const operand = this.eval(cast.unaryExpression(), frame, null);
+      value = { value: convert(operand.value, type), type };
+    } else {
+      const memberOps = ops.filter((op) => op.DOT() !== null);
+      next = memberOps.length;
+      if (ops.slice(0, next).some((op) => op.DOT() === null)) {
+        this.fail(`'${ctx.getText()}' is not an integer value`);
+      }
+      value = this.readName(this.resolveName(primary, memberOps, frame), frame);
+    }
+
+    for (const op of ops.slice(next)) {
+      value = this.bitRead(value, op, frame);
+    }
+    return value;
+  }
+
+  /**
+   * x[n] and x[start, width] on an integer value.
+   */
+  private bitRead(
+    value: IValue,
+    op: Parser.PostfixOpContext,
+    frame: IFrame,
+  ): IValue {
+    const indices = op.expression();
+    if (indices.length === 0) {
+      return this.fail(`'${op.getText()}' is not supported`);
+    }
+    const start = this.eval(indices[0], frame, null).value;
+    const width = indices[1] ? this.eval(indices[1], frame, null).value : 1n;
+    if (start < 0n || width < 1n || start + width > BigInt(value.type.bits)) {
+      this.fail(`bit range [${start}, ${width}] is outside the value`);
+    }
+    const type = promote(value.type);
+    const bits = (value.value >> start) & ((1n << width) - 1n);
+    return { value: bits, type };
+  }
+
+  /**
+   * Name of a variable, constant or function: x, this.x, global.x, Scope.x.
+   */
+  private resolveName(
+    primary: Parser.PrimaryExpressionContext,
+    members: Parser.PostfixOpContext[],
+    frame: IFrame,
+  ): string {
+    const member = members[0]?.IDENTIFIER()?.getText();
+    if (members.length === 0 && primary.IDENTIFIER()) {
+      return primary.IDENTIFIER()!.getText();
+    }
+    if (members.length === 1 && member) {
+      if (primary.THIS() && frame.scopeName) {
+        return `${frame.scopeName}_${member}`;
+      }
+      if (primary.GLOBAL()) {
+        return member;
+      }
+      if (primary.IDENTIFIER()) {
+        return `${primary.IDENTIFIER()!.getText()}_${member}`;
+      }
+    }
+    const text = primary.getText() + members.map((m) => m.getText()).join("");
+    return this.fail(`'${text}' is not supported`);
+  }
+
+  private callWith(
+    name: string,
+    args: Parser.ExpressionContext[],
+    frame: IFrame,
+  ): IValue {
+    const decl = ConstTableEvaluator.getFunction(name);
+    const params = decl.parameterList()?.parameter() ?? [];
+    const values = args.map((arg, i) => {
+      const identifier = simpleIdentifier(arg);
+      const cell = identifier ? this.findCell(identifier, frame) : undefined;
+      if (cell) {
+        return cell;
+      }
+      const paramType = params[i]?.type().primitiveType()?.getText();
+      return this.eval(arg, frame, paramType ? INT_TYPES[paramType] : null);
+    });
+    return this.call(name, values);
+  }
+
+  private readName(name: string, frame: IFrame): IValue {
+    const cell = this.findCell(name, frame);
+    if (cell) {
+      return { value: cell.value, type: INT_TYPES[cell.cnxType] };
+    }
+    const constant = CodeGenState.constValues.get(name);
+    if (constant === undefined || !Number.isInteger(constant)) {
+      return this.fail(`'${name}' is not a local, parameter or integer constant`);
+    }
+    const value = BigInt(constant);
+    const baseType = CodeGenState.getVariableTypeInfo(name)?.baseType;
+    const declared = baseType ? INT_TYPES[baseType] : undefined;
+    if (declared) {
+      return { value, type: declared };
+    }
+    return { value, type: fits(value, INT) ? INT : INT64 };
+  }
+
+  private findCell(name: string, frame: IFrame): ICell | undefined {
+    for (let i = frame.blocks.length - 1; i >= 0; i--) {
+      const cell = frame.blocks[i].get(name);
+      if (cell) {
+        return cell;
+      }
+    }
+    return undefined;
+  }
+
+  /**
+   * Integer literal with its C type.
+   */
+  private literalValue(text: string, expected: IIntType | null): IValue {
+    if (text === "true" || text === "false") {
+      return intValue(text === "true" ? 1n : 0n);
+    }
+    if (text.startsWith("'")) {
+      return intValue(BigInt(charCode(text)));
+    }
+    const match = /^(0[xXbB][0-9a-fA-F]+|\d+)(?:([uUiI])(8|16|32|64))?$/.exec(
+      text,
+    );
+    if (!match) {
+      return this.fail(`literal ${text} is not an integer`);
+    }
+    const value = BigInt(match[1]);
+    if (match[3] === "64") {
+      return { value, type: /[uU]/.test(match[2]) ? UINT64 : INT64 };
+    }
+    // The generated literal gets a U / ULL suffix in an unsigned context
+    if (expected && !expected.signed && expected.bits > 1) {
+      const type = expected.bits === 64 || !fits(value, UINT) ? UINT64 : UINT;
+      return { value, type };
+    }
+    const isDecimal = /^\d/.test(match[1]) && !/^0[xXbB]/.test(match[1]);
+    const candidates = isDecimal ? [INT, INT64] : [INT, UINT, INT64, UINT64];
+    const type = candidates.find((candidate) => fits(value, candidate));
+    if (!type) {
+      return this.fail(`literal ${text} does not fit a 64-bit integer`);
+    }
+    return { value, type };
+  }
+
+  private primitiveType(
+    ctx: Parser.TypeContext,
+    functionName: string,
+    what: string,
+  ): string {
+    const name = ctx.primitiveType()?.getText();
+    if (!name || !INT_TYPES[name]) {
+      return this.fail(
+        `${what} of '${functionName}' has type ${ctx.getText()}; only integer and bool types can be evaluated`,
+      );
+    }
+    return name;
+  }
+
+  private fail(message: string): never {
+    throw new Error(
+      `Error: Cannot evaluate table '${this.tableName}' at transpile time: ${message}`,
+    );
+  }
+}
+
+/**
+ * Operand children of a binary chain (every other child).
+ */
+function operandsOf(node: ParserRuleContext): ParserRuleContext[] {
+  const operands: ParserRuleContext[] = [];
+  for (let i = 0; i < node.getChildCount(); i += 2) {
+    operands.push(node.getChild(i) as ParserRuleContext);
+  }
+  return operands;
+}
+
+/**
+ * Name of an expression that is a bare identifier, or null.
+ */
+function simpleIdentifier(ctx: Parser.ExpressionContext): string | null {
+  const text = ctx.getText();
+  return /^[A-Za-z_]\w*$/.test(text) ? text : null;
+}
+
+const CHAR_ESCAPES: Record<string, number> = {
+  n: 10,
+  t: 9,
+  r: 13,
+  "0": 0,
+  "\\": 92,
+  "'": 39,
+  '"': 34,
+};
+
+function charCode(text: string): number {
+  const body = text.slice(1, -1);
+  if (body.startsWith("\\")) {
+    return CHAR_ESCAPES[body[1]] ?? body.codePointAt(1)!;
+  }
+  return body.codePointAt(0)!;
+}
+
+class ConstTableEvaluator {
+  /**
+   * Resolve the function named by a table generator `[fn*]`, or null if the
+   * fill value is not a function of this file.
+   */
+  static resolveGenerator(fillValue: Parser.ExpressionContext): string | null {
+    const text = fillValue.getText();
+    let key: string | null = null;
+    const member = /^(this|global|\w+)\.(\w+)$/.exec(text);
+    if (/^\w+$/.test(text)) {
+      key = text;
+    } else if (member?.[1] === "this") {
+      key = CodeGenState.currentScope
+        ? `${CodeGenState.currentScope}_${member[2]}`
+        : null;
+    } else if (member?.[1] === "global") {
+      key = member[2];
+    } else if (member) {
+      key = `${member[1]}_${member[2]}`;
+    }
+    return key && CodeGenState.functionDeclarations.has(key) ? key : null;
+  }
+
+  /**
+   * Evaluate fn(0) .. fn(count - 1) and format the results as C literals.
+   *
+   * @param functionName - Generator function (C name, Scope_fn for scopes)
+   * @param count - Table length
+   * @param elementType - C-Next integer element type
+   * @param tableName - Table name, for error messages
+   * @throws Error if the function cannot be evaluated or a result does not
+   *   fit the element type
+   */
+  static evaluateTable(
+    functionName: string,
+    count: number,
+    elementType: string,
+    tableName: string,
+  ): string[] {
+    const range = TYPE_RANGES[elementType];
+    const decl = ConstTableEvaluator.getFunction(functionName);
+    const params = decl.parameterList()?.parameter();
+    const indexType = params?.[0]?.type().primitiveType()?.getText() ?? "";
+    const indexRange = TYPE_RANGES[indexType];
+    if (decl.type().VOID()) {
+      throw new Error(
+        `Error: Table generator '${functionName}' for '${tableName}' must return an integer`,
+      );
+    }
+    if (params?.length !== 1 || !indexRange || indexRange[1] < count - 1) {
+      throw new Error(
+        `Error: Table generator '${functionName}' for '${tableName}' must take one integer index parameter that holds ${count - 1}`,
+      );
+    }
+    const evaluation = new Evaluation(tableName);
+    const values: string[] = [];
+    for (let i = 0; i < count; i++) {
+      const index: IValue = { value: BigInt(i), type: UINT };
+      const result = evaluation.call(functionName, [index]).value;
+      if (result < range[0] || result > range[1]) {
+        throw new Error(
+          `Error: ${functionName}(${i}) = ${result} does not fit ${elementType} table '${tableName}'`,
+        );
+      }
+      values.push(ConstTableEvaluator.formatValue(result, elementType));
+    }
+    return values;
+  }
+
+  /**
+   * Brace initializer for evaluated values, eight per line for long tables.
+   */
+  static formatTable(values: string[]): string {
+    if (values.length <= VALUES_PER_LINE) {
+      return `{${values.join(", ")}}`;
+    }
+    const lines: string[] = [];
+    for (let i = 0; i < values.length; i += VALUES_PER_LINE) {
+      const row = values.slice(i, i + VALUES_PER_LINE).join(", ");
+      const comma = i + VALUES_PER_LINE < values.length ? "," : "";
+      lines.push(`${FormatUtils.indent(1)}${row}${comma}`);
+    }
+    return ["{", ...lines, "}"].join("\n");
+  }
+
+  /**
+   * C literal for a table element: hex with U/ULL for unsigned types,
+   * decimal (LL for i64) for signed ones.
+   */
+  static formatValue(value: bigint, elementType: string): string {
+    const type = INT_TYPES[elementType];
+    if (!type.signed) {
+      const digits = value
+        .toString(16)
+        .toUpperCase()
+        .padStart(type.bits / 4, "0");
+      return `0x${digits}${type.bits === 64 ? "ULL" : "U"}`;
+    }
+    const suffix = type.bits === 64 ? "LL" : "";
+    if (value === TYPE_RANGES[elementType][0] && type.bits >= 32) {
+      // -2147483648 is a negated long in C; spell the minimum as max - 1
+      return `(-${-value - 1n}${suffix} - 1${suffix})`;
+    }
+    return `${value}${suffix}`;
+  }
+
+  /**
+   * Declaration of a function of this file.
+   */
+  static getFunction(name: string): Parser.FunctionDeclarationContext {
+    const decl = CodeGenState.functionDeclarations.get(name);
+    if (!decl) {
+      throw new Error(
+        `Error: Cannot evaluate '${name}' at transpile time: only functions declared in this file can be evaluated`,
+      );
+    }
+    return decl;
+  }
+
+  /**
+   * Scope a function is declared in, or null at top level.
+   */
+  static getScopeName(decl: Parser.FunctionDeclarationContext): string | null {
+    const scope = decl.parent?.parent;
+    return scope instanceof Parser.ScopeDeclarationContext
+      ? scope.IDENTIFIER().getText()
+      : null;
+  }
+}
+
+export default ConstTableEvaluator;
@@ -0,0 +1,218 @@
+/**
+ * ConstantDivisorHelper
+ *
+ * Lowers safe_div/safe_mod/safe_divmod with a constant, non-zero divisor to
+ * plain arithmetic (strengthReduce option, ADR-051). The divisor-zero check
+ * of the cnx_safe_* helpers cannot fail, so a call used as a statement is
+ * replaced by the assignment it would perform:
+ *
+ *   safe_mod(slot, head + 1, 64, 0);   ->  slot = (head + 1) & 0x3FU;
+ *   safe_div(blocks, count, 16, 0);    ->  blocks = count >> 4;
+ *   safe_div(avg, total, 10, 0);       ->  avg = total / 10U;
+ *   safe_divmod(q, r, n, 8, 0);        ->  q = n >> 3;
+ *                                          r = n & 0x7U;
+ *
+ * A call whose error flag is used keeps the helper: returning `false` next
+ * to the assignment would need the comma operator (MISRA C:2012 Rule 12.3).
+ * So does a safe_divmod whose quotient output is read by the numerator, as
+ * the remainder would see the overwritten value.
+ *
+ * Signed power-of-two divisors must round toward zero like C division. An
+ * arithmetic right shift would round toward negative infinity, and shifting
+ * a negative value is implementation-defined in C (E0805 rejects it in
+ * C-Next), so negative dividends are shifted and masked as a magnitude:
+ *
+ *   safe_div(q, x, 4, 0);  ->  q = (x < 0 ? -(int32_t)((0U - (uint32_t)x) >> 2)
+ *                                          : (int32_t)((uint32_t)x >> 2));
+ *
+ * The magnitude is taken in uint32_t (uint64_t for i64), so INT_MIN has one.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper";
+import TYPE_MAP from "../types/TYPE_MAP";
+import TYPE_WIDTH from "../types/TYPE_WIDTH";
+import SIGNED_TYPES from "../types/SIGNED_TYPES";
+import UNSIGNED_TYPES from "../types/UNSIGNED_TYPES";
+
+/** Generated operands that need no parentheses */
+const SIMPLE_OPERAND_PATTERN = /^[\w.]+$/;
+
+/** First C identifier of a generated lvalue, e.g. `q` in `(*q)` */
+const ROOT_IDENTIFIER_PATTERN = /[A-Za-z_]\w*/;
+
+/** Safe division built-ins */
+const SAFE_DIV_CALL_PATTERN = /^safe_(?:div|mod|divmod)$/;
+
+class ConstantDivisorHelper {
+  /**
+   * True if the divisor is a non-zero constant the output type can hold,
+   * i.e. the helper's check cannot fail and its result can be inlined.
+   * Negative divisors keep the helper.
+   */
+  static isInlineDivisor(divisor: number, cnxType: string): boolean {
+    if (!ConstantDivisorHelper.isIntegerType(cnxType)) {
+      return false;
+    }
+    if (!Number.isSafeInteger(divisor) || divisor < 1) {
+      return false;
+    }
+    return divisor <= ConstantDivisorHelper.maxValue(cnxType);
+  }
+
+  /**
+   * True if the lowering reads the numerator more than once, so the
+   * numerator must be free of function calls.
+   */
+  static readsNumeratorTwice(
+    operation: "div" | "mod" | "divmod",
+    divisor: number,
+    cnxType: string,
+  ): boolean {
+    return (
+      operation === "divmod" ||
+      ConstantDivisorHelper.isSignedPowerOfTwo(divisor, cnxType)
+    );
+  }
+
+  /**
+   * Numerator operand: converted to the output type (as the helper's
+   * parameter would) unless it already has it, parenthesized if compound.
+   * Callers must request the cast for any compound numerator: C promotes
+   * `head + 1` to int, so it only wraps in the output type after the cast.
+   */
+  static operand(code: string, cnxType: string, needsCast: boolean): string {
+    if (needsCast) {
+      return `(${TYPE_MAP[cnxType]})(${code})`;
+    }
+    return SIMPLE_OPERAND_PATTERN.test(code) ? code : `(${code})`;
+  }
+
+  /**
+   * True if the generated numerator reads the variable the generated
+   * quotient output writes (compared by root identifier, so `buf[i]` is
+   * taken to alias any use of `buf`).
+   */
+  static numeratorReads(numerator: string, quotient: string): boolean {
+    const root = ROOT_IDENTIFIER_PATTERN.exec(quotient)?.[0];
+    return (
+      root !== undefined && new RegExp(String.raw`\b${root}\b`).test(numerator)
+    );
+  }
+
+  /**
+   * Quotient of operand by divisor, truncated toward zero.
+   */
+  static quotient(operand: string, divisor: number, cnxType: string): string {
+    const shift = Math.log2(divisor);
+    if (ConstantDivisorHelper.isSignedPowerOfTwo(divisor, cnxType)) {
+      return ConstantDivisorHelper.signedMagnitude(
+        operand,
+        cnxType,
+        `>> ${shift}`,
+      );
+    }
+    if (ConstantDivisorHelper.isUnsigned(cnxType) && Number.isInteger(shift)) {
+      return `${operand} >> ${shift}`;
+    }
+    return `${operand} / ${ConstantDivisorHelper.literal(divisor, cnxType)}`;
+  }
+
+  /**
+   * Remainder of operand by divisor, with the sign of the operand.
+   */
+  static remainder(operand: string, divisor: number, cnxType: string): string {
+    const mask = ConstantDivisorHelper.mask(divisor, cnxType);
+    if (ConstantDivisorHelper.isSignedPowerOfTwo(divisor, cnxType)) {
+      return ConstantDivisorHelper.signedMagnitude(
+        operand,
+        cnxType,
+        `& ${mask}`,
+      );
+    }
+    if (
+      ConstantDivisorHelper.isUnsigned(cnxType) &&
+      Number.isInteger(Math.log2(divisor))
+    ) {
+      return `${operand} & ${mask}`;
+    }
+    return `${operand} % ${ConstantDivisorHelper.literal(divisor, cnxType)}`;
+  }
+
+  /**
+   * True if the expression is exactly one safe_div/safe_mod/safe_divmod
+   * call, i.e. used as a statement its error flag is discarded.
+   */
+  static isSafeDivCall(ctx: Parser.ExpressionContext): boolean {
+    const postfix = ExpressionUnwrapper.getPostfixExpression(ctx);
+    const name = postfix?.primaryExpression().IDENTIFIER()?.getText();
+    const ops = postfix?.postfixOp() ?? [];
+    return (
+      name !== undefined &&
+      SAFE_DIV_CALL_PATTERN.test(name) &&
+      ops.length === 1 &&
+      ops[0].LPAREN() !== null
+    );
+  }
+
+  /**
+   * Apply a shift or mask to |operand| and restore the operand's sign.
+   */
+  private static signedMagnitude(
+    operand: string,
+    cnxType: string,
+    operation: string,
+  ): string {
+    const cType = TYPE_MAP[cnxType];
+    const magnitudeType = TYPE_WIDTH[cnxType] === 64 ? "uint64_t" : "uint32_t";
+    const negative = `-(${cType})((0U - (${magnitudeType})${operand}) ${operation})`;
+    const positive = `(${cType})((${magnitudeType})${operand} ${operation})`;
+    return `(${operand} < 0 ? ${negative} : ${positive})`;
+  }
+
+  /**
+   * Signed divisors of 1 divide exactly; from 2 up the magnitude form is
+   * needed (and fits: the magnitude of INT_MIN shifted by 1 or more does).
+   */
+  private static isSignedPowerOfTwo(divisor: number, cnxType: string): boolean {
+    return (
+      !ConstantDivisorHelper.isUnsigned(cnxType) &&
+      divisor >= 2 &&
+      Number.isInteger(Math.log2(divisor))
+    );
+  }
+
+  /** divisor - 1 as a hex constant in the magnitude's unsigned type */
+  private static mask(divisor: number, cnxType: string): string {
+    const hex = (divisor - 1).toString(16).toUpperCase();
+    return `0x${hex}${TYPE_WIDTH[cnxType] === 64 ? "ULL" : "U"}`;
+  }
+
+  /** Divisor literal in the output type's signedness and width */
+  private static literal(divisor: number, cnxType: string): string {
+    const is64 = TYPE_WIDTH[cnxType] === 64;
+    if (ConstantDivisorHelper.isUnsigned(cnxType)) {
+      return `${divisor}${is64 ? "ULL" : "U"}`;
+    }
+    return `${divisor}${is64 ? "LL" : ""}`;
+  }
+
+  private static maxValue(cnxType: string): number {
+    const width = TYPE_WIDTH[cnxType];
+    const bits = ConstantDivisorHelper.isUnsigned(cnxType) ? width : width - 1;
+    return 2 ** bits - 1;
+  }
+
+  private static isUnsigned(cnxType: string): boolean {
+    return (UNSIGNED_TYPES as readonly string[]).includes(cnxType);
+  }
+
+  private static isIntegerType(cnxType: string): boolean {
+    return (
+      ConstantDivisorHelper.isUnsigned(cnxType) ||
+      (SIGNED_TYPES as readonly string[]).includes(cnxType)
+    );
+  }
+}
+
+export default ConstantDivisorHelper;
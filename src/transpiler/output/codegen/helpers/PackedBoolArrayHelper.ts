@@ -0,0 +1,297 @@
+/**
+ * PackedBoolArrayHelper
+ *
+ * Bit-packed storage for boolean arrays (packedBoolArrays option).
+ * A `bool[N]` array is stored as `uint32_t[(N + 31) / 32]`; element reads and
+ * writes lower to shift/mask code on the containing word, fills are
+ * emitted as whole-word initializers and `flags.any` ORs the storage words.
+ * Elements have no address, so they can only be passed to parameters the
+ * callee does not modify.
+ *
+ * Only one-dimensional arrays with a compile-time size are packed; struct
+ * fields, parameters and multi-dimensional arrays keep byte storage.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser.js";
+import ArrayInitializerUtils from "../../../logic/symbols/cnext/utils/ArrayInitializerUtils.js";
+import BitUtils from "../../../../utils/BitUtils.js";
+import ExpressionUtils from "../../../../utils/ExpressionUtils.js";
+import FormatUtils from "../../../../utils/FormatUtils.js";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper.js";
+import CodeGenState from "../../../state/CodeGenState.js";
+
+/** Bits per storage word */
+const WORD_BITS = 32;
+
+/** C type of a storage word */
+const WORD_TYPE = "uint32_t";
+
+/** Unsigned integer literal, optionally with MISRA U suffix */
+const CONST_INDEX_RE = /^\d+U?$/;
+
+/** Index code that is a plain variable or literal, cheap to repeat */
+const SIMPLE_INDEX_RE = /^\w+$/;
+
+/**
+ * A packed array, or one of its elements, used as a call argument
+ */
+interface IPackedArgument {
+  /** Argument as written */
+  text: string;
+  /** flags[i] rather than the whole array */
+  isElement: boolean;
+}
+
+class PackedBoolArrayHelper {
+  static readonly WORD_TYPE = WORD_TYPE;
+
+  /**
+   * Check whether an array qualifies for packed storage.
+   *
+   * @param baseType - C-Next element type
+   * @param dimensions - Array dimensions (numeric dimensions only)
+   * @param declaredDimCount - Number of dimensions written in the source
+   */
+  static isEligible(
+    baseType: string,
+    dimensions: readonly number[] | undefined,
+    declaredDimCount: number,
+  ): boolean {
+    return (
+      baseType === "bool" &&
+      declaredDimCount === 1 &&
+      dimensions?.length === 1 &&
+      dimensions[0] > 0
+    );
+  }
+
+  /**
+   * Number of storage words for a bit count.
+   */
+  static wordCount(bitCount: number): number {
+    return Math.ceil(bitCount / WORD_BITS);
+  }
+
+  /**
+   * Storage word holding element `index` (folded for constant indices).
+   */
+  static wordIndex(index: string): string {
+    if (CONST_INDEX_RE.test(index)) {
+      return `${Math.floor(Number.parseInt(index, 10) / WORD_BITS)}U`;
+    }
+    return `(${index}) >> 5U`;
+  }
+
+  /**
+   * Bit position of element `index` within its word.
+   */
+  static bitOffset(index: string): string {
+    if (CONST_INDEX_RE.test(index)) {
+      return `${Number.parseInt(index, 10) % WORD_BITS}U`;
+    }
+    return `((${index}) & 31U)`;
+  }
+
+  /**
+   * Generate a boolean read of `name[index]`.
+   */
+  static read(name: string, index: string): string {
+    const word = `${name}[${PackedBoolArrayHelper.wordIndex(index)}]`;
+    const offset = PackedBoolArrayHelper.bitOffset(index);
+    if (offset === "0U") {
+      return `((${word} & 1U) != 0U)`;
+    }
+    return `(((${word} >> ${offset}) & 1U) != 0U)`;
+  }
+
+  /**
+   * Generate a read-modify-write of `name[index] <- value`. The index is
+   * used four times, so any other index is evaluated once into a temporary.
+   */
+  static write(name: string, index: string, value: string): string {
+    if (SIMPLE_INDEX_RE.test(index)) {
+      return PackedBoolArrayHelper.writeBit(name, index, value);
+    }
+    const temp = `_cnx_tmp_${CodeGenState.tempVarCounter++}`;
+    const lines = [
+      `const ${WORD_TYPE} ${temp} = ${index};`,
+      PackedBoolArrayHelper.writeBit(name, temp, value),
+    ];
+    const inner = lines.map((line) => FormatUtils.indent(1) + line);
+    return ["{", ...inner, "}"].join("\n");
+  }
+
+  /**
+   * Reject a function call in the index of a packed element read, which
+   * uses the index twice and cannot declare a temporary.
+   */
+  static checkReadIndex(index: Parser.ExpressionContext, name: string): void {
+    if (ExpressionUtils.hasFunctionCall(index)) {
+      throw new Error(
+        `Error: Packed bool element '${name}[${index.getText()}]' cannot be read with a function call in its index. ` +
+          `Store the index in a local variable first.`,
+      );
+    }
+  }
+
+  /**
+   * Generate `flags.any` as one test of the ORed storage words. Bits past
+   * the last element are never set, so they cannot make it true.
+   */
+  static any(name: string, bitCount: number): string {
+    const words = Array.from(
+      { length: PackedBoolArrayHelper.wordCount(bitCount) },
+      (_, word) => `${name}[${word}U]`,
+    );
+    const ored = words.length === 1 ? words[0] : `(${words.join(" | ")})`;
+    return `(${ored} != 0U)`;
+  }
+
+  /**
+   * Find a packed array (`flags`, `this.flags`, `global.flags`) or one of
+   * its elements (`flags[i]`) passed as a call argument.
+   *
+   * @returns The argument, or null if it does not name packed storage
+   */
+  static findArgument(ctx: Parser.ExpressionContext): IPackedArgument | null {
+    if (!CodeGenState.packedBoolArrays) {
+      return null;
+    }
+    const postfix = ExpressionUnwrapper.getPostfixExpression(ctx);
+    if (!postfix) {
+      return null;
+    }
+    const primary = postfix.primaryExpression();
+    let ops = postfix.postfixOp();
+    let name: string | undefined;
+    if (primary.IDENTIFIER()) {
+      const id = primary.IDENTIFIER()!.getText();
+      name = CodeGenState.localVariables.has(id)
+        ? id
+        : CodeGenState.resolveIdentifier(id);
+    } else if (primary.THIS() && CodeGenState.currentScope) {
+      const member = ops[0]?.IDENTIFIER()?.getText();
+      name = member && `${CodeGenState.currentScope}_${member}`;
+      ops = ops.slice(1);
+    } else if (primary.GLOBAL()) {
+      name = ops[0]?.IDENTIFIER()?.getText();
+      ops = ops.slice(1);
+    }
+    if (!name || !CodeGenState.getVariableTypeInfo(name)?.isPackedBool) {
+      return null;
+    }
+    if (ops.length === 0) {
+      return { text: ctx.getText(), isElement: false };
+    }
+    const isElement = ops.length === 1 && ops[0].expression().length === 1;
+    return isElement ? { text: ctx.getText(), isElement: true } : null;
+  }
+
+  /**
+   * Generate the word initializer for a packed declaration.
+   * Handles zero-init (no initializer), fill-all `[v*]` and element lists.
+   *
+   * @param expression - Declaration initializer, or null
+   * @param bitCount - Declared element count
+   * @param generateExpression - Generates C for an element/fill expression
+   */
+  static generateInitializer(
+    expression: Parser.ExpressionContext | null,
+    bitCount: number,
+    generateExpression: (ctx: Parser.ExpressionContext) => string,
+  ): string {
+    if (!expression) {
+      return "{0}";
+    }
+    const arrayInit = ArrayInitializerUtils.findArrayInitializer(expression);
+    if (!arrayInit) {
+      throw new Error(
+        `Error: Packed bool arrays must be initialized with an array initializer`,
+      );
+    }
+
+    const fillExpr = arrayInit.expression();
+    if (fillExpr) {
+      return PackedBoolArrayHelper.fillWords(
+        generateExpression(fillExpr),
+        bitCount,
+      );
+    }
+
+    const elements = arrayInit.arrayInitializerElement();
+    if (elements.length !== bitCount) {
+      throw new Error(
+        `Error: Array size mismatch - declared [${bitCount}] but got ${elements.length} elements`,
+      );
+    }
+    return PackedBoolArrayHelper.packWords(
+      elements.map((elem) => {
+        const elemExpr = elem.expression();
+        if (!elemExpr) {
+          throw new Error(
+            `Error: Packed bool array elements must be boolean expressions`,
+          );
+        }
+        return generateExpression(elemExpr);
+      }),
+    );
+  }
+
+  /**
+   * Whole-word fill: every element set to `value`.
+   * Bits past the last element stay clear.
+   */
+  static fillWords(value: string, bitCount: number): string {
+    if (value === "false") {
+      return "{0}";
+    }
+    const words: string[] = [];
+    for (let first = 0; first < bitCount; first += WORD_BITS) {
+      const used = Math.min(WORD_BITS, bitCount - first);
+      const mask = PackedBoolArrayHelper.formatWord(
+        used === WORD_BITS ? 0xffffffff : 2 ** used - 1,
+      );
+      words.push(value === "true" ? mask : `((${value}) ? ${mask} : 0U)`);
+    }
+    return `{${words.join(", ")}}`;
+  }
+
+  /**
+   * Pack an element list into words. Literal true/false fold to constants;
+   * other elements contribute a shifted term.
+   */
+  static packWords(values: readonly string[]): string {
+    const words: string[] = [];
+    for (let first = 0; first < values.length; first += WORD_BITS) {
+      let constant = 0;
+      const terms: string[] = [];
+      const chunk = values.slice(first, first + WORD_BITS);
+      chunk.forEach((value, bit) => {
+        if (value === "true") {
+          constant += 2 ** bit;
+        } else if (value !== "false") {
+          terms.push(`(${BitUtils.boolToInt(value)} << ${bit}U)`);
+        }
+      });
+      if (constant !== 0 || terms.length === 0) {
+        terms.unshift(PackedBoolArrayHelper.formatWord(constant));
+      }
+      words.push(terms.join(" | "));
+    }
+    return `{${words.join(", ")}}`;
+  }
+
+  private static writeBit(name: string, index: string, value: string): string {
+    return BitUtils.singleBitWrite(
+      `${name}[${PackedBoolArrayHelper.wordIndex(index)}]`,
+      PackedBoolArrayHelper.bitOffset(index),
+      value,
+    );
+  }
+
+  private static formatWord(value: number): string {
+    return `0x${value.toString(16).toUpperCase().padStart(8, "0")}U`;
+  }
+}
+
+export default PackedBoolArrayHelper;
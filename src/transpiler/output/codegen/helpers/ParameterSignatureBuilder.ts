@@ -34,7 +34,7 @@ class ParameterSignatureBuilder {
       param.arrayDimensions &&
       param.arrayDimensions.length > 0
     ) {
-      return this._buildArrayParam(param);
+      return this._buildArrayParam(param, refSuffix);
     }
 
     // Pass-by-value parameters (ISR, float, enum, small primitives)
@@ -44,7 +44,7 @@ class ParameterSignatureBuilder {
 
     // Non-array string: string<N> -> const char* name
     if (param.isString && !param.isArray) {
-      return this._buildStringParam(param);
+      return this._buildStringParam(param, refSuffix);
     }
 
     // Issue #995: Opaque handles are always pass-by-reference with pointer syntax
@@ -68,10 +68,19 @@ class ParameterSignatureBuilder {
    * - u8[4][4] matrix -> const uint8_t matrix[4][4]
    * - string<32>[5] names -> const char names[5][33]
    * - string[5] names -> char* names[5] (unbounded string array)
+   * - restrict (C only): u8[16] dst -> uint8_t dst[restrict 16]
    */
-  private static _buildArrayParam(param: IParameterInput): string {
+  private static _buildArrayParam(
+    param: IParameterInput,
+    refSuffix: string,
+  ): string {
     const constPrefix = this._getConstPrefix(param);
-    const dims = param.arrayDimensions!.map((d) => `[${d}]`).join("");
+    const dimList = param.arrayDimensions!.map((d) => `[${d}]`);
+    // C99 array parameter qualifier; C++ has no equivalent syntax
+    if (param.isRestrict && refSuffix === "*") {
+      dimList[0] = `[restrict ${param.arrayDimensions![0]}]`;
+    }
+    const dims = dimList.join("");
 
     // Unbounded string arrays use char* (array of char pointers)
     if (param.isUnboundedString) {
@@ -100,9 +109,13 @@ class ParameterSignatureBuilder {
    * Build non-array string parameter signature.
    * string<N> -> const char* name (with auto-const if unmodified)
    */
-  private static _buildStringParam(param: IParameterInput): string {
+  private static _buildStringParam(
+    param: IParameterInput,
+    refSuffix: string,
+  ): string {
     const constPrefix = this._getConstPrefix(param);
-    return `${constPrefix}char* ${param.name}`;
+    const restrict = this._getRestrictQualifier(param, refSuffix);
+    return `${constPrefix}char* ${restrict}${param.name}`;
   }
 
   /**
@@ -123,7 +136,10 @@ class ParameterSignatureBuilder {
     // Issue #895/#995: Override refSuffix for callback-compatible or opaque handle params
     const actualSuffix =
       param.forcePointerSyntax || param.isOpaqueHandle ? "*" : refSuffix;
-    return `${constPrefix}${param.mappedType}${actualSuffix} ${param.name}`;
+    const restrict = param.isOpaqueHandle
+      ? ""
+      : this._getRestrictQualifier(param, refSuffix);
+    return `${constPrefix}${param.mappedType}${actualSuffix} ${restrict}${param.name}`;
   }
 
   /**
@@ -134,6 +150,20 @@ class ParameterSignatureBuilder {
     return `${constMod}${param.mappedType} ${param.name}`;
   }
 
+  /**
+   * restrict qualifier (with trailing space) for a pointer or reference:
+   * C99 restrict in C mode, the GCC/Clang __restrict__ extension in C++.
+   */
+  private static _getRestrictQualifier(
+    param: IParameterInput,
+    refSuffix: string,
+  ): string {
+    if (!param.isRestrict) {
+      return "";
+    }
+    return refSuffix === "&" ? "__restrict__ " : "restrict ";
+  }
+
   /**
    * Get const prefix combining explicit const, auto-const, and forced const.
    * Priority: forceConst > isConst > isAutoConst
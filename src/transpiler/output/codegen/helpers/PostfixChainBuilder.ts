@@ -6,6 +6,9 @@
  *
  * Extracted from CodeGenerator.doGenerateAssignmentTarget to reduce
  * cognitive complexity.
+ *
+ * Struct-of-arrays targets (soaStructs) move the element index behind the
+ * field: samples[i].x -> samples.x[i].
  */
 
 import IPostfixChainDeps from "../types/IPostfixChainDeps";
@@ -33,9 +36,19 @@ class PostfixChainBuilder {
     let result = baseResult;
     const identifierChain: string[] = [firstId];
     let isFirstOp = true;
+    let soaIndex: string | undefined;
 
     for (const op of operations) {
-      if (op.memberName) {
+      if (soaIndex !== undefined) {
+        if (!op.memberName) {
+          throw new Error(
+            `Error: Struct-of-arrays element '${result}[${soaIndex}]' can only be assigned by field or as a whole`,
+          );
+        }
+        result = `${result}.${op.memberName}[${soaIndex}]`;
+        identifierChain.push(op.memberName);
+        soaIndex = undefined;
+      } else if (op.memberName) {
         result = PostfixChainBuilder.processMemberAccess(
           result,
           op.memberName,
@@ -44,6 +57,11 @@ class PostfixChainBuilder {
           deps,
         );
         identifierChain.push(op.memberName);
+      } else if (
+        op.expressions.length === 1 &&
+        deps.isStructOfArrays?.(result)
+      ) {
+        soaIndex = deps.generateExpression(op.expressions[0]);
       } else {
         result = PostfixChainBuilder.processSubscript(
           result,
@@ -54,7 +72,8 @@ class PostfixChainBuilder {
       isFirstOp = false;
     }
 
-    return result;
+    // Whole element: keep array syntax (SOA_ELEMENT scatters the fields)
+    return soaIndex === undefined ? result : `${result}[${soaIndex}]`;
   }
 
   /**
@@ -0,0 +1,142 @@
+/**
+ * StructLayoutHelper
+ *
+ * Padding-minimizing field order and size assertions for C-Next structs
+ * (reorderStructs option, or per struct with reorderedStructs). Shared by
+ * StructGenerator and the header struct generator so that the .c/.cpp and
+ * .h/.hpp definitions always agree.
+ *
+ * reorderStructs covers private scope structs only; top-level and public
+ * scope structs are part of the C interface and need reorderedStructs.
+ *
+ * Only structs whose every field has a known layout are reordered, and only
+ * when the new order is smaller; structs holding external C types, callbacks
+ * or opaque handles keep declaration order and get no assertion.
+ */
+
+import TypeLayoutCalculator from "../analysis/TypeLayoutCalculator";
+import ICodeGenSymbols from "../../../types/ICodeGenSymbols";
+import IStructLayout from "../types/IStructLayout";
+import TLayoutSymbols from "../types/TLayoutSymbols";
+
+class StructLayoutHelper {
+  /**
+   * Select the structs of one file that are emitted in padding-minimizing
+   * order: the listed ones, plus with reorderStructs every private scope
+   * struct. Top-level and public scope structs are the file's C interface,
+   * so the project-wide option leaves them in declaration order.
+   *
+   * @param symbols - Symbols of the file
+   * @param reorderStructs - Project-wide reorderStructs option
+   * @param names - reorderedStructs entries (C-Next names, e.g. "Foo.Bar")
+   * @returns C names of the reordered structs
+   */
+  static selectReordered(
+    symbols: ICodeGenSymbols,
+    reorderStructs: boolean,
+    names: readonly string[],
+  ): Set<string> {
+    const selected = new Set(names.map((name) => name.replaceAll(".", "_")));
+    if (!reorderStructs) {
+      return selected;
+    }
+    for (const [scopeName, visibility] of symbols.scopeMemberVisibility) {
+      for (const [member, access] of visibility) {
+        const cName = `${scopeName}_${member}`;
+        if (access === "private" && symbols.knownStructs.has(cName)) {
+          selected.add(cName);
+        }
+      }
+    }
+    return selected;
+  }
+
+  /**
+   * Whether a struct is emitted in padding-minimizing order.
+   */
+  static isReordered(symbols: TLayoutSymbols, structName: string): boolean {
+    return symbols.reorderedStructs?.has(structName) ?? false;
+  }
+
+  /**
+   * Compute the emitted layout of a struct with reordering enabled.
+   *
+   * @param symbols - Struct, enum and bitmap symbol data
+   * @param structName - Struct to lay out
+   * @param wordSize - Target word size
+   * @param compactEnums - Compact enum storage setting
+   * @returns Layout in emission order, or null if any field is unknown
+   */
+  static getReorderedLayout(
+    symbols: TLayoutSymbols,
+    structName: string,
+    wordSize: 8 | 16 | 32,
+    compactEnums: boolean,
+  ): IStructLayout | null {
+    const calculator = new TypeLayoutCalculator(symbols, {
+      wordSize,
+      compactEnums,
+      reorderFields: true,
+    });
+    return calculator.getStructLayout(structName);
+  }
+
+  /**
+   * Order items by the field order of a layout.
+   * Items whose name is not in the layout keep their relative order at the end.
+   */
+  static orderByLayout<T>(
+    items: readonly T[],
+    getName: (item: T) => string,
+    layout: IStructLayout | null,
+  ): T[] {
+    if (!layout) {
+      return [...items];
+    }
+    const rank = new Map(layout.fields.map((f, i) => [f.name, i]));
+    const last = layout.fields.length;
+    return items
+      .map((item, index) => ({ item, index }))
+      .sort(
+        (a, b) =>
+          (rank.get(getName(a.item)) ?? last) -
+            (rank.get(getName(b.item)) ?? last) || a.index - b.index,
+      )
+      .map(({ item }) => item);
+  }
+
+  /**
+   * Generate a compile-time size check for a struct.
+   * Uses static_assert for C++ and _Static_assert for C11.
+   */
+  static generateSizeAssert(
+    structName: string,
+    size: number,
+    cppMode: boolean,
+  ): string {
+    const assertKeyword = cppMode ? "static_assert" : "_Static_assert";
+    return `${assertKeyword}(sizeof(${structName}) == ${size}, "${structName} size differs from the computed layout");`;
+  }
+
+  /**
+   * Generate a size check for a C header that may also be included from C++.
+   */
+  static generateHeaderSizeAssert(
+    structName: string,
+    size: number,
+    cppMode: boolean,
+  ): string[] {
+    if (cppMode) {
+      return [StructLayoutHelper.generateSizeAssert(structName, size, true)];
+    }
+    return [
+      "#ifdef __cplusplus",
+      StructLayoutHelper.generateSizeAssert(structName, size, true),
+      "#else",
+      StructLayoutHelper.generateSizeAssert(structName, size, false),
+      "#endif",
+    ];
+  }
+}
+
+export default StructLayoutHelper;
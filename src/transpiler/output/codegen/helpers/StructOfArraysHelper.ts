@@ -0,0 +1,289 @@
+/**
+ * StructOfArraysHelper
+ *
+ * Struct-of-arrays storage for arrays of C-Next structs (soaStructs option).
+ * `Sample[1024] samples` is stored as one anonymous struct holding an array
+ * per field, so `samples[i].x` lowers to `samples.x[i]` and a loop reading one
+ * field only pulls that field's cache lines.
+ *
+ * Only one-dimensional arrays with a compile-time size, no initializer and
+ * scalar (primitive or enum) fields are eligible. The storage has no C type
+ * that other translation units could name, so SoA arrays must not escape:
+ * top-level and public scope arrays are rejected, and neither the array nor a
+ * whole element may be passed to a function.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import ExpressionUnwrapper from "../../../../utils/ExpressionUnwrapper";
+import TYPE_MAP from "../types/TYPE_MAP";
+import StructLayoutHelper from "./StructLayoutHelper";
+
+/** C-Next primitive types allowed as SoA fields */
+const SCALAR_TYPES = new Set([
+  "u8",
+  "u16",
+  "u32",
+  "u64",
+  "i8",
+  "i16",
+  "i32",
+  "i64",
+  "f32",
+  "f64",
+  "bool",
+]);
+
+/** A function call anywhere in generated C (index must be side-effect free) */
+const CALL_RE = /[A-Za-z_]\w*\s*\(/;
+
+/** Plain C identifier (value can be read per field without a temporary) */
+const IDENTIFIER_RE = /^[A-Za-z_]\w*$/;
+
+/**
+ * One field of a SoA array: its name and C element type.
+ */
+interface ISoaField {
+  name: string;
+  cType: string;
+}
+
+class StructOfArraysHelper {
+  /**
+   * Check whether an array declaration asks for SoA storage.
+   *
+   * @param baseType - Element type as emitted in C
+   * @param declaredDimCount - Number of dimensions written in the source
+   */
+  static isCandidate(baseType: string, declaredDimCount: number): boolean {
+    return CodeGenState.soaStructs.has(baseType) && declaredDimCount === 1;
+  }
+
+  /**
+   * Validate a SoA array declaration. Throws if the array could escape to C
+   * or cannot be given per-field storage.
+   *
+   * @param name - Variable name as written in the source
+   * @param structName - Element struct type
+   * @param size - Element count, or undefined if not a compile-time constant
+   * @param isExported - True for top-level and public scope variables
+   * @param hasInitializer - True if the declaration has an initializer
+   */
+  static validateDeclaration(
+    name: string,
+    structName: string,
+    size: number | undefined,
+    isExported: boolean,
+    hasInitializer: boolean,
+  ): void {
+    if (size === undefined || size <= 0) {
+      throw new Error(
+        `Error: Struct-of-arrays array '${name}' needs a compile-time size`,
+      );
+    }
+    if (isExported) {
+      throw new Error(
+        `Error: Struct-of-arrays array '${name}' would be visible to C through the generated header. ` +
+          `Declare it as a private scope member or a local variable.`,
+      );
+    }
+    if (hasInitializer) {
+      throw new Error(
+        `Error: Struct-of-arrays array '${name}' cannot have an initializer. ` +
+          `It is zero-initialized; assign elements after the declaration.`,
+      );
+    }
+    StructOfArraysHelper.getFields(structName);
+  }
+
+  /**
+   * Get the fields of a SoA struct in declaration order.
+   * Throws for structs that are not C-Next structs or have non-scalar fields.
+   */
+  static getFields(structName: string): ISoaField[] {
+    const fields = CodeGenState.symbols?.structFields.get(structName);
+    if (!fields) {
+      throw new Error(
+        `Error: soaStructs entry '${structName}' is not a C-Next struct`,
+      );
+    }
+    const result: ISoaField[] = [];
+    for (const [name, type] of fields) {
+      if (CodeGenState.getMemberTypeInfo(structName, name)?.isArray) {
+        throw new Error(
+          `Error: Struct-of-arrays storage for '${structName}' does not support array field '${name}'`,
+        );
+      }
+      if (SCALAR_TYPES.has(type)) {
+        result.push({ name, cType: TYPE_MAP[type] });
+      } else if (CodeGenState.isKnownEnum(type)) {
+        result.push({ name, cType: type });
+      } else {
+        throw new Error(
+          `Error: Struct-of-arrays storage for '${structName}' does not support field '${name}' of type '${type}'. ` +
+            `Only primitive and enum fields can be split into arrays.`,
+        );
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Generate a SoA declaration with zero initialization.
+   * Example: `Sample[1024] samples` ->
+   *   struct {
+   *       float x[1024];
+   *       float y[1024];
+   *   } samples = {0};
+   *
+   * @param prefix - Storage/qualifier prefix (e.g. "static ")
+   * @param structName - Element struct type
+   * @param name - C variable name
+   * @param count - Element count
+   */
+  static generateDecl(
+    prefix: string,
+    structName: string,
+    name: string,
+    count: number,
+  ): string {
+    const lines = [`${prefix}struct {`];
+    for (const field of StructOfArraysHelper.getFields(structName)) {
+      lines.push(`    ${field.cType} ${field.name}[${count}];`);
+    }
+    const zeroInit = CodeGenState.cppMode ? "{}" : "{0}";
+    lines.push(`} ${name} = ${zeroInit};`);
+    return lines.join("\n");
+  }
+
+  /**
+   * Generate access to one field of an element: `base.field[index]`.
+   */
+  static fieldElement(
+    structName: string,
+    base: string,
+    fieldName: string,
+    index: string,
+  ): string {
+    if (!CodeGenState.symbols?.structFields.get(structName)?.has(fieldName)) {
+      throw new Error(
+        `Error: Struct '${structName}' has no field '${fieldName}'`,
+      );
+    }
+    return `${base}.${fieldName}[${index}]`;
+  }
+
+  /**
+   * Generate a whole-element read as a struct value gathered from every field.
+   * Example: `(Sample){ .x = samples.x[i], .y = samples.y[i] }`
+   */
+  static gatherElement(
+    structName: string,
+    base: string,
+    index: string,
+  ): string {
+    StructOfArraysHelper.validateRepeatableIndex(base, index);
+    const fieldInits = StructOfArraysHelper.getEmittedFields(structName).map(
+      (f) => `.${f.name} = ${base}.${f.name}[${index}]`,
+    );
+    const initializer = `{ ${fieldInits.join(", ")} }`;
+    if (CodeGenState.inDeclarationInit) {
+      return initializer;
+    }
+    return `(${structName})${initializer}`;
+  }
+
+  /**
+   * Generate a whole-element write that scatters a struct value into every
+   * field array. A value that is not a plain identifier is evaluated once
+   * into a temporary first.
+   */
+  static scatterElement(
+    structName: string,
+    base: string,
+    index: string,
+    value: string,
+  ): string {
+    StructOfArraysHelper.validateRepeatableIndex(base, index);
+    const writes: string[] = [];
+    let source = value;
+    if (!IDENTIFIER_RE.test(value)) {
+      source = CodeGenState.getNextTempVarName();
+      writes.push(`const ${structName} ${source} = ${value};`);
+    }
+    for (const field of StructOfArraysHelper.getFields(structName)) {
+      writes.push(`${base}.${field.name}[${index}] = ${source}.${field.name};`);
+    }
+    return writes.join("\n");
+  }
+
+  /**
+   * Find a SoA array, or a whole element of one, used as a call argument.
+   * Returns the source text of the escaping expression, or null.
+   */
+  static findEscapingArgument(ctx: Parser.ExpressionContext): string | null {
+    if (CodeGenState.soaStructs.size === 0) {
+      return null;
+    }
+    const postfix = ExpressionUnwrapper.getPostfixExpression(ctx);
+    if (!postfix) {
+      return null;
+    }
+    const primary = postfix.primaryExpression();
+    let ops = postfix.postfixOp();
+    let name: string | undefined;
+    if (primary.IDENTIFIER()) {
+      const id = primary.IDENTIFIER()!.getText();
+      name = CodeGenState.localVariables.has(id)
+        ? id
+        : CodeGenState.resolveIdentifier(id);
+    } else if (primary.THIS() && CodeGenState.currentScope) {
+      const member = ops[0]?.IDENTIFIER()?.getText();
+      name = member && `${CodeGenState.currentScope}_${member}`;
+      ops = ops.slice(1);
+    }
+    if (!name || !CodeGenState.getVariableTypeInfo(name)?.isStructOfArrays) {
+      return null;
+    }
+    const isWholeArray = ops.length === 0;
+    const isWholeElement = ops.length === 1 && ops[0].expression().length === 1;
+    return isWholeArray || isWholeElement ? ctx.getText() : null;
+  }
+
+  /**
+   * Fields in emitted struct order. C++ designated initializers must follow
+   * member declaration order, which reordering may change.
+   */
+  private static getEmittedFields(structName: string): ISoaField[] {
+    const fields = StructOfArraysHelper.getFields(structName);
+    if (
+      !CodeGenState.cppMode ||
+      !CodeGenState.symbols ||
+      !StructLayoutHelper.isReordered(CodeGenState.symbols, structName)
+    ) {
+      return fields;
+    }
+    const layout = StructLayoutHelper.getReorderedLayout(
+      CodeGenState.symbols,
+      structName,
+      CodeGenState.targetCapabilities.wordSize,
+      CodeGenState.compactEnums,
+    );
+    return StructLayoutHelper.orderByLayout(fields, (f) => f.name, layout);
+  }
+
+  /**
+   * Whole-element copies read the index once per field, so it must not
+   * contain a function call.
+   */
+  private static validateRepeatableIndex(base: string, index: string): void {
+    if (CALL_RE.test(index)) {
+      throw new Error(
+        `Error: Whole-element access to struct-of-arrays array '${base}' needs an index without function calls. ` +
+          `Store the index in a local variable first.`,
+      );
+    }
+  }
+}
+
+export default StructOfArraysHelper;
@@ -0,0 +1,410 @@
+/**
+ * SwitchTableHelper
+ *
+ * Lowers value-mapping switches to a lookup table (switchTables option).
+ * A switch qualifies when every case body is one statement assigning a
+ * constant to the same variable (or returning a constant) and the case
+ * labels cover a dense integer range:
+ *
+ *   switch (code) {
+ *       case 1 { result <- 10; }  case 2 { result <- 20; }
+ *       case 3 { result <- 30; }  default { result <- 99; }
+ *   }
+ *
+ * becomes
+ *
+ *   {
+ *       static const uint32_t _cnx_table_0[3] = {10U, 20U, 30U};
+ *       const uint32_t _cnx_key_0 = (uint32_t)(code) - 1U;
+ *       if (_cnx_key_0 < 3U) {
+ *           result = _cnx_table_0[_cnx_key_0];
+ *       } else {
+ *           result = 99U;
+ *       }
+ *   }
+ *
+ * The key is converted to unsigned (static_cast in C++ mode) before the
+ * lowest label is subtracted, so one comparison rejects keys on both sides
+ * of the range. Keys inside the range without a case take the default's
+ * constant; keys outside it run the default body. Switches with such gaps need a constant default.
+ */
+
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import TypeCheckUtils from "../../../../utils/TypeCheckUtils";
+import TYPE_MAP from "../types/TYPE_MAP";
+import IGeneratorInput from "../generators/IGeneratorInput";
+import IGeneratorOutput from "../generators/IGeneratorOutput";
+import IOrchestrator from "../generators/IOrchestrator";
+import ConstTableEvaluator from "./ConstTableEvaluator";
+import CppModeHelper from "./CppModeHelper";
+
+/** Fewest case labels worth a table (fewer compare just as cheaply) */
+const MIN_LABELS = 3;
+
+/** A table may have at most one gap entry per case label */
+const MAX_SPAN_PER_LABEL = 2;
+
+/** C-Next source literals usable as table values */
+const LITERAL_PATTERN =
+  /^-?(?:0[xX][\da-fA-F]+|0[bB][01]+|\d+(?:\.\d+)?(?:[eE][+-]?\d+)?)(?:[uif]\d+)?$|^(?:true|false)$|^'(?:[^'\\]|\\.)'$/;
+
+/** Generated C constants: literals and enum members */
+const C_CONSTANT_PATTERN = /^-?[\w.']+$/;
+
+/** Generated `target = value;` */
+const ASSIGNMENT_PATTERN = /^([A-Za-z_]\w*) = (.+);$/;
+
+/** Generated `return value;` */
+const RETURN_PATTERN = /^return (.+);$/;
+
+/** Character escapes allowed in char literal case labels */
+const CHAR_ESCAPES: Record<string, number> = {
+  "\\0": 0,
+  "\\t": 9,
+  "\\n": 10,
+  "\\r": 13,
+  "\\\\": 92,
+  "\\'": 39,
+};
+
+/**
+ * One statement per case: the constant written by the case
+ */
+interface ICaseValue {
+  /** Generated C statement */
+  code: string;
+  /** Assigned variable (C name), or null for a return */
+  target: string | null;
+  /** Generated C constant */
+  value: string;
+}
+
+class SwitchTableHelper {
+  /**
+   * Lower a switch to a lookup table, or return null when it does not
+   * qualify and must be generated as a C switch.
+   *
+   * @param node - The switch statement
+   * @param exprCode - Generated switch expression
+   * @param switchEnumType - Enum type of the switch expression, if any
+   */
+  static tryGenerate(
+    node: Parser.SwitchStatementContext,
+    exprCode: string,
+    switchEnumType: string | null,
+    input: IGeneratorInput,
+    orchestrator: IOrchestrator,
+  ): IGeneratorOutput | null {
+    const keys = SwitchTableHelper._collectKeys(node, switchEnumType, input);
+    if (!keys) {
+      return null;
+    }
+    const min = keys.reduce((a, [key]) => (key < a ? key : a), keys[0][0]);
+    const max = keys.reduce((a, [key]) => (key > a ? key : a), keys[0][0]);
+    const span = Number(max - min) + 1;
+    if (keys.length < MIN_LABELS || span > keys.length * MAX_SPAN_PER_LABEL) {
+      return null;
+    }
+
+    const defaultCtx = node.defaultCase();
+    const defaultStmt = defaultCtx
+      ? SwitchTableHelper._getConstantStatement(defaultCtx.block(), input)
+      : null;
+    if (span > keys.length && !defaultStmt) {
+      return null;
+    }
+
+    // Pre-checks passed: generating constant statements has no side effects
+    // beyond what the C switch would have, so a late fallback is safe
+    const cases = new Map<Parser.SwitchCaseContext, ICaseValue>();
+    for (const caseCtx of node.switchCase()) {
+      const stmt = caseCtx.block().statement(0)!;
+      const value = SwitchTableHelper._generateCaseValue(stmt, orchestrator);
+      if (!value) {
+        return null;
+      }
+      cases.set(caseCtx, value);
+    }
+    const defaultValue = defaultStmt
+      ? SwitchTableHelper._generateCaseValue(defaultStmt, orchestrator)
+      : null;
+    if (defaultStmt && !defaultValue) {
+      return null;
+    }
+    const all = [...cases.values()];
+    if (defaultValue) {
+      all.push(defaultValue);
+    }
+    const first = all[0];
+    if (all.some((value) => value.target !== first.target)) {
+      return null;
+    }
+    const elementType = SwitchTableHelper._getElementType(
+      first.target,
+      input,
+      orchestrator,
+    );
+    if (!elementType) {
+      return null;
+    }
+
+    const values = new Array<string>(span).fill(defaultValue?.value ?? "0");
+    for (const [key, caseCtx] of keys) {
+      values[Number(key - min)] = cases.get(caseCtx)!.value;
+    }
+
+    const keyType = orchestrator.getExpressionType(node.expression()) ?? "";
+    return {
+      code: SwitchTableHelper._generateLookup(
+        exprCode,
+        /^[ui]64$/.test(keyType),
+        min,
+        values,
+        elementType,
+        first.target,
+        defaultCtx,
+        defaultValue,
+        orchestrator,
+      ),
+      effects: [{ type: "include", header: "stdint" }],
+    };
+  }
+
+  /**
+   * Resolve every case label to its key, or null if a label is not an
+   * integer constant or a case body is not one constant statement.
+   */
+  private static _collectKeys(
+    node: Parser.SwitchStatementContext,
+    switchEnumType: string | null,
+    input: IGeneratorInput,
+  ): [bigint, Parser.SwitchCaseContext][] | null {
+    const keys: [bigint, Parser.SwitchCaseContext][] = [];
+    const seen = new Set<bigint>();
+    for (const caseCtx of node.switchCase()) {
+      if (!SwitchTableHelper._getConstantStatement(caseCtx.block(), input)) {
+        return null;
+      }
+      for (const label of caseCtx.caseLabel()) {
+        const key = SwitchTableHelper.resolveLabelValue(
+          label,
+          switchEnumType,
+          input,
+        );
+        if (key === null || seen.has(key)) {
+          return null;
+        }
+        seen.add(key);
+        keys.push([key, caseCtx]);
+      }
+    }
+    return keys.length > 0 ? keys : null;
+  }
+
+  /**
+   * Value of a case label: integer and char literals, enum members and
+   * integer constants. Returns null for anything else.
+   */
+  static resolveLabelValue(
+    label: Parser.CaseLabelContext,
+    switchEnumType: string | null,
+    input: IGeneratorInput,
+  ): bigint | null {
+    const qualified = label.qualifiedType();
+    if (qualified) {
+      const parts = qualified.IDENTIFIER().map((id) => id.getText());
+      const member = parts.pop()!;
+      return SwitchTableHelper._enumValue(parts.join("_"), member, input);
+    }
+
+    const id = label.IDENTIFIER()?.getText();
+    if (id) {
+      if (switchEnumType) {
+        return SwitchTableHelper._enumValue(switchEnumType, id, input);
+      }
+      const value = input.constValues.get(id);
+      return Number.isInteger(value) ? BigInt(value!) : null;
+    }
+
+    const char = label.CHAR_LITERAL()?.getText();
+    if (char) {
+      const body = char.slice(1, -1);
+      if (body.length === 1) {
+        return BigInt(body.codePointAt(0)!);
+      }
+      return body in CHAR_ESCAPES ? BigInt(CHAR_ESCAPES[body]) : null;
+    }
+
+    const digits =
+      label.INTEGER_LITERAL() ?? label.HEX_LITERAL() ?? label.BINARY_LITERAL();
+    if (!digits) {
+      return null;
+    }
+    const value = BigInt(digits.getText());
+    return label.children?.[0]?.getText() === "-" ? -value : value;
+  }
+
+  /**
+   * Value of an enum member, or null if unknown
+   */
+  private static _enumValue(
+    enumName: string,
+    member: string,
+    input: IGeneratorInput,
+  ): bigint | null {
+    const value = input.symbols?.enumMembers.get(enumName)?.get(member);
+    return value === undefined ? null : BigInt(value);
+  }
+
+  /**
+   * The single statement of a block when it is `target <- constant;` or
+   * `return constant;`, else null.
+   */
+  private static _getConstantStatement(
+    block: Parser.BlockContext,
+    input: IGeneratorInput,
+  ): Parser.StatementContext | null {
+    const statements = block.statement();
+    if (statements.length !== 1) {
+      return null;
+    }
+    const stmt = statements[0];
+    const assign = stmt.assignmentStatement();
+    const value =
+      assign?.assignmentOperator().getText() === "<-"
+        ? assign.expression()
+        : stmt.returnStatement()?.expression();
+    if (!value) {
+      return null;
+    }
+    return SwitchTableHelper._isConstant(value.getText(), input) ? stmt : null;
+  }
+
+  /**
+   * A literal or a qualified enum member (Color.RED, Motor.State.IDLE)
+   */
+  private static _isConstant(text: string, input: IGeneratorInput): boolean {
+    if (LITERAL_PATTERN.test(text)) {
+      return true;
+    }
+    const parts = text.split(".");
+    if (parts.length < 2) {
+      return false;
+    }
+    const member = parts.pop()!;
+    return (
+      SwitchTableHelper._enumValue(parts.join("_"), member, input) !== null
+    );
+  }
+
+  /**
+   * Generate a case statement and split it into target and value
+   */
+  private static _generateCaseValue(
+    stmt: Parser.StatementContext,
+    orchestrator: IOrchestrator,
+  ): ICaseValue | null {
+    const code = orchestrator.generateStatement(stmt);
+    const assign = ASSIGNMENT_PATTERN.exec(code);
+    const target = assign ? assign[1] : null;
+    const value = assign ? assign[2] : RETURN_PATTERN.exec(code)?.[1];
+    if (!value || !C_CONSTANT_PATTERN.test(value)) {
+      return null;
+    }
+    return { code, target, value };
+  }
+
+  /**
+   * C element type: the assigned variable's type or the return type.
+   * Only scalar integer, float, bool and enum values are tabulated.
+   */
+  private static _getElementType(
+    target: string | null,
+    input: IGeneratorInput,
+    orchestrator: IOrchestrator,
+  ): string | null {
+    let typeName: string | null;
+    if (target === null) {
+      typeName = orchestrator.getCurrentFunctionReturnType();
+    } else {
+      const info = input.typeRegistry.get(target);
+      typeName = info && !info.isArray ? info.baseType : null;
+    }
+    if (!typeName) {
+      return null;
+    }
+    if (input.symbols?.knownEnums.has(typeName)) {
+      return typeName;
+    }
+    const isScalar =
+      TypeCheckUtils.isInteger(typeName) ||
+      TypeCheckUtils.isFloat(typeName) ||
+      typeName === "bool";
+    return isScalar ? TYPE_MAP[typeName] : null;
+  }
+
+  /**
+   * Emit the table, the bounds-checked lookup and the default path
+   */
+  private static _generateLookup(
+    exprCode: string,
+    wideKey: boolean,
+    min: bigint,
+    values: string[],
+    elementType: string,
+    target: string | null,
+    defaultCtx: Parser.DefaultCaseContext | null,
+    defaultValue: ICaseValue | null,
+    orchestrator: IOrchestrator,
+  ): string {
+    const id = CodeGenState.tempVarCounter++;
+    const table = `_cnx_table_${id}`;
+    const key = `_cnx_key_${id}`;
+    const keyType = wideKey ? "uint64_t" : "uint32_t";
+    const suffix = wideKey ? "ULL" : "U";
+    const offset = SwitchTableHelper._formatOffset(min, suffix);
+    // The C cast binds tighter than the switch expression, so wrap it there
+    const keyExpr = CppModeHelper.isCppMode()
+      ? CppModeHelper.cast(keyType, exprCode)
+      : CppModeHelper.cast(keyType, `(${exprCode})`);
+    const lookup = `${table}[${key}]`;
+    const hit = target === null ? `return ${lookup};` : `${target} = ${lookup};`;
+
+    const inner = (text: string) => orchestrator.indent(text);
+    const nested = (text: string) => inner(inner(text));
+    const lines = [
+      "{",
+      inner(
+        `static const ${elementType} ${table}[${values.length}] = ${ConstTableEvaluator.formatTable(values)};`,
+      ),
+      inner(`const ${keyType} ${key} = ${keyExpr}${offset};`),
+      inner(`if (${key} < ${values.length}${suffix}) {`),
+      nested(hit),
+    ];
+
+    const defaultLines = defaultValue
+      ? [defaultValue.code]
+      : (defaultCtx?.block().statement() ?? []).map((stmt) =>
+          orchestrator.generateStatement(stmt),
+        );
+    const defaultCode = defaultLines.filter((line) => line);
+    if (defaultCode.length > 0) {
+      lines.push(inner("} else {"), ...defaultCode.map(nested));
+    }
+    lines.push(inner("}"), "}");
+    return lines.join("\n");
+  }
+
+  /**
+   * Subtract the lowest label in unsigned arithmetic
+   */
+  private static _formatOffset(min: bigint, suffix: string): string {
+    if (min === 0n) {
+      return "";
+    }
+    return min < 0n ? ` + ${-min}${suffix}` : ` - ${min}${suffix}`;
+  }
+}
+
+export default SwitchTableHelper;
@@ -10,6 +10,7 @@
 import * as Parser from "../../../logic/parser/grammar/CNextParser.js";
 import TYPE_MAP from "../types/TYPE_MAP.js";
 import TIncludeHeader from "../generators/TIncludeHeader.js";
+import FixedPointUtils from "../../../../utils/FixedPointUtils.js";
 
 /**
  * Result of generating a primitive type.
@@ -124,6 +125,12 @@ class TypeGenerationHelper {
       return "char*";
     }
 
+    // Q types are stored as plain integers (q15 -> int16_t)
+    const fixedPoint = FixedPointUtils.parse(typeName);
+    if (fixedPoint) {
+      return fixedPoint.cType;
+    }
+
     if (needsStructKeyword) {
       return `struct ${typeName}`;
     }
@@ -149,6 +156,10 @@ class TypeGenerationHelper {
     }
 
     if (userTypeName) {
+      const fixedPoint = FixedPointUtils.parse(userTypeName);
+      if (fixedPoint) {
+        return fixedPoint.cType;
+      }
       if (needsStructKeyword) {
         return `struct ${userTypeName}`;
       }
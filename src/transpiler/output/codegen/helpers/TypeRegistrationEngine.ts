@@ -15,6 +15,10 @@ import CodeGenState from "../../../state/CodeGenState";
 import TypeRegistrationUtils from "../TypeRegistrationUtils";
 import QualifiedNameGenerator from "../utils/QualifiedNameGenerator";
 import ArrayDimensionParser from "./ArrayDimensionParser";
+import PackedBoolArrayHelper from "./PackedBoolArrayHelper";
+import StructOfArraysHelper from "./StructOfArraysHelper";
+import ScopeUtils from "../../../../utils/ScopeUtils";
+import ArrayInitializerUtils from "../../../logic/symbols/cnext/utils/ArrayInitializerUtils";
 
 /**
  * Callbacks required for type registration.
@@ -68,7 +72,8 @@ class TypeRegistrationEngine {
     varDecl: Parser.VariableDeclarationContext,
     callbacks: ITypeRegistrationCallbacks,
   ): void {
-    TypeRegistrationEngine._trackVariableType(varDecl, callbacks);
+    // Top-level variables are always exported through the header
+    TypeRegistrationEngine._trackVariableType(varDecl, callbacks, true);
     if (varDecl.constModifier() && varDecl.expression()) {
       const constName = varDecl.IDENTIFIER().getText();
       const constValue = callbacks.tryEvaluateConstant(varDecl.expression()!);
@@ -94,10 +99,14 @@ class TypeRegistrationEngine {
         const varDecl = member.variableDeclaration()!;
         const varName = varDecl.IDENTIFIER().getText();
         const fullName = QualifiedNameGenerator.forMember(scopeName, varName);
+        const visibility =
+          member.visibilityModifier()?.getText() ??
+          ScopeUtils.getDefaultVisibility(false);
         TypeRegistrationEngine._trackVariableTypeWithName(
           varDecl,
           fullName,
           callbacks,
+          visibility === "public",
         );
       }
     }
@@ -206,15 +215,22 @@ class TypeRegistrationEngine {
   private static _trackVariableType(
     varDecl: Parser.VariableDeclarationContext,
     callbacks: ITypeRegistrationCallbacks,
+    isExported: boolean = false,
   ): void {
     const name = varDecl.IDENTIFIER().getText();
-    TypeRegistrationEngine._trackVariableTypeWithName(varDecl, name, callbacks);
+    TypeRegistrationEngine._trackVariableTypeWithName(
+      varDecl,
+      name,
+      callbacks,
+      isExported,
+    );
   }
 
   private static _trackVariableTypeWithName(
     varDecl: Parser.VariableDeclarationContext,
     registryName: string,
     callbacks: ITypeRegistrationCallbacks,
+    isExported: boolean = false,
   ): void {
     const typeCtx = varDecl.type();
     const arrayDim = varDecl.arrayDimension();
@@ -249,6 +265,13 @@ class TypeRegistrationEngine {
         overflowBehavior,
         isAtomic,
         callbacks,
+        varDecl.expression(),
+      );
+      TypeRegistrationEngine._markStructOfArrays(
+        varDecl,
+        registryName,
+        callbacks,
+        isExported,
       );
       return;
     }
@@ -398,6 +421,7 @@ class TypeRegistrationEngine {
     overflowBehavior: TOverflowBehavior,
     isAtomic: boolean,
     callbacks: ITypeRegistrationCallbacks,
+    initExpr: Parser.ExpressionContext | null = null,
   ): void {
     // Issue #1029: Handle string arrays (string<N>[M]) - must check before primitiveType/userType
     if (arrayTypeCtx.stringType()) {
@@ -442,6 +466,27 @@ class TypeRegistrationEngine {
       callbacks,
     );
 
+    const packedBitCount = TypeRegistrationEngine._getPackedBoolBitCount(
+      typeInfo.baseType,
+      arrayTypeCtx,
+      arrayDim,
+      initExpr,
+      callbacks,
+    );
+    if (packedBitCount !== undefined) {
+      CodeGenState.setVariableTypeInfo(registryName, {
+        baseType: typeInfo.baseType,
+        bitWidth: typeInfo.bitWidth,
+        isArray: true,
+        arrayDimensions: [packedBitCount],
+        isConst,
+        overflowBehavior,
+        isAtomic,
+        isPackedBool: true,
+      });
+      return;
+    }
+
     CodeGenState.setVariableTypeInfo(registryName, {
       baseType: typeInfo.baseType,
       bitWidth: typeInfo.bitWidth,
@@ -453,6 +498,73 @@ class TypeRegistrationEngine {
     });
   }
 
+  /**
+   * Element count of a bool array stored bit-packed (packedBoolArrays),
+   * or undefined if the array keeps byte storage. Sizes are resolved the
+   * same way as VariableCollector so headers and cross-file users agree.
+   */
+  private static _getPackedBoolBitCount(
+    baseType: string,
+    arrayTypeCtx: Parser.ArrayTypeContext,
+    arrayDim: Parser.ArrayDimensionContext[] | null,
+    initExpr: Parser.ExpressionContext | null,
+    callbacks: ITypeRegistrationCallbacks,
+  ): number | undefined {
+    const typeDims = arrayTypeCtx.arrayTypeDimension();
+    const declaredDimCount = typeDims.length + (arrayDim?.length ?? 0);
+    if (!CodeGenState.packedBoolArrays || typeDims.length !== 1) {
+      return undefined;
+    }
+    const sizeExpr = typeDims[0].expression();
+    const size = sizeExpr
+      ? callbacks.tryEvaluateConstant(sizeExpr)
+      : initExpr && ArrayInitializerUtils.getInferredSize(initExpr);
+    if (size === undefined || size === null) {
+      return undefined;
+    }
+    return PackedBoolArrayHelper.isEligible(baseType, [size], declaredDimCount)
+      ? size
+      : undefined;
+  }
+
+  /**
+   * Switch an eligible struct array to struct-of-arrays storage (soaStructs).
+   * Throws if the array cannot use it (see StructOfArraysHelper).
+   */
+  private static _markStructOfArrays(
+    varDecl: Parser.VariableDeclarationContext,
+    registryName: string,
+    callbacks: ITypeRegistrationCallbacks,
+    isExported: boolean,
+  ): void {
+    const typeInfo = CodeGenState.getVariableTypeInfo(registryName);
+    const arrayTypeCtx = varDecl.type().arrayType()!;
+    const typeDims = arrayTypeCtx.arrayTypeDimension();
+    const declaredDimCount =
+      typeDims.length + (varDecl.arrayDimension()?.length ?? 0);
+    if (
+      !typeInfo ||
+      !StructOfArraysHelper.isCandidate(typeInfo.baseType, declaredDimCount)
+    ) {
+      return;
+    }
+
+    const sizeExpr = typeDims[0].expression();
+    const size = sizeExpr ? callbacks.tryEvaluateConstant(sizeExpr) : undefined;
+    StructOfArraysHelper.validateDeclaration(
+      varDecl.IDENTIFIER().getText(),
+      typeInfo.baseType,
+      size,
+      isExported,
+      varDecl.expression() !== null,
+    );
+    CodeGenState.setVariableTypeInfo(registryName, {
+      ...typeInfo,
+      arrayDimensions: [size!],
+      isStructOfArrays: true,
+    });
+  }
+
   /**
    * Extract base type and bit width from an array type context.
    * Handles primitive, qualified, scoped, and user types.
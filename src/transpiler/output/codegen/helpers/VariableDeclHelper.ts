@@ -22,6 +22,8 @@ import CppModeHelper from "./CppModeHelper.js";
 import EnumAssignmentValidator from "./EnumAssignmentValidator.js";
 import IntegerLiteralValidator from "./IntegerLiteralValidator.js";
 import NarrowingCastHelper from "./NarrowingCastHelper.js";
+import PackedBoolArrayHelper from "./PackedBoolArrayHelper.js";
+import StructOfArraysHelper from "./StructOfArraysHelper.js";
 import StringDeclHelper from "./StringDeclHelper.js";
 import VariableModifierBuilder from "./VariableModifierBuilder.js";
 import TYPE_MAP from "../types/TYPE_MAP.js";
@@ -653,6 +655,29 @@ class VariableDeclHelper {
 
     // Build base declaration
     const modifierPrefix = VariableModifierBuilder.toPrefix(modifiers);
+
+    // Packed bool arrays: word storage with whole-word initializers
+    const typeInfo = CodeGenState.getVariableTypeInfo(name);
+    if (typeInfo?.isPackedBool) {
+      return VariableDeclHelper.generatePackedBoolDecl(
+        ctx,
+        `${modifierPrefix}${PackedBoolArrayHelper.WORD_TYPE} ${name}`,
+        typeInfo.arrayDimensions![0],
+        callbacks.generateExpression,
+      );
+    }
+
+    // Struct-of-arrays: one array per field, zero-initialized
+    if (typeInfo?.isStructOfArrays) {
+      CodeGenState.localArrays.add(name);
+      return StructOfArraysHelper.generateDecl(
+        modifierPrefix,
+        typeInfo.baseType,
+        name,
+        typeInfo.arrayDimensions![0],
+      );
+    }
+
     let decl = `${modifierPrefix}${type} ${name}`;
 
     // Handle array declarations - early return if array init handled
@@ -693,6 +718,36 @@ class VariableDeclHelper {
     });
   }
 
+  /**
+   * Generate a packed bool array declaration (packedBoolArrays).
+   * Example: `bool[40] flags <- [true*]` ->
+   * `uint32_t flags[2] = {0xFFFFFFFFU, 0x000000FFU};`
+   *
+   * @param ctx - Variable declaration context
+   * @param decl - Declaration prefix with word type and name
+   * @param bitCount - Declared element count
+   * @param generateExpression - Generates C for initializer elements
+   * @returns Complete declaration code
+   */
+  static generatePackedBoolDecl(
+    ctx: Parser.VariableDeclarationContext,
+    decl: string,
+    bitCount: number,
+    generateExpression: (ctx: Parser.ExpressionContext) => string,
+  ): string {
+    CodeGenState.requireStdint();
+    CodeGenState.localArrays.add(ctx.IDENTIFIER().getText());
+    const words = PackedBoolArrayHelper.wordCount(bitCount);
+    const init = CodeGenState.withExpectedType("bool", () =>
+      PackedBoolArrayHelper.generateInitializer(
+        ctx.expression(),
+        bitCount,
+        generateExpression,
+      ),
+    );
+    return `${decl}[${words}] = ${init};`;
+  }
+
   /**
    * Generate C++ constructor-style declaration.
    * Validates that all arguments are const variables.
@@ -0,0 +1,409 @@
+/**
+ * VectorTableHelper - ADR-106 static interrupt vector tables
+ *
+ * With the staticVectors option a register declaration with ISR members is
+ * a vector table: slot = offset / 4, so IRQ n of a Cortex-M table sits at
+ * offset (16 + n) * 4. Instead of volatile slots written at startup the
+ * file gets one const table in the .isr_vector section:
+ *
+ *   register VectorTable @ 0x08000000 {
+ *       SysTick: ISR rw @ 0x3C,
+ *       IRQ: ISR[240] rw @ 0x40,
+ *   }
+ *   VectorTable.SysTick <- tick;      // bound at transpile time
+ *   VectorTable.IRQ[20] <- uartRx;    // 20 checked against ISR[240]
+ *
+ * Bindings must name a void() function of this file and may appear in any
+ * function; the assignment itself generates no code. Binding one slot to
+ * two handlers is an error. Bound handlers are defined with CNX_ISR
+ * (interrupt attribute on Cortex-M, word alignment, optional isrSection).
+ */
+
+import { ParseTreeWalker } from "antlr4ng";
+import { CNextListener } from "../../../logic/parser/grammar/CNextListener";
+import * as Parser from "../../../logic/parser/grammar/CNextParser";
+import CodeGenState from "../../../state/CodeGenState";
+import ArrayDimensionParser from "./ArrayDimensionParser";
+import IVectorTable from "../types/IVectorTable";
+
+/** Linker section of the generated tables */
+const VECTOR_SECTION = ".isr_vector";
+
+/** Cortex-M VTOR needs the table aligned to a power of two >= 128 bytes */
+const MIN_TABLE_ALIGNMENT = 128;
+
+/** Unbound slots packed per line */
+const SLOTS_PER_LINE = 8;
+
+/**
+ * A resolved vector binding statement
+ */
+interface IVectorBinding {
+  table: IVectorTable;
+  slot: number;
+  handler: string;
+  target: string;
+}
+
+class BindingCollector extends CNextListener {
+  override enterAssignmentStatement = (
+    ctx: Parser.AssignmentStatementContext,
+  ): void => {
+    const binding = VectorTableHelper.resolveBinding(ctx);
+    if (binding) {
+      VectorTableHelper.bind(binding);
+    }
+  };
+}
+
+class VectorTableHelper {
+  /**
+   * Find the vector tables of a file and collect their bindings.
+   * Runs before declarations are generated so handlers get CNX_ISR.
+   */
+  static collect(tree: Parser.ProgramContext): void {
+    for (const decl of tree.declaration()) {
+      const registerDecl = decl.registerDeclaration();
+      const table = registerDecl
+        ? VectorTableHelper._buildTable(registerDecl)
+        : null;
+      if (table) {
+        CodeGenState.vectorTables.set(table.name, table);
+      }
+    }
+    if (CodeGenState.vectorTables.size === 0) {
+      return;
+    }
+    CodeGenState.requireISR();
+    ParseTreeWalker.DEFAULT.walk(new BindingCollector(), tree);
+  }
+
+  /**
+   * Resolve `R.M <- fn` / `R.M[i] <- fn` on a vector table ISR member.
+   * Returns null for any other assignment.
+   */
+  static resolveBinding(
+    ctx: Parser.AssignmentStatementContext,
+  ): IVectorBinding | null {
+    const target = ctx.assignmentTarget();
+    const table = CodeGenState.vectorTables.get(target.IDENTIFIER().getText());
+    const ops = target.postfixTargetOp();
+    const memberName = ops[0]?.IDENTIFIER()?.getText();
+    const member = memberName ? table?.members.get(memberName) : undefined;
+    if (!table || !member) {
+      return null;
+    }
+    const label = `${table.name}.${memberName}`;
+    if (ctx.assignmentOperator().getText() !== "<-") {
+      throw new Error(`Error: vector ${label} can only be bound with <-`);
+    }
+
+    let slot = member.slot;
+    let boundTarget = label;
+    if (member.count === null) {
+      if (ops.length !== 1) {
+        throw new Error(`Error: vector ${label} is a single ISR slot`);
+      }
+    } else {
+      const index = VectorTableHelper._getIndex(ops, label);
+      if (index < 0 || index >= member.count) {
+        throw new Error(
+          `Error: IRQ ${index} is outside ${label}[${member.count}]`,
+        );
+      }
+      slot += index;
+      boundTarget = `${label}[${index}]`;
+    }
+
+    const handler = VectorTableHelper._resolveHandler(ctx, boundTarget);
+    return { table, slot, handler, target: boundTarget };
+  }
+
+  /**
+   * Record a binding; a slot may only ever get one handler.
+   */
+  static bind(binding: IVectorBinding): void {
+    const { table, slot, handler, target } = binding;
+    const existing = table.bindings.get(slot);
+    if (existing && existing.handler !== handler) {
+      throw new Error(
+        `Error: vector ${target} is bound to both '${existing.handler}' and '${handler}'`,
+      );
+    }
+    table.bindings.set(slot, { handler, target });
+    CodeGenState.isrHandlers.add(handler);
+  }
+
+  /**
+   * The binding statement itself: the table entry replaces the write.
+   */
+  static tryGenerateBinding(
+    ctx: Parser.AssignmentStatementContext,
+  ): string | null {
+    if (CodeGenState.vectorTables.size === 0) {
+      return null;
+    }
+    const binding = VectorTableHelper.resolveBinding(ctx);
+    if (!binding) {
+      return null;
+    }
+    return `/* ${binding.target} <- ${binding.handler}: static vector table entry */`;
+  }
+
+  /**
+   * Register declarations of a vector table: the array, and read access to
+   * its ISR members (ISR[N] members as a pointer to their first slot).
+   */
+  static generateDeclaration(table: IVectorTable): string[] {
+    const lines = [`extern const ISR ${table.name}[${table.length}];`];
+    for (const [member, { slot, count }] of table.members) {
+      const slotRef = `${table.name}[${slot}]`;
+      lines.push(
+        count === null
+          ? `#define ${table.name}_${member} (${slotRef})`
+          : `#define ${table.name}_${member} (&${slotRef})`,
+      );
+    }
+    return lines;
+  }
+
+  /**
+   * Whether a register member (C name) is an ISR[N] slot range of a vector
+   * table, so `R.M[i]` reads a slot instead of a bit.
+   */
+  static isSlotRange(cName: string): boolean {
+    for (const table of CodeGenState.vectorTables.values()) {
+      for (const [member, { count }] of table.members) {
+        if (count !== null && `${table.name}_${member}` === cName) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Attribute macro for a handler definition (C name), with trailing space
+   */
+  static getHandlerAttribute(cName: string): string {
+    return CodeGenState.isrHandlers.has(cName) ? "CNX_ISR " : "";
+  }
+
+  /**
+   * CNX_VECTORS / CNX_ISR definitions, emitted once per file with tables.
+   */
+  static generateMacros(): string[] {
+    const section = CodeGenState.isrSection
+      ? `, section("${CodeGenState.isrSection}")`
+      : "";
+    return [
+      "/* ADR-106: Static vector tables and interrupt handler attributes */",
+      "#ifndef CNX_ISR",
+      "#if defined(__GNUC__) || defined(__clang__)",
+      `#define CNX_VECTORS(align) __attribute__((section("${VECTOR_SECTION}"), used, aligned(align)))`,
+      "#if defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M'",
+      `#define CNX_ISR __attribute__((interrupt("IRQ"), aligned(4)${section}))`,
+      "#else",
+      `#define CNX_ISR __attribute__((aligned(4)${section}))`,
+      "#endif",
+      "#else",
+      "#define CNX_VECTORS(align)",
+      "#define CNX_ISR",
+      "#endif",
+      "#endif",
+      "",
+    ];
+  }
+
+  /**
+   * The const tables, emitted after every handler definition.
+   */
+  static generateTables(): string[] {
+    const lines: string[] = [];
+    for (const table of CodeGenState.vectorTables.values()) {
+      lines.push(
+        "",
+        `/* ADR-106: ${table.name} @ ${table.baseAddress}, placed by the linker script */`,
+        `CNX_VECTORS(${VectorTableHelper._getAlignment(table)})`,
+        `const ISR ${table.name}[${table.length}] = {`,
+        ...VectorTableHelper._generateEntries(table),
+        "};",
+      );
+    }
+    return lines;
+  }
+
+  /**
+   * Table for a register with ISR members, or null
+   */
+  private static _buildTable(
+    register: Parser.RegisterDeclarationContext,
+  ): IVectorTable | null {
+    const name = register.IDENTIFIER().getText();
+    const members = new Map<string, { slot: number; count: number | null }>();
+    const owners = new Map<number, string>();
+    let length = 0;
+
+    for (const member of register.registerMember()) {
+      const count = VectorTableHelper._getIsrCount(member, name);
+      if (count === undefined) {
+        continue;
+      }
+      const memberName = member.IDENTIFIER().getText();
+      const label = `${name}.${memberName}`;
+      const offset = VectorTableHelper._evaluate(member.expression());
+      if (offset === undefined || offset < 0 || offset % 4 !== 0) {
+        throw new Error(
+          `Error: vector ${label} offset '${member.expression().getText()}' must be a constant multiple of 4`,
+        );
+      }
+      const slot = offset / 4;
+      for (let i = slot; i < slot + (count ?? 1); i++) {
+        const owner = owners.get(i);
+        if (owner) {
+          throw new Error(
+            `Error: vectors ${owner} and ${label} share slot ${i} of ${name}`,
+          );
+        }
+        owners.set(i, label);
+      }
+      members.set(memberName, { slot, count });
+      length = Math.max(length, slot + (count ?? 1));
+    }
+
+    if (members.size === 0) {
+      return null;
+    }
+    return {
+      name,
+      baseAddress: register.expression().getText(),
+      length,
+      members,
+      bindings: new Map(),
+    };
+  }
+
+  /**
+   * null for an ISR member, N for ISR[N], undefined for other types
+   */
+  private static _getIsrCount(
+    member: Parser.RegisterMemberContext,
+    registerName: string,
+  ): number | null | undefined {
+    const type = member.type();
+    if (type.primitiveType()?.getText() === "ISR") {
+      return null;
+    }
+    const arrayType = type.arrayType();
+    if (arrayType?.primitiveType()?.getText() !== "ISR") {
+      return undefined;
+    }
+    const dims = arrayType.arrayTypeDimension();
+    const dimExpr = dims.length === 1 ? dims[0].expression() : null;
+    const count = dimExpr ? VectorTableHelper._evaluate(dimExpr) : undefined;
+    if (count === undefined || count <= 0) {
+      throw new Error(
+        `Error: vector ${registerName}.${member.IDENTIFIER().getText()} needs one constant size, as in ISR[240]`,
+      );
+    }
+    return count;
+  }
+
+  private static _getIndex(
+    ops: Parser.PostfixTargetOpContext[],
+    label: string,
+  ): number {
+    const indexExprs = ops.length === 2 ? ops[1].expression() : [];
+    const index =
+      indexExprs.length === 1
+        ? VectorTableHelper._evaluate(indexExprs[0])
+        : undefined;
+    if (index === undefined) {
+      throw new Error(
+        `Error: vector ${label} must be bound with a constant IRQ number, as in ${label}[20]`,
+      );
+    }
+    return index;
+  }
+
+  /**
+   * C name of the bound function; it must be a void() function of this file
+   */
+  private static _resolveHandler(
+    ctx: Parser.AssignmentStatementContext,
+    target: string,
+  ): string {
+    const text = ctx.expression().getText();
+    const scope = VectorTableHelper._getEnclosingScope(ctx);
+    let cName = text.replace(/^global\./, "");
+    if (cName.startsWith("this.") && scope) {
+      cName = `${scope}_${cName.slice("this.".length)}`;
+    }
+    cName = cName.replaceAll(".", "_");
+
+    const func = CodeGenState.functionDeclarations.get(cName);
+    const isVoid = func?.type()?.getText() === "void";
+    if (!func || !isVoid || func.parameterList()) {
+      throw new Error(
+        `Error: vector ${target} must be bound to a void() function of this file, got '${text}'`,
+      );
+    }
+    return cName;
+  }
+
+  private static _getEnclosingScope(
+    ctx: Parser.AssignmentStatementContext,
+  ): string | null {
+    let node: unknown = ctx.parent;
+    while (node) {
+      if (node instanceof Parser.ScopeDeclarationContext) {
+        return node.IDENTIFIER().getText();
+      }
+      node = (node as { parent?: unknown }).parent;
+    }
+    return null;
+  }
+
+  private static _evaluate(expr: Parser.ExpressionContext): number | undefined {
+    return ArrayDimensionParser.parseSingleDimension(expr, {
+      constValues: CodeGenState.constValues,
+    });
+  }
+
+  private static _getAlignment(table: IVectorTable): number {
+    let alignment = MIN_TABLE_ALIGNMENT;
+    while (alignment < table.length * 4) {
+      alignment *= 2;
+    }
+    return alignment;
+  }
+
+  /**
+   * Positional initializer (valid C and C++): bound handlers on their own
+   * line, unbound slots 0.
+   */
+  private static _generateEntries(table: IVectorTable): string[] {
+    const lines: string[] = [];
+    let zeros: string[] = [];
+    const flushZeros = (): void => {
+      for (let i = 0; i < zeros.length; i += SLOTS_PER_LINE) {
+        lines.push(`    ${zeros.slice(i, i + SLOTS_PER_LINE).join(" ")}`);
+      }
+      zeros = [];
+    };
+
+    for (let slot = 0; slot < table.length; slot++) {
+      const binding = table.bindings.get(slot);
+      if (!binding) {
+        zeros.push("0,");
+        continue;
+      }
+      flushZeros();
+      lines.push(`    ${binding.handler}, /* ${slot}: ${binding.target} */`);
+    }
+    flushZeros();
+    return lines;
+  }
+}
+
+export default VectorTableHelper;
@@ -0,0 +1,269 @@
+/**
+ * Unit tests for ArrayArithmeticHelper
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import ArrayArithmeticHelper from "../ArrayArithmeticHelper";
+import CNextSourceParser from "../../../../logic/parser/CNextSourceParser";
+import CodeGenState from "../../../../state/CodeGenState";
+import TTypeInfo from "../../types/TTypeInfo";
+
+const deps = {
+  generateUnaryExpr: (ctx: { getText(): string }) => ctx.getText(),
+  generateAssignmentTarget: (ctx: { getText(): string }) => ctx.getText(),
+};
+
+/**
+ * Parse one assignment statement inside a function body.
+ */
+function parseAssignment(statement: string) {
+  const { tree } = CNextSourceParser.parse(`void test() { ${statement} }`);
+  const block = tree.declaration(0)!.functionDeclaration()!.block();
+  return block.statement(0)!.assignmentStatement()!;
+}
+
+function registerArray(
+  name: string,
+  baseType: string,
+  length: number,
+  extra: Partial<TTypeInfo> = {},
+): void {
+  CodeGenState.setVariableTypeInfo(name, {
+    baseType,
+    bitWidth: 0,
+    isArray: true,
+    arrayDimensions: [length],
+    isConst: false,
+    ...extra,
+  });
+}
+
+function lower(statement: string): string | null {
+  return ArrayArithmeticHelper.tryGenerateAssignment(
+    parseAssignment(statement),
+    deps,
+  );
+}
+
+describe("ArrayArithmeticHelper", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+    registerArray("out", "f32", 64);
+    registerArray("a", "f32", 64);
+    registerArray("b", "f32", 64);
+  });
+
+  describe("tryGenerateAssignment", () => {
+    it("lowers array + array to a counted loop", () => {
+      expect(lower("out <- a + b;")).toBe(
+        [
+          "for (uint32_t _cnx_i = 0U; _cnx_i < 64U; _cnx_i++) {",
+          "    out[_cnx_i] = a[_cnx_i] + b[_cnx_i];",
+          "}",
+        ].join("\n"),
+      );
+      expect(CodeGenState.needsStdint).toBe(true);
+    });
+
+    it("keeps plain variable scalars inline", () => {
+      CodeGenState.setVariableTypeInfo("gain", {
+        baseType: "f32",
+        bitWidth: 32,
+        isArray: false,
+        isConst: false,
+      });
+      expect(lower("out <- gain * a;")).toContain(
+        "out[_cnx_i] = gain * a[_cnx_i];",
+      );
+    });
+
+    it("evaluates other scalars once before the loop", () => {
+      const code = lower("out <- a * b[0];")!;
+      expect(code).toContain("const float _cnx_tmp_0 = b[0];");
+      expect(code).toContain("out[_cnx_i] = a[_cnx_i] * _cnx_tmp_0;");
+      expect(code.startsWith("{\n")).toBe(true);
+    });
+
+    it("lowers compound float assignment in place", () => {
+      expect(lower("out +<- a;")).toContain("out[_cnx_i] += a[_cnx_i];");
+    });
+
+    it("does not saturate compound float assignment on clamp arrays", () => {
+      registerArray("acc", "f32", 64, { overflowBehavior: "clamp" });
+      expect(lower("acc +<- a;")).toContain("acc[_cnx_i] += a[_cnx_i];");
+    });
+
+    it("saturates compound assignment on clamp integer arrays", () => {
+      registerArray("counts", "u8", 8, { overflowBehavior: "clamp" });
+      registerArray("deltas", "u8", 8);
+      expect(lower("counts +<- deltas;")).toContain(
+        "counts[_cnx_i] = cnx_clamp_add_u8(counts[_cnx_i], deltas[_cnx_i]);",
+      );
+      expect(CodeGenState.usedClampOps.has("add_u8")).toBe(true);
+    });
+
+    it("keeps wrap semantics for element-wise integer arithmetic", () => {
+      registerArray("x", "i16", 8);
+      registerArray("y", "i16", 8);
+      registerArray("z", "i16", 8);
+      expect(lower("z <- x - y;")).toContain(
+        "z[_cnx_i] = x[_cnx_i] - y[_cnx_i];",
+      );
+    });
+
+    it("saturates Q type elements", () => {
+      registerArray("qa", "q15", 16);
+      registerArray("qb", "q15", 16);
+      registerArray("qo", "q15", 16);
+      expect(lower("qo <- qa * qb;")).toContain(
+        "qo[_cnx_i] = cnx_clamp_mul_q15(qa[_cnx_i], qb[_cnx_i]);",
+      );
+      expect(CodeGenState.usedClampOps.has("mul_q15")).toBe(true);
+    });
+
+    it("returns null when no operand is an array", () => {
+      expect(lower("out <- a[0] + b[1];")).toBeNull();
+      expect(lower("out <- a;")).toBeNull();
+    });
+
+    it("returns null for non-array targets", () => {
+      expect(lower("x <- a + b;")).toBeNull();
+    });
+
+    it("rejects mismatched lengths and element types", () => {
+      registerArray("short", "f32", 32);
+      registerArray("ints", "i32", 64);
+      expect(() => lower("out <- a + short;")).toThrow("different lengths");
+      expect(() => lower("out <- a + ints;")).toThrow(
+        "different element types",
+      );
+    });
+
+    it("rejects multi-dimensional arrays", () => {
+      CodeGenState.setVariableTypeInfo("grid", {
+        baseType: "f32",
+        bitWidth: 0,
+        isArray: true,
+        arrayDimensions: [8, 8],
+        isConst: false,
+      });
+      expect(() => lower("out <- a + grid;")).toThrow("one-dimensional");
+    });
+
+    it("rejects const targets", () => {
+      registerArray("table", "f32", 64, { isConst: true });
+      expect(() => lower("table <- a + b;")).toThrow("const variable");
+    });
+
+    describe("with cmsisDsp on a DSP target", () => {
+      beforeEach(() => {
+        CodeGenState.cmsisDsp = true;
+        CodeGenState.targetCapabilities = {
+          wordSize: 32,
+          hasLdrexStrex: true,
+          hasBasepri: true,
+          hasDsp: true,
+        };
+      });
+
+      it("calls the CMSIS-DSP f32 functions", () => {
+        expect(lower("out <- a + b;")).toBe("arm_add_f32(a, b, out, 64U);");
+        expect(lower("out <- a * 0.5;")).toMatch(/^arm_scale_f32\(a, /);
+        expect(lower("out +<- a;")).toBe("arm_add_f32(out, a, out, 64U);");
+        expect(CodeGenState.needsArmMath).toBe(true);
+      });
+
+      it("keeps the rounding Q multiply as a loop", () => {
+        registerArray("qa", "q15", 16);
+        registerArray("qb", "q15", 16);
+        registerArray("qo", "q15", 16);
+        expect(lower("qo <- qa + qb;")).toBe("arm_add_q15(qa, qb, qo, 16U);");
+        expect(lower("qo <- qa * qb;")).toContain("cnx_clamp_mul_q15");
+      });
+
+      it("is not used without the DSP capability", () => {
+        CodeGenState.targetCapabilities = {
+          wordSize: 32,
+          hasLdrexStrex: true,
+          hasBasepri: true,
+        };
+        expect(lower("out <- a + b;")).toContain("for (");
+      });
+    });
+  });
+
+  describe("generateReduction", () => {
+    it("calls the reduction helper with the array length", () => {
+      expect(
+        ArrayArithmeticHelper.generateReduction(
+          "sum",
+          "a",
+          CodeGenState.getVariableTypeInfo("a"),
+          "a",
+        ),
+      ).toBe("cnx_vec_sum_f32(a, 64U)");
+      expect(CodeGenState.usedVectorOps.has("sum_f32")).toBe(true);
+    });
+
+    it("returns null for non-array values", () => {
+      expect(
+        ArrayArithmeticHelper.generateReduction("sum", "s", undefined, "s"),
+      ).toBeNull();
+    });
+
+    it("tests bool arrays element by element", () => {
+      const flags = {
+        baseType: "bool",
+        bitWidth: 8,
+        isArray: true,
+        arrayDimensions: [40],
+        isConst: false,
+      };
+      expect(
+        ArrayArithmeticHelper.generateReduction("any", "f", flags, "f"),
+      ).toBe("cnx_vec_any_bool(f, 40U)");
+      expect(CodeGenState.usedVectorOps.has("any_bool")).toBe(true);
+    });
+
+    it("rejects .any on non-bool arrays", () => {
+      expect(() =>
+        ArrayArithmeticHelper.generateReduction(
+          "any",
+          "a",
+          CodeGenState.getVariableTypeInfo("a"),
+          "a",
+        ),
+      ).toThrow(".any needs a one-dimensional bool array");
+    });
+  });
+
+  describe("tryGenerateDotProduct", () => {
+    it("lowers (a * b).sum to the dot helper", () => {
+      const assign = parseAssignment("x <- a * b;");
+      expect(
+        ArrayArithmeticHelper.tryGenerateDotProduct(
+          assign.expression(),
+          deps.generateUnaryExpr,
+        ),
+      ).toBe("cnx_vec_dot_f32(a, b, 64U)");
+      expect(CodeGenState.usedVectorOps.has("dot_f32")).toBe(true);
+    });
+
+    it("ignores sums and scalar products", () => {
+      const sum = parseAssignment("x <- a + b;");
+      const scaled = parseAssignment("x <- a * 2;");
+      expect(
+        ArrayArithmeticHelper.tryGenerateDotProduct(
+          sum.expression(),
+          deps.generateUnaryExpr,
+        ),
+      ).toBeNull();
+      expect(
+        ArrayArithmeticHelper.tryGenerateDotProduct(
+          scaled.expression(),
+          deps.generateUnaryExpr,
+        ),
+      ).toBeNull();
+    });
+  });
+});
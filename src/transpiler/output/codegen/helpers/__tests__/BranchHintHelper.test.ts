@@ -0,0 +1,178 @@
+/**
+ * Unit tests for BranchHintHelper
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import BranchHintHelper from "../BranchHintHelper";
+import controlFlowGenerators from "../../generators/statements/ControlFlowGenerator";
+import switchGenerators from "../../generators/statements/SwitchGenerator";
+import CNextSourceParser from "../../../../logic/parser/CNextSourceParser";
+import CodeGenState from "../../../../state/CodeGenState";
+import * as Parser from "../../../../logic/parser/grammar/CNextParser";
+import IGeneratorInput from "../../generators/IGeneratorInput";
+import IGeneratorState from "../../generators/IGeneratorState";
+import IOrchestrator from "../../generators/IOrchestrator";
+
+/**
+ * Parse the first statement of a function body.
+ */
+function parseStatement(body: string): Parser.StatementContext {
+  const { tree } = CNextSourceParser.parse(`void test() { ${body} }`);
+  return tree.declaration(0)!.functionDeclaration()!.block().statement(0)!;
+}
+
+function ifCondition(condition: string): Parser.ExpressionContext {
+  return parseStatement(`if (${condition}) { }`).ifStatement()!.expression();
+}
+
+function switchExpression(expr: string): Parser.ExpressionContext {
+  return parseStatement(`switch (${expr}) { case 0 { } }`)
+    .switchStatement()!
+    .expression();
+}
+
+function createOrchestrator(): IOrchestrator {
+  return {
+    generateExpression: (ctx: Parser.ExpressionContext) =>
+      ctx.getText().replace(".", "_"),
+    generateStatement: () => "{ }",
+    countStringLengthAccesses: () => new Map(),
+    countBlockLengthAccesses: () => undefined,
+    setupLengthCache: () => "",
+    clearLengthCache: () => undefined,
+    flushPendingTempDeclarations: () => "",
+    validateConditionNoFunctionCall: () => undefined,
+    validateConditionIsBoolean: () => undefined,
+    validateSwitchStatement: () => undefined,
+    getExpressionEnumType: () => "State",
+    indent: (text: string) => `    ${text}`,
+  } as unknown as IOrchestrator;
+}
+
+describe("BranchHintHelper", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  describe("getConditionHint", () => {
+    it("unwraps likely() and unlikely() conditions", () => {
+      const hint = BranchHintHelper.getConditionHint(
+        ifCondition("unlikely(fault = true)"),
+        "if",
+      );
+
+      expect(hint?.macro).toBe("CNX_UNLIKELY");
+      expect(hint?.condition.getText()).toBe("fault=true");
+
+      const likely = ifCondition("likely(ready)");
+      expect(BranchHintHelper.getConditionHint(likely, "if")?.macro).toBe(
+        "CNX_LIKELY",
+      );
+    });
+
+    it("ignores other conditions and user functions named likely", () => {
+      expect(
+        BranchHintHelper.getConditionHint(ifCondition("ready"), "if"),
+      ).toBeNull();
+      expect(
+        BranchHintHelper.getConditionHint(ifCondition("!likely(x)"), "if"),
+      ).toBeNull();
+
+      CodeGenState.knownFunctions.add("likely");
+      expect(
+        BranchHintHelper.getConditionHint(ifCondition("likely(x)"), "if"),
+      ).toBeNull();
+    });
+
+    it("requires exactly one argument", () => {
+      expect(() =>
+        BranchHintHelper.getConditionHint(ifCondition("likely(a, b)"), "if"),
+      ).toThrow("likely() in an if condition takes one argument, got 2");
+    });
+  });
+
+  describe("getSwitchHint", () => {
+    it("splits likely(key, value) into key and expected case", () => {
+      const hint = BranchHintHelper.getSwitchHint(
+        switchExpression("likely(state, State.IDLE)"),
+      );
+
+      expect(hint?.key.getText()).toBe("state");
+      expect(hint?.expected.getText()).toBe("State.IDLE");
+    });
+
+    it("rejects unlikely() and a missing expected value", () => {
+      expect(() =>
+        BranchHintHelper.getSwitchHint(switchExpression("unlikely(a, b)")),
+      ).toThrow("switch expects likely(key, value)");
+      expect(() =>
+        BranchHintHelper.getSwitchHint(switchExpression("likely(state)")),
+      ).toThrow("not likely() with 1 argument(s)");
+    });
+  });
+
+  describe("getFunctionAttribute", () => {
+    it("returns the attribute macro and requires the hint macros", () => {
+      CodeGenState.coldFunctions = new Set(["Fault_report"]);
+      CodeGenState.hotFunctions = new Set(["isr"]);
+
+      expect(BranchHintHelper.getFunctionAttribute("Fault_report")).toBe(
+        "CNX_COLD ",
+      );
+      expect(BranchHintHelper.getFunctionAttribute("isr")).toBe("CNX_HOT ");
+      expect(CodeGenState.needsBranchHints).toBe(true);
+    });
+
+    it("returns nothing for other functions", () => {
+      expect(BranchHintHelper.getFunctionAttribute("main")).toBe("");
+      expect(CodeGenState.needsBranchHints).toBe(false);
+    });
+  });
+
+  it("normalizes Scope.fn names to C names", () => {
+    expect(BranchHintHelper.toCName("Fault.report")).toBe("Fault_report");
+    expect(BranchHintHelper.toCName("Fault_report")).toBe("Fault_report");
+  });
+});
+
+describe("generators with branch hints", () => {
+  const input = {} as IGeneratorInput;
+  const state = {} as IGeneratorState;
+
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  it("wraps a hinted if condition", () => {
+    const result = controlFlowGenerators.generateIf(
+      parseStatement("if (unlikely(errors > 0)) { }").ifStatement()!,
+      input,
+      state,
+      createOrchestrator(),
+    );
+
+    expect(result.code).toBe("if (CNX_UNLIKELY(errors>0)) { }");
+    expect(result.effects).toContainEqual({
+      type: "include",
+      header: "branch_hints",
+    });
+  });
+
+  it("dispatches a hinted switch through CNX_EXPECT", () => {
+    const node = parseStatement(
+      "switch (likely(state, State.IDLE)) { case State.IDLE { } }",
+    ).switchStatement()!;
+    const result = switchGenerators.generateSwitch(
+      node,
+      input,
+      state,
+      createOrchestrator(),
+    );
+
+    expect(result.code).toContain("switch (CNX_EXPECT(state, State_IDLE)) {");
+    expect(result.effects).toContainEqual({
+      type: "include",
+      header: "branch_hints",
+    });
+  });
+});
@@ -0,0 +1,61 @@
+import { describe, it, expect } from "vitest";
+import CompactEnumHelper from "../CompactEnumHelper.js";
+
+function members(...values: number[]): Map<string, number> {
+  return new Map(values.map((v, i) => [`M${i}`, v]));
+}
+
+describe("CompactEnumHelper", () => {
+  describe("inferBitWidth", () => {
+    it("returns 8 when all values fit in a byte", () => {
+      expect(CompactEnumHelper.inferBitWidth(members(0, 1, 255))).toBe(8);
+    });
+
+    it("returns 16 when the max value exceeds 255", () => {
+      expect(CompactEnumHelper.inferBitWidth(members(0, 256))).toBe(16);
+      expect(CompactEnumHelper.inferBitWidth(members(65535))).toBe(16);
+    });
+
+    it("returns 32 when the max value exceeds 65535", () => {
+      expect(CompactEnumHelper.inferBitWidth(members(65536))).toBe(32);
+    });
+
+    it("returns 32 for negative members", () => {
+      expect(CompactEnumHelper.inferBitWidth(members(-1, 0))).toBe(32);
+    });
+  });
+
+  describe("getTypedefOpening", () => {
+    it("returns plain typedef when not compact", () => {
+      expect(
+        CompactEnumHelper.getTypedefOpening(members(0, 1), false, true),
+      ).toBe("typedef enum {");
+    });
+
+    it("returns a GCC/Clang-guarded packed attribute in C mode", () => {
+      expect(
+        CompactEnumHelper.getTypedefOpening(members(0, 1), true, false),
+      ).toBe(
+        [
+          "#if defined(__GNUC__) || defined(__clang__)",
+          "typedef enum __attribute__((packed)) {",
+          "#else",
+          "typedef enum {",
+          "#endif",
+        ].join("\n"),
+      );
+    });
+
+    it("returns fixed underlying type in C++ mode", () => {
+      expect(
+        CompactEnumHelper.getTypedefOpening(members(0, 70000), true, true),
+      ).toBe("typedef enum : uint32_t {");
+    });
+
+    it("keeps negative-valued enums int-sized", () => {
+      expect(
+        CompactEnumHelper.getTypedefOpening(members(-1, 1), true, false),
+      ).toBe("typedef enum {");
+    });
+  });
+});
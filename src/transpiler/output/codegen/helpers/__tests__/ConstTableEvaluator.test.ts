@@ -0,0 +1,287 @@
+/**
+ * Unit tests for ConstTableEvaluator
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import ConstTableEvaluator from "../ConstTableEvaluator";
+import CNextSourceParser from "../../../../logic/parser/CNextSourceParser";
+import CodeGenState from "../../../../state/CodeGenState";
+
+/**
+ * Parse a source file and register its functions as CodeGenerator does.
+ */
+function load(source: string): void {
+  const { tree } = CNextSourceParser.parse(source);
+  for (const decl of tree.declaration()) {
+    const func = decl.functionDeclaration();
+    if (func) {
+      CodeGenState.functionDeclarations.set(func.IDENTIFIER().getText(), func);
+    }
+    const scope = decl.scopeDeclaration();
+    for (const member of scope?.scopeMember() ?? []) {
+      const scoped = member.functionDeclaration();
+      if (scoped) {
+        const name = `${scope!.IDENTIFIER().getText()}_${scoped.IDENTIFIER().getText()}`;
+        CodeGenState.functionDeclarations.set(name, scoped);
+      }
+    }
+  }
+}
+
+function table(name: string, count: number, elementType: string): string[] {
+  return ConstTableEvaluator.evaluateTable(name, count, elementType, "table");
+}
+
+const CRC32 = `
+u32 crc32Entry(u32 index) {
+    u32 crc <- index;
+    for (u32 bit <- 0; bit < 8; bit +<- 1) {
+        if ((crc & 1) = 1) {
+            crc <- (crc >> 1) ^ 0xEDB88320;
+        } else {
+            crc >><- 1;
+        }
+    }
+    return crc;
+}
+`;
+
+const CRC16 = `
+u16 crc16Entry(u8 index) {
+    u16 crc <- index << 8;
+    u8 bit <- 0;
+    while (bit < 8) {
+        if (crc[15] = true) {
+            crc <- (crc << 1) ^ 0x1021;
+        } else {
+            crc <- crc << 1;
+        }
+        bit +<- 1;
+    }
+    return crc;
+}
+`;
+
+describe("ConstTableEvaluator", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  describe("evaluateTable", () => {
+    it("computes a CRC-32 table", () => {
+      load(CRC32);
+      const values = table("crc32Entry", 256, "u32");
+
+      expect(values).toHaveLength(256);
+      expect(values[0]).toBe("0x00000000U");
+      expect(values[1]).toBe("0x77073096U");
+      expect(values[2]).toBe("0xEE0E612CU");
+      expect(values[255]).toBe("0x2D02EF8DU");
+    });
+
+    it("computes a CRC-16/CCITT table with bit reads", () => {
+      load(CRC16);
+
+      expect(table("crc16Entry", 8, "u16")).toEqual([
+        "0x0000U",
+        "0x1021U",
+        "0x2042U",
+        "0x3063U",
+        "0x4084U",
+        "0x50A5U",
+        "0x60C6U",
+        "0x70E7U",
+      ]);
+    });
+
+    it("calls scope functions and reads scope constants", () => {
+      load(`
+        scope Gamma {
+            u8 square(u32 x) {
+                return (x * x) / this.DIVISOR;
+            }
+            u8 entry(u32 i) {
+                return this.square(i);
+            }
+        }
+      `);
+      CodeGenState.constValues.set("Gamma_DIVISOR", 255);
+
+      expect(table("Gamma_entry", 4, "u8")).toEqual([
+        "0x00U",
+        "0x00U",
+        "0x00U",
+        "0x00U",
+      ]);
+      expect(table("Gamma_entry", 256, "u8")[255]).toBe("0xFFU");
+    });
+
+    it("saturates compound arithmetic on clamp locals", () => {
+      load(`
+        u8 clamped(u32 i) {
+            u8 x <- 250;
+            x +<- i;
+            return x;
+        }
+        u8 wrapped(u32 i) {
+            wrap u8 x <- 250;
+            x +<- i;
+            return x;
+        }
+      `);
+
+      expect(table("clamped", 10, "u8")[9]).toBe("0xFFU");
+      expect(table("wrapped", 10, "u8")[9]).toBe("0x03U");
+    });
+
+    it("follows C conversions for signed and unsigned operands", () => {
+      load(`
+        i32 signedEntry(u32 i) {
+            i32 x <- 0 - 3;
+            return x / 2;
+        }
+        u32 unsignedEntry(u32 i) {
+            return i - 1;
+        }
+      `);
+
+      expect(table("signedEntry", 1, "i32")).toEqual(["-1"]);
+      expect(table("unsignedEntry", 1, "u32")).toEqual(["0xFFFFFFFFU"]);
+    });
+
+    it("passes modified variables by reference", () => {
+      load(`
+        void bump(u32 value) {
+            value +<- 1;
+        }
+        u32 entry(u32 i) {
+            u32 n <- i;
+            bump(n);
+            return n;
+        }
+      `);
+
+      expect(table("entry", 3, "u32")).toEqual([
+        "0x00000001U",
+        "0x00000002U",
+        "0x00000003U",
+      ]);
+    });
+
+    it("rejects functions with side effects", () => {
+      load(`
+        u32 counter <- 0;
+        u32 entry(u32 i) {
+            global.counter <- i;
+            return i;
+        }
+      `);
+
+      expect(() => table("entry", 1, "u32")).toThrow(
+        "Cannot evaluate table 'table' at transpile time: 'entry' assigns to 'global.counter'",
+      );
+    });
+
+    it("rejects reads of non-constant globals", () => {
+      load(`
+        u32 entry(u32 i) {
+            return i + offset;
+        }
+      `);
+
+      expect(() => table("entry", 1, "u32")).toThrow(
+        "'offset' is not a local, parameter or integer constant",
+      );
+    });
+
+    it("reports signed overflow, division by zero and runaway recursion", () => {
+      load(`
+        i32 overflow(u32 i) {
+            i32 x <- 2147483647;
+            return x + 1;
+        }
+        u32 divide(u32 i) {
+            return 10 / i;
+        }
+        u32 recurse(u32 i) {
+            return recurse(i);
+        }
+      `);
+
+      expect(() => table("overflow", 1, "i32")).toThrow("overflows i32");
+      expect(() => table("divide", 1, "u32")).toThrow("division by zero");
+      expect(() => table("recurse", 1, "u32")).toThrow("deeper than 64");
+    });
+
+    it("rejects results that do not fit the element type", () => {
+      load(CRC32);
+
+      expect(() => table("crc32Entry", 2, "u16")).toThrow(
+        "crc32Entry(1) = 1996959894 does not fit u16 table 'table'",
+      );
+    });
+
+    it("requires an index parameter wide enough for the table", () => {
+      load(CRC16);
+
+      expect(() => table("crc16Entry", 300, "u16")).toThrow(
+        "must take one integer index parameter that holds 299",
+      );
+    });
+  });
+
+  describe("resolveGenerator", () => {
+    function resolve(fillValue: string): string | null {
+      const { tree } = CNextSourceParser.parse(`u8 x <- ${fillValue};`);
+      const decl = tree.declaration(0)!.variableDeclaration()!;
+      return ConstTableEvaluator.resolveGenerator(decl.expression()!);
+    }
+
+    it("resolves functions of this file", () => {
+      load(CRC32);
+
+      expect(resolve("crc32Entry")).toBe("crc32Entry");
+      expect(resolve("other")).toBeNull();
+      expect(resolve("0")).toBeNull();
+    });
+
+    it("resolves this.fn inside a scope and Scope.fn outside", () => {
+      load(`scope Crc { u8 entry(u8 i) { return i; } }`);
+
+      expect(resolve("Crc.entry")).toBe("Crc_entry");
+      CodeGenState.currentScope = "Crc";
+      expect(resolve("this.entry")).toBe("Crc_entry");
+    });
+  });
+
+  describe("formatValue", () => {
+    it("formats unsigned values as padded hex", () => {
+      expect(ConstTableEvaluator.formatValue(0x1021n, "u16")).toBe("0x1021U");
+      expect(ConstTableEvaluator.formatValue(5n, "u64")).toBe(
+        "0x0000000000000005ULL",
+      );
+    });
+
+    it("formats signed values as decimal", () => {
+      expect(ConstTableEvaluator.formatValue(-5n, "i16")).toBe("-5");
+      expect(ConstTableEvaluator.formatValue(-5n, "i64")).toBe("-5LL");
+      expect(ConstTableEvaluator.formatValue(-2147483648n, "i32")).toBe(
+        "(-2147483647 - 1)",
+      );
+    });
+  });
+
+  describe("formatTable", () => {
+    it("keeps short tables on one line", () => {
+      expect(ConstTableEvaluator.formatTable(["1", "2"])).toBe("{1, 2}");
+    });
+
+    it("wraps long tables eight values per line", () => {
+      const values = Array.from({ length: 10 }, (_, i) => String(i));
+
+      expect(ConstTableEvaluator.formatTable(values)).toBe(
+        "{\n    0, 1, 2, 3, 4, 5, 6, 7,\n    8, 9\n}",
+      );
+    });
+  });
+});
@@ -0,0 +1,145 @@
+/**
+ * Unit tests for ConstantDivisorHelper
+ * Tests the inline lowering of safe division by constant divisors
+ */
+import { describe, it, expect } from "vitest";
+import { CharStream, CommonTokenStream } from "antlr4ng";
+import { CNextLexer } from "../../../../logic/parser/grammar/CNextLexer";
+import { CNextParser } from "../../../../logic/parser/grammar/CNextParser";
+import ConstantDivisorHelper from "../ConstantDivisorHelper";
+
+function parseExpression(text: string) {
+  const lexer = new CNextLexer(CharStream.fromString(text));
+  return new CNextParser(new CommonTokenStream(lexer)).expression();
+}
+
+describe("ConstantDivisorHelper", () => {
+  describe("isInlineDivisor", () => {
+    it("accepts positive divisors the output type can hold", () => {
+      expect(ConstantDivisorHelper.isInlineDivisor(64, "u8")).toBe(true);
+      expect(ConstantDivisorHelper.isInlineDivisor(255, "u8")).toBe(true);
+      expect(ConstantDivisorHelper.isInlineDivisor(127, "i8")).toBe(true);
+      expect(ConstantDivisorHelper.isInlineDivisor(1000, "u64")).toBe(true);
+    });
+
+    it("keeps the helper for zero, negative and out-of-range divisors", () => {
+      expect(ConstantDivisorHelper.isInlineDivisor(0, "u32")).toBe(false);
+      expect(ConstantDivisorHelper.isInlineDivisor(-4, "i32")).toBe(false);
+      expect(ConstantDivisorHelper.isInlineDivisor(256, "u8")).toBe(false);
+      expect(ConstantDivisorHelper.isInlineDivisor(128, "i8")).toBe(false);
+      expect(ConstantDivisorHelper.isInlineDivisor(4, "f32")).toBe(false);
+    });
+  });
+
+  describe("unsigned", () => {
+    it("uses shifts and masks for powers of two", () => {
+      expect(ConstantDivisorHelper.quotient("count", 16, "u32")).toBe(
+        "count >> 4",
+      );
+      expect(ConstantDivisorHelper.remainder("idx", 64, "u32")).toBe(
+        "idx & 0x3FU",
+      );
+      expect(ConstantDivisorHelper.remainder("idx", 256, "u64")).toBe(
+        "idx & 0xFFULL",
+      );
+    });
+
+    it("divides by other constants with a typed literal", () => {
+      expect(ConstantDivisorHelper.quotient("total", 10, "u32")).toBe(
+        "total / 10U",
+      );
+      expect(ConstantDivisorHelper.remainder("total", 10, "u64")).toBe(
+        "total % 10ULL",
+      );
+    });
+  });
+
+  describe("signed", () => {
+    it("shifts and masks the magnitude for powers of two", () => {
+      expect(ConstantDivisorHelper.quotient("x", 4, "i32")).toBe(
+        "(x < 0 ? -(int32_t)((0U - (uint32_t)x) >> 2) : (int32_t)((uint32_t)x >> 2))",
+      );
+      expect(ConstantDivisorHelper.remainder("x", 8, "i64")).toBe(
+        "(x < 0 ? -(int64_t)((0U - (uint64_t)x) & 0x7ULL) : (int64_t)((uint64_t)x & 0x7ULL))",
+      );
+    });
+
+    it("divides by other constants and by 1 directly", () => {
+      expect(ConstantDivisorHelper.quotient("x", 10, "i32")).toBe("x / 10");
+      expect(ConstantDivisorHelper.remainder("x", 3, "i64")).toBe("x % 3LL");
+      expect(ConstantDivisorHelper.quotient("x", 1, "i32")).toBe("x / 1");
+    });
+  });
+
+  describe("readsNumeratorTwice", () => {
+    it("is true for signed powers of two and divmod", () => {
+      expect(ConstantDivisorHelper.readsNumeratorTwice("div", 4, "i32")).toBe(
+        true,
+      );
+      expect(ConstantDivisorHelper.readsNumeratorTwice("div", 4, "u32")).toBe(
+        false,
+      );
+      expect(ConstantDivisorHelper.readsNumeratorTwice("mod", 3, "i32")).toBe(
+        false,
+      );
+      expect(
+        ConstantDivisorHelper.readsNumeratorTwice("divmod", 3, "u32"),
+      ).toBe(true);
+    });
+  });
+
+  describe("operand", () => {
+    it("converts to the output type or parenthesizes compound code", () => {
+      expect(ConstantDivisorHelper.operand("head", "u32", false)).toBe("head");
+      expect(ConstantDivisorHelper.operand("head + 1", "u32", false)).toBe(
+        "(head + 1)",
+      );
+      expect(ConstantDivisorHelper.operand("raw", "u8", true)).toBe(
+        "(uint8_t)(raw)",
+      );
+    });
+  });
+
+  describe("numeratorReads", () => {
+    it("matches the quotient's root identifier as a whole word", () => {
+      expect(ConstantDivisorHelper.numeratorReads("x + 1", "x")).toBe(true);
+      expect(ConstantDivisorHelper.numeratorReads("(*q) * 2", "(*q)")).toBe(
+        true,
+      );
+      expect(ConstantDivisorHelper.numeratorReads("buf[0]", "buf[i]")).toBe(
+        true,
+      );
+      expect(ConstantDivisorHelper.numeratorReads("xs + 1", "x")).toBe(false);
+      expect(ConstantDivisorHelper.numeratorReads("head", "q")).toBe(false);
+    });
+  });
+
+  describe("isSafeDivCall", () => {
+    it("matches a whole safe division call", () => {
+      expect(
+        ConstantDivisorHelper.isSafeDivCall(
+          parseExpression("safe_div(blocks, count, 16, 0)"),
+        ),
+      ).toBe(true);
+      expect(
+        ConstantDivisorHelper.isSafeDivCall(
+          parseExpression("safe_divmod(q, r, n, 8, 0)"),
+        ),
+      ).toBe(true);
+    });
+
+    it("rejects other calls and calls inside larger expressions", () => {
+      expect(
+        ConstantDivisorHelper.isSafeDivCall(parseExpression("log(x, false)")),
+      ).toBe(false);
+      expect(
+        ConstantDivisorHelper.isSafeDivCall(
+          parseExpression("safe_div(q, n, 4, 0) = false"),
+        ),
+      ).toBe(false);
+      expect(
+        ConstantDivisorHelper.isSafeDivCall(parseExpression("safe_div")),
+      ).toBe(false);
+    });
+  });
+});
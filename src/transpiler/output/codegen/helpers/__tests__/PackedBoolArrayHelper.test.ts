@@ -0,0 +1,154 @@
+/**
+ * Unit tests for PackedBoolArrayHelper
+ */
+
+import { describe, it, expect } from "vitest";
+import PackedBoolArrayHelper from "../PackedBoolArrayHelper";
+import CodeGenState from "../../../../state/CodeGenState";
+
+/**
+ * Evaluate a generated word initializer on the host, for equivalence checks.
+ */
+function evalWords(init: string, count: number): number[] {
+  const words = init
+    .slice(1, -1)
+    .split(", ")
+    .map((w) => Number.parseInt(w.replace(/U$/, ""), 16));
+  while (words.length < count) words.push(0);
+  return words;
+}
+
+/**
+ * Host model of the generated read expression.
+ */
+function readBit(words: number[], index: number): boolean {
+  return ((words[index >>> 5] >>> (index & 31)) & 1) !== 0;
+}
+
+describe("PackedBoolArrayHelper", () => {
+  describe("isEligible", () => {
+    it("accepts one-dimensional bool arrays", () => {
+      expect(PackedBoolArrayHelper.isEligible("bool", [256], 1)).toBe(true);
+    });
+
+    it("rejects other element types", () => {
+      expect(PackedBoolArrayHelper.isEligible("u8", [256], 1)).toBe(false);
+    });
+
+    it("rejects multi-dimensional arrays", () => {
+      expect(PackedBoolArrayHelper.isEligible("bool", [4, 8], 2)).toBe(false);
+    });
+
+    it("rejects arrays without a known size", () => {
+      expect(PackedBoolArrayHelper.isEligible("bool", [], 1)).toBe(false);
+      expect(PackedBoolArrayHelper.isEligible("bool", undefined, 1)).toBe(
+        false,
+      );
+    });
+  });
+
+  describe("wordCount", () => {
+    it("rounds up to whole words", () => {
+      expect(PackedBoolArrayHelper.wordCount(1)).toBe(1);
+      expect(PackedBoolArrayHelper.wordCount(32)).toBe(1);
+      expect(PackedBoolArrayHelper.wordCount(33)).toBe(2);
+      expect(PackedBoolArrayHelper.wordCount(256)).toBe(8);
+    });
+  });
+
+  describe("read", () => {
+    it("shifts and masks the containing word", () => {
+      expect(PackedBoolArrayHelper.read("flags", "i")).toBe(
+        "(((flags[(i) >> 5U] >> ((i) & 31U)) & 1U) != 0U)",
+      );
+    });
+
+    it("folds constant indices", () => {
+      expect(PackedBoolArrayHelper.read("flags", "37U")).toBe(
+        "(((flags[1U] >> 5U) & 1U) != 0U)",
+      );
+      expect(PackedBoolArrayHelper.read("flags", "64U")).toBe(
+        "((flags[2U] & 1U) != 0U)",
+      );
+    });
+  });
+
+  describe("write", () => {
+    it("reuses the single-bit read-modify-write", () => {
+      expect(PackedBoolArrayHelper.write("flags", "3U", "true")).toBe(
+        "flags[0U] = (flags[0U] & ~(1U << 3U)) | (1U << 3U);",
+      );
+    });
+
+    it("evaluates a compound index once into a temporary", () => {
+      CodeGenState.tempVarCounter = 4;
+      const lines = PackedBoolArrayHelper.write("flags", "i + 1U", "ok").split(
+        "\n",
+      );
+      expect(lines[0]).toBe("{");
+      expect(lines[1]).toBe("    const uint32_t _cnx_tmp_4 = i + 1U;");
+      expect(lines[2]).toContain("flags[(_cnx_tmp_4) >> 5U] = ");
+      expect(lines[2]).not.toContain("i + 1U");
+      expect(lines[3]).toBe("}");
+    });
+  });
+
+  describe("any", () => {
+    it("tests the ORed storage words", () => {
+      expect(PackedBoolArrayHelper.any("flags", 20)).toBe("(flags[0U] != 0U)");
+      expect(PackedBoolArrayHelper.any("flags", 70)).toBe(
+        "((flags[0U] | flags[1U] | flags[2U]) != 0U)",
+      );
+    });
+  });
+
+  describe("fillWords", () => {
+    it("zero-fills false", () => {
+      expect(PackedBoolArrayHelper.fillWords("false", 100)).toBe("{0}");
+    });
+
+    it("fills whole words and masks the tail", () => {
+      expect(PackedBoolArrayHelper.fillWords("true", 40)).toBe(
+        "{0xFFFFFFFFU, 0x000000FFU}",
+      );
+    });
+
+    it("selects words for runtime fill values", () => {
+      expect(PackedBoolArrayHelper.fillWords("on", 8)).toBe(
+        "{((on) ? 0x000000FFU : 0U)}",
+      );
+    });
+
+    it("sets exactly the declared elements", () => {
+      const words = evalWords(PackedBoolArrayHelper.fillWords("true", 70), 3);
+      for (let i = 0; i < 96; i++) {
+        expect(readBit(words, i)).toBe(i < 70);
+      }
+    });
+  });
+
+  describe("packWords", () => {
+    it("folds literal elements", () => {
+      expect(
+        PackedBoolArrayHelper.packWords(["true", "false", "true", "true"]),
+      ).toBe("{0x0000000DU}");
+    });
+
+    it("shifts runtime elements into place", () => {
+      expect(PackedBoolArrayHelper.packWords(["true", "a", "false"])).toBe(
+        "{0x00000001U | ((a ? 1U : 0U) << 1U)}",
+      );
+    });
+
+    it("matches byte-array semantics element by element", () => {
+      const values = Array.from({ length: 45 }, (_, i) => i % 3 === 0);
+      const words = evalWords(
+        PackedBoolArrayHelper.packWords(values.map(String)),
+        2,
+      );
+      values.forEach((value, i) => {
+        expect(readBit(words, i)).toBe(value);
+      });
+    });
+  });
+});
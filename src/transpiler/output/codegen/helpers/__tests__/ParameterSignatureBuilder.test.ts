@@ -467,4 +467,67 @@ describe("ParameterSignatureBuilder", () => {
       expect(result).toBe("uint8_t* buf");
     });
   });
+
+  describe("restrict-qualified parameters", () => {
+    it("qualifies the first array dimension in C mode only", () => {
+      const input = createInput({
+        name: "dst",
+        baseType: "u8",
+        mappedType: "uint8_t",
+        isArray: true,
+        arrayDimensions: ["4", "16"],
+        isRestrict: true,
+      });
+
+      expect(ParameterSignatureBuilder.build(input, "*")).toBe(
+        "uint8_t dst[restrict 4][16]",
+      );
+      expect(ParameterSignatureBuilder.build(input, "&")).toBe(
+        "uint8_t dst[4][16]",
+      );
+    });
+
+    it("qualifies struct pointers and C++ references", () => {
+      const input = createInput({
+        name: "p",
+        baseType: "Point",
+        mappedType: "Point",
+        isAutoConst: true,
+        isRestrict: true,
+      });
+
+      expect(ParameterSignatureBuilder.build(input, "*")).toBe(
+        "const Point* restrict p",
+      );
+      expect(ParameterSignatureBuilder.build(input, "&")).toBe(
+        "const Point& __restrict__ p",
+      );
+    });
+
+    it("qualifies string pointers but not values or opaque handles", () => {
+      const text = createInput({
+        name: "text",
+        baseType: "string<32>",
+        mappedType: "char",
+        isString: true,
+        isPassByReference: false,
+        isRestrict: true,
+      });
+      const value = createInput({ isPassByValue: true, isRestrict: true });
+      const handle = createInput({
+        name: "w",
+        mappedType: "widget_t",
+        isOpaqueHandle: true,
+        isRestrict: true,
+      });
+
+      expect(ParameterSignatureBuilder.build(text, "*")).toBe(
+        "char* restrict text",
+      );
+      expect(ParameterSignatureBuilder.build(value, "*")).toBe(
+        "uint32_t param",
+      );
+      expect(ParameterSignatureBuilder.build(handle, "*")).toBe("widget_t* w");
+    });
+  });
 });
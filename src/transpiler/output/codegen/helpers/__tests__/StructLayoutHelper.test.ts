@@ -0,0 +1,114 @@
+/**
+ * Unit tests for StructLayoutHelper
+ */
+
+import { describe, it, expect } from "vitest";
+import StructLayoutHelper from "../StructLayoutHelper";
+import ICodeGenSymbols from "../../../../types/ICodeGenSymbols";
+
+const symbols = {
+  structFields: new Map([
+    [
+      "Mixed",
+      new Map([
+        ["a", "u8"],
+        ["b", "u32"],
+        ["c", "u16"],
+      ]),
+    ],
+  ]),
+  structFieldDimensions: new Map(),
+  enumMembers: new Map(),
+  bitmapBackingType: new Map(),
+};
+
+describe("StructLayoutHelper", () => {
+  describe("selectReordered", () => {
+    const fileSymbols = {
+      knownStructs: new Set(["Packet", "Store_Entry", "Store_Record"]),
+      scopeMemberVisibility: new Map([
+        [
+          "Store",
+          new Map<string, "public" | "private">([
+            ["Entry", "private"],
+            ["Record", "public"],
+            ["count", "private"],
+          ]),
+        ],
+      ]),
+    } as unknown as ICodeGenSymbols;
+
+    it("selects listed structs by C name", () => {
+      expect(
+        StructLayoutHelper.selectReordered(fileSymbols, false, [
+          "Packet",
+          "Store.Record",
+        ]),
+      ).toEqual(new Set(["Packet", "Store_Record"]));
+    });
+
+    it("selects only private scope structs with reorderStructs", () => {
+      expect(StructLayoutHelper.selectReordered(fileSymbols, true, [])).toEqual(
+        new Set(["Store_Entry"]),
+      );
+    });
+  });
+
+  describe("getReorderedLayout", () => {
+    it("returns the padding-minimizing layout", () => {
+      const layout = StructLayoutHelper.getReorderedLayout(
+        symbols,
+        "Mixed",
+        32,
+        false,
+      );
+      expect(layout?.fields.map((f) => f.name)).toEqual(["b", "c", "a"]);
+      expect(layout?.size).toBe(8);
+    });
+
+    it("returns null for unknown structs", () => {
+      expect(
+        StructLayoutHelper.getReorderedLayout(symbols, "Other", 32, false),
+      ).toBeNull();
+    });
+  });
+
+  describe("orderByLayout", () => {
+    const layout = StructLayoutHelper.getReorderedLayout(
+      symbols,
+      "Mixed",
+      32,
+      false,
+    );
+
+    it("orders items by layout field order", () => {
+      const inits = [
+        { fieldName: "a", value: "1U" },
+        { fieldName: "c", value: "2U" },
+      ];
+      expect(
+        StructLayoutHelper.orderByLayout(inits, (f) => f.fieldName, layout).map(
+          (f) => f.fieldName,
+        ),
+      ).toEqual(["c", "a"]);
+    });
+
+    it("keeps source order without a layout", () => {
+      const names = ["a", "b", "c"];
+      expect(StructLayoutHelper.orderByLayout(names, (n) => n, null)).toEqual(
+        names,
+      );
+    });
+  });
+
+  describe("generateSizeAssert", () => {
+    it("uses _Static_assert for C and static_assert for C++", () => {
+      expect(StructLayoutHelper.generateSizeAssert("Mixed", 8, false)).toBe(
+        '_Static_assert(sizeof(Mixed) == 8, "Mixed size differs from the computed layout");',
+      );
+      expect(
+        StructLayoutHelper.generateSizeAssert("Mixed", 8, true),
+      ).toMatch(/^static_assert\(sizeof\(Mixed\) == 8, /);
+    });
+  });
+});
@@ -0,0 +1,213 @@
+/**
+ * Unit tests for StructOfArraysHelper
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import StructOfArraysHelper from "../StructOfArraysHelper";
+import CodeGenState from "../../../../state/CodeGenState";
+import type ICodeGenSymbols from "../../../../types/ICodeGenSymbols";
+
+/**
+ * Register the test structs on CodeGenState.
+ */
+function setupSymbols(): void {
+  CodeGenState.symbols = {
+    structFields: new Map([
+      [
+        "Sample",
+        new Map([
+          ["x", "f32"],
+          ["id", "u8"],
+          ["mode", "Mode"],
+        ]),
+      ],
+      ["Named", new Map([["label", "string<8>"]])],
+      ["Buffered", new Map([["data", "u8"]])],
+    ]),
+    structFieldDimensions: new Map([["Buffered", new Map([["data", [4]]])]]),
+    structFieldArrays: new Map([["Buffered", new Set(["data"])]]),
+    knownEnums: new Set(["Mode"]),
+  } as unknown as ICodeGenSymbols;
+}
+
+describe("StructOfArraysHelper", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+    CodeGenState.soaStructs = new Set(["Sample"]);
+    setupSymbols();
+  });
+
+  describe("isCandidate", () => {
+    it("accepts one-dimensional arrays of listed structs", () => {
+      expect(StructOfArraysHelper.isCandidate("Sample", 1)).toBe(true);
+    });
+
+    it("rejects unlisted structs and multi-dimensional arrays", () => {
+      expect(StructOfArraysHelper.isCandidate("Named", 1)).toBe(false);
+      expect(StructOfArraysHelper.isCandidate("Sample", 2)).toBe(false);
+    });
+  });
+
+  describe("validateDeclaration", () => {
+    it("accepts private fixed-size arrays", () => {
+      expect(() =>
+        StructOfArraysHelper.validateDeclaration(
+          "samples",
+          "Sample",
+          16,
+          false,
+          false,
+        ),
+      ).not.toThrow();
+    });
+
+    it("rejects arrays without a compile-time size", () => {
+      expect(() =>
+        StructOfArraysHelper.validateDeclaration(
+          "samples",
+          "Sample",
+          undefined,
+          false,
+          false,
+        ),
+      ).toThrow("needs a compile-time size");
+    });
+
+    it("rejects arrays visible through the header", () => {
+      expect(() =>
+        StructOfArraysHelper.validateDeclaration(
+          "samples",
+          "Sample",
+          16,
+          true,
+          false,
+        ),
+      ).toThrow("would be visible to C");
+    });
+
+    it("rejects initializers", () => {
+      expect(() =>
+        StructOfArraysHelper.validateDeclaration(
+          "samples",
+          "Sample",
+          16,
+          false,
+          true,
+        ),
+      ).toThrow("cannot have an initializer");
+    });
+  });
+
+  describe("getFields", () => {
+    it("maps primitive and enum fields to C types", () => {
+      expect(StructOfArraysHelper.getFields("Sample")).toEqual([
+        { name: "x", cType: "float" },
+        { name: "id", cType: "uint8_t" },
+        { name: "mode", cType: "Mode" },
+      ]);
+    });
+
+    it("rejects non-scalar fields", () => {
+      expect(() => StructOfArraysHelper.getFields("Named")).toThrow(
+        "does not support field 'label'",
+      );
+    });
+
+    it("rejects array fields", () => {
+      expect(() => StructOfArraysHelper.getFields("Buffered")).toThrow(
+        "does not support array field 'data'",
+      );
+    });
+
+    it("rejects unknown structs", () => {
+      expect(() => StructOfArraysHelper.getFields("Missing")).toThrow(
+        "is not a C-Next struct",
+      );
+    });
+  });
+
+  describe("generateDecl", () => {
+    it("emits one array per field", () => {
+      expect(
+        StructOfArraysHelper.generateDecl("static ", "Sample", "samples", 8),
+      ).toBe(
+        [
+          "static struct {",
+          "    float x[8];",
+          "    uint8_t id[8];",
+          "    Mode mode[8];",
+          "} samples = {0};",
+        ].join("\n"),
+      );
+    });
+
+    it("uses empty-brace initialization in C++ mode", () => {
+      CodeGenState.cppMode = true;
+      const decl = StructOfArraysHelper.generateDecl("", "Sample", "s", 8);
+      expect(decl).toMatch(/\} s = \{\};$/);
+    });
+  });
+
+  describe("element access", () => {
+    it("lowers a field read to a field array index", () => {
+      expect(
+        StructOfArraysHelper.fieldElement("Sample", "samples", "x", "i"),
+      ).toBe("samples.x[i]");
+    });
+
+    it("rejects unknown fields", () => {
+      expect(() =>
+        StructOfArraysHelper.fieldElement("Sample", "samples", "y", "i"),
+      ).toThrow("has no field 'y'");
+    });
+
+    it("gathers a whole element as a compound literal", () => {
+      const read = StructOfArraysHelper.gatherElement("Sample", "s", "i");
+      expect(read).toBe(
+        "(Sample){ .x = s.x[i], .id = s.id[i], .mode = s.mode[i] }",
+      );
+    });
+
+    it("gathers a plain initializer inside a declaration", () => {
+      CodeGenState.inDeclarationInit = true;
+      const init = StructOfArraysHelper.gatherElement("Sample", "s", "0U");
+      expect(init).toBe("{ .x = s.x[0U], .id = s.id[0U], .mode = s.mode[0U] }");
+    });
+
+    it("scatters an identifier field by field", () => {
+      expect(
+        StructOfArraysHelper.scatterElement("Sample", "samples", "i", "s"),
+      ).toBe(
+        [
+          "samples.x[i] = s.x;",
+          "samples.id[i] = s.id;",
+          "samples.mode[i] = s.mode;",
+        ].join("\n"),
+      );
+    });
+
+    it("evaluates other values once into a temporary", () => {
+      expect(
+        StructOfArraysHelper.scatterElement(
+          "Sample",
+          "samples",
+          "i",
+          "makeSample()",
+        ),
+      ).toBe(
+        [
+          "const Sample _tmp0 = makeSample();",
+          "samples.x[i] = _tmp0.x;",
+          "samples.id[i] = _tmp0.id;",
+          "samples.mode[i] = _tmp0.mode;",
+        ].join("\n"),
+      );
+    });
+
+    it("rejects whole-element indices with calls", () => {
+      expect(() =>
+        StructOfArraysHelper.gatherElement("Sample", "samples", "next()"),
+      ).toThrow("needs an index without function calls");
+    });
+  });
+});
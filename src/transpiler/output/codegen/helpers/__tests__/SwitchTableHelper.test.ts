@@ -0,0 +1,347 @@
+/**
+ * Unit tests for SwitchTableHelper
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import SwitchTableHelper from "../SwitchTableHelper";
+import switchGenerators from "../../generators/statements/SwitchGenerator";
+import CNextSourceParser from "../../../../logic/parser/CNextSourceParser";
+import CodeGenState from "../../../../state/CodeGenState";
+import * as Parser from "../../../../logic/parser/grammar/CNextParser";
+import IGeneratorInput from "../../generators/IGeneratorInput";
+import IGeneratorState from "../../generators/IGeneratorState";
+import IOrchestrator from "../../generators/IOrchestrator";
+import TTypeInfo from "../../types/TTypeInfo";
+
+const COLORS = new Map([
+  ["RED", 0],
+  ["GREEN", 1],
+  ["BLUE", 2],
+]);
+
+/**
+ * Parse the first statement of a function body as a switch.
+ */
+function parseSwitch(body: string): Parser.SwitchStatementContext {
+  const { tree } = CNextSourceParser.parse(`void test() { ${body} }`);
+  const block = tree.declaration(0)!.functionDeclaration()!.block();
+  return block.statement(0)!.switchStatement()!;
+}
+
+function scalar(baseType: string): TTypeInfo {
+  return { baseType, bitWidth: 32, isArray: false, isConst: false };
+}
+
+function createInput(switchTables = true): IGeneratorInput {
+  return {
+    symbols: {
+      enumMembers: new Map([["Color", COLORS]]),
+      knownEnums: new Set(["Color"]),
+    },
+    typeRegistry: new Map([
+      ["result", scalar("u32")],
+      ["other", scalar("u32")],
+      ["color", scalar("Color")],
+      ["buffer", { ...scalar("u8"), isArray: true, arrayDimensions: [4] }],
+    ]),
+    constValues: new Map([["LIMIT", 7]]),
+    switchTables,
+  } as unknown as IGeneratorInput;
+}
+
+/**
+ * Literal C for a C-Next constant: unsigned suffix, enum underscores.
+ */
+function toC(text: string): string {
+  return /^\d+$/.test(text) ? `${text}U` : text.replace(".", "_");
+}
+
+function createOrchestrator(
+  options: { keyType?: string; returnType?: string } = {},
+): IOrchestrator {
+  return {
+    generateExpression: (ctx: Parser.ExpressionContext) => ctx.getText(),
+    validateSwitchStatement: () => undefined,
+    getExpressionEnumType: () => null,
+    getExpressionType: () => options.keyType ?? "u8",
+    getCurrentFunctionReturnType: () => options.returnType ?? null,
+    indent: (text: string) =>
+      text
+        .split("\n")
+        .map((line) => `    ${line}`)
+        .join("\n"),
+    generateStatement: (stmt: Parser.StatementContext) => {
+      const assign = stmt.assignmentStatement();
+      if (assign) {
+        const target = assign.assignmentTarget().getText();
+        const op = assign.assignmentOperator().getText() === "<-" ? "=" : "+=";
+        return `${target} ${op} ${toC(assign.expression().getText())};`;
+      }
+      const value = stmt.returnStatement()?.expression()?.getText();
+      return value ? `return ${toC(value)};` : stmt.getText();
+    },
+  } as unknown as IOrchestrator;
+}
+
+function lower(
+  body: string,
+  orchestrator = createOrchestrator(),
+  enumType: string | null = null,
+): string | null {
+  const node = parseSwitch(body);
+  return (
+    SwitchTableHelper.tryGenerate(
+      node,
+      node.expression().getText(),
+      enumType,
+      createInput(),
+      orchestrator,
+    )?.code ?? null
+  );
+}
+
+const ASSIGN_SWITCH = `
+  switch (code) {
+      case 1 { result <- 10; }
+      case 2 { result <- 20; }
+      case 3 { result <- 30; }
+      default { result <- 99; }
+  }`;
+
+describe("SwitchTableHelper", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  describe("tryGenerate", () => {
+    it("lowers constant assignments to a bounds-checked table", () => {
+      expect(lower(ASSIGN_SWITCH)).toBe(
+        [
+          "{",
+          "    static const uint32_t _cnx_table_0[3] = {10U, 20U, 30U};",
+          "    const uint32_t _cnx_key_0 = (uint32_t)(code) - 1U;",
+          "    if (_cnx_key_0 < 3U) {",
+          "        result = _cnx_table_0[_cnx_key_0];",
+          "    } else {",
+          "        result = 99U;",
+          "    }",
+          "}",
+        ].join("\n"),
+      );
+    });
+
+    it("fills gaps with the default constant and expands || labels", () => {
+      const code = lower(`
+        switch (code) {
+            case 0 || 1 { result <- 5; }
+            case 3 { result <- 7; }
+            case 4 { result <- 8; }
+            default { result <- 0; }
+        }`);
+
+      expect(code).toContain("[5] = {5U, 5U, 0U, 7U, 8U};");
+      expect(code).toContain("= (uint32_t)(code);");
+    });
+
+    it("adds the offset for negative labels", () => {
+      expect(
+        lower(`
+          switch (code) {
+              case -1 { result <- 1; }
+              case 0 { result <- 2; }
+              case 1 { result <- 3; }
+          }`),
+      ).toContain("const uint32_t _cnx_key_0 = (uint32_t)(code) + 1U;");
+    });
+
+    it("tabulates enum keys and returned constants", () => {
+      const code = lower(
+        `switch (color) {
+            case Color.RED { return Color.BLUE; }
+            case Color.GREEN { return Color.RED; }
+            case Color.BLUE { return Color.GREEN; }
+        }`,
+        createOrchestrator({ keyType: "Color", returnType: "Color" }),
+      );
+
+      expect(code).toContain(
+        "static const Color _cnx_table_0[3] = {Color_BLUE, Color_RED, Color_GREEN};",
+      );
+      expect(code).toContain("return _cnx_table_0[_cnx_key_0];");
+      expect(code).not.toContain("else");
+    });
+
+    it("resolves unqualified labels against the switch enum type", () => {
+      const code = lower(
+        `switch (color) {
+            case RED { result <- 1; }
+            case GREEN { result <- 2; }
+            case BLUE { result <- 3; }
+        }`,
+        createOrchestrator({ keyType: "Color" }),
+        "Color",
+      );
+
+      expect(code).toContain("= {1U, 2U, 3U};");
+    });
+
+    it("uses a 64-bit key for 64-bit switch expressions", () => {
+      const code = lower(ASSIGN_SWITCH, createOrchestrator({ keyType: "u64" }));
+
+      expect(code).toContain(
+        "const uint64_t _cnx_key_0 = (uint64_t)(code) - 1ULL;",
+      );
+      expect(code).toContain("if (_cnx_key_0 < 3ULL) {");
+    });
+
+    it("uses static_cast for the key in C++ mode", () => {
+      CodeGenState.cppMode = true;
+      const code = lower(ASSIGN_SWITCH, createOrchestrator());
+
+      expect(code).toContain(
+        "const uint32_t _cnx_key_0 = static_cast<uint32_t>(code) - 1U;",
+      );
+    });
+
+        it("keeps a non-constant default as the out-of-range path", () => {
+      const code = lower(`
+        switch (code) {
+            case 0 { result <- 1; }
+            case 1 { result <- 2; }
+            case 2 { result <- 3; }
+            default { other <- 1; result <- 0; }
+        }`)!;
+
+      expect(code).toContain(
+        "    } else {\n        other = 1U;\n        result = 0U;\n    }",
+      );
+    });
+
+    it("leaves sparse and short switches alone", () => {
+      expect(
+        lower(`
+          switch (code) {
+              case 0 { result <- 1; }
+              case 10 { result <- 2; }
+              case 100 { result <- 3; }
+              default { result <- 0; }
+          }`),
+      ).toBeNull();
+      expect(
+        lower(`
+          switch (code) {
+              case 0 { result <- 1; }
+              case 1 { result <- 2; }
+          }`),
+      ).toBeNull();
+    });
+
+    it("leaves gaps without a constant default alone", () => {
+      expect(
+        lower(`
+          switch (code) {
+              case 0 { result <- 1; }
+              case 2 { result <- 2; }
+              case 3 { result <- 3; }
+          }`),
+      ).toBeNull();
+    });
+
+    it("requires one constant statement per case on the same target", () => {
+      const bodies = [
+        "case 0 { result <- 1; other <- 1; }",
+        "case 0 { result <- code; }",
+        "case 0 { result +<- 1; }",
+        "case 0 { other <- 1; }",
+        "case 0 { return 1; }",
+      ];
+      for (const body of bodies) {
+        expect(
+          lower(`
+            switch (code) {
+                ${body}
+                case 1 { result <- 2; }
+                case 2 { result <- 3; }
+            }`),
+        ).toBeNull();
+      }
+    });
+
+    it("requires a scalar target of known type", () => {
+      expect(
+        lower(`
+          switch (code) {
+              case 0 { buffer <- 1; }
+              case 1 { buffer <- 2; }
+              case 2 { buffer <- 3; }
+          }`),
+      ).toBeNull();
+      expect(
+        lower(`
+          switch (code) {
+              case 0 { unknown <- 1; }
+              case 1 { unknown <- 2; }
+              case 2 { unknown <- 3; }
+          }`),
+      ).toBeNull();
+    });
+  });
+
+  describe("resolveLabelValue", () => {
+    function labels(text: string): (bigint | null)[] {
+      const node = parseSwitch(`switch (code) { case ${text} { } }`);
+      return node
+        .switchCase(0)!
+        .caseLabel()
+        .map((label) =>
+          SwitchTableHelper.resolveLabelValue(label, null, createInput()),
+        );
+    }
+
+    it("resolves integer literals in every base", () => {
+      const values = labels("10 || -3 || 0x1F || -0x10 || 0b101");
+
+      expect(values).toEqual([10n, -3n, 31n, -16n, 5n]);
+    });
+
+    it("resolves character literals and simple escapes", () => {
+      expect(labels(String.raw`'A' || '\n' || '\0'`)).toEqual([65n, 10n, 0n]);
+    });
+
+    it("resolves enum members and integer constants", () => {
+      expect(labels("Color.BLUE || LIMIT || MISSING")).toEqual([2n, 7n, null]);
+    });
+  });
+});
+
+describe("SwitchGenerator with switchTables", () => {
+  const state = {} as IGeneratorState;
+
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  it("emits the lookup table and requires stdint.h", () => {
+    const result = switchGenerators.generateSwitch(
+      parseSwitch(ASSIGN_SWITCH),
+      createInput(),
+      state,
+      createOrchestrator(),
+    );
+
+    expect(result.code.startsWith("{\n    static const uint32_t")).toBe(true);
+    expect(result.effects).toEqual([{ type: "include", header: "stdint" }]);
+  });
+
+  it("emits a C switch when the option is off", () => {
+    const result = switchGenerators.generateSwitch(
+      parseSwitch(ASSIGN_SWITCH),
+      createInput(false),
+      state,
+      createOrchestrator(),
+    );
+
+    expect(result.code).toContain("switch (code) {");
+    expect(result.code).toContain("    case 1: {");
+  });
+});
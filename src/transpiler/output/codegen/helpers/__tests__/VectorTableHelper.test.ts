@@ -0,0 +1,175 @@
+/**
+ * Unit tests for VectorTableHelper
+ */
+
+import { describe, it, expect, beforeEach } from "vitest";
+import VectorTableHelper from "../VectorTableHelper";
+import CNextSourceParser from "../../../../logic/parser/CNextSourceParser";
+import CodeGenState from "../../../../state/CodeGenState";
+
+const VECTORS = `
+register VectorTable @ 0x08000000 {
+    SysTick: ISR rw @ 0x3C,
+    IRQ: ISR[240] rw @ 0x40,
+    VTOR: u32 rw @ 0x400,
+}
+`;
+
+/**
+ * Parse a source file, register its functions as CodeGenerator does and
+ * collect its vector tables.
+ */
+function collect(source: string): void {
+  const { tree } = CNextSourceParser.parse(source);
+  for (const decl of tree.declaration()) {
+    const func = decl.functionDeclaration();
+    if (func) {
+      CodeGenState.functionDeclarations.set(func.IDENTIFIER().getText(), func);
+    }
+    const scope = decl.scopeDeclaration();
+    for (const member of scope?.scopeMember() ?? []) {
+      const scoped = member.functionDeclaration();
+      if (scoped) {
+        const name = `${scope!.IDENTIFIER().getText()}_${scoped.IDENTIFIER().getText()}`;
+        CodeGenState.functionDeclarations.set(name, scoped);
+      }
+    }
+  }
+  VectorTableHelper.collect(tree);
+}
+
+describe("VectorTableHelper", () => {
+  beforeEach(() => {
+    CodeGenState.reset();
+  });
+
+  describe("collect", () => {
+    it("maps ISR members to slots and binds handlers", () => {
+      collect(`${VECTORS}
+        void tick() { }
+        void uartRx() { }
+        void init() {
+            VectorTable.SysTick <- tick;
+            VectorTable.IRQ[20] <- uartRx;
+        }`);
+
+      const table = CodeGenState.vectorTables.get("VectorTable")!;
+      expect(table.length).toBe(256);
+      expect(table.members.get("SysTick")).toEqual({ slot: 15, count: null });
+      expect(table.members.get("IRQ")).toEqual({ slot: 16, count: 240 });
+      expect(table.members.has("VTOR")).toBe(false);
+      expect(table.bindings.get(36)).toEqual({
+        handler: "uartRx",
+        target: "VectorTable.IRQ[20]",
+      });
+      expect([...CodeGenState.isrHandlers]).toEqual(["tick", "uartRx"]);
+      expect(CodeGenState.needsISR).toBe(true);
+    });
+
+    it("resolves this. handlers inside a scope", () => {
+      collect(`${VECTORS}
+        scope Uart {
+            void rx() { }
+            public void init() {
+                VectorTable.IRQ[0] <- this.rx;
+            }
+        }`);
+
+      expect(CodeGenState.isrHandlers.has("Uart_rx")).toBe(true);
+    });
+
+    it("ignores registers without ISR members", () => {
+      collect("register GPIO @ 0x40000000 { DR: u32 rw @ 0x00, }");
+
+      expect(CodeGenState.vectorTables.size).toBe(0);
+      expect(CodeGenState.needsISR).toBe(false);
+    });
+
+    it("rejects IRQ numbers outside the declared table", () => {
+      expect(() =>
+        collect(`${VECTORS}
+          void handler() { }
+          void init() { VectorTable.IRQ[240] <- handler; }`),
+      ).toThrow("Error: IRQ 240 is outside VectorTable.IRQ[240]");
+    });
+
+    it("rejects two handlers for one slot", () => {
+      expect(() =>
+        collect(`${VECTORS}
+          void a() { }
+          void b() { }
+          void init() {
+              VectorTable.IRQ[3] <- a;
+              VectorTable.IRQ[3] <- b;
+          }`),
+      ).toThrow(
+        "Error: vector VectorTable.IRQ[3] is bound to both 'a' and 'b'",
+      );
+    });
+
+    it("rejects handlers that are not void() functions", () => {
+      expect(() =>
+        collect(`${VECTORS}
+          void handler(u8 code) { }
+          void init() { VectorTable.SysTick <- handler; }`),
+      ).toThrow("must be bound to a void() function of this file");
+    });
+
+    it("rejects misaligned and overlapping slots", () => {
+      expect(() =>
+        collect("register V @ 0x0 { A: ISR rw @ 0x06, }"),
+      ).toThrow("Error: vector V.A offset '0x06' must be a constant multiple");
+      expect(() =>
+        collect("register V @ 0x0 { A: ISR[4] rw @ 0x00, B: ISR rw @ 0x08, }"),
+      ).toThrow("Error: vectors V.A and V.B share slot 2 of V");
+    });
+  });
+
+  describe("generation", () => {
+    beforeEach(() => {
+      collect(`${VECTORS}
+        void tick() { }
+        void init() { VectorTable.SysTick <- tick; }`);
+    });
+
+    it("emits the table with positional entries", () => {
+      const lines = VectorTableHelper.generateTables();
+
+      expect(lines).toContain("CNX_VECTORS(1024)");
+      expect(lines).toContain("const ISR VectorTable[256] = {");
+      expect(lines).toContain("    0, 0, 0, 0, 0, 0, 0, 0,");
+      expect(lines).toContain("    0, 0, 0, 0, 0, 0, 0,");
+      expect(lines).toContain("    tick, /* 15: VectorTable.SysTick */");
+      expect(lines.at(-1)).toBe("};");
+    });
+
+    it("declares the table and read access to its slots", () => {
+      const table = CodeGenState.vectorTables.get("VectorTable")!;
+
+      expect(VectorTableHelper.generateDeclaration(table)).toEqual([
+        "extern const ISR VectorTable[256];",
+        "#define VectorTable_SysTick (VectorTable[15])",
+        "#define VectorTable_IRQ (&VectorTable[16])",
+      ]);
+    });
+
+    it("recognizes ISR[N] members as slot ranges", () => {
+      expect(VectorTableHelper.isSlotRange("VectorTable_IRQ")).toBe(true);
+      expect(VectorTableHelper.isSlotRange("VectorTable_SysTick")).toBe(false);
+      expect(VectorTableHelper.isSlotRange("GPIO_DR")).toBe(false);
+    });
+
+    it("marks bound handlers with CNX_ISR", () => {
+      expect(VectorTableHelper.getHandlerAttribute("tick")).toBe("CNX_ISR ");
+      expect(VectorTableHelper.getHandlerAttribute("init")).toBe("");
+    });
+
+    it("places handlers in the configured section", () => {
+      CodeGenState.isrSection = ".fastrun";
+
+      expect(VectorTableHelper.generateMacros()).toContain(
+        '#define CNX_ISR __attribute__((interrupt("IRQ"), aligned(4), section(".fastrun")))',
+      );
+    });
+  });
+});
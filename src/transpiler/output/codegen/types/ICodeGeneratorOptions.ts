@@ -6,6 +6,40 @@ import ICodeGenSymbols from "../../../types/ICodeGenSymbols";
 interface ICodeGeneratorOptions {
   /** ADR-044: When true, generate panic helpers instead of clamp helpers */
   debugMode?: boolean;
+  /** When true, enums use the smallest backing width that holds all values */
+  compactEnums?: boolean;
+  /** When true, one-dimensional bool arrays are bit-packed into uint32_t words */
+  packedBoolArrays?: boolean;
+  /** Structs whose arrays are stored as one array per field */
+  soaStructs?: string[];
+  /** Scope functions (C names) to emit with internal linkage */
+  internalFunctions?: ReadonlySet<string>;
+  /** Scope functions and variables (C names) no root reaches; not emitted */
+  deadSymbols?: ReadonlySet<string>;
+  /** Amalgamation: helpers emitted so far, shared across files (mutated) */
+  emittedHelpers?: Set<string>;
+  /** When true, clamp/safe-div helpers come from the shared cnx_runtime.h */
+  sharedHelpers?: boolean;
+  /** When true, array arithmetic uses CMSIS-DSP on targets with hasDsp */
+  cmsisDsp?: boolean;
+  /** When true, dense value-mapping switches lower to lookup tables */
+  switchTables?: boolean;
+  /** When true, safe_div/safe_mod/safe_divmod by constants skip the helpers */
+  strengthReduce?: boolean;
+  /** When true, clamp and safe-div helpers mark error branches unlikely */
+  branchHints?: boolean;
+  /** Functions (Scope.fn or C names) defined with the cold attribute */
+  coldFunctions?: string[];
+  /** Functions (Scope.fn or C names) defined with the hot attribute */
+  hotFunctions?: string[];
+  /** ADR-106: Registers with ISR members become const vector tables */
+  staticVectors?: boolean;
+  /** ADR-106: Linker section for bound interrupt handlers (e.g. ITCM) */
+  isrSection?: string;
+  /** Qualify pointer parameters restrict where no call site aliases them */
+  restrictParams?: boolean;
+  /** ADR-054: Range-check array subscripts for the bounds report */
+  boundsReport?: boolean;
   /**
    * ADR-055: Pre-collected symbol info from CNextResolver + TSymbolInfoAdapter.
    * When provided, CodeGenerator uses this instead of creating SymbolCollector.
@@ -32,6 +32,21 @@ interface IHeaderOptions {
    * This allows C-Next callbacks to match C++ function pointer signatures.
    */
   cppMode?: boolean;
+
+  /**
+   * Compact enum storage: enum typedefs use the smallest backing width.
+   * Must match the code generator setting so .c and .h definitions agree.
+   */
+  compactEnums?: boolean;
+
+  /**
+   * Packed bool arrays: extern declarations use uint32_t word storage.
+   * Must match the code generator setting.
+   */
+  packedBoolArrays?: boolean;
+
+  /** Target word size used for struct layout (default: 32) */
+  targetWordSize?: 8 | 16 | 32;
 }
 
 export default IHeaderOptions;
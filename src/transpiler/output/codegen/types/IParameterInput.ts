@@ -73,6 +73,12 @@ interface IParameterInput {
    * in ParameterSignatureBuilder to avoid dual code paths.
    */
   isOpaqueHandle?: boolean;
+
+  /**
+   * restrictParams: no call site passes storage this parameter can alias,
+   * so a pointer parameter is qualified restrict (__restrict__ in C++).
+   */
+  isRestrict?: boolean;
 }
 
 export default IParameterInput;
@@ -11,6 +11,9 @@ interface IPostfixChainDeps {
     identifierChain: string[],
     memberName: string,
   ): string;
+
+  /** Check if a target is a struct-of-arrays array (soaStructs) */
+  isStructOfArrays?(target: string): boolean;
 }
 
 export default IPostfixChainDeps;
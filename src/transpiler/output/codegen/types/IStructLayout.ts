@@ -0,0 +1,19 @@
+import ITypeLayout from "./ITypeLayout";
+
+/**
+ * Computed memory layout of a struct: field offsets plus padding totals
+ */
+interface IStructLayout extends ITypeLayout {
+  /** Total padding bytes (inter-field and trailing) */
+  padding: number;
+
+  /** Fields in emission order with their offsets */
+  fields: Array<{
+    name: string;
+    offset: number;
+    size: number;
+    align: number;
+  }>;
+}
+
+export default IStructLayout;
@@ -7,6 +7,8 @@ interface ITargetCapabilities {
   wordSize: 8 | 16 | 32;
   hasLdrexStrex: boolean;
   hasBasepri: boolean;
+  /** ARMv7E-M DSP extension (SIMD/saturating instructions, CMSIS-DSP) */
+  hasDsp?: boolean;
 }
 
 export default ITargetCapabilities;
@@ -0,0 +1,9 @@
+/**
+ * Size and alignment of a type for a given target, in bytes
+ */
+interface ITypeLayout {
+  size: number;
+  align: number;
+}
+
+export default ITypeLayout;
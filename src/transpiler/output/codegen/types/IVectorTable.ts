@@ -0,0 +1,19 @@
+/**
+ * ADR-106: A register declaration emitted as a static const vector table
+ * (staticVectors option)
+ */
+
+interface IVectorTable {
+  /** Register name, also the name of the C array */
+  name: string;
+  /** Base address (C) the linker script places the table at */
+  baseAddress: string;
+  /** Word slots in the table: highest declared ISR slot + 1 */
+  length: number;
+  /** ISR members: first slot, element count for ISR[N] members (else null) */
+  members: Map<string, { slot: number; count: number | null }>;
+  /** Bound slots: handler C name and the bound member (R.M or R.M[i]) */
+  bindings: Map<number, { handler: string; target: string }>;
+}
+
+export default IVectorTable;
@@ -0,0 +1,16 @@
+import ICodeGenSymbols from "../../../types/ICodeGenSymbols";
+
+/**
+ * Symbol data needed for type layout computation.
+ * Satisfied by both ICodeGenSymbols and the header type input.
+ */
+type TLayoutSymbols = Pick<
+  ICodeGenSymbols,
+  "structFields"
+  | "structFieldDimensions"
+  | "reorderedStructs"
+  | "enumMembers"
+  | "bitmapBackingType"
+>;
+
+export default TLayoutSymbols;
@@ -20,6 +20,8 @@ type TTypeInfo = {
   isExternalCppType?: boolean; // Issue #375: C++ types instantiated via constructor
   isParameter?: boolean; // Issue #579: Track if this is a function parameter (becomes pointer in C)
   isPointer?: boolean; // Issue #895 Bug B: Track if variable is a pointer (inferred from C function return type)
+  isPackedBool?: boolean; // bool[N] stored as uint32_t words (packedBoolArrays)
+  isStructOfArrays?: boolean; // Struct array stored one array per field (soaStructs)
 };
 
 export default TTypeInfo;
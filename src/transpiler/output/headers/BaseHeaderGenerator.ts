@@ -12,6 +12,7 @@ import IHeaderOptions from "../codegen/types/IHeaderOptions";
 import IHeaderTypeInput from "./generators/IHeaderTypeInput";
 import typeUtils from "./generators/mapType";
 import HeaderGeneratorUtils from "./HeaderGeneratorUtils";
+import FixedPointUtils from "../../../utils/FixedPointUtils";
 // Unified parameter generation (Phase 1)
 import ParameterInputAdapter from "../codegen/helpers/ParameterInputAdapter";
 import ParameterSignatureBuilder from "../codegen/helpers/ParameterSignatureBuilder";
@@ -113,7 +114,11 @@ abstract class BaseHeaderGenerator {
       ...HeaderGeneratorUtils.generateForwardDeclarations(
         cCompatibleExternalTypes,
       ),
-      ...HeaderGeneratorUtils.generateEnumSection(groups.enums, typeInput),
+      ...HeaderGeneratorUtils.generateEnumSection(
+        groups.enums,
+        typeInput,
+        options,
+      ),
       ...HeaderGeneratorUtils.generateBitmapSection(groups.bitmaps, typeInput),
       ...HeaderGeneratorUtils.generateTypeAliasSection(groups.types),
       ...HeaderGeneratorUtils.generateCallbackStructForwardDecls(
@@ -128,8 +133,12 @@ abstract class BaseHeaderGenerator {
         groups.structs,
         groups.classes,
         typeInput,
+        options,
+      ),
+      ...HeaderGeneratorUtils.generateVariableSection(
+        cCompatibleVariables,
+        options,
       ),
-      ...HeaderGeneratorUtils.generateVariableSection(cCompatibleVariables),
       ...this.generateFunctionSection(
         groups.functions,
         passByValueParams,
@@ -204,11 +213,12 @@ abstract class BaseHeaderGenerator {
     passByValueSet?: ReadonlySet<string>,
     allKnownEnums?: ReadonlySet<string>,
   ): string {
-    // Pre-compute pass-by-value (ISR, float, enum, or explicitly marked)
+    // Pre-compute pass-by-value (ISR, float, Q type, enum, or explicitly marked)
     const isPassByValue =
       p.type === "ISR" ||
       p.type === "f32" ||
       p.type === "f64" ||
+      FixedPointUtils.isFixedPoint(p.type) ||
       allKnownEnums?.has(p.type) ||
       passByValueSet?.has(p.name) ||
       false;
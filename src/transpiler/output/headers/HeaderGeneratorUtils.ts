@@ -16,6 +16,7 @@ import generateEnumHeader from "./generators/generateEnumHeader";
 import generateStructHeader from "./generators/generateStructHeader";
 import generateBitmapHeader from "./generators/generateBitmapHeader";
 import VariableDeclarationFormatter from "../codegen/helpers/VariableDeclarationFormatter";
+import PackedBoolArrayHelper from "../codegen/helpers/PackedBoolArrayHelper";
 import type IVariableFormatInput from "../codegen/types/IVariableFormatInput";
 import MisraSuppressionUtils from "../MisraSuppressionUtils";
 
@@ -398,6 +399,7 @@ class HeaderGeneratorUtils {
   static generateEnumSection(
     enums: IHeaderSymbol[],
     typeInput?: IHeaderTypeInput,
+    options: IHeaderOptions = {},
   ): string[] {
     if (enums.length === 0) {
       return [];
@@ -406,7 +408,7 @@ class HeaderGeneratorUtils {
     const lines: string[] = ["/* Enumerations */"];
     for (const sym of enums) {
       if (typeInput) {
-        lines.push(generateEnumHeader(sym.name, typeInput));
+        lines.push(generateEnumHeader(sym.name, typeInput, options));
       } else {
         lines.push(`/* Enum: ${sym.name} (see implementation for values) */`);
       }
@@ -539,6 +541,7 @@ class HeaderGeneratorUtils {
     structs: IHeaderSymbol[],
     classes: IHeaderSymbol[],
     typeInput?: IHeaderTypeInput,
+    options: IHeaderOptions = {},
   ): string[] {
     if (structs.length === 0 && classes.length === 0) {
       return [];
@@ -549,10 +552,10 @@ class HeaderGeneratorUtils {
     if (typeInput) {
       lines.push("/* Struct definitions */");
       for (const sym of structs) {
-        lines.push(generateStructHeader(sym.name, typeInput));
+        lines.push(generateStructHeader(sym.name, typeInput, options));
       }
       for (const sym of classes) {
-        lines.push(generateStructHeader(sym.name, typeInput));
+        lines.push(generateStructHeader(sym.name, typeInput, options));
       }
     } else {
       lines.push("/* Forward declarations */");
@@ -563,7 +566,10 @@ class HeaderGeneratorUtils {
         lines.push(`typedef struct ${sym.name} ${sym.name};`);
       }
     }
-    lines.push("");
+    // Size-checked struct definitions already end with a blank line
+    if (!lines.at(-1)!.endsWith("\n")) {
+      lines.push("");
+    }
     return lines;
   }
 
@@ -571,19 +577,30 @@ class HeaderGeneratorUtils {
    * Generate extern variable declarations section
    *
    * Uses VariableDeclarationFormatter for consistent formatting with CodeGenerator.
+   * With packedBoolArrays, packed bool arrays are declared as their word storage.
    */
-  static generateVariableSection(variables: IHeaderSymbol[]): string[] {
+  static generateVariableSection(
+    variables: IHeaderSymbol[],
+    options: IHeaderOptions = {},
+  ): string[] {
     if (variables.length === 0) {
       return [];
     }
 
     const lines: string[] = ["/* External variables */"];
     for (const sym of variables) {
+      const packedWords = options.packedBoolArrays
+        ? HeaderGeneratorUtils.getPackedBoolWordCount(sym)
+        : null;
+
       // Build normalized input for the unified formatter
       const input: IVariableFormatInput = {
         name: sym.name,
         cnextType: sym.type || "int",
-        mappedType: mapType(sym.type || "int"),
+        mappedType:
+          packedWords === null
+            ? mapType(sym.type || "int")
+            : PackedBoolArrayHelper.WORD_TYPE,
         modifiers: {
           isConst: sym.isConst ?? false,
           isAtomic: sym.isAtomic ?? false,
@@ -591,7 +608,9 @@ class HeaderGeneratorUtils {
           isExtern: true, // Headers always use extern
         },
         arrayDimensions:
-          sym.isArray && sym.arrayDimensions ? sym.arrayDimensions : undefined,
+          packedWords === null
+            ? HeaderGeneratorUtils.getArrayDimensions(sym)
+            : [String(packedWords)],
       };
 
       const declaration = VariableDeclarationFormatter.format(input);
@@ -601,6 +620,36 @@ class HeaderGeneratorUtils {
     return lines;
   }
 
+  /** Array dimensions of a non-packed variable */
+  private static getArrayDimensions(
+    sym: IHeaderSymbol,
+  ): readonly string[] | undefined {
+    return sym.isArray && sym.arrayDimensions ? sym.arrayDimensions : undefined;
+  }
+
+  /**
+   * Word count of a packed bool array variable, or null if not packed.
+   * Mirrors the eligibility check used when registering variable types.
+   */
+  private static getPackedBoolWordCount(sym: IHeaderSymbol): number | null {
+    if (!sym.isArray || !sym.arrayDimensions) {
+      return null;
+    }
+    const dims = sym.arrayDimensions
+      .filter((d) => /^\d+$/.test(d))
+      .map((d) => Number.parseInt(d, 10));
+    if (
+      !PackedBoolArrayHelper.isEligible(
+        sym.type ?? "",
+        dims,
+        sym.arrayDimensions.length,
+      )
+    ) {
+      return null;
+    }
+    return PackedBoolArrayHelper.wordCount(dims[0]);
+  }
+
   /**
    * Generate C++ extern "C" wrapper closing and header guard end
    */
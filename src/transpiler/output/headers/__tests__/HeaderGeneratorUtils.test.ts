@@ -728,6 +728,39 @@ describe("HeaderGeneratorUtils", () => {
       expect(lines).toContain("typedef struct Shape Shape;");
       expect(lines).toContain("/* Forward declarations */");
     });
+
+    it("separates size-checked definitions with one blank line", () => {
+      const fields = new Map([
+        ["flag", "u8"],
+        ["value", "u32"],
+        ["id", "u16"],
+      ]);
+      const typeInput = {
+        enumMembers: new Map(),
+        structFields: new Map([
+          ["Packet", fields],
+          ["Frame", fields],
+        ]),
+        structFieldDimensions: new Map(),
+        reorderedStructs: new Set(["Packet", "Frame"]),
+        bitmapBackingType: new Map(),
+        bitmapFields: new Map(),
+      };
+      const structs = [
+        makeSymbol({ name: "Packet", kind: "struct" }),
+        makeSymbol({ name: "Frame", kind: "struct" }),
+      ];
+
+      const text = HeaderGeneratorUtils.generateStructSection(
+        structs,
+        [],
+        typeInput,
+        { cppMode: true },
+      ).join("\n");
+
+      expect(text).toContain('layout");\n\ntypedef struct Frame {');
+      expect(text.endsWith('layout");\n')).toBe(true);
+    });
   });
 
   describe("generateVariableSection", () => {
@@ -792,6 +825,45 @@ describe("HeaderGeneratorUtils", () => {
 
       expect(lines).toContain("extern uint8_t buffer[64];");
     });
+
+    describe("packed bool arrays", () => {
+      const flags = makeSymbol({
+        name: "flags",
+        kind: "variable",
+        type: "bool",
+        isArray: true,
+        arrayDimensions: ["40"],
+      });
+
+      it("declares word storage when enabled", () => {
+        const lines = HeaderGeneratorUtils.generateVariableSection([flags], {
+          packedBoolArrays: true,
+        });
+
+        expect(lines).toContain("extern uint32_t flags[2];");
+      });
+
+      it("keeps bool storage by default", () => {
+        const lines = HeaderGeneratorUtils.generateVariableSection([flags]);
+
+        expect(lines).toContain("extern bool flags[40];");
+      });
+
+      it("keeps bool storage for multi-dimensional arrays", () => {
+        const grid = makeSymbol({
+          name: "grid",
+          kind: "variable",
+          type: "bool",
+          isArray: true,
+          arrayDimensions: ["4", "8"],
+        });
+        const lines = HeaderGeneratorUtils.generateVariableSection([grid], {
+          packedBoolArrays: true,
+        });
+
+        expect(lines).toContain("extern bool grid[4][8];");
+      });
+    });
   });
 
   describe("generateHeaderEnd", () => {
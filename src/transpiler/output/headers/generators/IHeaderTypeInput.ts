@@ -23,6 +23,9 @@ interface IHeaderTypeInput {
     ReadonlyMap<string, readonly number[]>
   >;
 
+  /** Structs emitted in padding-minimizing order (C names) */
+  readonly reorderedStructs?: ReadonlySet<string>;
+
   /** Backing type for each bitmap: bitmapName -> typeName (e.g., "uint8_t") */
   readonly bitmapBackingType: ReadonlyMap<string, string>;
 
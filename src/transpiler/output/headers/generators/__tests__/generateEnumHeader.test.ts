@@ -164,4 +164,34 @@ describe("generateEnumHeader", () => {
       expect(result).toContain("Bounds_ZERO = 0");
     });
   });
+
+  describe("compact enums", () => {
+    it("should emit packed enum in C headers", () => {
+      const members = new Map<string, number>([
+        ["IDLE", 0],
+        ["ERROR", 200],
+      ]);
+      const input = createInput(new Map([["State", members]]));
+
+      const result = generateEnumHeader("State", input, { compactEnums: true });
+
+      expect(result).toContain("typedef enum __attribute__((packed)) {");
+      expect(result).toContain("State_ERROR = 200");
+    });
+
+    it("should emit fixed underlying type in C++ headers", () => {
+      const members = new Map<string, number>([
+        ["IDLE", 0],
+        ["ERROR", 200],
+      ]);
+      const input = createInput(new Map([["State", members]]));
+
+      const result = generateEnumHeader("State", input, {
+        compactEnums: true,
+        cppMode: true,
+      });
+
+      expect(result).toContain("typedef enum : uint8_t {");
+    });
+  });
 });
@@ -219,4 +219,98 @@ describe("generateStructHeader", () => {
       expect(result).toContain("char label[17];");
     });
   });
+
+  describe("reordered structs", () => {
+    const fields = new Map([
+      [
+        "Mixed",
+        new Map<string, string>([
+          ["a", "u8"],
+          ["b", "u32"],
+          ["c", "u16"],
+        ]),
+      ],
+    ]);
+
+    /**
+     * Header input with one struct selected for reordering
+     */
+    function reordered(
+      structFields: Map<string, Map<string, string>>,
+      name: string,
+    ) {
+      return {
+        ...createInput(structFields),
+        reorderedStructs: new Set([name]),
+      };
+    }
+
+    it("should match the code generator order and assert the size", () => {
+      const result = generateStructHeader("Mixed", reordered(fields, "Mixed"));
+
+      expect(result).toBe(
+        [
+          "typedef struct Mixed {",
+          "    uint32_t b;",
+          "    uint16_t c;",
+          "    uint8_t a;",
+          "} Mixed;",
+          "#ifdef __cplusplus",
+          'static_assert(sizeof(Mixed) == 8, "Mixed size differs from the computed layout");',
+          "#else",
+          '_Static_assert(sizeof(Mixed) == 8, "Mixed size differs from the computed layout");',
+          "#endif",
+          "",
+        ].join("\n"),
+      );
+    });
+
+    it("should keep declaration order for structs not selected", () => {
+      const result = generateStructHeader("Mixed", reordered(fields, "Other"));
+
+      expect(result.split("\n").slice(1, 4)).toEqual([
+        "    uint8_t a;",
+        "    uint32_t b;",
+        "    uint16_t c;",
+      ]);
+      expect(result).not.toContain("static_assert");
+    });
+
+    it("should keep declaration order when reordering does not shrink", () => {
+      const ordered = new Map([
+        [
+          "Ordered",
+          new Map<string, string>([
+            ["first", "u8"],
+            ["second", "u16"],
+            ["third", "u32"],
+          ]),
+        ],
+      ]);
+
+      const result = generateStructHeader(
+        "Ordered",
+        reordered(ordered, "Ordered"),
+        { cppMode: true },
+      );
+      const lines = result.split("\n");
+
+      expect(lines[1]).toContain("first");
+      expect(lines[2]).toContain("second");
+      expect(lines[3]).toContain("third");
+      expect(lines[5]).toBe(
+        'static_assert(sizeof(Ordered) == 8, "Ordered size differs from the computed layout");',
+      );
+    });
+
+    it("should use the target word size for the asserted size", () => {
+      const result = generateStructHeader("Mixed", reordered(fields, "Mixed"), {
+        cppMode: true,
+        targetWordSize: 8,
+      });
+
+      expect(result).toContain("uint8_t a;\n    uint32_t b;");
+      expect(result).toContain("sizeof(Mixed) == 7");
+    });
+  });
 });
@@ -6,6 +6,8 @@
  */
 
 import IHeaderTypeInput from "./IHeaderTypeInput";
+import IHeaderOptions from "../../codegen/types/IHeaderOptions";
+import CompactEnumHelper from "../../codegen/helpers/CompactEnumHelper";
 
 /**
  * Generate a C typedef enum declaration for the given enum name.
@@ -20,9 +22,14 @@ import IHeaderTypeInput from "./IHeaderTypeInput";
  *
  * @param name - The enum type name
  * @param input - Symbol information containing enum members
+ * @param options - Header options (compactEnums, cppMode select the backing type)
  * @returns C typedef enum declaration, or comment if enum data unavailable
  */
-function generateEnumHeader(name: string, input: IHeaderTypeInput): string {
+function generateEnumHeader(
+  name: string,
+  input: IHeaderTypeInput,
+  options: IHeaderOptions = {},
+): string {
   const members = input.enumMembers.get(name);
 
   // Graceful fallback if enum data not available
@@ -31,7 +38,13 @@ function generateEnumHeader(name: string, input: IHeaderTypeInput): string {
   }
 
   const lines: string[] = [];
-  lines.push("typedef enum {");
+  lines.push(
+    CompactEnumHelper.getTypedefOpening(
+      members,
+      options.compactEnums ?? false,
+      options.cppMode ?? false,
+    ),
+  );
 
   // Convert members to sorted array for consistent output
   const memberEntries = Array.from(members.entries()).sort(
@@ -6,6 +6,8 @@
  */
 
 import IHeaderTypeInput from "./IHeaderTypeInput";
+import IHeaderOptions from "../../codegen/types/IHeaderOptions";
+import StructLayoutHelper from "../../codegen/helpers/StructLayoutHelper";
 import typeUtils from "./mapType";
 import CppNamespaceUtils from "../../../../utils/CppNamespaceUtils";
 
@@ -68,11 +70,20 @@ function generateFieldLine(
  * } StructName;
  * ```
  *
+ * With reorderStructs, fields follow the padding-minimizing order used by
+ * StructGenerator and the struct size is checked with a static assertion,
+ * followed by a blank line to set it apart from the next definition.
+ *
  * @param name - The struct type name
  * @param input - Symbol information containing struct fields
+ * @param options - Header options (targetWordSize, compactEnums, cppMode)
  * @returns C typedef struct declaration, or forward declaration if data unavailable
  */
-function generateStructHeader(name: string, input: IHeaderTypeInput): string {
+function generateStructHeader(
+  name: string,
+  input: IHeaderTypeInput,
+  options: IHeaderOptions = {},
+): string {
   const fields = input.structFields.get(name);
 
   // Graceful fallback if struct data not available
@@ -85,14 +96,38 @@ function generateStructHeader(name: string, input: IHeaderTypeInput): string {
   // Issue #296: Use named struct for forward declaration compatibility
   lines.push(`typedef struct ${name} {`);
 
-  // Iterate fields in insertion order (Map preserves order)
-  for (const [fieldName, fieldType] of fields) {
+  const layout = StructLayoutHelper.isReordered(input, name)
+    ? StructLayoutHelper.getReorderedLayout(
+        input,
+        name,
+        options.targetWordSize ?? 32,
+        options.compactEnums ?? false,
+      )
+    : null;
+
+  // Iterate fields in insertion order (Map preserves order) unless reordered
+  const entries = StructLayoutHelper.orderByLayout(
+    Array.from(fields.entries()),
+    ([fieldName]) => fieldName,
+    layout,
+  );
+  for (const [fieldName, fieldType] of entries) {
     const cType = resolveFieldCType(fieldType, input);
     const dims = dimensions?.get(fieldName);
     lines.push(generateFieldLine(fieldName, cType, dims));
   }
 
   lines.push(`} ${name};`);
+  if (layout) {
+    lines.push(
+      ...StructLayoutHelper.generateHeaderSizeAssert(
+        name,
+        layout.size,
+        options.cppMode ?? false,
+      ),
+      "",
+    );
+  }
 
   return lines.join("\n");
 }
@@ -8,6 +8,7 @@
  */
 
 import CNEXT_TO_C_TYPE_MAP from "../../../../utils/constants/TypeMappings";
+import FixedPointUtils from "../../../../utils/FixedPointUtils";
 
 /**
  * Map a C-Next type to C type
@@ -17,6 +18,7 @@ import CNEXT_TO_C_TYPE_MAP from "../../../../utils/constants/TypeMappings";
  * - Pointer types (u32* -> uint32_t*)
  * - Array types (u32[10] -> uint32_t[10])
  * - String types (string<N> -> char[N+1])
+ * - Fixed-point Q types (q15 -> int16_t)
  * - User-defined types (pass through unchanged)
  *
  * @param type - The C-Next type string
@@ -35,6 +37,11 @@ function mapType(type: string): string {
     return `char[${capacity + 1}]`;
   }
 
+  const fixedPoint = FixedPointUtils.parse(type);
+  if (fixedPoint) {
+    return fixedPoint.cType;
+  }
+
   // Handle pointer types
   if (type.endsWith("*")) {
     const baseType = type.slice(0, -1).trim();
@@ -54,7 +61,7 @@ function mapType(type: string): string {
 }
 
 /**
- * Check if a type is a built-in C-Next type (primitive or string<N>)
+ * Check if a type is a built-in C-Next type (primitive, string<N> or Q type)
  * Used by header generator to avoid generating forward declarations for built-in types
  */
 function isBuiltInType(typeName: string): boolean {
@@ -68,7 +75,7 @@ function isBuiltInType(typeName: string): boolean {
     return true;
   }
 
-  return false;
+  return FixedPointUtils.isFixedPoint(typeName);
 }
 
 export default { TYPE_MAP: CNEXT_TO_C_TYPE_MAP, mapType, isBuiltInType };
@@ -22,14 +22,18 @@
  */
 
 import SymbolTable from "../logic/symbols/SymbolTable";
+import type * as Parser from "../logic/parser/grammar/CNextParser";
 import ICodeGenSymbols from "../types/ICodeGenSymbols";
 import TTypeInfo from "../output/codegen/types/TTypeInfo";
 import TParameterInfo from "../output/codegen/types/TParameterInfo";
 import IFunctionSignature from "../output/codegen/types/IFunctionSignature";
 import ICallbackTypeInfo from "../output/codegen/types/ICallbackTypeInfo";
 import ITargetCapabilities from "../output/codegen/types/ITargetCapabilities";
+import IVectorTable from "../output/codegen/types/IVectorTable";
+import IBoundsReportEntry from "../types/IBoundsReportEntry";
 import TOverflowBehavior from "../output/codegen/types/TOverflowBehavior";
 import TYPE_WIDTH from "../output/codegen/types/TYPE_WIDTH";
+import PackedBoolArrayHelper from "../output/codegen/helpers/PackedBoolArrayHelper";
 import type ICodeGenApi from "../output/codegen/types/ICodeGenApi";
 import TypeResolver from "../../utils/TypeResolver";
 
@@ -171,6 +175,10 @@ export default class CodeGenState {
   /** Function parameter lists for call graph analysis */
   static functionParamLists: Map<string, string[]> = new Map();
 
+  /** Function declarations of this file by C name (transpile-time evaluation) */
+  static functionDeclarations: Map<string, Parser.FunctionDeclarationContext> =
+    new Map();
+
   /** Issue #558: Cross-file modifications to inject */
   static pendingCrossFileModifications: ReadonlyMap<
     string,
@@ -193,6 +201,9 @@ export default class CodeGenState {
   /** Track which safe division helpers are needed: "div_u32", "mod_i16" */
   static usedSafeDivOps: Set<string> = new Set();
 
+  /** Track which array arithmetic helpers are needed: "sum_f32", "dot_q15" */
+  static usedVectorOps: Set<string> = new Set();
+
   // ===========================================================================
   // CURRENT CONTEXT (changes during AST traversal)
   // ===========================================================================
@@ -240,6 +251,10 @@ export default class CodeGenState {
    *  literals are not constant expressions and fail at file scope on GCC < 13. */
   static inDeclarationInit: boolean = false;
 
+  /** Whether the safe_div/safe_mod/safe_divmod call being generated is a whole
+   *  expression statement, so its result is unused (ADR-051 strengthReduce). */
+  static inSafeDivStatement: boolean = false;
+
   /** Expected type for struct initializers and enum inference */
   static expectedType: string | null = null;
 
@@ -295,12 +310,18 @@ export default class CodeGenState {
   /** ADR-049/050: For atomic intrinsics and critical sections */
   static needsCMSIS: boolean = false;
 
+  /** CMSIS-DSP array arithmetic (cmsisDsp option) */
+  static needsArmMath: boolean = false;
+
   /** Issue #632: For float-to-int clamp casts */
   static needsLimits: boolean = false;
 
   /** Issue #473: IRQ wrappers for critical sections */
   static needsIrqWrappers: boolean = false;
 
+  /** CNX_LIKELY/CNX_UNLIKELY/CNX_COLD branch hint macros */
+  static needsBranchHints: boolean = false;
+
   // ===========================================================================
   // OPAQUE TYPE SCOPE VARIABLES (Issue #948)
   // ===========================================================================
@@ -323,6 +344,76 @@ export default class CodeGenState {
   /** Debug mode generates panic-on-overflow helpers (ADR-044) */
   static debugMode: boolean = false;
 
+  /** Compact enum storage: enums use the smallest backing width */
+  static compactEnums: boolean = false;
+
+  /** Packed bool arrays: 1-D bool[N] stored as uint32_t bit words */
+  static packedBoolArrays: boolean = false;
+
+  /** Structs whose arrays are stored as one array per field */
+  static soaStructs: ReadonlySet<string> = new Set();
+
+  /** Scope functions (C names) emitted static by whole-program linkage */
+  static internalFunctions: ReadonlySet<string> = new Set();
+
+  /** Scope functions and variables (C names) dropped as unreachable */
+  static deadSymbols: ReadonlySet<string> = new Set();
+
+  /**
+   * Amalgamation: helpers already emitted by earlier files of the shared
+   * translation unit (null when each file is its own translation unit)
+   */
+  static emittedHelpers: Set<string> | null = null;
+
+  /** Clamp and safe-div helpers live in the project-wide cnx_runtime files */
+  static sharedHelpers: boolean = false;
+
+  /** Array arithmetic lowers to CMSIS-DSP when the target has hasDsp */
+  static cmsisDsp: boolean = false;
+
+  /** Dense value-mapping switches lower to lookup tables */
+  static switchTables: boolean = false;
+
+  /** safe_div/safe_mod/safe_divmod by constant divisors skip the helpers */
+  static strengthReduce: boolean = false;
+
+  /** Clamp and safe-div helpers mark their error branches unlikely */
+  static branchHints: boolean = false;
+
+  /** Functions (C names) defined with the cold attribute */
+  static coldFunctions: ReadonlySet<string> = new Set();
+
+  /** Functions (C names) defined with the hot attribute */
+  static hotFunctions: ReadonlySet<string> = new Set();
+
+  /** ADR-106: Registers with ISR members become const vector tables */
+  static staticVectors: boolean = false;
+
+  /** ADR-106: Linker section for bound interrupt handlers (e.g. ITCM) */
+  static isrSection: string | null = null;
+
+  /** ADR-106: Vector tables of this file, by register name */
+  static vectorTables: Map<string, IVectorTable> = new Map();
+
+  /** ADR-106: Handlers (C names) bound into a vector table */
+  static isrHandlers: Set<string> = new Set();
+
+  /** Qualify pointer parameters restrict where no call site aliases them */
+  static restrictParams: boolean = false;
+
+  /** Function C name -> parameters proven free of aliasing (restrictParams) */
+  static restrictQualified: ReadonlyMap<string, ReadonlySet<string>> =
+    new Map();
+
+  /** Call sites that kept parameters from being restrict-qualified */
+  static aliasWarnings: string[] = [];
+
+  /** ADR-054: Range-check array subscripts (bounds report) */
+  static boundsReport: boolean = false;
+
+  /** ADR-054: Subscripts checked in this file, for the bounds report */
+  static boundsEntries: IBoundsReportEntry[] = [];
+
   /** Pending temp variable declarations for C++ mode */
   static pendingTempDeclarations: string[] = [];
 
@@ -384,11 +475,13 @@ export default class CodeGenState {
     this.passByValueParams = new Map();
     this.functionCallGraph = new Map();
     this.functionParamLists = new Map();
+    this.functionDeclarations = new Map();
     // Note: pendingCrossFileModifications/ParamLists are set externally, not reset
 
     // Overflow & division helpers
     this.usedClampOps = new Set();
     this.usedSafeDivOps = new Set();
+    this.usedVectorOps = new Set();
 
     // Current context
     this.currentScope = null;
@@ -405,6 +498,7 @@ export default class CodeGenState {
     this.indentLevel = 0;
     this.inFunctionBody = false;
     this.inDeclarationInit = false;
+    this.inSafeDivStatement = false;
     this.expectedType = null;
     this.suppressBareEnumResolution = false;
     this.mainArgsName = null;
@@ -425,12 +519,36 @@ export default class CodeGenState {
     this.needsFloatStaticAssert = false;
     this.needsISR = false;
     this.needsCMSIS = false;
+    this.needsArmMath = false;
     this.needsLimits = false;
     this.needsIrqWrappers = false;
+    this.needsBranchHints = false;
 
     // C++ mode state
     this.cppMode = false;
     this.debugMode = false;
+    this.compactEnums = false;
+    this.packedBoolArrays = false;
+    this.soaStructs = new Set();
+    this.internalFunctions = new Set();
+    this.deadSymbols = new Set();
+    this.emittedHelpers = null;
+    this.sharedHelpers = false;
+    this.cmsisDsp = false;
+    this.switchTables = false;
+    this.strengthReduce = false;
+    this.branchHints = false;
+    this.coldFunctions = new Set();
+    this.hotFunctions = new Set();
+    this.staticVectors = false;
+    this.isrSection = null;
+    this.vectorTables = new Map();
+    this.isrHandlers = new Set();
+    this.restrictParams = false;
+    this.restrictQualified = new Map();
+    this.aliasWarnings = [];
+    this.boundsReport = false;
+    this.boundsEntries = [];
     this.pendingTempDeclarations = [];
     this.tempVarCounter = 0;
     this.pendingCppClassAssignments = [];
@@ -511,6 +629,18 @@ export default class CodeGenState {
     }
   }
 
+  /** Execute fn with inSafeDivStatement=true, restoring prior value on exit.
+   *  The safe division built-in consumes the flag before its arguments. */
+  static withSafeDivStatement<T>(fn: () => T): T {
+    const saved = this.inSafeDivStatement;
+    this.inSafeDivStatement = true;
+    try {
+      return fn();
+    } finally {
+      this.inSafeDivStatement = saved;
+    }
+  }
+
   /** Execute fn with inDeclarationInit=false, restoring prior value on exit.
    *  Used in sub-expression contexts (function args, ternary arms) where
    *  plain designated initializers are not valid C. */
@@ -736,20 +866,30 @@ export default class CodeGenState {
     const baseType = isString ? "char" : typeName;
 
     const isEnum = this.isKnownEnum(baseType);
+    const arrayDimensions = symbol.arrayDimensions
+      ?.map((d) => (typeof d === "number" ? d : Number.parseInt(d, 10)))
+      .filter((n) => !Number.isNaN(n));
+    const isPackedBool =
+      this.packedBoolArrays &&
+      symbol.isArray === true &&
+      PackedBoolArrayHelper.isEligible(
+        baseType,
+        arrayDimensions,
+        symbol.arrayDimensions?.length ?? 0,
+      );
 
     return {
       baseType,
       bitWidth: isString ? 8 : TYPE_WIDTH[baseType] || 0,
       isArray: symbol.isArray || false,
-      arrayDimensions: symbol.arrayDimensions
-        ?.map((d) => (typeof d === "number" ? d : Number.parseInt(d, 10)))
-        .filter((n) => !Number.isNaN(n)),
+      arrayDimensions,
       isConst: symbol.isConst || false,
       isAtomic: symbol.isAtomic || false,
       isEnum,
       enumTypeName: isEnum ? baseType : undefined,
       isString,
       stringCapacity,
+      isPackedBool: isPackedBool || undefined,
     };
   }
 
@@ -1075,6 +1215,20 @@ export default class CodeGenState {
     this.needsCMSIS = true;
   }
 
+  /**
+   * Mark that the CMSIS-DSP header is needed.
+   */
+  static requireArmMath(): void {
+    this.needsArmMath = true;
+  }
+
+  /**
+   * Mark that the branch hint macros are needed.
+   */
+  static requireBranchHints(): void {
+    this.needsBranchHints = true;
+  }
+
   /**
    * Mark that limits.h is needed.
    */
@@ -1156,6 +1310,20 @@ export default class CodeGenState {
     this.usedSafeDivOps.add(`${operation}_${cnxType}`);
   }
 
+  /**
+   * Mark an array reduction helper as used.
+   */
+  static markVectorOpUsed(operation: string, cnxType: string): void {
+    this.usedVectorOps.add(`${operation}_${cnxType}`);
+  }
+
+  /**
+   * Array arithmetic calls CMSIS-DSP (cmsisDsp option on a DSP target).
+   */
+  static usesCmsisDsp(): boolean {
+    return this.cmsisDsp && this.targetCapabilities.hasDsp === true;
+  }
+
   // ===========================================================================
   // FLOAT BIT SHADOW HELPERS
   // ===========================================================================
@@ -9,10 +9,11 @@
 import ICodeGenSymbols from "../types/ICodeGenSymbols";
 
 /**
- * Encapsulates the 6 accumulated state fields from Transpiler.
+ * Encapsulates the 7 accumulated state fields from Transpiler.
  *
  * State groups:
- * - Group 1 (Header Generation): symbolCollectors, passByValueParams, userIncludes
+ * - Group 1 (Header Generation): symbolCollectors, passByValueParams, userIncludes,
+ *   targetWordSizes
  * - Group 2 (Symbol Resolution): symbolInfoByFile
  * - Group 3 (Cross-file Type Info): headerIncludeDirectives
  * - Group 4 (Cycle Prevention): processedHeaders
@@ -32,6 +33,9 @@ class TranspilerState {
   /** Issue #424: Store user includes per file for header generation */
   private readonly userIncludes = new Map<string, string[]>();
 
+  /** Target word size each file was generated for (struct layout in headers) */
+  private readonly targetWordSizes = new Map<string, 8 | 16 | 32>();
+
   // === Group 2: Symbol Resolution State ===
 
   /** Issue #465: Store ICodeGenSymbols per file during stage 3 for external enum resolution */
@@ -60,6 +64,7 @@ class TranspilerState {
     this.symbolCollectors.clear();
     this.passByValueParams.clear();
     this.userIncludes.clear();
+    this.targetWordSizes.clear();
     this.symbolInfoByFile.clear();
     this.headerIncludeDirectives.clear();
     this.processedHeaders.clear();
@@ -125,6 +130,22 @@ class TranspilerState {
     return this.userIncludes.get(filePath) ?? [];
   }
 
+  // === Target Word Sizes (Group 1) ===
+
+  /**
+   * Store the target word size a file was generated for.
+   */
+  setTargetWordSize(filePath: string, wordSize: 8 | 16 | 32): void {
+    this.targetWordSizes.set(filePath, wordSize);
+  }
+
+  /**
+   * Get the target word size for a file (undefined if not generated).
+   */
+  getTargetWordSize(filePath: string): 8 | 16 | 32 | undefined {
+    return this.targetWordSizes.get(filePath);
+  }
+
   // === Symbol Info By File (Group 2) ===
 
   /**
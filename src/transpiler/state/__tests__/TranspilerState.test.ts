@@ -137,6 +137,22 @@ describe("TranspilerState", () => {
     });
   });
 
+  describe("Target Word Sizes (Group 1)", () => {
+    it("should store and retrieve word sizes per file", () => {
+      state.setTargetWordSize("/path/avr.cnx", 8);
+      state.setTargetWordSize("/path/arm.cnx", 32);
+
+      expect(state.getTargetWordSize("/path/avr.cnx")).toBe(8);
+      expect(state.getTargetWordSize("/path/arm.cnx")).toBe(32);
+    });
+
+    it("should be cleared by reset", () => {
+      state.setTargetWordSize("/path/file.cnx", 16);
+      state.reset();
+      expect(state.getTargetWordSize("/path/file.cnx")).toBeUndefined();
+    });
+  });
+
   describe("Symbol Info By File (Group 2)", () => {
     it("should store and retrieve file symbol info", () => {
       const info = createMockSymbolInfo("ExternalEnum");
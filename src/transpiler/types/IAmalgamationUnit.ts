@@ -0,0 +1,18 @@
+/**
+ * Generated output of one C-Next file for the amalgamated build (--amalgamate)
+ */
+interface IAmalgamationUnit {
+  /** Source file the output came from */
+  sourcePath: string;
+
+  /** Generated header, or null if the file exports nothing */
+  headerCode: string | null;
+
+  /** File name of the generated header (e.g. "lib.h") */
+  headerName: string;
+
+  /** Generated C/C++ source */
+  code: string;
+}
+
+export default IAmalgamationUnit;
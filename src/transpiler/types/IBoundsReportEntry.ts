@@ -0,0 +1,27 @@
+/**
+ * ADR-054: One array subscript checked by range analysis (--bounds-report)
+ */
+interface IBoundsReportEntry {
+  /** Source file containing the access */
+  sourcePath: string;
+
+  /** Line of the subscript expression */
+  line: number;
+
+  /** Column of the subscript expression */
+  column: number;
+
+  /** Access as written, up to and including this subscript (buf[i]) */
+  access: string;
+
+  /** Element count of the indexed dimension (null if not a constant) */
+  size: number | null;
+
+  /** True if every value the index can take is within [0, size - 1] */
+  isProven: boolean;
+
+  /** Derived index interval ("0..15"), null if nothing was derived */
+  indexRange: string | null;
+}
+
+export default IBoundsReportEntry;
@@ -48,6 +48,9 @@ interface ICodeGenSymbols {
     ReadonlyMap<string, readonly number[]>
   >;
 
+  /** Structs emitted in padding-minimizing order (C names; reorderStructs, reorderedStructs) */
+  readonly reorderedStructs?: ReadonlySet<string>;
+
   // === Enum Information (ADR-017) ===
 
   /** Enum members and values: enumName -> (memberName -> value) */
@@ -0,0 +1,29 @@
+import { CommonTokenStream } from "antlr4ng";
+import { ProgramContext } from "../logic/parser/grammar/CNextParser";
+import ICodeGenSymbols from "./ICodeGenSymbols";
+
+/**
+ * Parse and analyzer output of one C-Next file, kept by the first Stage 5
+ * pass of a dual-output run (dualOutput) so the C++ pass only regenerates.
+ */
+interface IFileAnalysis {
+  readonly tree: ProgramContext;
+
+  readonly tokenStream: CommonTokenStream;
+
+  readonly declarationCount: number;
+
+  /** The file's own symbols */
+  readonly localSymbolInfo: ICodeGenSymbols;
+
+  /** localSymbolInfo merged with included enums and opaque types */
+  readonly symbolInfo: ICodeGenSymbols;
+
+  /**
+   * CodeGenState.callbackCompatibleFunctions after this file's analyzers
+   * (FunctionCallAnalyzer adds to it file by file)
+   */
+  readonly callbackCompatibleFunctions: ReadonlyMap<string, string>;
+}
+
+export default IFileAnalysis;
@@ -0,0 +1,30 @@
+/**
+ * One row of the layout-size report (--layout-report)
+ */
+interface ILayoutReportEntry {
+  /** Source file that defines the type */
+  sourcePath: string;
+
+  /** Type category */
+  kind: "enum" | "struct";
+
+  /** Generated C type name */
+  name: string;
+
+  /** Size in bytes with default enum storage and declaration field order */
+  defaultSize: number;
+
+  /** Size in bytes with the configured options */
+  size: number;
+
+  /** Alignment in bytes */
+  align: number;
+
+  /** Padding bytes inside the type (structs only) */
+  padding: number;
+
+  /** Smaller size reachable with reorderStructs (structs, when not enabled) */
+  reorderedSize?: number;
+}
+
+export default ILayoutReportEntry;
@@ -0,0 +1,18 @@
+/**
+ * Size change of one variable against a stored baseline (--memory-baseline)
+ */
+interface IMemoryDiffEntry {
+  /** Generated C name */
+  name: string;
+
+  /** Size in the baseline (0 if the variable was added) */
+  baselineSize: number;
+
+  /** Size now (0 if the variable was removed) */
+  size: number;
+
+  /** True for flash (const) storage, false for RAM */
+  isFlash: boolean;
+}
+
+export default IMemoryDiffEntry;
@@ -0,0 +1,24 @@
+/**
+ * Static storage of one global or scope variable (--memory-report)
+ */
+interface IMemoryReportEntry {
+  /** Source file that defines the variable */
+  sourcePath: string;
+
+  /** Enclosing scope, or null for top-level variables */
+  scope: string | null;
+
+  /** Generated C name (e.g. "Motor_speed") */
+  name: string;
+
+  /** Size in bytes on the target, or null if the type is unknown */
+  size: number | null;
+
+  /** Alignment in bytes (0 if the type is unknown) */
+  align: number;
+
+  /** Output section: initialized RAM, zeroed RAM or flash (const) */
+  section: "data" | "bss" | "rodata";
+}
+
+export default IMemoryReportEntry;
@@ -0,0 +1,24 @@
+/**
+ * Estimated stack frame of one C-Next function (--stack-report)
+ */
+interface IStackFrame {
+  /** Generated C function name (e.g. "Motor_update") */
+  name: string;
+
+  /** Source file that defines the function */
+  sourcePath: string;
+
+  /** Top-level function (entry point candidate: main, ISR handlers) */
+  isTopLevel: boolean;
+
+  /** Bytes for parameters, locals and call overhead on the target */
+  frameSize: number;
+
+  /** C names called or referenced (callbacks) in the body */
+  callees: string[];
+
+  /** False if a parameter or local has a type of unknown size */
+  isComplete: boolean;
+}
+
+export default IStackFrame;
@@ -0,0 +1,21 @@
+/**
+ * Worst-case stack usage of one entry point (--stack-report)
+ */
+interface IStackReportEntry {
+  /** Entry point C name: main or an uncalled top-level function (ISR) */
+  name: string;
+
+  /** Source file that defines the entry point */
+  sourcePath: string;
+
+  /** Bytes used along the deepest call path */
+  worstCase: number;
+
+  /** Deepest call path, starting at the entry point */
+  callPath: string[];
+
+  /** False if some reachable frame has a local of unknown size */
+  isComplete: boolean;
+}
+
+export default IStackReportEntry;
@@ -29,6 +29,13 @@ interface ITranspilerConfig {
   /** Issue #211: Force C++ output (--cpp flag). Auto-detection may also enable this. */
   cppRequired?: boolean;
 
+  /**
+   * Write both .c/.h and .cpp/.hpp (files mode). Discovery, symbol
+   * collection and the analyzers run once; only code and header generation
+   * repeat for C++. Ignored once the headers force C++ output.
+   */
+  dualOutput?: boolean;
+
   /** Parse only mode - no code generation */
   parseOnly?: boolean;
 
@@ -43,6 +50,113 @@ interface ITranspilerConfig {
 
   /** Issue #183: Disable symbol caching (default: false = cache enabled) */
   noCache?: boolean;
+
+  /** Store enums in the smallest backing width that holds all values */
+  compactEnums?: boolean;
+
+  /** Store one-dimensional bool arrays as bit-packed uint32_t words */
+  packedBoolArrays?: boolean;
+
+  /** Reorder private scope struct fields to minimize padding (emits sizeof static_asserts) */
+  reorderStructs?: boolean;
+
+  /** Structs emitted in padding-minimizing order even without reorderStructs */
+  reorderedStructs?: string[];
+
+  /** Structs whose arrays are stored as one array per field (struct-of-arrays) */
+  soaStructs?: string[];
+
+  /**
+   * Treat the run's C-Next files as the whole program: scope functions with
+   * default visibility that no other file calls get static linkage
+   */
+  internalLinkage?: boolean;
+
+  /**
+   * Write the whole project as one translation unit to this path instead of
+   * one source file per .cnx file (empty = per-file output)
+   */
+  amalgamate?: string;
+
+  /**
+   * Emit clamp and safe-div helpers once per project (cnx_runtime.h/.c)
+   * instead of as static inline copies in every generated file
+   */
+  sharedHelpers?: boolean;
+
+  /**
+   * Drop scope functions and variables that main, top-level functions
+   * (ISRs) and explicitly public members cannot reach (files mode)
+   */
+  eliminateDeadCode?: boolean;
+
+  /**
+   * Lower whole-array arithmetic to CMSIS-DSP calls when the target has
+   * the DSP extension (requires arm_math.h on the include path)
+   */
+  cmsisDsp?: boolean;
+
+  /**
+   * Lower switches that map a dense key range to constants into a
+   * static const lookup table with a bounds-checked index
+   */
+  switchTables?: boolean;
+
+  /**
+   * Mark the saturation/panic branches of overflow helpers and the
+   * division-by-zero branch of safe_div/safe_mod helpers CNX_UNLIKELY
+   */
+  branchHints?: boolean;
+
+  /** Functions (Scope.fn or C names) defined with the cold attribute */
+  coldFunctions?: string[];
+
+  /** Functions (Scope.fn or C names) defined with the hot attribute */
+  hotFunctions?: string[];
+
+  /**
+   * ADR-106: Emit registers with ISR members as const vector tables in
+   * .isr_vector; `R.M <- handler` bindings become table entries
+   */
+  staticVectors?: boolean;
+
+  /** ADR-106: Linker section for bound interrupt handlers (e.g. ITCM) */
+  isrSection?: string;
+
+  /**
+   * Qualify array, struct and string parameters of private/internal scope
+   * functions restrict (__restrict__ in C++) when no call site can pass
+   * aliasing storage; call sites that prevent it are reported as warnings
+   */
+  restrictParams?: boolean;
+
+  /**
+   * ADR-051: safe_div/safe_mod/safe_divmod whose divisor is a non-zero
+   * constant skip the cnx_safe_* helpers; powers of two become shifts and
+   * masks (sign-corrected for signed types)
+   */
+  strengthReduce?: boolean;
+
+  /** Worst-case stack per entry point (ITranspilerResult.stackReport) */
+  stackReport?: boolean;
+
+  /** Stack size in bytes to check the stack report against (0 = no check) */
+  stackSize?: number;
+
+  /** Static RAM/flash per variable (ITranspilerResult.memoryReport) */
+  memoryReport?: boolean;
+
+  /** Write the memory report entries as JSON to this file */
+  memoryJson?: string;
+
+  /** Memory report JSON to diff against (ITranspilerResult.memoryDiff) */
+  memoryBaseline?: string;
+
+  /** Collect enum/struct size report (ITranspilerResult.layoutReport) */
+  layoutReport?: boolean;
+
+  /** ADR-054: Array subscripts checked by range analysis (boundsReport) */
+  boundsReport?: boolean;
 }
 
 export default ITranspilerConfig;
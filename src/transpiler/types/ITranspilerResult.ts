@@ -1,6 +1,11 @@
 import ITranspileError from "../../lib/types/ITranspileError";
 import IGrammarCoverageReport from "../logic/analysis/types/IGrammarCoverageReport";
 import IFileResult from "./IFileResult";
+import ILayoutReportEntry from "./ILayoutReportEntry";
+import IStackReportEntry from "./IStackReportEntry";
+import IMemoryReportEntry from "./IMemoryReportEntry";
+import IBoundsReportEntry from "./IBoundsReportEntry";
+import IMemoryDiffEntry from "./IMemoryDiffEntry";
 
 /**
  * Result of running the unified transpiler
@@ -32,6 +37,24 @@ interface ITranspilerResult {
 
   /** Grammar coverage (if collectGrammarCoverage was enabled) */
   grammarCoverage?: IGrammarCoverageReport;
+
+  /** Enum/struct sizes per target (if layoutReport was enabled) */
+  layoutReport?: ILayoutReportEntry[];
+
+  /** C names of functions and variables removed (if eliminateDeadCode ran) */
+  deadCode?: string[];
+
+  /** Worst-case stack usage per entry point (if stackReport was enabled) */
+  stackReport?: IStackReportEntry[];
+
+  /** Static storage per variable (if memoryReport was enabled) */
+  memoryReport?: IMemoryReportEntry[];
+
+  /** Size changes against memoryBaseline (if one was given) */
+  memoryDiff?: IMemoryDiffEntry[];
+
+  /** Subscripts checked by range analysis (if boundsReport was enabled) */
+  boundsReport?: IBoundsReportEntry[];
 }
 
 export default ITranspilerResult;
@@ -0,0 +1,109 @@
+/**
+ * Fixed-point Q type utilities.
+ *
+ * Q types are built-in type names, not keywords, so existing identifiers
+ * such as `q1` keep working:
+ * - qF: signed, one sign bit and F fractional bits (q7, q15, q31)
+ * - qI_F / uqI_F: I integer bits (including the sign bit for q) and F
+ *   fractional bits (q8_8, uq16_16)
+ *
+ * The total width must be 8, 16 or 32 bits. Values are stored as the
+ * integer type of that width holding value * 2^F.
+ */
+
+import IFixedPointFormat from "./types/IFixedPointFormat";
+
+const FIXED_POINT_PATTERN = /^(u?)q(\d+)(?:_(\d+))?$/;
+
+const STORAGE_WIDTHS = new Set([8, 16, 32]);
+
+/** Numeric literal text accepted for Q values: 1, 0.5, .25, 1e-3, 0.5f32 */
+const NUMERIC_LITERAL = /^(\d+\.?\d*|\.\d+)([eE][+-]?\d+)?([fF](32|64))?$/;
+
+class FixedPointUtils {
+  /**
+   * Parse a Q type name, or return null if it is not one.
+   *
+   * @param typeName - C-Next type name
+   */
+  static parse(typeName: string | null | undefined): IFixedPointFormat | null {
+    const match = typeName ? FIXED_POINT_PATTERN.exec(typeName) : null;
+    if (!match) {
+      return null;
+    }
+    const isSigned = match[1] === "";
+    const first = Number.parseInt(match[2], 10);
+    const intBits = match[3] === undefined ? 1 : first;
+    const fracBits =
+      match[3] === undefined ? first : Number.parseInt(match[3], 10);
+    const width = intBits + fracBits;
+
+    // qF is signed only (uq15 would be ambiguous); q needs its sign bit
+    if (
+      (match[3] === undefined && !isSigned) ||
+      (isSigned && intBits < 1) ||
+      fracBits < 1 ||
+      !STORAGE_WIDTHS.has(width)
+    ) {
+      return null;
+    }
+    return {
+      name: typeName!,
+      isSigned,
+      width: width as 8 | 16 | 32,
+      fracBits,
+      storageType: `${isSigned ? "i" : "u"}${width}`,
+      cType: `${isSigned ? "" : "u"}int${width}_t`,
+    };
+  }
+
+  /**
+   * Check if a type name is a Q type.
+   */
+  static isFixedPoint(typeName: string | null | undefined): boolean {
+    return FixedPointUtils.parse(typeName) !== null;
+  }
+
+  /**
+   * Raw storage limits of a format.
+   */
+  static getRawRange(format: IFixedPointFormat): [number, number] {
+    if (format.isSigned) {
+      return [-(2 ** (format.width - 1)), 2 ** (format.width - 1) - 1];
+    }
+    return [0, 2 ** format.width - 1];
+  }
+
+  /**
+   * Convert a numeric literal to its raw storage value (round to nearest).
+   *
+   * @param literalText - Literal as written (without a leading minus)
+   * @param format - Target format
+   * @param isNegated - The literal is the operand of a unary minus
+   * @returns The raw magnitude, or null if the text is not numeric
+   * @throws Error if the value is outside the format's range
+   */
+  static toRaw(
+    literalText: string,
+    format: IFixedPointFormat,
+    isNegated: boolean = false,
+  ): number | null {
+    const match = NUMERIC_LITERAL.exec(literalText);
+    if (!match) {
+      return null;
+    }
+    const value = Number.parseFloat(literalText.replace(/[fF](32|64)$/, ""));
+    const raw = Math.round(value * 2 ** format.fracBits);
+    const [min, max] = FixedPointUtils.getRawRange(format);
+    const signedRaw = isNegated ? -raw : raw;
+    if (signedRaw < min || signedRaw > max) {
+      const scale = 2 ** format.fracBits;
+      throw new Error(
+        `Error: Value ${isNegated ? "-" : ""}${literalText} exceeds ${format.name} range (${min / scale} to ${max / scale})`,
+      );
+    }
+    return raw;
+  }
+}
+
+export default FixedPointUtils;
@@ -0,0 +1,89 @@
+/**
+ * Unit tests for FixedPointUtils
+ * Tests Q type name parsing and transpile-time literal conversion.
+ */
+import { describe, it, expect } from "vitest";
+import FixedPointUtils from "../FixedPointUtils";
+
+describe("FixedPointUtils", () => {
+  describe("parse", () => {
+    it("parses qF as one sign bit plus F fractional bits", () => {
+      expect(FixedPointUtils.parse("q15")).toEqual({
+        name: "q15",
+        isSigned: true,
+        width: 16,
+        fracBits: 15,
+        storageType: "i16",
+        cType: "int16_t",
+      });
+      expect(FixedPointUtils.parse("q31")?.cType).toBe("int32_t");
+      expect(FixedPointUtils.parse("q7")?.cType).toBe("int8_t");
+    });
+
+    it("parses qI_F and uqI_F", () => {
+      expect(FixedPointUtils.parse("q8_8")).toMatchObject({
+        isSigned: true,
+        fracBits: 8,
+        cType: "int16_t",
+      });
+      expect(FixedPointUtils.parse("uq16_16")).toMatchObject({
+        isSigned: false,
+        width: 32,
+        fracBits: 16,
+        storageType: "u32",
+        cType: "uint32_t",
+      });
+    });
+
+    it("rejects names that are not Q types", () => {
+      expect(FixedPointUtils.parse("q16")).toBeNull();
+      expect(FixedPointUtils.parse("uq15")).toBeNull();
+      expect(FixedPointUtils.parse("q0_16")).toBeNull();
+      expect(FixedPointUtils.parse("q16_0")).toBeNull();
+      expect(FixedPointUtils.parse("q32_32")).toBeNull();
+      expect(FixedPointUtils.parse("queue")).toBeNull();
+      expect(FixedPointUtils.parse(null)).toBeNull();
+    });
+  });
+
+  describe("getRawRange", () => {
+    it("returns storage limits", () => {
+      expect(
+        FixedPointUtils.getRawRange(FixedPointUtils.parse("q15")!),
+      ).toEqual([-32768, 32767]);
+      expect(
+        FixedPointUtils.getRawRange(FixedPointUtils.parse("uq8_8")!),
+      ).toEqual([0, 65535]);
+    });
+  });
+
+  describe("toRaw", () => {
+    const q15 = FixedPointUtils.parse("q15")!;
+    const uq16_16 = FixedPointUtils.parse("uq16_16")!;
+
+    it("scales and rounds to nearest", () => {
+      expect(FixedPointUtils.toRaw("0.5", q15)).toBe(16384);
+      expect(FixedPointUtils.toRaw("0.25f32", q15)).toBe(8192);
+      expect(FixedPointUtils.toRaw(".1", q15)).toBe(3277);
+      expect(FixedPointUtils.toRaw("1.5", uq16_16)).toBe(98304);
+    });
+
+    it("allows -1.0 but not 1.0 for signed Q1 formats", () => {
+      expect(FixedPointUtils.toRaw("1.0", q15, true)).toBe(32768);
+      expect(() => FixedPointUtils.toRaw("1.0", q15)).toThrow(
+        "Error: Value 1.0 exceeds q15 range",
+      );
+    });
+
+    it("rejects negative values for unsigned formats", () => {
+      expect(() => FixedPointUtils.toRaw("0.5", uq16_16, true)).toThrow(
+        "exceeds uq16_16 range",
+      );
+    });
+
+    it("returns null for non-numeric literals", () => {
+      expect(FixedPointUtils.toRaw("0x10", q15)).toBeNull();
+      expect(FixedPointUtils.toRaw("'a'", q15)).toBeNull();
+    });
+  });
+});
@@ -0,0 +1,24 @@
+/**
+ * Storage format of a fixed-point Q type (q15, q31, uq16_16, ...)
+ */
+interface IFixedPointFormat {
+  /** C-Next type name (e.g. "q15") */
+  name: string;
+
+  /** Two's complement (q) or unsigned (uq) */
+  isSigned: boolean;
+
+  /** Storage width in bits: 8, 16 or 32 */
+  width: 8 | 16 | 32;
+
+  /** Fractional bits: the raw value is the real value times 2^fracBits */
+  fracBits: number;
+
+  /** C-Next integer type with the same storage (e.g. "i16") */
+  storageType: string;
+
+  /** C storage type (e.g. "int16_t") */
+  cType: string;
+}
+
+export default IFixedPointFormat;
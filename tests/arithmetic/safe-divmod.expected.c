@@ -0,0 +1,65 @@
+/**
+ * Generated by C-Next Transpiler from: safe-divmod.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ADR-051: Safe division helper functions
+#include <stdbool.h>
+
+static inline bool cnx_safe_divmod_u32(uint32_t* quotient, uint32_t* remainder, uint32_t numerator, uint32_t divisor, uint32_t defaultValue) {
+    if (divisor == 0) {
+        *quotient = defaultValue;
+        *remainder = defaultValue;
+        return true;  // Error occurred
+    }
+    *quotient = numerator / divisor;
+    *remainder = numerator % divisor;
+    return false;  // Success
+}
+
+static inline bool cnx_safe_divmod_i32(int32_t* quotient, int32_t* remainder, int32_t numerator, int32_t divisor, int32_t defaultValue) {
+    if (divisor == 0) {
+        *quotient = defaultValue;
+        *remainder = defaultValue;
+        return true;  // Error occurred
+    }
+    *quotient = numerator / divisor;
+    *remainder = numerator % divisor;
+    return false;  // Success
+}
+
+// test-execution
+// ADR-051: safe_divmod() stores quotient and remainder from one division
+int main(void) {
+    uint32_t block = 0U;
+    uint32_t offset = 0U;
+    uint32_t blockSize = 512U;
+    bool err = cnx_safe_divmod_u32(&block, &offset, 1300, blockSize, 7);
+    if (err != false || block != 2 || offset != 276) {
+        return 1;
+    }
+    uint32_t zero = 0U;
+    err = cnx_safe_divmod_u32(&block, &offset, 1300, zero, 7);
+    if (err != true || block != 7 || offset != 7) {
+        return 2;
+    }
+    int32_t q = 0;
+    int32_t r = 0;
+    int32_t divisor = 4;
+    err = cnx_safe_divmod_i32(&q, &r, -7, divisor, 0);
+    if (err != false || q != -1 || r != -3) {
+        return 3;
+    }
+    err = cnx_safe_divmod_i32(&q, &r, 7, -divisor, 0);
+    if (err != false || q != -1 || r != 3) {
+        return 4;
+    }
+    cnx_safe_divmod_i32(&q, &r, 100, 7, 0);
+    if (q != 14 || r != 2) {
+        return 5;
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+/**
+ * Generated by C-Next Transpiler from: cmsis-calls.test.cnx
+ * A safer C for embedded systems
+ */
+
+// test-execution
+// Whole-array arithmetic through CMSIS-DSP (cmsisDsp on a DSP target)
+// Tests: f32 element-wise and scalar forms call arm_* functions, q15
+// add/sub saturate through arm_add/sub_q15, q15 multiply keeps the rounding
+// helper loop, and reductions use arm_max/min/dot_prod. Runs against the
+// stub arm_math.h in tests/include.
+
+#include <stdint.h>
+#include "arm_math.h"
+
+// Array reduction helpers
+
+static inline float cnx_vec_dot_f32(const float* restrict a, const float* restrict b, uint32_t n) {
+    float32_t result;
+    arm_dot_prod_f32(a, b, n, &result);
+    return result;
+}
+
+static inline int16_t cnx_vec_dot_q15(const int16_t* restrict a, const int16_t* restrict b, uint32_t n) {
+    q63_t acc;
+    arm_dot_prod_q15(a, b, n, &acc);
+    acc = (acc + ((q63_t)1 << 14)) >> 15;
+    if (acc > INT16_MAX) return INT16_MAX;
+    if (acc < INT16_MIN) return INT16_MIN;
+    return (int16_t)acc;
+}
+
+static inline float cnx_vec_max_f32(const float* restrict a, uint32_t n) {
+    float32_t result;
+    uint32_t index;
+    arm_max_f32(a, n, &result, &index);
+    return result;
+}
+
+static inline float cnx_vec_min_f32(const float* restrict a, uint32_t n) {
+    float32_t result;
+    uint32_t index;
+    arm_min_f32(a, n, &result, &index);
+    return result;
+}
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+static inline int16_t cnx_clamp_mul_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat(((int32_t)a * b + (1 << 14)) >> 15, 16);
+#else
+    int64_t result = ((int64_t)a * b + ((int64_t)1 << 14)) >> 15;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+float a[4] = {1.0, 2.0, 3.0, 4.0};
+
+float b[4] = {4.0, 3.0, 2.0, 1.0};
+
+float out[4] = {0};
+
+int16_t qa[4] = {16384, -16384, 24576, -32768};
+
+int16_t qb[4] = {16384, 16384, 16384, -32768};
+
+int16_t qo[4] = {0};
+
+int main(void) {
+    arm_add_f32(a, b, out, 4U);
+    if (out[0U] != 5.0) {
+        return 1;
+    }
+    arm_mult_f32(a, b, out, 4U);
+    if (out[1U] != 6.0) {
+        return 2;
+    }
+    arm_scale_f32(a, 2.0, out, 4U);
+    if (out[3U] != 8.0) {
+        return 3;
+    }
+    arm_offset_f32(a, -(1.0), out, 4U);
+    if (out[0U] != 0.0) {
+        return 4;
+    }
+    arm_add_f32(out, b, out, 4U);
+    if (out[0U] != 4.0) {
+        return 5;
+    }
+    float largest = cnx_vec_max_f32(a, 4U);
+    float smallest = cnx_vec_min_f32(b, 4U);
+    float dot = cnx_vec_dot_f32(a, b, 4U);
+    if (largest != 4.0) {
+        return 6;
+    }
+    if (smallest != 1.0) {
+        return 7;
+    }
+    if (dot != 20.0) {
+        return 8;
+    }
+    arm_add_q15(qa, qb, qo, 4U);
+    if (qo[0U] != 32767) {
+        return 10;
+    }
+    if (qo[3U] != -32768) {
+        return 11;
+    }
+    arm_sub_q15(qa, qb, qo, 4U);
+    if (qo[1U] != -32768) {
+        return 12;
+    }
+    for (uint32_t _cnx_i = 0U; _cnx_i < 4U; _cnx_i++) {
+        qo[_cnx_i] = cnx_clamp_mul_q15(qa[_cnx_i], qb[_cnx_i]);
+    }
+    if (qo[3U] != 32767) {
+        return 13;
+    }
+    int16_t qdot = cnx_vec_dot_q15(qa, qb, 4U);
+    if (qdot != 32767) {
+        return 14;
+    }
+    return 0;
+}
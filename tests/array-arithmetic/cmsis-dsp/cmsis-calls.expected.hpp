@@ -0,0 +1,28 @@
+#ifndef CMSIS_CALLS_TEST_H
+#define CMSIS_CALLS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: cmsis-calls.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern float a[4];
+extern float b[4];
+extern float out[4];
+extern int16_t qa[4];
+extern int16_t qb[4];
+extern int16_t qo[4];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMSIS_CALLS_TEST_H */
@@ -0,0 +1,228 @@
+/**
+ * Generated by C-Next Transpiler from: element-wise.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// Array reduction helpers
+
+static inline float cnx_vec_dot_f32(const float* __restrict a, const float* __restrict b, uint32_t n) {
+    float acc = 0.0f;
+    for (uint32_t i = 0U; i < n; i++) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+static inline float cnx_vec_max_f32(const float* __restrict a, uint32_t n) {
+    float result = a[0];
+    for (uint32_t i = 1U; i < n; i++) {
+        result = (a[i] > result) ? a[i] : result;
+    }
+    return result;
+}
+
+static inline float cnx_vec_min_f32(const float* __restrict a, uint32_t n) {
+    float result = a[0];
+    for (uint32_t i = 1U; i < n; i++) {
+        result = (a[i] < result) ? a[i] : result;
+    }
+    return result;
+}
+
+static inline float cnx_vec_sum_f32(const float* __restrict a, uint32_t n) {
+    float acc = 0.0f;
+    for (uint32_t i = 0U; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+static inline uint64_t cnx_vec_sum_u8(const uint8_t* __restrict a, uint32_t n) {
+    uint64_t acc = 0;
+    for (uint32_t i = 0U; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+static inline int16_t cnx_clamp_add_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat((int32_t)a + b, 16);
+#else
+    int64_t result = (int64_t)a + b;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+static inline uint8_t cnx_clamp_add_u8(uint8_t a, uint32_t b) {
+    if (b > (uint32_t)(UINT8_MAX - a)) return UINT8_MAX;
+    uint8_t result;
+    if (__builtin_add_overflow(a, (uint8_t)b, &result)) return UINT8_MAX;
+    return result;
+}
+
+static inline int16_t cnx_clamp_mul_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat(((int32_t)a * b + (1 << 14)) >> 15, 16);
+#else
+    int64_t result = ((int64_t)a * b + ((int64_t)1 << 14)) >> 15;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+// test-execution
+// Whole-array arithmetic lowered to counted loops
+// Tests: array op array, array op scalar, compound forms, integer wrap,
+// clamp compound saturation, Q15 saturation, reductions and dot products
+float a[8] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+
+float b[8] = {8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+
+float out[8] = {};
+
+uint32_t checkFloat(void) {
+    for (uint32_t _cnx_i = 0U; _cnx_i < 8U; _cnx_i++) {
+        out[_cnx_i] = a[_cnx_i] + b[_cnx_i];
+    }
+    for (uint32_t i = 0; i < 8; i += 1) {
+        if (out[i] != 9.0) {
+            return 1;
+        }
+    }
+    float gain = 0.5;
+    for (uint32_t _cnx_i = 0U; _cnx_i < 8U; _cnx_i++) {
+        out[_cnx_i] = gain * a[_cnx_i];
+    }
+    if (out[7U] != 4.0) {
+        return 2;
+    }
+    for (uint32_t _cnx_i = 0U; _cnx_i < 8U; _cnx_i++) {
+        out[_cnx_i] = a[_cnx_i] - b[_cnx_i];
+    }
+    if (out[0U] != -7.0) {
+        return 3;
+    }
+    if (out[7U] != 7.0) {
+        return 4;
+    }
+    for (uint32_t _cnx_i = 0U; _cnx_i < 8U; _cnx_i++) {
+        out[_cnx_i] += a[_cnx_i];
+    }
+    if (out[7U] != 15.0) {
+        return 5;
+    }
+    {
+        const float _cnx_tmp_0 = a[1U];
+        for (uint32_t _cnx_i = 0U; _cnx_i < 8U; _cnx_i++) {
+            out[_cnx_i] = a[_cnx_i] * _cnx_tmp_0;
+        }
+    }
+    if (out[3U] != 8.0) {
+        return 6;
+    }
+    float total = cnx_vec_sum_f32(a, 8U);
+    float largest = cnx_vec_max_f32(b, 8U);
+    float smallest = cnx_vec_min_f32(b, 8U);
+    float dot = cnx_vec_dot_f32(a, b, 8U);
+    if (total != 36.0) {
+        return 7;
+    }
+    if (largest != 8.0) {
+        return 8;
+    }
+    if (smallest != 1.0) {
+        return 9;
+    }
+    if (dot != 120.0) {
+        return 10;
+    }
+    return 0;
+}
+
+uint32_t checkInteger(void) {
+    int16_t x[4] = {32767, -32768, 100, -100};
+    int16_t y[4] = {1, 1, 1, 1};
+    int16_t z[4] = {};
+    for (uint32_t _cnx_i = 0U; _cnx_i < 4U; _cnx_i++) {
+        z[_cnx_i] = x[_cnx_i] - y[_cnx_i];
+    }
+    if (z[2U] != 99) {
+        return 20;
+    }
+    if (z[3U] != -101) {
+        return 21;
+    }
+    uint8_t counts[4] = {250U, 10U, 0U, 128U};
+    uint8_t deltas[4] = {10U, 10U, 10U, 200U};
+    for (uint32_t _cnx_i = 0U; _cnx_i < 4U; _cnx_i++) {
+        counts[_cnx_i] = cnx_clamp_add_u8(counts[_cnx_i], deltas[_cnx_i]);
+    }
+    if (counts[0U] != 255) {
+        return 22;
+    }
+    if (counts[1U] != 20) {
+        return 23;
+    }
+    if (counts[3U] != 255) {
+        return 24;
+    }
+    uint8_t bytes[4] = {1U, 2U, 3U, 4U};
+    uint64_t byteSum = cnx_vec_sum_u8(bytes, 4U);
+    if (byteSum != 10) {
+        return 25;
+    }
+    return 0;
+}
+
+uint32_t checkQ15(void) {
+    int16_t qa[4] = {16384, -16384, 24576, -32768};
+    int16_t qb[4] = {16384, 16384, 16384, -32768};
+    int16_t qo[4] = {};
+    for (uint32_t _cnx_i = 0U; _cnx_i < 4U; _cnx_i++) {
+        qo[_cnx_i] = cnx_clamp_add_q15(qa[_cnx_i], qb[_cnx_i]);
+    }
+    if (qo[0U] != 32767) {
+        return 30;
+    }
+    if (qo[1U] != 0) {
+        return 31;
+    }
+    if (qo[3U] != -32768) {
+        return 32;
+    }
+    for (uint32_t _cnx_i = 0U; _cnx_i < 4U; _cnx_i++) {
+        qo[_cnx_i] = cnx_clamp_mul_q15(qa[_cnx_i], qb[_cnx_i]);
+    }
+    if (qo[0U] != 8192) {
+        return 33;
+    }
+    if (qo[3U] != 32767) {
+        return 34;
+    }
+    return 0;
+}
+
+int main(void) {
+    uint32_t floatResult = checkFloat();
+    if (floatResult != 0) {
+        return floatResult;
+    }
+    uint32_t integerResult = checkInteger();
+    if (integerResult != 0) {
+        return integerResult;
+    }
+    return checkQ15();
+}
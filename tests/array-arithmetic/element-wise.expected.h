@@ -0,0 +1,25 @@
+#ifndef ELEMENT_WISE_TEST_H
+#define ELEMENT_WISE_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: element-wise.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern float a[8];
+extern float b[8];
+extern float out[8];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELEMENT_WISE_TEST_H */
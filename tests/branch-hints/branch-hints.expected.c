@@ -0,0 +1,126 @@
+/**
+ * Generated by C-Next Transpiler from: branch-hints.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "branch-hints.test.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Branch hint macros
+#ifndef CNX_LIKELY
+#if defined(__GNUC__) || defined(__clang__)
+#define CNX_LIKELY(x) __builtin_expect(!!(x), 1)
+#define CNX_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define CNX_EXPECT(x, v) __builtin_expect((x), (v))
+#define CNX_COLD __attribute__((cold))
+#define CNX_HOT __attribute__((hot))
+#else
+#define CNX_LIKELY(x) (x)
+#define CNX_UNLIKELY(x) (x)
+#define CNX_EXPECT(x, v) (x)
+#define CNX_COLD
+#define CNX_HOT
+#endif
+#endif
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+static inline uint32_t cnx_clamp_add_u32(uint32_t a, uint64_t b) {
+    if (CNX_UNLIKELY(b > (uint64_t)(UINT32_MAX - a))) return UINT32_MAX;
+    uint32_t result;
+    if (CNX_UNLIKELY(__builtin_add_overflow(a, (uint32_t)b, &result))) return UINT32_MAX;
+    return result;
+}
+
+static inline uint8_t cnx_clamp_add_u8(uint8_t a, uint32_t b) {
+    if (CNX_UNLIKELY(b > (uint32_t)(UINT8_MAX - a))) return UINT8_MAX;
+    uint8_t result;
+    if (CNX_UNLIKELY(__builtin_add_overflow(a, (uint8_t)b, &result))) return UINT8_MAX;
+    return result;
+}
+
+// ADR-051: Safe division helper functions
+#include <stdbool.h>
+
+static inline bool cnx_safe_div_u32(uint32_t* output, uint32_t numerator, uint32_t divisor, uint32_t defaultValue) {
+    if (CNX_UNLIKELY(divisor == 0)) {
+        *output = defaultValue;
+        return true;  // Error occurred
+    }
+    *output = numerator / divisor;
+    return false;  // Success
+}
+
+// test-execution
+// likely/unlikely on if and switch, cold/hot functions from the directory
+// config, and branchHints on the overflow and safe_div helpers
+/* Scope: Fault */
+static uint32_t Fault_count = 0U;
+
+CNX_COLD void Fault_report(void) {
+    Fault_count = cnx_clamp_add_u32(Fault_count, 1U);
+}
+
+uint32_t Fault_total(void) {
+    return Fault_count;
+}
+
+CNX_HOT uint32_t average(uint32_t sum, uint32_t n) {
+    uint32_t result = 0U;
+    bool failed = cnx_safe_div_u32(&result, sum, n, 0);
+    if (CNX_UNLIKELY(failed == true)) {
+        Fault_report();
+    }
+    return result;
+}
+
+uint8_t step(Mode mode) {
+    uint8_t code = 0U;
+    switch (CNX_EXPECT(mode, Mode_RUN)) {
+        case Mode_IDLE: {
+            code = 1U;
+            break;
+        }
+        case Mode_RUN: {
+            code = 2U;
+            break;
+        }
+        default: {
+            code = 3U;
+            break;
+        }
+    }
+    return code;
+}
+
+int main(void) {
+    uint32_t avg = average(10U, 2U);
+    if (CNX_LIKELY(avg != 5)) {
+        return 1;
+    }
+    avg = average(10U, 0U);
+    if (avg != 0) {
+        return 2;
+    }
+    uint32_t faults = Fault_total();
+    if (faults != 1) {
+        return 3;
+    }
+    uint8_t code = step(Mode_RUN);
+    if (code != 2) {
+        return 4;
+    }
+    code = step(Mode_FAULT);
+    if (code != 3) {
+        return 5;
+    }
+    uint8_t level = 250U;
+    level = cnx_clamp_add_u8(level, 10U);
+    if (level != 255) {
+        return 6;
+    }
+    return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef BRANCH_HINTS_TEST_H
+#define BRANCH_HINTS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: branch-hints.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    Mode_IDLE = 0,
+    Mode_RUN = 1,
+    Mode_FAULT = 2
+} Mode;
+
+/* Function prototypes */
+void Fault_report(void);
+uint32_t Fault_total(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BRANCH_HINTS_TEST_H */
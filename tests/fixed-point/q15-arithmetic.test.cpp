@@ -0,0 +1,127 @@
+/**
+ * Generated by C-Next Transpiler from: q15-arithmetic.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+static inline int16_t cnx_clamp_add_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat((int32_t)a + b, 16);
+#else
+    int64_t result = (int64_t)a + b;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+static inline int16_t cnx_clamp_div_q15(int16_t a, int16_t b) {
+    if (b == 0) return a < 0 ? INT16_MIN : INT16_MAX;
+    int64_t result = (int64_t)a * ((int64_t)1 << 15) / b;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+}
+
+static inline int16_t cnx_clamp_mul_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat(((int32_t)a * b + (1 << 14)) >> 15, 16);
+#else
+    int64_t result = ((int64_t)a * b + ((int64_t)1 << 14)) >> 15;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+static inline int16_t cnx_clamp_sub_q15(int16_t a, int16_t b) {
+#if defined(__ARM_FEATURE_DSP)
+    return (int16_t)__ssat((int32_t)a - b, 16);
+#else
+    int64_t result = (int64_t)a - b;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+#endif
+}
+
+// test-execution
+// q15 arithmetic saturates at both ends of [-1.0, 1.0) and rounds products
+// to nearest. Host builds have no __ARM_FEATURE_DSP, so this runs the
+// portable fallback of each helper.
+int16_t divide(int16_t a, int16_t b) {
+    return cnx_clamp_div_q15(a, b);
+}
+
+int main(void) {
+    int16_t half = 16384;
+    int16_t quarter = 8192;
+    int16_t hi = 24576;
+    int16_t lo = -24576;
+    int16_t minusOne = -32768;
+    int16_t sum = cnx_clamp_add_q15(hi, hi);
+    if (sum != 32767) {
+        return 1;
+    }
+    int16_t diff = cnx_clamp_sub_q15(lo, hi);
+    if (diff != -32768) {
+        return 2;
+    }
+    int16_t negSum = cnx_clamp_add_q15(lo, lo);
+    if (negSum != -32768) {
+        return 3;
+    }
+    int16_t square = cnx_clamp_mul_q15(minusOne, minusOne);
+    if (square != 32767) {
+        return 4;
+    }
+    int16_t product = cnx_clamp_mul_q15(lo, hi);
+    if (product != -18432) {
+        return 5;
+    }
+    int16_t negQuarter = cnx_clamp_mul_q15(half, -16384);
+    if (negQuarter != -8192) {
+        return 6;
+    }
+    int16_t threeLsb = -3;
+    int16_t oneLsb = -1;
+    int16_t roundedHalf = cnx_clamp_mul_q15(threeLsb, half);
+    if (roundedHalf != -1) {
+        return 7;
+    }
+    int16_t roundedZero = cnx_clamp_mul_q15(oneLsb, half);
+    if (roundedZero != 0) {
+        return 8;
+    }
+    int16_t zero = 0;
+    int16_t quotient = cnx_clamp_div_q15(quarter, half);
+    if (quotient != 16384) {
+        return 9;
+    }
+    int16_t saturated = divide(half, quarter);
+    if (saturated != 32767) {
+        return 10;
+    }
+    int16_t minusHalf = -16384;
+    int16_t negSaturated = divide(minusHalf, quarter);
+    if (negSaturated != -32768) {
+        return 11;
+    }
+    int16_t posByZero = divide(half, zero);
+    if (posByZero != 32767) {
+        return 12;
+    }
+    int16_t negByZero = divide(lo, zero);
+    if (negByZero != -32768) {
+        return 13;
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * Generated by C-Next Transpiler from: uq16-16-arithmetic.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+static inline uint32_t cnx_clamp_add_uq16_16(uint32_t a, uint32_t b) {
+    int64_t result = (int64_t)a + b;
+    if (result > UINT32_MAX) return UINT32_MAX;
+    if (result < 0) return 0;
+    return (uint32_t)result;
+}
+
+static inline uint32_t cnx_clamp_div_uq16_16(uint32_t a, uint32_t b) {
+    if (b == 0) return UINT32_MAX;
+    uint64_t result = (uint64_t)a * ((uint64_t)1 << 16) / b;
+    if (result > UINT32_MAX) return UINT32_MAX;
+    return (uint32_t)result;
+}
+
+static inline uint32_t cnx_clamp_mul_uq16_16(uint32_t a, uint32_t b) {
+    uint64_t result = ((uint64_t)a * b + ((uint64_t)1 << 15)) >> 16;
+    if (result > UINT32_MAX) return UINT32_MAX;
+    return (uint32_t)result;
+}
+
+static inline uint32_t cnx_clamp_sub_uq16_16(uint32_t a, uint32_t b) {
+    int64_t result = (int64_t)a - b;
+    if (result > UINT32_MAX) return UINT32_MAX;
+    if (result < 0) return 0;
+    return (uint32_t)result;
+}
+
+// test-execution
+// uq16_16 arithmetic saturates at 0.0 and at the largest value (2^16 - 2^-16)
+// and rounds products to nearest. Unsigned formats have no DSP form, so
+// every helper is the portable one.
+uint32_t divide(uint32_t a, uint32_t b) {
+    return cnx_clamp_div_uq16_16(a, b);
+}
+
+int main(void) {
+    uint32_t one = 65536U;
+    uint32_t two = 131072U;
+    uint32_t half = 32768U;
+    uint32_t oneHalf = 98304U;
+    uint32_t nearMax = 4294901760U;
+    uint32_t big = 19660800U;
+    uint32_t sum = cnx_clamp_add_uq16_16(nearMax, two);
+    if (sum != 4294967295U) {
+        return 1;
+    }
+    uint32_t diff = cnx_clamp_sub_uq16_16(one, two);
+    if (diff != 0U) {
+        return 2;
+    }
+    uint32_t exact = cnx_clamp_add_uq16_16(oneHalf, half);
+    if (exact != 131072U) {
+        return 3;
+    }
+    uint32_t product = cnx_clamp_mul_uq16_16(oneHalf, oneHalf);
+    if (product != 147456U) {
+        return 4;
+    }
+    uint32_t square = cnx_clamp_mul_uq16_16(big, big);
+    if (square != 4294967295U) {
+        return 5;
+    }
+    uint32_t oneLsb = 1U;
+    uint32_t rounded = cnx_clamp_mul_uq16_16(oneLsb, half);
+    if (rounded != 1U) {
+        return 6;
+    }
+    uint32_t zero = 0U;
+    uint32_t quotient = cnx_clamp_div_uq16_16(one, half);
+    if (quotient != 131072U) {
+        return 7;
+    }
+    uint32_t saturated = divide(nearMax, half);
+    if (saturated != 4294967295U) {
+        return 8;
+    }
+    uint32_t byZero = divide(one, zero);
+    if (byZero != 4294967295U) {
+        return 9;
+    }
+    return 0;
+}
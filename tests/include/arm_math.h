@@ -0,0 +1,69 @@
+/* Stub CMSIS-DSP header for C-Next test compilation */
+#ifndef ARM_MATH_H
+#define ARM_MATH_H
+
+#include <stdint.h>
+
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+typedef float float32_t;
+
+static inline q15_t __cnx_stub_sat_q15(int32_t x) {
+    return (q15_t)(x > 32767 ? 32767 : (x < -32768 ? -32768 : x));
+}
+
+/* Element-wise f32 */
+static inline void arm_add_f32(const float32_t* a, const float32_t* b, float32_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = a[i] + b[i];
+}
+static inline void arm_sub_f32(const float32_t* a, const float32_t* b, float32_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = a[i] - b[i];
+}
+static inline void arm_mult_f32(const float32_t* a, const float32_t* b, float32_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = a[i] * b[i];
+}
+static inline void arm_scale_f32(const float32_t* src, float32_t scale, float32_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = src[i] * scale;
+}
+static inline void arm_offset_f32(const float32_t* src, float32_t offset, float32_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = src[i] + offset;
+}
+
+/* Element-wise q15 (saturating) */
+static inline void arm_add_q15(const q15_t* a, const q15_t* b, q15_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = __cnx_stub_sat_q15((int32_t)a[i] + b[i]);
+}
+static inline void arm_sub_q15(const q15_t* a, const q15_t* b, q15_t* dst, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) dst[i] = __cnx_stub_sat_q15((int32_t)a[i] - b[i]);
+}
+
+/* Reductions */
+static inline void arm_max_f32(const float32_t* src, uint32_t n, float32_t* result, uint32_t* index) {
+    *result = src[0];
+    *index = 0U;
+    for (uint32_t i = 1U; i < n; i++) {
+        if (src[i] > *result) { *result = src[i]; *index = i; }
+    }
+}
+static inline void arm_min_f32(const float32_t* src, uint32_t n, float32_t* result, uint32_t* index) {
+    *result = src[0];
+    *index = 0U;
+    for (uint32_t i = 1U; i < n; i++) {
+        if (src[i] < *result) { *result = src[i]; *index = i; }
+    }
+}
+static inline void arm_dot_prod_f32(const float32_t* a, const float32_t* b, uint32_t n, float32_t* result) {
+    float32_t acc = 0.0f;
+    for (uint32_t i = 0U; i < n; i++) acc += a[i] * b[i];
+    *result = acc;
+}
+/* 34.30 result */
+static inline void arm_dot_prod_q15(const q15_t* a, const q15_t* b, uint32_t n, q63_t* result) {
+    q63_t acc = 0;
+    for (uint32_t i = 0U; i < n; i++) acc += (q31_t)a[i] * b[i];
+    *result = acc;
+}
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * Generated by C-Next Transpiler from: equivalence.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "equivalence.test.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+static inline uint32_t cnx_clamp_add_u32(uint32_t a, uint64_t b) {
+    if (b > (uint64_t)(UINT32_MAX - a)) return UINT32_MAX;
+    uint32_t result;
+    if (__builtin_add_overflow(a, (uint32_t)b, &result)) return UINT32_MAX;
+    return result;
+}
+
+// test-execution
+// Tests: packed bool arrays behave like byte bool arrays
+// The same source runs unpacked in tests/packed-bool/unpacked
+uint32_t latched[2] = {0};
+
+uint32_t enabled[2] = {0xFFFFFFFFU, 0xFFFFFFFFU};
+
+uint32_t pattern[1] = {0x00000015U};
+
+/* Scope: Faults */
+static uint32_t Faults_active[2] = {0};
+
+void Faults_raise(uint32_t channel) {
+    Faults_active[(channel) >> 5U] = (Faults_active[(channel) >> 5U] & ~(1U << ((channel) & 31U))) | (1U << ((channel) & 31U));
+}
+
+bool Faults_anyActive(void) {
+    return ((Faults_active[0U] | Faults_active[1U]) != 0U);
+}
+
+bool isLatched(bool value) {
+    return value;
+}
+
+uint32_t countSet(void) {
+    uint32_t count = 0U;
+    for (uint32_t i = 0; i < 40; i += 1) {
+        if ((((latched[(i) >> 5U] >> ((i) & 31U)) & 1U) != 0U) == true) {
+            count = cnx_clamp_add_u32(count, 1U);
+        }
+    }
+    return count;
+}
+
+int main(void) {
+    if (((latched[0U] | latched[1U]) != 0U) == true) {
+        return 1;
+    }
+    uint32_t count = countSet();
+    if (count != 0) {
+        return 2;
+    }
+    latched[0U] = (latched[0U] & ~(1U << 0U)) | (1U << 0U);
+    latched[0U] = (latched[0U] & ~(1U << 31U)) | (1U << 31U);
+    uint32_t idx = 32U;
+    latched[(idx) >> 5U] = (latched[(idx) >> 5U] & ~(1U << ((idx) & 31U))) | (1U << ((idx) & 31U));
+    latched[1U] = (latched[1U] & ~(1U << 7U)) | (1U << 7U);
+    count = countSet();
+    if (count != 4) {
+        return 3;
+    }
+    if (((latched[0U] | latched[1U]) != 0U) != true) {
+        return 4;
+    }
+    bool copy = isLatched((((latched[0U] >> 31U) & 1U) != 0U));
+    if (copy != true) {
+        return 5;
+    }
+    copy = isLatched((((latched[0U] >> 30U) & 1U) != 0U));
+    if (copy != false) {
+        return 6;
+    }
+    latched[0U] = (latched[0U] & ~(1U << 31U)) | (0U << 31U);
+    if ((((latched[0U] >> 30U) & 1U) != 0U) != false || ((latched[1U] & 1U) != 0U) != true) {
+        return 7;
+    }
+    latched[0U] = (latched[0U] & ~(1U << 0U)) | (0U << 0U);
+    latched[(idx) >> 5U] = (latched[(idx) >> 5U] & ~(1U << ((idx) & 31U))) | (0U << ((idx) & 31U));
+    latched[1U] = (latched[1U] & ~(1U << 7U)) | (0U << 7U);
+    if (((latched[0U] | latched[1U]) != 0U) == true) {
+        return 8;
+    }
+    for (uint32_t i = 0; i < 64; i += 1) {
+        if ((((enabled[(i) >> 5U] >> ((i) & 31U)) & 1U) != 0U) != true) {
+            return 9;
+        }
+    }
+    if (((pattern[0U] & 1U) != 0U) != true || (((pattern[0U] >> 1U) & 1U) != 0U) != false || (((pattern[0U] >> 4U) & 1U) != 0U) != true) {
+        return 10;
+    }
+    if (64 != 64) {
+        return 11;
+    }
+    bool faulted = Faults_anyActive();
+    if (faulted == true) {
+        return 12;
+    }
+    Faults_raise(32U);
+    faulted = Faults_anyActive();
+    if (faulted != true) {
+        return 13;
+    }
+    uint32_t next = 7U;
+    {
+        const uint32_t _cnx_tmp_0 = next + 1U;
+        latched[(_cnx_tmp_0) >> 5U] = (latched[(_cnx_tmp_0) >> 5U] & ~(1U << ((_cnx_tmp_0) & 31U))) | (1U << ((_cnx_tmp_0) & 31U));
+    }
+    if ((((latched[0U] >> 8U) & 1U) != 0U) != true || (((latched[(next + 1U) >> 5U] >> ((next + 1U) & 31U)) & 1U) != 0U) != true) {
+        return 14;
+    }
+    return 0;
+}
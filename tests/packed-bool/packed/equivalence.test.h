@@ -0,0 +1,29 @@
+#ifndef EQUIVALENCE_TEST_H
+#define EQUIVALENCE_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: equivalence.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern uint32_t latched[2];
+extern uint32_t enabled[2];
+extern uint32_t pattern[1];
+
+/* Function prototypes */
+void Faults_raise(uint32_t channel);
+bool Faults_anyActive(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EQUIVALENCE_TEST_H */
@@ -0,0 +1,128 @@
+/**
+ * Generated by C-Next Transpiler from: equivalence.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "equivalence.test.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Array reduction helpers
+
+static inline bool cnx_vec_any_bool(const bool* restrict a, uint32_t n) {
+    for (uint32_t i = 0U; i < n; i++) {
+        if (a[i]) return true;
+    }
+    return false;
+}
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+static inline uint32_t cnx_clamp_add_u32(uint32_t a, uint64_t b) {
+    if (b > (uint64_t)(UINT32_MAX - a)) return UINT32_MAX;
+    uint32_t result;
+    if (__builtin_add_overflow(a, (uint32_t)b, &result)) return UINT32_MAX;
+    return result;
+}
+
+// test-execution
+// Tests: byte bool arrays, the reference for tests/packed-bool/packed
+// The same source runs packed in tests/packed-bool/packed
+bool latched[40] = {0};
+
+bool enabled[64] = {true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true};
+
+bool pattern[5] = {true, false, true, false, true};
+
+/* Scope: Faults */
+static bool Faults_active[33] = {0};
+
+void Faults_raise(uint32_t channel) {
+    Faults_active[channel] = true;
+}
+
+bool Faults_anyActive(void) {
+    return cnx_vec_any_bool(Faults_active, 33U);
+}
+
+bool isLatched(bool value) {
+    return value;
+}
+
+uint32_t countSet(void) {
+    uint32_t count = 0U;
+    for (uint32_t i = 0; i < 40; i += 1) {
+        if (latched[i] == true) {
+            count = cnx_clamp_add_u32(count, 1U);
+        }
+    }
+    return count;
+}
+
+int main(void) {
+    if (cnx_vec_any_bool(latched, 40U) == true) {
+        return 1;
+    }
+    uint32_t count = countSet();
+    if (count != 0) {
+        return 2;
+    }
+    latched[0] = true;
+    latched[31] = true;
+    uint32_t idx = 32U;
+    latched[idx] = true;
+    latched[39] = true;
+    count = countSet();
+    if (count != 4) {
+        return 3;
+    }
+    if (cnx_vec_any_bool(latched, 40U) != true) {
+        return 4;
+    }
+    bool copy = isLatched(latched[31U]);
+    if (copy != true) {
+        return 5;
+    }
+    copy = isLatched(latched[30U]);
+    if (copy != false) {
+        return 6;
+    }
+    latched[31] = false;
+    if (latched[30U] != false || latched[32U] != true) {
+        return 7;
+    }
+    latched[0] = false;
+    latched[idx] = false;
+    latched[39] = false;
+    if (cnx_vec_any_bool(latched, 40U) == true) {
+        return 8;
+    }
+    for (uint32_t i = 0; i < 64; i += 1) {
+        if (enabled[i] != true) {
+            return 9;
+        }
+    }
+    if (pattern[0U] != true || pattern[1U] != false || pattern[4U] != true) {
+        return 10;
+    }
+    if (64 != 64) {
+        return 11;
+    }
+    bool faulted = Faults_anyActive();
+    if (faulted == true) {
+        return 12;
+    }
+    Faults_raise(32U);
+    faulted = Faults_anyActive();
+    if (faulted != true) {
+        return 13;
+    }
+    uint32_t next = 7U;
+    latched[next + 1] = true;
+    if (latched[8U] != true || latched[next + 1U] != true) {
+        return 14;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * Generated by C-Next Transpiler from: restrict-params.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "restrict-params.test.hpp"
+
+#include <stdint.h>
+
+// test-execution
+// restrictParams: Buffer.copy() only ever receives distinct buffers and is
+// qualified restrict; Buffer.mix() is also called with one buffer twice and
+// keeps plain parameters
+/* Scope: Buffer */
+static uint8_t Buffer_rx[4] = {};
+static uint8_t Buffer_tx[4] = {};
+
+static void Buffer_copy(uint8_t dst[4], uint8_t src[4]) {
+    for (uint32_t i = 0; i < 4; i += 1) {
+        dst[i] = src[i];
+    }
+}
+
+static void Buffer_mix(uint8_t dst[4], uint8_t src[4]) {
+    for (uint32_t i = 0; i < 4; i += 1) {
+        dst[i] = dst[i] + src[i];
+    }
+}
+
+void Buffer_fill(void) {
+    uint8_t local[4] = {1U, 2U, 3U, 4U};
+    Buffer_copy(Buffer_rx, local);
+    Buffer_copy(Buffer_tx, Buffer_rx);
+    Buffer_mix(Buffer_tx, local);
+    Buffer_mix(Buffer_rx, Buffer_rx);
+}
+
+uint8_t Buffer_rxAt(uint32_t i) {
+    return Buffer_rx[i];
+}
+
+uint8_t Buffer_txAt(uint32_t i) {
+    return Buffer_tx[i];
+}
+
+int main(void) {
+    Buffer_fill();
+    uint8_t rx3 = Buffer_rxAt(3U);
+    uint8_t tx3 = Buffer_txAt(3U);
+    if (rx3 != 8) {
+        return 1;
+    }
+    if (tx3 != 8) {
+        return 2;
+    }
+    return 0;
+}
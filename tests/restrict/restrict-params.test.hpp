@@ -0,0 +1,25 @@
+#ifndef RESTRICT_PARAMS_TEST_H
+#define RESTRICT_PARAMS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: restrict-params.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Function prototypes */
+void Buffer_fill(void);
+uint8_t Buffer_rxAt(uint32_t i);
+uint8_t Buffer_txAt(uint32_t i);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESTRICT_PARAMS_TEST_H */
@@ -29,57 +29,57 @@ uint32_t PrivateMethodTest_publicResult = 0U;
 bool PrivateMethodTest_publicFlag = false;
 int32_t PrivateMethodTest_publicAccumulator = 0;
 
-uint32_t PrivateMethodTest_getPrivateState(void) {
+static uint32_t PrivateMethodTest_getPrivateState(void) {
     return PrivateMethodTest_privateState;
 }
 
-bool PrivateMethodTest_getPrivateFlag(void) {
+static bool PrivateMethodTest_getPrivateFlag(void) {
     return PrivateMethodTest_privateFlag;
 }
 
-int32_t PrivateMethodTest_getPrivateAccumulator(void) {
+static int32_t PrivateMethodTest_getPrivateAccumulator(void) {
     return PrivateMethodTest_privateAccumulator;
 }
 
-void PrivateMethodTest_incrementCallCount(void) {
+static void PrivateMethodTest_incrementCallCount(void) {
     PrivateMethodTest_callCount = PrivateMethodTest_callCount + 1U;
 }
 
-uint8_t PrivateMethodTest_getCallCount(void) {
+static uint8_t PrivateMethodTest_getCallCount(void) {
     return PrivateMethodTest_callCount;
 }
 
-uint32_t PrivateMethodTest_readGlobalCounter(void) {
+static uint32_t PrivateMethodTest_readGlobalCounter(void) {
     return globalCounter;
 }
 
-bool PrivateMethodTest_readGlobalFlag(void) {
+static bool PrivateMethodTest_readGlobalFlag(void) {
     return globalFlag;
 }
 
-int32_t PrivateMethodTest_readGlobalOffset(void) {
+static int32_t PrivateMethodTest_readGlobalOffset(void) {
     return globalOffset;
 }
 
-uint32_t PrivateMethodTest_combineStateAndGlobal(void) {
+static uint32_t PrivateMethodTest_combineStateAndGlobal(void) {
     return PrivateMethodTest_privateState + globalCounter;
 }
 
-bool PrivateMethodTest_checkBothFlags(void) {
+static bool PrivateMethodTest_checkBothFlags(void) {
     return PrivateMethodTest_privateFlag && globalFlag;
 }
 
-uint32_t PrivateMethodTest_getStateViaHelper(void) {
+static uint32_t PrivateMethodTest_getStateViaHelper(void) {
     return PrivateMethodTest_getPrivateState();
 }
 
-void PrivateMethodTest_performPrivateChain(void) {
+static void PrivateMethodTest_performPrivateChain(void) {
     PrivateMethodTest_incrementCallCount();
     PrivateMethodTest_privateState = PrivateMethodTest_privateState + 10U;
     PrivateMethodTest_privateFlag = !PrivateMethodTest_privateFlag;
 }
 
-void PrivateMethodTest_addValue(int32_t amount) {
+static void PrivateMethodTest_addValue(int32_t amount) {
     PrivateMethodTest_privateAccumulator = PrivateMethodTest_privateAccumulator + amount;
     PrivateMethodTest_incrementCallCount();
 }
@@ -112,6 +112,14 @@ uint32_t PrivateMethodTest_exposeGlobalCounter(void) {
     return PrivateMethodTest_readGlobalCounter();
 }
 
+bool PrivateMethodTest_exposeGlobalFlag(void) {
+    return PrivateMethodTest_readGlobalFlag();
+}
+
+int32_t PrivateMethodTest_exposeGlobalOffset(void) {
+    return PrivateMethodTest_readGlobalOffset();
+}
+
 uint32_t PrivateMethodTest_exposeCombinedStateAndGlobal(void) {
     return PrivateMethodTest_combineStateAndGlobal();
 }
@@ -186,5 +194,9 @@ int main(void) {
     if (PrivateMethodTest_publicResult != 777) return 18;
     if (PrivateMethodTest_publicFlag != true) return 19;
     if (PrivateMethodTest_publicAccumulator != 70) return 20;
+    bool resultGlobalFlag = PrivateMethodTest_exposeGlobalFlag();
+    if (resultGlobalFlag != true) return 21;
+    int32_t resultOffset = PrivateMethodTest_exposeGlobalOffset();
+    if (resultOffset != -50) return 22;
     return 0;
 }
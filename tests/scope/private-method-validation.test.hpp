@@ -22,19 +22,6 @@ extern bool PrivateMethodTest_publicFlag;
 extern int32_t PrivateMethodTest_publicAccumulator;
 
 /* Function prototypes */
-uint32_t PrivateMethodTest_getPrivateState(void);
-bool PrivateMethodTest_getPrivateFlag(void);
-int32_t PrivateMethodTest_getPrivateAccumulator(void);
-void PrivateMethodTest_incrementCallCount(void);
-uint8_t PrivateMethodTest_getCallCount(void);
-uint32_t PrivateMethodTest_readGlobalCounter(void);
-bool PrivateMethodTest_readGlobalFlag(void);
-int32_t PrivateMethodTest_readGlobalOffset(void);
-uint32_t PrivateMethodTest_combineStateAndGlobal(void);
-bool PrivateMethodTest_checkBothFlags(void);
-uint32_t PrivateMethodTest_getStateViaHelper(void);
-void PrivateMethodTest_performPrivateChain(void);
-void PrivateMethodTest_addValue(int32_t amount);
 uint32_t PrivateMethodTest_exposePrivateState(void);
 void PrivateMethodTest_setPrivateState(uint32_t val);
 bool PrivateMethodTest_exposePrivateFlag(void);
@@ -42,6 +29,8 @@ void PrivateMethodTest_setPrivateFlag(bool val);
 int32_t PrivateMethodTest_exposePrivateAccumulator(void);
 void PrivateMethodTest_addToAccumulator(int32_t val);
 uint32_t PrivateMethodTest_exposeGlobalCounter(void);
+bool PrivateMethodTest_exposeGlobalFlag(void);
+int32_t PrivateMethodTest_exposeGlobalOffset(void);
 uint32_t PrivateMethodTest_exposeCombinedStateAndGlobal(void);
 bool PrivateMethodTest_exposeBothFlagsCheck(void);
 uint32_t PrivateMethodTest_exposeStateViaHelper(void);
@@ -0,0 +1,35 @@
+/**
+ * Generated by C-Next Transpiler from: scope-array-args.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "scope-array-args.test.h"
+
+#include <stdint.h>
+
+// test-execution
+// Scope and global arrays passed as this.arr, global.arr or Scope.arr decay
+// to pointers in C, like bare array names (no &)
+uint8_t totals[4] = {0};
+
+void addInto(uint8_t dst[4], uint8_t src[4]) {
+    for (uint32_t i = 0; i < 4; i += 1) {
+        dst[i] = dst[i] + src[i];
+    }
+}
+
+/* Scope: Samples */
+uint8_t Samples_values[4] = {1U, 2U, 3U, 4U};
+
+void Samples_accumulate(void) {
+    addInto(totals, Samples_values);
+}
+
+int main(void) {
+    Samples_accumulate();
+    addInto(totals, Samples_values);
+    if (totals[3U] != 8) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef SCOPE_ARRAY_ARGS_TEST_H
+#define SCOPE_ARRAY_ARGS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: scope-array-args.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern uint8_t totals[4];
+extern uint8_t Samples_values[4];
+
+/* Function prototypes */
+void Samples_accumulate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCOPE_ARRAY_ARGS_TEST_H */
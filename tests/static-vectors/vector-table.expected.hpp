@@ -0,0 +1,24 @@
+#ifndef VECTOR_TABLE_TEST_H
+#define VECTOR_TABLE_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: vector-table.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern uint32_t ticks;
+extern uint32_t received;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTOR_TABLE_TEST_H */
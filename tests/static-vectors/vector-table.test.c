@@ -0,0 +1,97 @@
+/**
+ * Generated by C-Next Transpiler from: vector-table.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+/* ADR-106: Static vector tables and interrupt handler attributes */
+#ifndef CNX_ISR
+#if defined(__GNUC__) || defined(__clang__)
+#define CNX_VECTORS(align) __attribute__((section(".isr_vector"), used, aligned(align)))
+#if defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M'
+#define CNX_ISR __attribute__((interrupt("IRQ"), aligned(4), section(".fastrun")))
+#else
+#define CNX_ISR __attribute__((aligned(4), section(".fastrun")))
+#endif
+#else
+#define CNX_VECTORS(align)
+#define CNX_ISR
+#endif
+#endif
+
+/* ADR-040: ISR function pointer type */
+typedef void (*ISR)(void);
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+static inline uint32_t cnx_clamp_add_u32(uint32_t a, uint64_t b) {
+    if (b > (uint64_t)(UINT32_MAX - a)) return UINT32_MAX;
+    uint32_t result;
+    if (__builtin_add_overflow(a, (uint32_t)b, &result)) return UINT32_MAX;
+    return result;
+}
+
+// test-execution
+// ADR-106: with staticVectors, ISR register bindings become entries of a
+// const vector table resolved at transpile time
+/* Register: VectorTable @ 0x08000000 */
+extern const ISR VectorTable[32];
+#define VectorTable_SysTick (VectorTable[15])
+#define VectorTable_IRQ (&VectorTable[16])
+
+uint32_t ticks = 0U;
+
+uint32_t received = 0U;
+
+CNX_ISR void sysTick(void) {
+    ticks = cnx_clamp_add_u32(ticks, 1U);
+}
+
+CNX_ISR void uartRx(void) {
+    received = cnx_clamp_add_u32(received, 1U);
+}
+
+void init(void) {
+    /* VectorTable.SysTick <- sysTick: static vector table entry */
+    /* VectorTable.IRQ[5] <- uartRx: static vector table entry */
+    /* VectorTable.IRQ[15] <- uartRx: static vector table entry */
+}
+
+int main(void) {
+    init();
+    sysTick();
+    uartRx();
+    if (ticks != 1) {
+        return 1;
+    }
+    if (received != 1) {
+        return 2;
+    }
+    ISR tick = VectorTable_SysTick;
+    tick();
+    ISR rx = VectorTable_IRQ[5U];
+    rx();
+    if (ticks != 2) {
+        return 3;
+    }
+    if (received != 2) {
+        return 4;
+    }
+    return 0;
+}
+
+
+/* ADR-106: VectorTable @ 0x08000000, placed by the linker script */
+CNX_VECTORS(128)
+const ISR VectorTable[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0,
+    sysTick, /* 15: VectorTable.SysTick */
+    0, 0, 0, 0, 0,
+    uartRx, /* 21: VectorTable.IRQ[5] */
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+    uartRx, /* 31: VectorTable.IRQ[15] */
+};
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * Generated by C-Next Transpiler from: constant-divisors.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ADR-051: Safe division helper functions
+#include <stdbool.h>
+
+static inline bool cnx_safe_div_u32(uint32_t* output, uint32_t numerator, uint32_t divisor, uint32_t defaultValue) {
+    if (divisor == 0) {
+        *output = defaultValue;
+        return true;  // Error occurred
+    }
+    *output = numerator / divisor;
+    return false;  // Success
+}
+
+static inline bool cnx_safe_divmod_u32(uint32_t* quotient, uint32_t* remainder, uint32_t numerator, uint32_t divisor, uint32_t defaultValue) {
+    if (divisor == 0) {
+        *quotient = defaultValue;
+        *remainder = defaultValue;
+        return true;  // Error occurred
+    }
+    *quotient = numerator / divisor;
+    *remainder = numerator % divisor;
+    return false;  // Success
+}
+
+static inline bool cnx_safe_div_i32(int32_t* output, int32_t numerator, int32_t divisor, int32_t defaultValue) {
+    if (divisor == 0) {
+        *output = defaultValue;
+        return true;  // Error occurred
+    }
+    *output = numerator / divisor;
+    return false;  // Success
+}
+
+static inline bool cnx_safe_mod_i32(int32_t* output, int32_t numerator, int32_t divisor, int32_t defaultValue) {
+    if (divisor == 0) {
+        *output = defaultValue;
+        return true;  // Error occurred
+    }
+    *output = numerator % divisor;
+    return false;  // Success
+}
+
+static inline bool cnx_safe_divmod_i32(int32_t* quotient, int32_t* remainder, int32_t numerator, int32_t divisor, int32_t defaultValue) {
+    if (divisor == 0) {
+        *quotient = defaultValue;
+        *remainder = defaultValue;
+        return true;  // Error occurred
+    }
+    *quotient = numerator / divisor;
+    *remainder = numerator % divisor;
+    return false;  // Success
+}
+
+// test-execution
+// ADR-051: with strengthReduce, safe division statements by a constant
+// become plain assignments; results match the helpers (runtime divisors)
+int32_t checkSigned(int32_t x) {
+    int32_t q = 0;
+    int32_t r = 0;
+    int32_t expectedQ = 0;
+    int32_t expectedR = 0;
+    int32_t four = 4;
+    int32_t ten = 10;
+    q = (x < 0 ? -(int32_t)((0U - (uint32_t)x) >> 2) : (int32_t)((uint32_t)x >> 2));
+    r = (x < 0 ? -(int32_t)((0U - (uint32_t)x) & 0x3U) : (int32_t)((uint32_t)x & 0x3U));
+    bool divErr = cnx_safe_div_i32(&expectedQ, x, four, 0);
+    bool modErr = cnx_safe_mod_i32(&expectedR, x, four, 0);
+    if (divErr != false || modErr != false || q != expectedQ || r != expectedR) {
+        return 1;
+    }
+    q = x / 10;
+    r = x % 10;
+    bool divmodErr = cnx_safe_divmod_i32(&expectedQ, &expectedR, x, ten, 0);
+    if (divmodErr != false || q != expectedQ || r != expectedR) {
+        return 2;
+    }
+    return 0;
+}
+
+int main(void) {
+    uint32_t slot = 0U;
+    uint32_t head = 70U;
+    slot = (uint32_t)(head + 1) & 0x3FU;
+    if (slot != 7) {
+        return 1;
+    }
+    uint32_t block = 0U;
+    uint32_t offset = 0U;
+    block = (uint32_t)(1300) >> 9;
+    offset = (uint32_t)(1300) & 0x1FFU;
+    if (block != 2 || offset != 276) {
+        return 2;
+    }
+    bool err = cnx_safe_div_u32(&block, 1300, 16, 99);
+    if (err != false || block != 81) {
+        return 3;
+    }
+    uint8_t last = 255U;
+    uint8_t wrapped = 0U;
+    wrapped = (uint8_t)(last + 1) & 0xFU;
+    if (wrapped != 0) {
+        return 4;
+    }
+    uint32_t value = 100U;
+    uint32_t rest = 0U;
+    cnx_safe_divmod_u32(&value, &rest, value, 8, 0);
+    if (value != 12 || rest != 4) {
+        return 5;
+    }
+    int32_t result = checkSigned(-7);
+    if (result != 0) {
+        return 10 + result;
+    }
+    result = checkSigned(7);
+    if (result != 0) {
+        return 20 + result;
+    }
+    result = checkSigned(-2147483648);
+    if (result != 0) {
+        return 30 + result;
+    }
+    result = checkSigned(-123);
+    if (result != 0) {
+        return 40 + result;
+    }
+    return 0;
+}
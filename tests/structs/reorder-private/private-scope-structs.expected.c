@@ -0,0 +1,40 @@
+/**
+ * Generated by C-Next Transpiler from: private-scope-structs.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include "private-scope-structs.test.h"
+
+#include <stdint.h>
+
+// test-execution
+// reorderStructs: only private scope structs are reordered; top-level and
+// public scope structs are the header's C interface and keep their order
+/* Scope: Store */
+
+uint32_t Store_entrySize(void) {
+    return sizeof(Store_Entry);
+}
+
+uint32_t Store_entryValue(void) {
+    Store_Entry e = { .flag = 1U, .value = 100000U, .id = 7U };
+    return e.value + e.id + e.flag;
+}
+
+int main(void) {
+    if (sizeof(Packet) != 12) {
+        return 1;
+    }
+    if (sizeof(Store_Record) != 12) {
+        return 2;
+    }
+    uint32_t size = Store_entrySize();
+    if (size != 8) {
+        return 3;
+    }
+    uint32_t value = Store_entryValue();
+    if (value != 100008) {
+        return 4;
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#ifndef PRIVATE_SCOPE_STRUCTS_TEST_H
+#define PRIVATE_SCOPE_STRUCTS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: private-scope-structs.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Struct definitions */
+typedef struct Store_Entry {
+    uint32_t value;
+    uint16_t id;
+    uint8_t flag;
+} Store_Entry;
+#ifdef __cplusplus
+static_assert(sizeof(Store_Entry) == 8, "Store_Entry size differs from the computed layout");
+#else
+_Static_assert(sizeof(Store_Entry) == 8, "Store_Entry size differs from the computed layout");
+#endif
+
+typedef struct Store_Record {
+    uint8_t flag;
+    uint32_t value;
+    uint16_t id;
+} Store_Record;
+typedef struct Packet {
+    uint8_t flag;
+    uint32_t value;
+    uint16_t id;
+} Packet;
+
+/* Function prototypes */
+uint32_t Store_entrySize(void);
+uint32_t Store_entryValue(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIVATE_SCOPE_STRUCTS_TEST_H */
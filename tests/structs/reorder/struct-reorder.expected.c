@@ -0,0 +1,42 @@
+/**
+ * Generated by C-Next Transpiler from: struct-reorder.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// test-execution
+// reorderedStructs: padding-minimizing field order for one struct only
+typedef struct Packet {
+    uint32_t value;
+    uint16_t id;
+    uint8_t flag;
+} Packet;
+_Static_assert(sizeof(Packet) == 8, "Packet size differs from the computed layout");
+
+typedef struct Plain {
+    uint8_t flag;
+    uint32_t value;
+    uint16_t id;
+} Plain;
+
+int main(void) {
+    Packet p = { .flag = 1U, .value = 100000U, .id = 7U };
+    Plain q = { .flag = 1U, .value = 100000U, .id = 7U };
+    if (sizeof(Packet) != 8) {
+        return 1;
+    }
+    if (sizeof(Plain) != 12) {
+        return 2;
+    }
+    if (p.flag != 1) {
+        return 3;
+    }
+    if (p.value != q.value) {
+        return 4;
+    }
+    if (p.id != 7) {
+        return 5;
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef STRUCT_REORDER_TEST_H
+#define STRUCT_REORDER_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: struct-reorder.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Struct definitions */
+typedef struct Packet {
+    uint32_t value;
+    uint16_t id;
+    uint8_t flag;
+} Packet;
+static_assert(sizeof(Packet) == 8, "Packet size differs from the computed layout");
+
+typedef struct Plain {
+    uint8_t flag;
+    uint32_t value;
+    uint16_t id;
+} Plain;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRUCT_REORDER_TEST_H */
@@ -0,0 +1,106 @@
+/**
+ * Generated by C-Next Transpiler from: table-signed-enum-keys.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// test-execution
+// switchTables: signed and enum keys in a lookup table
+// Tests: negative labels, negative keys below the range, enum keys with
+// explicit values and enum-valued table entries
+typedef enum {
+    ELevel_OFF = 2,
+    ELevel_LOW = 3,
+    ELevel_MID = 4,
+    ELevel_HIGH = 5,
+    ELevel_BOOST = 9
+} ELevel;
+
+int32_t toSigned(int8_t code) {
+    {
+        static const int32_t _cnx_table_0[4] = {-200, -100, 0, 100};
+        const uint32_t _cnx_key_0 = static_cast<uint32_t>(code) + 2U;
+        if (_cnx_key_0 < 4U) {
+            return _cnx_table_0[_cnx_key_0];
+        } else {
+            return 7;
+        }
+    }
+}
+
+uint8_t toPercent(ELevel level) {
+    {
+        static const uint8_t _cnx_table_1[4] = {0, 25, 50, 100};
+        const uint32_t _cnx_key_1 = static_cast<uint32_t>(level) - 2U;
+        if (_cnx_key_1 < 4U) {
+            return _cnx_table_1[_cnx_key_1];
+        } else {
+            return 255;
+        }
+    }
+}
+
+ELevel fromIndex(int16_t index) {
+    {
+        static const ELevel _cnx_table_2[4] = {ELevel_OFF, ELevel_LOW, ELevel_MID, ELevel_HIGH};
+        const uint32_t _cnx_key_2 = static_cast<uint32_t>(index);
+        if (_cnx_key_2 < 4U) {
+            return _cnx_table_2[_cnx_key_2];
+        } else {
+            return ELevel_BOOST;
+        }
+    }
+}
+
+int main(void) {
+    int32_t lowest = toSigned(-2);
+    int32_t highest = toSigned(1);
+    int32_t below = toSigned(-3);
+    int32_t above = toSigned(2);
+    int32_t minKey = toSigned(-128);
+    int32_t maxKey = toSigned(127);
+    if (lowest != -200) {
+        return 1;
+    }
+    if (highest != 100) {
+        return 2;
+    }
+    if (below != 7) {
+        return 3;
+    }
+    if (above != 7) {
+        return 4;
+    }
+    if (minKey != 7) {
+        return 5;
+    }
+    if (maxKey != 7) {
+        return 6;
+    }
+    uint8_t off = toPercent(ELevel_OFF);
+    uint8_t high = toPercent(ELevel_HIGH);
+    uint8_t boost = toPercent(ELevel_BOOST);
+    if (off != 0) {
+        return 10;
+    }
+    if (high != 100) {
+        return 11;
+    }
+    if (boost != 255) {
+        return 12;
+    }
+    ELevel mid = fromIndex(2);
+    ELevel negative = fromIndex(-1);
+    ELevel past = fromIndex(4);
+    if (mid != ELevel_MID) {
+        return 20;
+    }
+    if (negative != ELevel_BOOST) {
+        return 21;
+    }
+    if (past != ELevel_BOOST) {
+        return 22;
+    }
+    return 0;
+}
@@ -0,0 +1,29 @@
+#ifndef TABLE_SIGNED_ENUM_KEYS_TEST_H
+#define TABLE_SIGNED_ENUM_KEYS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: table-signed-enum-keys.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    ELevel_OFF = 2,
+    ELevel_LOW = 3,
+    ELevel_MID = 4,
+    ELevel_HIGH = 5,
+    ELevel_BOOST = 9
+} ELevel;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TABLE_SIGNED_ENUM_KEYS_TEST_H */
@@ -0,0 +1,149 @@
+/**
+ * Generated by C-Next Transpiler from: table-unsigned-keys.test.cnx
+ * A safer C for embedded systems
+ */
+
+#include <stdint.h>
+
+// ADR-044: Overflow helper functions
+#include <limits.h>
+
+static inline uint32_t cnx_clamp_add_u32(uint32_t a, uint64_t b) {
+    if (b > (uint64_t)(UINT32_MAX - a)) return UINT32_MAX;
+    uint32_t result;
+    if (__builtin_add_overflow(a, (uint32_t)b, &result)) return UINT32_MAX;
+    return result;
+}
+
+// test-execution
+// switchTables: dense unsigned switches become a bounds-checked table
+// Tests: keys below the lowest and above the highest label, gaps taking
+// the default's constant, a non-constant default, returns and u64 keys
+uint32_t result = 0;
+
+uint32_t defaultHits = 0;
+
+void mapWithGap(uint32_t code) {
+    {
+        static const uint32_t _cnx_table_0[5] = {30U, 40U, 99U, 60U, 70U};
+        const uint32_t _cnx_key_0 = static_cast<uint32_t>(code) - 3U;
+        if (_cnx_key_0 < 5U) {
+            result = _cnx_table_0[_cnx_key_0];
+        } else {
+            result = 99U;
+        }
+    }
+}
+
+void mapWithCountedDefault(uint8_t code) {
+    {
+        static const uint32_t _cnx_table_1[3] = {11U, 22U, 33U};
+        const uint32_t _cnx_key_1 = static_cast<uint32_t>(code) - 1U;
+        if (_cnx_key_1 < 3U) {
+            result = _cnx_table_1[_cnx_key_1];
+        } else {
+            defaultHits = cnx_clamp_add_u32(defaultHits, 1U);
+            result = 0U;
+        }
+    }
+}
+
+uint16_t lookup(uint16_t code) {
+    {
+        static const uint16_t _cnx_table_2[4] = {500, 501, 502, 503};
+        const uint32_t _cnx_key_2 = static_cast<uint32_t>(code);
+        if (_cnx_key_2 < 4U) {
+            return _cnx_table_2[_cnx_key_2];
+        } else {
+            return 0xFFFF;
+        }
+    }
+}
+
+uint32_t wideLookup(uint64_t code) {
+    {
+        static const uint32_t _cnx_table_3[3] = {1, 2, 3};
+        const uint64_t _cnx_key_3 = static_cast<uint64_t>(code) - 10ULL;
+        if (_cnx_key_3 < 3ULL) {
+            return _cnx_table_3[_cnx_key_3];
+        } else {
+            return 0;
+        }
+    }
+}
+
+int main(void) {
+    mapWithGap(3U);
+    if (result != 30) {
+        return 1;
+    }
+    mapWithGap(7U);
+    if (result != 70) {
+        return 2;
+    }
+    mapWithGap(5U);
+    if (result != 99) {
+        return 3;
+    }
+    mapWithGap(2U);
+    if (result != 99) {
+        return 4;
+    }
+    mapWithGap(8U);
+    if (result != 99) {
+        return 5;
+    }
+    mapWithGap(0U);
+    if (result != 99) {
+        return 6;
+    }
+    mapWithGap(0xFFFFFFFFU);
+    if (result != 99) {
+        return 7;
+    }
+    mapWithCountedDefault(2U);
+    if (result != 22) {
+        return 10;
+    }
+    mapWithCountedDefault(0U);
+    if (result != 0) {
+        return 11;
+    }
+    mapWithCountedDefault(4U);
+    if (result != 0) {
+        return 12;
+    }
+    mapWithCountedDefault(255U);
+    if (defaultHits != 3) {
+        return 13;
+    }
+    uint16_t first = lookup(0U);
+    uint16_t last = lookup(3U);
+    uint16_t above = lookup(4U);
+    uint16_t top = lookup(0xFFFFU);
+    if (first != 500) {
+        return 20;
+    }
+    if (last != 503) {
+        return 21;
+    }
+    if (above != 0xFFFF) {
+        return 22;
+    }
+    if (top != 0xFFFF) {
+        return 23;
+    }
+    uint32_t wideHit = wideLookup(12ULL);
+    uint32_t wideBelow = wideLookup(9ULL);
+    uint32_t wideFar = wideLookup(0x100000000AULL);
+    if (wideHit != 3) {
+        return 30;
+    }
+    if (wideBelow != 0) {
+        return 31;
+    }
+    if (wideFar != 0) {
+        return 32;
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef TABLE_UNSIGNED_KEYS_TEST_H
+#define TABLE_UNSIGNED_KEYS_TEST_H
+
+/**
+ * Generated by C-Next Transpiler from: table-unsigned-keys.test.cnx
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern uint32_t result;
+extern uint32_t defaultHits;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TABLE_UNSIGNED_KEYS_TEST_H */